@@ -1,20 +1,73 @@
-/******************************************************************************
- *
- * @File: Ultrasonic_Private.h
- *
- * @Brief: Private definitions for the Ultrasonic Module
- *
- * @Author: Project Team 
- *
- * @Date: November 11, 2023
- *
- ******************************************************************************/
-
-#ifndef HAL_ULTRASONIC_ULTRASONIC_PRIVATE_H_
-#define HAL_ULTRASONIC_ULTRASONIC_PRIVATE_H_
-
-
-
-
-
-#endif /* HAL_ULTRASONIC_ULTRASONIC_PRIVATE_H_ */
+/******************************************************************************
+ *
+ * @File: Ultrasonic_Private.h
+ *
+ * @Brief: Private definitions for the Ultrasonic Module
+ *
+ * @Author: Project Team 
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef HAL_ULTRASONIC_ULTRASONIC_PRIVATE_H_
+#define HAL_ULTRASONIC_ULTRASONIC_PRIVATE_H_
+
+/* echo measurement backends (US_BACKEND) */
+#define US_BACKEND_POLLING		0
+#define US_BACKEND_EXTI			1
+
+#define US_SENSOR_COUNT			4
+
+#if (US_BACKEND == US_BACKEND_EXTI)
+#if ((ECHO_PIN1 == ECHO_PIN2) || (ECHO_PIN1 == ECHO_PIN3) || (ECHO_PIN1 == ECHO_PIN4) || \
+	 (ECHO_PIN2 == ECHO_PIN3) || (ECHO_PIN2 == ECHO_PIN4) || (ECHO_PIN3 == ECHO_PIN4))
+#error "The EXTI backend needs one EXTI line per echo pin, use different pin numbers"
+#endif
+#endif
+
+/* speed of sound, cm per us, halved for the round trip */
+#define US_CM_PER_US			0.0343
+#define US_ROUND_TRIP			2
+/* echo width of one cm of distance, rounded up */
+#define US_US_PER_CM			59
+
+/**
+ * @brief Pins of one sensor.
+ */
+typedef struct
+{
+	u8 Us_u8TriggerPort;
+	u8 Us_u8TriggerPin;
+	u8 Us_u8EchoPort;
+	u8 Us_u8EchoPin;
+}US_PINS_t;
+
+/**
+ * @brief Measurement states of one sensor.
+ */
+typedef enum
+{
+	US_IDLE,			/**< no measurement, or its result was read */
+	US_WAIT_RISE,		/**< triggered, waiting for the echo to start */
+	US_ECHO_HIGH,		/**< echo started, waiting for its end */
+	US_DONE				/**< echo width ready */
+}US_STATE_t;
+
+/**
+ * @brief Measurement of one sensor, written by the EXTI interrupt.
+ */
+typedef struct
+{
+	volatile US_STATE_t Us_State;
+	u32 Us_u32TriggerTime;			/**< us, start of the timeout */
+	volatile u32 Us_u32RiseTime;	/**< us, echo rising edge */
+	volatile u32 Us_u32EchoUs;		/**< echo width */
+	u32 Us_u32GateUs;				/**< echo width at which the measurement ends (range gate) */
+}US_ECHO_t;
+
+
+
+
+
+#endif /* HAL_ULTRASONIC_ULTRASONIC_PRIVATE_H_ */
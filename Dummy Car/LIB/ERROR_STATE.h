@@ -1,22 +1,22 @@
-/*
- * ERROR_STATE.h
- *
- *  Created on: 7 Oct 2023
- *      Author: joesk
- */
-
-#ifndef LIB_ERROR_STATE_H_
-#define LIB_ERROR_STATE_H_
-
-typedef enum
-{
-	OK,
-	NOK,
-	NULL_PTR_ERR,
-	OUT_OF_RANGE
-
-}ERROR_STATE_T;
-
-
-
-#endif /* LIB_ERROR_STATE_H_ */
+/*
+ * ERROR_STATE.h
+ *
+ *  Created on: 7 Oct 2023
+ *      Author: joesk
+ */
+
+#ifndef LIB_ERROR_STATE_H_
+#define LIB_ERROR_STATE_H_
+
+typedef enum
+{
+	OK,
+	NOK,
+	NULL_PTR_ERR,
+	OUT_OF_RANGE
+
+}ERROR_STATE_T;
+
+
+
+#endif /* LIB_ERROR_STATE_H_ */
@@ -1,21 +1,21 @@
-#ifndef ITI_STD_TYPES_H_
-#define ITI_STD_TYPES_H_
-
-typedef unsigned char u8;  //1 byte decimal data type 
-typedef signed char s8;  //1 byte decimal data type
-
-typedef unsigned short int u16;  //2 byte decimal data type
-typedef signed short int s16;  //2 byte decimal data type
-
-typedef unsigned long int u32;  //4 byte decimal data type
-typedef signed long int s32;  //4 byte decimal data type
-
-typedef float f32;  //4 byte floating data type
-
-typedef double f64;  //8 byte floating data type
-typedef long double f96;  //12 byte floating data type
-
-
-#define NULL  (void *)0
-
-#endif
+#ifndef ITI_STD_TYPES_H_
+#define ITI_STD_TYPES_H_
+
+typedef unsigned char u8;  //1 byte decimal data type 
+typedef signed char s8;  //1 byte decimal data type
+
+typedef unsigned short int u16;  //2 byte decimal data type
+typedef signed short int s16;  //2 byte decimal data type
+
+typedef unsigned long int u32;  //4 byte decimal data type
+typedef signed long int s32;  //4 byte decimal data type
+
+typedef float f32;  //4 byte floating data type
+
+typedef double f64;  //8 byte floating data type
+typedef long double f96;  //12 byte floating data type
+
+
+#define NULL  (void *)0
+
+#endif
@@ -1,19 +1,19 @@
-/** ****************************************************************************
- *
- * @File EXTI_Config.h
- *
- * @brief this file contains confirations related to EXTI Module
- *
- * @author Project Team
- *
- * @date 6/11/2023
- *
- ****************************************************************************** */
- 
-#ifndef EXTI_CONFIG_H_
-#define EXTI_CONFIG_H_
-
-
-
-
+/** ****************************************************************************
+ *
+ * @File EXTI_Config.h
+ *
+ * @brief this file contains confirations related to EXTI Module
+ *
+ * @author Project Team
+ *
+ * @date 6/11/2023
+ *
+ ****************************************************************************** */
+ 
+#ifndef EXTI_CONFIG_H_
+#define EXTI_CONFIG_H_
+
+
+
+
 #endif
\ No newline at end of file
@@ -1,281 +1,488 @@
-/** ****************************************************************************
- *
- * @File TIMER_Program.c
- *
- * @brief this file contains functions related to Timer Module
- *
- * @author Project Team
- *
- * @date 6/11/2023
- *
- ****************************************************************************** */
-/*******************************************************************************
- *                          	Standard Types                                 *
- *******************************************************************************/
-
-#include "../../LIB/ITI_STD_TYPES.h"
-#include "../../LIB/BIT_MATH.h"
-
-/*******************************************************************************
- *                          	MCAL Components                                 *
- *******************************************************************************/
-#include "TIMER_interface.h"
-#include "TIMER_private.h"
-
-
-/**
- * @brief this function is used to start the timer
- * 
- * @param Copy_uddtTMR_no [TMR2 - TMR3 - TMR4 - TMR5]
- * @return void
- */
-void MTMR_voidStart(TMRN_t Copy_uddtTMR_no)
-{
-	switch(Copy_uddtTMR_no)
-	{
-	case TMR_2:
-		/* Enable Timer */
-		SET_BIT(TMR2 -> CR1, CEN_BIT);
-		break;
-	case TMR_3:
-		/* Initialize all the registers */
-		SET_BIT(TMR3 -> EGR, 0);
-		/* Enable Timer */
-		SET_BIT(TMR3 -> CR1, CEN_BIT);
-		break;
-	case TMR_4:
-		/* Initialize all the registers */
-		SET_BIT(TMR4 -> EGR, 0);
-		/* Enable Timer */
-		SET_BIT(TMR4 -> CR1, CEN_BIT);
-		break;
-	case TMR_5:
-		/* Initialize all the registers */
-		SET_BIT(TMR5 -> EGR, 0);
-		/* Enable Timer */
-		SET_BIT(TMR5 -> CR1, CEN_BIT);
-		break;
-
-	default  : 								break;
-	}
-}
-
-/**
- * @brief this function is used to stop the timer
- * 
- * @param Copy_uddtTMR_no [TMR2 - TMR3 - TMR4 - TMR5]
- * @return void
- */
-void MTMR_voidStop(TMRN_t Copy_uddtTMR_no)
-{
-	switch(Copy_uddtTMR_no)
-	{
-		case TMR_2: CLR_BIT(TMR2 -> CR1, CEN_BIT); break;
-		case TMR_3: CLR_BIT(TMR3 -> CR1, CEN_BIT); break;
-		case TMR_4: CLR_BIT(TMR4 -> CR1, CEN_BIT); break;
-		case TMR_5: CLR_BIT(TMR5 -> CR1, CEN_BIT); break;
-		default  : 									  break;
-	}
-}
-
-/**
- * @brief this function is used to set the prescaler
- * 
- * @param Copy_uddtTMR_no [TMR2 - TMR3 - TMR4 - TMR5]
- * @param Copy_u16Value value from 1 to 65536
- * @return void
- */
-void MTMR_voidSetPrescaler(TMRN_t Copy_uddtTMR_no, u16 Copy_u16Value)
-{
-	switch(Copy_uddtTMR_no)
-	{
-		case TMR_2: /* Clear all bits*/
-				   Clr_ALL_BITS(TMR2 -> PSC);
-				   /* Set prescaler value */
-				   TMR2 -> PSC |= Copy_u16Value - 1;
-				   break;
-		case TMR_3: /* Clear all bits*/
-				   Clr_ALL_BITS(TMR3 -> PSC);
-				   /* Set prescaler value */
-				   TMR3 -> PSC |= Copy_u16Value - 1;
-				   break;
-		case TMR_5: /* Clear all bits*/
-			       Clr_ALL_BITS(TMR5 -> PSC);
-			       /* Set prescaler value */
-			       TMR5 -> PSC |= Copy_u16Value - 1;
-			       break;
-		default  :									 break;
-	}
-}
-
-/**
- * @brief this function is used to set the timer mode when generating a signal
- * 
- * @param Copy_uddtTMR_no timer number [TMR2 - TMR3 - TMR4 - TMR5]
- * @param Copy_uddtFn timer mode [FROZEN - ACTIVE - INACTIVE - TOGGLE - INACTIVE_FORCE - ACTIVE_FORCE - PWM_MODE1 - PWM_MODE2]
- * @param Copy_uddtChNo Channel number [CH1 ~ CH4]
- * @return void
- */
-void MTMR_voidSetChannelOutput(TMRN_t Copy_uddtTMR_no, CMPFn_t Copy_uddtFn, CHN_t Copy_uddtChNo)
-{
-	switch(Copy_uddtTMR_no)
-	{
-	case TMR_2:
-		switch(Copy_uddtChNo)
-		{
-		case CH1: /* Set Capture/Compare 1 as output */
-			CLR_BIT(TMR2 -> CCMR1, 1);
-			CLR_BIT(TMR2 -> CCMR1, 0);
-			//Clr_BITS(TMR2 -> CCMR1, 0x00000073);
-			/* Output Compare 1 pre-load enable */
-			SET_BIT(TMR2 -> CCMR1, 3);
-			/* Select Output Compare 1 */
-			//TMR2 -> CCMR1 |= (Copy_uddtFn << OC1M_SHIFT);
-			TMR2 -> CCMR1 = ((TMR2 -> CCMR1) &(0xFFFFFF8F)) | (Copy_uddtFn << OC1M_SHIFT);
-			/* Select Capture/Compare 1 output polarity active high */
-			//CLR_BIT(TMR2 -> CCER, 1);
-			/* Initialize all the registers (ana kda bn2l el compare value we el auto reload value we el prescaler ll shadow reg 34an tt7t fe elregister bta3tha ) */
-			SET_BIT(TMR2 -> EGR, 0);
-			/* Enable Capture/Compare 1 output */
-			SET_BIT(TMR2 -> CCER, CC1EN_BIT);
-			break;
-
-		case CH2:
-			/* Set Capture/Compare 1 as output */
-			CLR_BIT(TMR2 -> CCMR1, 8);
-			CLR_BIT(TMR2 -> CCMR1, 9);
-			//Clr_BITS(TMR2 -> CCMR1, 0x00000073);
-			/* Output Compare 1 pre-load enable */
-			SET_BIT(TMR2 -> CCMR1, 11);
-			/* Select Output Compare 1 */
-			//TMR2 -> CCMR1 |= (Copy_uddtFn << OC2M_SHIFT);
-			TMR2 -> CCMR1 = ((TMR2 -> CCMR1) &(0xFFFF8FFF)) | (Copy_uddtFn << 12);
-			/* Initialize all the registers (ana kda bn2l el compare value we el auto reload value we el prescaler ll shadow reg 34an tt7t fe elregister bta3tha ) */
-			SET_BIT(TMR2 -> EGR, 0);
-			/* Enable Capture/Compare 1 output */
-			SET_BIT(TMR2 -> CCER, 4);
-			break;
-
-		case CH3:
-			/* Set Capture/Compare 1 as output */
-			CLR_BIT(TMR2 -> CCMR2, 0);
-			CLR_BIT(TMR2 -> CCMR2, 1);
-			//Clr_BITS(TMR2 -> CCMR1, 0x00000073);
-			/* Output Compare 1 pre-load enable */
-			SET_BIT(TMR2 -> CCMR2, 3);
-			/* Select Output Compare 1 */
-			//TMR2 -> CCMR1 |= (Copy_uddtFn << OC3M_SHIFT);
-			TMR2 -> CCMR2 = ((TMR2 -> CCMR2) &(0xFFFFFF8F)) | (Copy_uddtFn << 4);
-			/* Initialize all the registers (ana kda bn2l el compare value we el auto reload value we el prescaler ll shadow reg 34an tt7t fe elregister bta3tha ) */
-			SET_BIT(TMR2 -> EGR, 0);
-			/* Enable Capture/Compare 1 output */
-			SET_BIT(TMR2 -> CCER, 8);
-			break;
-
-		case CH4:
-			/* Set Capture/Compare 1 as output */
-			CLR_BIT(TMR2 -> CCMR2, 8);
-			CLR_BIT(TMR2 -> CCMR2, 9);
-			//Clr_BITS(TMR2 -> CCMR1, 0x00000073);
-			/* Output Compare 1 pre-load enable */
-			SET_BIT(TMR2 -> CCMR2, 11);
-			/* Select Output Compare 1 */
-			//TMR2 -> CCMR1 |= (Copy_uddtFn << OC4M_SHIFT);
-			TMR2 -> CCMR2 = ((TMR2 -> CCMR2) &(0xFFFF8FFF)) | (Copy_uddtFn << 12);
-			/* Initialize all the registers (ana kda bn2l el compare value we el auto reload value we el prescaler ll shadow reg 34an tt7t fe elregister bta3tha ) */
-			SET_BIT(TMR2 -> EGR, 0);
-			/* Enable Capture/Compare 1 output */
-			SET_BIT(TMR2 -> CCER, 12);
-			break;
-		}
-		break;
-
-		default:                               break;
-	}
-}
-
-/**
- * @brief this function is used to set the compare value at the CCR_REG
- * 
- * @param Copy_uddtTMR_no timer number [TMR2 - TMR3 - TMR4 - TMR5]
- * @param Copy_uddtChNo Channel number [CH1 ~ CH4]
- * @param cmpValue compare value [0 ~ 65536]
- * @return void
- */
-void MTMR_voidSetCMPVal(TMRN_t Copy_uddtTMR_no, CHN_t Copy_uddtChNo, u32 cmpValue)
-{
-	switch(Copy_uddtTMR_no)
-	{
-	case TMR_2:
-		switch(Copy_uddtChNo)
-		{
-		case CH1: /* Set Compare Value*/
-			TMR2 -> CCR1 = cmpValue;
-			break;
-		case CH2: /* Set Compare Value*/
-			TMR2 -> CCR2 = cmpValue;
-			break;
-		case CH3: /* Set Compare Value*/
-			TMR2 -> CCR3 = cmpValue;
-			break;
-		case CH4: /* Set Compare Value*/
-			TMR2 -> CCR4 = cmpValue;
-			break;
-		default: 										break;
-		}  												break;
-		default: 										break;
-	}
-}
-
-/**
- * @brief this function is used to set the Auto Reload Preload Value - ARR
- * 
- * @param Copy_uddtTMR_no timer number [TMR2 - TMR3 - TMR4 - TMR5]
- * @param Copy_u32Value value [0 ~ 65536]
- * @return void
- */
-void MTMR_voidSetARR(TMRN_t Copy_uddtTMR_no, u32 Copy_u32Value)
-{
-	// enabling auto reload pre-load
-	SET_BIT(TMR2->CR1,7);
-	// set auto reload value
-	switch(Copy_uddtTMR_no)
-	{
-		case TMR_2: /* Set Auto-reload Value*/
-				   TMR2 -> ARR = Copy_u32Value;
-				   break;
-
-		case TMR_3: /* Set Auto-reload Value*/
-				   TMR3 -> ARR = (u16)Copy_u32Value;
-			       break;
-
-		case TMR_5: /* Set Auto-reload Value*/
-				   TMR5 -> ARR = Copy_u32Value;
-				   break;
-		default:   							break;
-	}
-}
-
-/**
- * @brief this function is used to reset count (clear the CNT_REG)
- * 
- * @param Copy_uddtTMR_no timer number [TMR2 - TMR3 - TMR4 - TMR5]
- * @return void
- */
-void MTMR_voidClearCount(TMRN_t Copy_uddtTMR_no)
-{
-	switch(Copy_uddtTMR_no)
-	{
-	case TMR_2:
-		TMR2 -> CNT = 0;
-		break;
-	case TMR_3:
-		TMR3 -> CNT = 0;
-		break;
-	case TMR_5:
-		TMR5 -> CNT = 0;
-		break;
-	default:                               break;
-	}
-}
-
+/** ****************************************************************************
+ *
+ * @File TIMER_Program.c
+ *
+ * @brief this file contains functions related to Timer Module
+ *
+ * @author Project Team
+ *
+ * @date 6/11/2023
+ *
+ ****************************************************************************** */
+/*******************************************************************************
+ *                          	Standard Types                                 *
+ *******************************************************************************/
+
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "TIMER_interface.h"
+#include "TIMER_private.h"
+#include "TIMER_config.h"
+#include "../RCC/RCC_Interface.h"
+
+/* registers of TMR_2 .. TMR_5, indexed by TMRN_t */
+static volatile TMR_t * const MTMR_ApstrTimers[TMR_COUNT] = {TMR2, TMR3, TMR4, TMR5};
+/* counting frequency requested for each timer (0: prescaler set directly), kept to follow the clock changes */
+static u32 MTMR_Au32CountFreq[TMR_COUNT];
+
+/* compute the prescaler of a counting frequency from the current timer clock and load it at once */
+static void MTMR_voidApplyCountFrequency(TMRN_t Copy_uddtTMR_no)
+{
+	volatile TMR_t * L_pstrTimer = MTMR_ApstrTimers[Copy_uddtTMR_no];
+	u32 L_u32Prescaler = MRCC_u32GetApb1TimerClk() / MTMR_Au32CountFreq[Copy_uddtTMR_no];
+	u32 L_u32Count;
+
+	if(L_u32Prescaler == 0)
+	{
+		L_u32Prescaler = 1;
+	}
+	else if(L_u32Prescaler > 65535)
+	{
+		L_u32Prescaler = 65535;
+	}
+	L_pstrTimer -> PSC = L_u32Prescaler - 1;
+	/* the prescaler is buffered until the next update event: force it, keeping the counter (the timebase must not jump) */
+	L_u32Count = L_pstrTimer -> CNT;
+	SET_BIT(L_pstrTimer -> EGR, UG_BIT);
+	L_pstrTimer -> CNT = L_u32Count;
+}
+
+
+/**
+ * @brief this function is used to start the timer
+ * 
+ * @param Copy_uddtTMR_no [TMR2 - TMR3 - TMR4 - TMR5]
+ * @return void
+ */
+void MTMR_voidStart(TMRN_t Copy_uddtTMR_no)
+{
+	switch(Copy_uddtTMR_no)
+	{
+	case TMR_2:
+		/* Enable Timer */
+		SET_BIT(TMR2 -> CR1, CEN_BIT);
+		break;
+	case TMR_3:
+		/* Initialize all the registers */
+		SET_BIT(TMR3 -> EGR, 0);
+		/* Enable Timer */
+		SET_BIT(TMR3 -> CR1, CEN_BIT);
+		break;
+	case TMR_4:
+		/* Initialize all the registers */
+		SET_BIT(TMR4 -> EGR, 0);
+		/* Enable Timer */
+		SET_BIT(TMR4 -> CR1, CEN_BIT);
+		break;
+	case TMR_5:
+		/* Initialize all the registers */
+		SET_BIT(TMR5 -> EGR, 0);
+		/* Enable Timer */
+		SET_BIT(TMR5 -> CR1, CEN_BIT);
+		break;
+
+	default  : 								break;
+	}
+}
+
+/**
+ * @brief this function is used to stop the timer
+ * 
+ * @param Copy_uddtTMR_no [TMR2 - TMR3 - TMR4 - TMR5]
+ * @return void
+ */
+void MTMR_voidStop(TMRN_t Copy_uddtTMR_no)
+{
+	switch(Copy_uddtTMR_no)
+	{
+		case TMR_2: CLR_BIT(TMR2 -> CR1, CEN_BIT); break;
+		case TMR_3: CLR_BIT(TMR3 -> CR1, CEN_BIT); break;
+		case TMR_4: CLR_BIT(TMR4 -> CR1, CEN_BIT); break;
+		case TMR_5: CLR_BIT(TMR5 -> CR1, CEN_BIT); break;
+		default  : 									  break;
+	}
+}
+
+/**
+ * @brief this function is used to set the prescaler
+ * 
+ * @param Copy_uddtTMR_no [TMR2 - TMR3 - TMR4 - TMR5]
+ * @param Copy_u16Value value from 1 to 65536
+ * @return void
+ */
+void MTMR_voidSetPrescaler(TMRN_t Copy_uddtTMR_no, u16 Copy_u16Value)
+{
+	switch(Copy_uddtTMR_no)
+	{
+		case TMR_2: /* Clear all bits*/
+				   Clr_ALL_BITS(TMR2 -> PSC);
+				   /* Set prescaler value */
+				   TMR2 -> PSC |= Copy_u16Value - 1;
+				   break;
+		case TMR_3: /* Clear all bits*/
+				   Clr_ALL_BITS(TMR3 -> PSC);
+				   /* Set prescaler value */
+				   TMR3 -> PSC |= Copy_u16Value - 1;
+				   break;
+		case TMR_5: /* Clear all bits*/
+			       Clr_ALL_BITS(TMR5 -> PSC);
+			       /* Set prescaler value */
+			       TMR5 -> PSC |= Copy_u16Value - 1;
+			       break;
+		default  :									 break;
+	}
+}
+
+/**
+ * @brief this function is used to set the timer mode when generating a signal
+ * 
+ * @param Copy_uddtTMR_no timer number [TMR2 - TMR3 - TMR4 - TMR5]
+ * @param Copy_uddtFn timer mode [FROZEN - ACTIVE - INACTIVE - TOGGLE - INACTIVE_FORCE - ACTIVE_FORCE - PWM_MODE1 - PWM_MODE2]
+ * @param Copy_uddtChNo Channel number [CH1 ~ CH4]
+ * @return void
+ */
+void MTMR_voidSetChannelOutput(TMRN_t Copy_uddtTMR_no, CMPFn_t Copy_uddtFn, CHN_t Copy_uddtChNo)
+{
+	switch(Copy_uddtTMR_no)
+	{
+	case TMR_2:
+		switch(Copy_uddtChNo)
+		{
+		case CH1: /* Set Capture/Compare 1 as output */
+			CLR_BIT(TMR2 -> CCMR1, 1);
+			CLR_BIT(TMR2 -> CCMR1, 0);
+			//Clr_BITS(TMR2 -> CCMR1, 0x00000073);
+			/* Output Compare 1 pre-load enable */
+			SET_BIT(TMR2 -> CCMR1, 3);
+			/* Select Output Compare 1 */
+			//TMR2 -> CCMR1 |= (Copy_uddtFn << OC1M_SHIFT);
+			TMR2 -> CCMR1 = ((TMR2 -> CCMR1) &(0xFFFFFF8F)) | (Copy_uddtFn << OC1M_SHIFT);
+			/* Select Capture/Compare 1 output polarity active high */
+			//CLR_BIT(TMR2 -> CCER, 1);
+			/* Initialize all the registers (ana kda bn2l el compare value we el auto reload value we el prescaler ll shadow reg 34an tt7t fe elregister bta3tha ) */
+			SET_BIT(TMR2 -> EGR, 0);
+			/* Enable Capture/Compare 1 output */
+			SET_BIT(TMR2 -> CCER, CC1EN_BIT);
+			break;
+
+		case CH2:
+			/* Set Capture/Compare 1 as output */
+			CLR_BIT(TMR2 -> CCMR1, 8);
+			CLR_BIT(TMR2 -> CCMR1, 9);
+			//Clr_BITS(TMR2 -> CCMR1, 0x00000073);
+			/* Output Compare 1 pre-load enable */
+			SET_BIT(TMR2 -> CCMR1, 11);
+			/* Select Output Compare 1 */
+			//TMR2 -> CCMR1 |= (Copy_uddtFn << OC2M_SHIFT);
+			TMR2 -> CCMR1 = ((TMR2 -> CCMR1) &(0xFFFF8FFF)) | (Copy_uddtFn << 12);
+			/* Initialize all the registers (ana kda bn2l el compare value we el auto reload value we el prescaler ll shadow reg 34an tt7t fe elregister bta3tha ) */
+			SET_BIT(TMR2 -> EGR, 0);
+			/* Enable Capture/Compare 1 output */
+			SET_BIT(TMR2 -> CCER, 4);
+			break;
+
+		case CH3:
+			/* Set Capture/Compare 1 as output */
+			CLR_BIT(TMR2 -> CCMR2, 0);
+			CLR_BIT(TMR2 -> CCMR2, 1);
+			//Clr_BITS(TMR2 -> CCMR1, 0x00000073);
+			/* Output Compare 1 pre-load enable */
+			SET_BIT(TMR2 -> CCMR2, 3);
+			/* Select Output Compare 1 */
+			//TMR2 -> CCMR1 |= (Copy_uddtFn << OC3M_SHIFT);
+			TMR2 -> CCMR2 = ((TMR2 -> CCMR2) &(0xFFFFFF8F)) | (Copy_uddtFn << 4);
+			/* Initialize all the registers (ana kda bn2l el compare value we el auto reload value we el prescaler ll shadow reg 34an tt7t fe elregister bta3tha ) */
+			SET_BIT(TMR2 -> EGR, 0);
+			/* Enable Capture/Compare 1 output */
+			SET_BIT(TMR2 -> CCER, 8);
+			break;
+
+		case CH4:
+			/* Set Capture/Compare 1 as output */
+			CLR_BIT(TMR2 -> CCMR2, 8);
+			CLR_BIT(TMR2 -> CCMR2, 9);
+			//Clr_BITS(TMR2 -> CCMR1, 0x00000073);
+			/* Output Compare 1 pre-load enable */
+			SET_BIT(TMR2 -> CCMR2, 11);
+			/* Select Output Compare 1 */
+			//TMR2 -> CCMR1 |= (Copy_uddtFn << OC4M_SHIFT);
+			TMR2 -> CCMR2 = ((TMR2 -> CCMR2) &(0xFFFF8FFF)) | (Copy_uddtFn << 12);
+			/* Initialize all the registers (ana kda bn2l el compare value we el auto reload value we el prescaler ll shadow reg 34an tt7t fe elregister bta3tha ) */
+			SET_BIT(TMR2 -> EGR, 0);
+			/* Enable Capture/Compare 1 output */
+			SET_BIT(TMR2 -> CCER, 12);
+			break;
+		}
+		break;
+
+	case TMR_4:
+		/* the blind spot LEDs */
+		switch(Copy_uddtChNo)
+		{
+		case CH1:
+			/* Set Capture/Compare 1 as output */
+			CLR_BIT(TMR4 -> CCMR1, 0);
+			CLR_BIT(TMR4 -> CCMR1, 1);
+			/* Output Compare 1 pre-load enable */
+			SET_BIT(TMR4 -> CCMR1, 3);
+			/* Select Output Compare 1 mode */
+			TMR4 -> CCMR1 = ((TMR4 -> CCMR1) &(0xFFFFFF8F)) | (Copy_uddtFn << 4);
+			/* Initialize all the registers */
+			SET_BIT(TMR4 -> EGR, 0);
+			/* Enable Capture/Compare 1 output */
+			SET_BIT(TMR4 -> CCER, 0);
+			break;
+
+		case CH2:
+			/* Set Capture/Compare 2 as output */
+			CLR_BIT(TMR4 -> CCMR1, 8);
+			CLR_BIT(TMR4 -> CCMR1, 9);
+			/* Output Compare 2 pre-load enable */
+			SET_BIT(TMR4 -> CCMR1, 11);
+			/* Select Output Compare 2 mode */
+			TMR4 -> CCMR1 = ((TMR4 -> CCMR1) &(0xFFFF8FFF)) | (Copy_uddtFn << 12);
+			/* Initialize all the registers */
+			SET_BIT(TMR4 -> EGR, 0);
+			/* Enable Capture/Compare 2 output */
+			SET_BIT(TMR4 -> CCER, 4);
+			break;
+
+		case CH3:
+			/* Set Capture/Compare 3 as output */
+			CLR_BIT(TMR4 -> CCMR2, 0);
+			CLR_BIT(TMR4 -> CCMR2, 1);
+			/* Output Compare 3 pre-load enable */
+			SET_BIT(TMR4 -> CCMR2, 3);
+			/* Select Output Compare 3 mode */
+			TMR4 -> CCMR2 = ((TMR4 -> CCMR2) &(0xFFFFFF8F)) | (Copy_uddtFn << 4);
+			/* Initialize all the registers */
+			SET_BIT(TMR4 -> EGR, 0);
+			/* Enable Capture/Compare 3 output */
+			SET_BIT(TMR4 -> CCER, 8);
+			break;
+
+		case CH4:
+			/* Set Capture/Compare 4 as output */
+			CLR_BIT(TMR4 -> CCMR2, 8);
+			CLR_BIT(TMR4 -> CCMR2, 9);
+			/* Output Compare 4 pre-load enable */
+			SET_BIT(TMR4 -> CCMR2, 11);
+			/* Select Output Compare 4 mode */
+			TMR4 -> CCMR2 = ((TMR4 -> CCMR2) &(0xFFFF8FFF)) | (Copy_uddtFn << 12);
+			/* Initialize all the registers */
+			SET_BIT(TMR4 -> EGR, 0);
+			/* Enable Capture/Compare 4 output */
+			SET_BIT(TMR4 -> CCER, 12);
+			break;
+		}
+		break;
+
+		default:                               break;
+	}
+}
+
+/**
+ * @brief this function is used to set the compare value at the CCR_REG
+ * 
+ * @param Copy_uddtTMR_no timer number [TMR2 - TMR3 - TMR4 - TMR5]
+ * @param Copy_uddtChNo Channel number [CH1 ~ CH4]
+ * @param cmpValue compare value [0 ~ 65536]
+ * @return void
+ */
+void MTMR_voidSetCMPVal(TMRN_t Copy_uddtTMR_no, CHN_t Copy_uddtChNo, u32 cmpValue)
+{
+	switch(Copy_uddtTMR_no)
+	{
+	case TMR_2:
+		switch(Copy_uddtChNo)
+		{
+		case CH1: /* Set Compare Value*/
+			TMR2 -> CCR1 = cmpValue;
+			break;
+		case CH2: /* Set Compare Value*/
+			TMR2 -> CCR2 = cmpValue;
+			break;
+		case CH3: /* Set Compare Value*/
+			TMR2 -> CCR3 = cmpValue;
+			break;
+		case CH4: /* Set Compare Value*/
+			TMR2 -> CCR4 = cmpValue;
+			break;
+		default: 										break;
+		}  												break;
+	case TMR_4:
+		switch(Copy_uddtChNo)
+		{
+		case CH1: /* Set Compare Value*/
+			TMR4 -> CCR1 = (u16)cmpValue;
+			break;
+		case CH2: /* Set Compare Value*/
+			TMR4 -> CCR2 = (u16)cmpValue;
+			break;
+		case CH3: /* Set Compare Value*/
+			TMR4 -> CCR3 = (u16)cmpValue;
+			break;
+		case CH4: /* Set Compare Value*/
+			TMR4 -> CCR4 = (u16)cmpValue;
+			break;
+		default: 										break;
+		}  												break;
+		default: 										break;
+	}
+}
+
+/**
+ * @brief this function is used to set the Auto Reload Preload Value - ARR
+ * 
+ * @param Copy_uddtTMR_no timer number [TMR2 - TMR3 - TMR4 - TMR5]
+ * @param Copy_u32Value value [0 ~ 65536]
+ * @return void
+ */
+void MTMR_voidSetARR(TMRN_t Copy_uddtTMR_no, u32 Copy_u32Value)
+{
+	// enabling auto reload pre-load
+	SET_BIT(TMR2->CR1,7);
+	// set auto reload value
+	switch(Copy_uddtTMR_no)
+	{
+		case TMR_2: /* Set Auto-reload Value*/
+				   TMR2 -> ARR = Copy_u32Value;
+				   break;
+
+		case TMR_3: /* Set Auto-reload Value*/
+				   TMR3 -> ARR = (u16)Copy_u32Value;
+			       break;
+
+		case TMR_4: /* Set Auto-reload Value*/
+				   TMR4 -> ARR = (u16)Copy_u32Value;
+			       break;
+
+		case TMR_5: /* Set Auto-reload Value*/
+				   TMR5 -> ARR = Copy_u32Value;
+				   break;
+		default:   							break;
+	}
+}
+
+/**
+ * @brief this function is used to reset count (clear the CNT_REG)
+ * 
+ * @param Copy_uddtTMR_no timer number [TMR2 - TMR3 - TMR4 - TMR5]
+ * @return void
+ */
+void MTMR_voidClearCount(TMRN_t Copy_uddtTMR_no)
+{
+	switch(Copy_uddtTMR_no)
+	{
+	case TMR_2:
+		TMR2 -> CNT = 0;
+		break;
+	case TMR_3:
+		TMR3 -> CNT = 0;
+		break;
+	case TMR_5:
+		TMR5 -> CNT = 0;
+		break;
+	default:                               break;
+	}
+}
+
+/**
+ * @brief this function is used to read the counter value (CNT_REG)
+ * 
+ * @param Copy_uddtTMR_no timer number [TMR2 - TMR3 - TMR4 - TMR5]
+ * @return current counter value
+ */
+u32 MTMR_u32GetCount(TMRN_t Copy_uddtTMR_no)
+{
+	u32 L_u32Count = 0;
+	switch(Copy_uddtTMR_no)
+	{
+	case TMR_2:
+		L_u32Count = TMR2 -> CNT;
+		break;
+	case TMR_3:
+		L_u32Count = TMR3 -> CNT;
+		break;
+	case TMR_4:
+		L_u32Count = TMR4 -> CNT;
+		break;
+	case TMR_5:
+		L_u32Count = TMR5 -> CNT;
+		break;
+	default:                               break;
+	}
+	return L_u32Count;
+}
+
+/**
+ * @brief this function is used to set the counting frequency of a timer
+ *
+ * The prescaler is computed from the APB1 timer clock read from RCC, so the
+ * timer keeps its frequency whatever the clock profile, and it is loaded at once.
+ *
+ * @param Copy_uddtTMR_no [TMR2 - TMR3 - TMR4 - TMR5]
+ * @param Copy_u32FreqHz counting frequency in Hz (the timer clock divided by 1 to 65535)
+ * @return void
+ */
+void MTMR_voidSetCountFrequency(TMRN_t Copy_uddtTMR_no, u32 Copy_u32FreqHz)
+{
+	if((Copy_uddtTMR_no < TMR_COUNT) && (Copy_u32FreqHz != 0))
+	{
+		MTMR_Au32CountFreq[Copy_uddtTMR_no] = Copy_u32FreqHz;
+		MTMR_voidApplyCountFrequency(Copy_uddtTMR_no);
+	}
+}
+
+/**
+ * @brief this function is used to follow a change of the clock tree
+ *
+ * The prescalers of the timers set with MTMR_voidSetCountFrequency are computed
+ * again from the new APB1 timer clock. The counters keep their value.
+ *
+ * @note the timers must still be clocked from RCC
+ * @return void
+ */
+void MTMR_voidUpdateClock(void)
+{
+	u8 L_u8Timer;
+
+	for(L_u8Timer = 0; L_u8Timer < TMR_COUNT; L_u8Timer++)
+	{
+		if(MTMR_Au32CountFreq[L_u8Timer] != 0)
+		{
+			MTMR_voidApplyCountFrequency((TMRN_t)L_u8Timer);
+		}
+	}
+}
+
+/**
+ * @brief this function is used to start the free running microsecond timebase
+ *
+ * The timer selected by TMR_TIMEBASE counts up at 1 MHz over its full 32-bit range,
+ * so the timebase wraps every ~71 minutes and differences of two readings stay valid across the wrap.
+ *
+ * @note the timer clock must be enabled from RCC before calling this function
+ * @return void
+ */
+void MTMR_voidTimeBaseInit(void)
+{
+	MTMR_voidSetCountFrequency(TMR_TIMEBASE, 1000000UL);
+	MTMR_voidSetARR(TMR_TIMEBASE, 0xFFFFFFFF);
+	MTMR_voidClearCount(TMR_TIMEBASE);
+	MTMR_voidStart(TMR_TIMEBASE);
+}
+
+/**
+ * @brief this function is used to read the microsecond timebase
+ *
+ * @return microseconds elapsed since MTMR_voidTimeBaseInit (wraps at 2^32)
+ */
+u32 MTMR_u32GetMicros(void)
+{
+	return MTMR_u32GetCount(TMR_TIMEBASE);
+}
@@ -1,14 +1,56 @@
-#ifndef NVIC_CONFIG_H_
-#define NVIC_CONFIG_H_
-
-/** ****************************************************************************
- *
- * @File NVIC_Config.h
- *
- * @brief this file contains configurations related to NVIC Module
- *
- * @author Project Team
- *
- * @date 6/11/2023	
- *
- ****************************************************************************** */
\ No newline at end of file
+#ifndef NVIC_CONFIG_H_
+#define NVIC_CONFIG_H_
+
+/** ****************************************************************************
+ *
+ * @File NVIC_Config.h
+ *
+ * @brief this file contains configurations related to NVIC Module
+ *
+ * @author Project Team
+ *
+ * @date 6/11/2023	
+ *
+ ****************************************************************************** */
+
+/*
+ * split of the 4 priority bits between preemption groups and sub groups
+ *	MNVIC_GROUPMODE_G16S0
+ *	MNVIC_GROUPMODE_G8S2
+ *	MNVIC_GROUPMODE_G4S4
+ *	MNVIC_GROUPMODE_G2S8
+ *	MNVIC_GROUPMODE_G0S16
+ */
+#define NVIC_GROUP_MODE				MNVIC_GROUPMODE_G4S4
+
+/*
+ * priority map of the cars (applied by MNVIC_voidInit), a lower group pre-empts a higher one
+ *
+ *	group 0 : EXTI lines	ultrasonic echo edges, their time stamp must not wait
+ *	group 1 : USART6		bluetooth orders, the stop command of the driver
+ *	group 2 : USART1		raspberry link: V2V frame checks and emergency stop, transmit FIFO
+ *	group 3 : SysTick		sleep deadline and intervals
+ *	          PendSV		deferred work of the handlers (last sub group: runs after everything else):
+ *	          				V2V frame decoding, the rest of the emergency handling
+ *
+ * the emergency stop of a V2V warning runs in the USART1 handler itself, it is not
+ * deferred to PendSV: only the echo edges and the bluetooth orders, both short
+ * handlers, can delay it. The V2V state shared with the task is guarded by masking
+ * PendSV (group 3), USART1 stays open.
+ */
+#define NVIC_EXTI_GROUP				0
+#define NVIC_EXTI_SUBGROUP			0
+
+#define NVIC_USART6_GROUP			1
+#define NVIC_USART6_SUBGROUP		0
+
+#define NVIC_USART1_GROUP			2
+#define NVIC_USART1_SUBGROUP		0
+
+#define NVIC_SYSTICK_GROUP			3
+#define NVIC_SYSTICK_SUBGROUP		0
+
+#define NVIC_PENDSV_GROUP			3
+#define NVIC_PENDSV_SUBGROUP		3
+
+#endif
@@ -1,48 +1,69 @@
-/***************************File Guard *****************************************/
-#ifndef NVIC_INTERFACE_H_
-#define NVIC_INTERFACE_H_
-/** ****************************************************************************
- *
- * @File NVIC_Interface.h
- *
- * @brief this file contains prototypes functions for NVIC Module
- *
- * @author Project Team
- *
- * @date 6/11/2023
- ******************************************************************************* */
-#define NVIC_USART1   37
-#define NVIC_USART2   38
-#define NVIC_USART6   71
-
-
-typedef enum 
-{
-	MNVIC_GROUPMODE_G16S0=3,
-	MNVIC_GROUPMODE_G8S2,
-	MNVIC_GROUPMODE_G4S4,
-	MNVIC_GROUPMODE_G2S8,
-	MNVIC_GROUPMODE_G0S16,
-	
-}MNVIC_GroupMode_t;
-
-
-/*********************************Functions Prototypes**********************************/
-
-void MNVIC_voidEnableInterrupt (u8 Copy_u8IntPos);
-
-void MNVIC_voidDisableInterrupt (u8 Copy_u8IntPos);
-
-void MNVIC_voidEnableInterruptPending (u8 Copy_u8IntPos);
-
-void MNVIC_voidDisableInterruptPending (u8 Copy_u8IntPos);
-
-u8 MNVIC_u8IsInterruptActive (u8 Copy_u8IntPos);
-
-void MNVIC_voidSetInterruptPriority (u8 Copy_u8IntPos,MNVIC_GroupMode_t Copy_uddtGroupMode,u8 Copy_u8GroupNum,u8 Copy_u8SubGroupNum);
-
-void MNVIC_voidSetInterruptGroupMode (MNVIC_GroupMode_t Copy_uddtGroupMode);
-
-
-
-#endif 
+/***************************File Guard *****************************************/
+#ifndef NVIC_INTERFACE_H_
+#define NVIC_INTERFACE_H_
+/** ****************************************************************************
+ *
+ * @File NVIC_Interface.h
+ *
+ * @brief this file contains prototypes functions for NVIC Module
+ *
+ * @author Project Team
+ *
+ * @date 6/11/2023
+ ******************************************************************************* */
+#define NVIC_USART1   37
+#define NVIC_USART2   38
+#define NVIC_USART6   71
+#define NVIC_EXTI0    6
+#define NVIC_EXTI1    7
+#define NVIC_EXTI2    8
+#define NVIC_EXTI3    9
+#define NVIC_EXTI4    10
+#define NVIC_EXTI9_5  23
+#define NVIC_EXTI15_10 40
+
+/* system exceptions, for MNVIC_voidSetSystemPriority */
+#define NVIC_SYS_PENDSV    14
+#define NVIC_SYS_SYSTICK   15
+
+
+typedef enum 
+{
+	MNVIC_GROUPMODE_G16S0=3,
+	MNVIC_GROUPMODE_G8S2,
+	MNVIC_GROUPMODE_G4S4,
+	MNVIC_GROUPMODE_G2S8,
+	MNVIC_GROUPMODE_G0S16,
+	
+}MNVIC_GroupMode_t;
+
+
+/*********************************Functions Prototypes**********************************/
+
+void MNVIC_voidEnableInterrupt (u8 Copy_u8IntPos);
+
+void MNVIC_voidDisableInterrupt (u8 Copy_u8IntPos);
+
+void MNVIC_voidEnableInterruptPending (u8 Copy_u8IntPos);
+
+void MNVIC_voidDisableInterruptPending (u8 Copy_u8IntPos);
+
+u8 MNVIC_u8IsInterruptActive (u8 Copy_u8IntPos);
+
+void MNVIC_voidSetInterruptPriority (u8 Copy_u8IntPos,MNVIC_GroupMode_t Copy_uddtGroupMode,u8 Copy_u8GroupNum,u8 Copy_u8SubGroupNum);
+
+void MNVIC_voidSetInterruptGroupMode (MNVIC_GroupMode_t Copy_uddtGroupMode);
+
+void MNVIC_voidInit (void);
+
+void MNVIC_voidSetPriority (u8 Copy_u8IntPos,u8 Copy_u8GroupNum,u8 Copy_u8SubGroupNum);
+
+void MNVIC_voidSetSystemPriority (u8 Copy_u8Exception,u8 Copy_u8GroupNum,u8 Copy_u8SubGroupNum);
+
+u8 MNVIC_u8EnterCritical (u8 Copy_u8GroupNum);
+
+void MNVIC_voidExitCritical (u8 Copy_u8SavedState);
+
+
+
+#endif 
@@ -1,170 +1,268 @@
-/** ****************************************************************************
- *
- * @File NVIC_Program.c
- *
- * @brief this file contains functions related to NVIC Module
- *
- * @author Project Team
- *
- * @date 6/11/2023
- *
- ****************************************************************************** */
-/*******************************************************************************
- *                          	Standard Types                                 *
- *******************************************************************************/
-#include "../../LIB/ITI_STD_TYPES.h"
-#include "../../LIB/BIT_MATH.h"
-/*******************************************************************************
- *                          	MCAL Components                                 *
- *******************************************************************************/
-#include "NVIC_Interface.h"
-#include "NVIC_Private.h"
-#include "NVIC_Config.h"
-
-/*******************************************************************************
- *                          	APIs Implementation                            *
- *******************************************************************************/
-/**
- * @brief Enable an interrupt in the NVIC.
- *
- * This function enables an interrupt at a specific position in the NVIC interrupt set-enable registers.
- *
- * @param Copy_u8IntPos The interrupt position to enable (0 to 84).
- *
- * @note The function sets the corresponding bit in the NVIC_ISER register based on the interrupt position.
- */
-void MNVIC_voidEnableInterrupt (u8 Copy_u8IntPos) //there are 85 inturrept source position as there are 85 position in vector table (85 Periphral)
-{
-	if(Copy_u8IntPos<32)
-		{
-			//MNVIC_REG->ISER[0] = (1<<copy_u8IntPos);
-			SET_BIT(NVIC_P->NVIC_ISER[0],(Copy_u8IntPos));
-		}
-		else if(Copy_u8IntPos<64)
-		{
-			//MNVIC_REG->ISER[1] = (1<<(copy_u8IntPos-32));
-			SET_BIT(NVIC_P->NVIC_ISER[1],(Copy_u8IntPos-32));
-
-		}
-		else if(Copy_u8IntPos<96)
-		{
-			//MNVIC_REG->ISER[2] = (1<<(copy_u8IntPos-64));
-			SET_BIT(NVIC_P->NVIC_ISER[2],(Copy_u8IntPos-64));
-		}
-		else
-		{
-			//wrong position
-		}
-}
-/**
- * @brief Disable an interrupt in the NVIC.
- *
- * This function disables an interrupt at a specific position in the NVIC interrupt clear-enable registers.
- *
- * @param Copy_u8IntPos The interrupt position to disable (0 to 84).
- *
- * @note The function clears the corresponding bit in the NVIC_ICER register based on the interrupt position.
- */
-void MNVIC_voidDisableInterrupt (u8 Copy_u8IntPos)
-{
-	// to get the place of this position in which register and the position in this register 
-	u8 L_u8RegPos;
-	u8 L_u8BitPos;
-	L_u8RegPos=Copy_u8IntPos/32; //to know which register 
-	L_u8BitPos=Copy_u8IntPos-(32*L_u8RegPos);//to know which bit in register 
-	//Clearing NVIC Enable for This Periphral ( each bit corresponding to position)	
-	SET_BIT(NVIC_P->NVIC_ICER[L_u8RegPos],L_u8BitPos);
-	//or NVIC_P->NVIC_ICER[L_u8RegPos]=(1<<L_u8BitPos);	
-}
-/**
- * @brief Set the pending flag for an interrupt in the NVIC.
- *
- * This function sets the pending flag for an interrupt at a specific position in the NVIC interrupt set-pending registers.
- *
- * @param Copy_u8IntPos The interrupt position to set as pending (0 to 84).
- *
- * @note Writing 1 to the ISPR bit corresponding to a disabled interrupt sets the state of that interrupt to pending.
- */
-void MNVIC_voidEnableInterruptPending (u8 Copy_u8IntPos)//Writing 1 to the ISPR bit corresponding to a disabled interrupt sets the state of that interrupt to pending
-{
-	// to get the place of this position in which register and the position in this register 
-	u8 L_u8RegPos;
-	u8 L_u8BitPos;
-	L_u8RegPos=Copy_u8IntPos/32; //to know which register 
-	L_u8BitPos=Copy_u8IntPos-(32*L_u8RegPos);//to know which bit in register 
-	//Setting Pending Flag for This Periphral ( each bit corresponding to position)	
-	SET_BIT(NVIC_P->NVIC_ISPR[L_u8RegPos],L_u8BitPos);
-}
-/**
- * @brief Clear the pending flag for an interrupt in the NVIC.
- *
- * This function clears the pending flag for an interrupt at a specific position in the NVIC interrupt clear-pending registers.
- *
- * @param Copy_u8IntPos The interrupt position to clear as pending (0 to 84).
- *
- * @note Writing 1 to an ICPR bit does not affect the active state of the corresponding interrupt.
- */
-void MNVIC_voidDisableInterruptPending (u8 Copy_u8IntPos)//Writing 1 to an ICPR bit does not affect the active state of the corresponding interrupt
-{
-	// to get the place of this position in which register and the position in this register 
-	u8 L_u8RegPos;
-	u8 L_u8BitPos;
-	L_u8RegPos=Copy_u8IntPos/32; //to know which register 
-	L_u8BitPos=Copy_u8IntPos-(32*L_u8RegPos);//to know which bit in register 
-	//Setting Pending Flag for This Periphral ( each bit corresponding to position)	
-	SET_BIT(NVIC_P->NVIC_ICPR[L_u8RegPos],L_u8BitPos);
-}
-/**
- * @brief Check if an interrupt is active.
- *
- * This function checks whether an interrupt is active (pending) at a specific position in the NVIC.
- *
- * @param Copy_u8IntPos The interrupt position to check (0 to 84).
- *
- * @return 1 if the interrupt is active, 0 if not.
- */
-u8 MNVIC_u8IsInterruptActive (u8 Copy_u8IntPos)
-{
-	// to get the place of this position in which register and the position in this register 
-	u8 L_u8RegPos;
-	u8 L_u8BitPos;
-	u8 L_u8ActiveState;
-	L_u8RegPos=Copy_u8IntPos/32; //to know which register 
-	L_u8BitPos=Copy_u8IntPos-(32*L_u8RegPos);//to know which bit in register 
-	//Setting Pending Flag for This Periphral ( each bit corresponding to position)	
-	L_u8ActiveState=GET_BIT(NVIC_P->NVIC_IABR[L_u8RegPos],L_u8BitPos);
-	
-	return L_u8ActiveState;
-}
-/**
- * @brief Set the priority of an interrupt.
- *
- * This function sets the priority of an interrupt at a specific position in the NVIC.
- *
- * @param Copy_u8IntPos The interrupt position to set the priority for (0 to 84).
- * @param Copy_uddtGroupMode The group mode for interrupt priority grouping.
- * @param Copy_u8GroupNum The group number (if applicable based on the group mode).
- * @param Copy_u8SubGroupNum The sub-group number (if applicable based on the group mode).
- *
- * @note The function calculates the priority value based on the group mode, group number, and sub-group number.
- *       It then sets the priority in the NVIC_IPR register.
- */
-void MNVIC_voidSetInterruptPriority (u8 Copy_u8IntPos,MNVIC_GroupMode_t Copy_uddtGroupMode,u8 Copy_u8GroupNum,u8 Copy_u8SubGroupNum)
-{
-	u8 LOC_u8PrioValue =0;
-	switch (Copy_uddtGroupMode)
-	{
-		case MNVIC_GROUPMODE_G0S16 : LOC_u8PrioValue =Copy_u8SubGroupNum;    break;
-		case MNVIC_GROUPMODE_G16S0 : LOC_u8PrioValue =Copy_u8GroupNum;       break;
-		case MNVIC_GROUPMODE_G4S4 :LOC_u8PrioValue =(Copy_u8GroupNum<<2) | Copy_u8SubGroupNum;    	break;
-		case MNVIC_GROUPMODE_G2S8 :LOC_u8PrioValue =(Copy_u8GroupNum<<3) | Copy_u8SubGroupNum; 		break;
-		case MNVIC_GROUPMODE_G8S2 :LOC_u8PrioValue =(Copy_u8GroupNum<<1) | Copy_u8SubGroupNum;		break;
-	}
-	NVIC_P->NVIC_IPR[Copy_u8IntPos]=(LOC_u8PrioValue<<4);
-}
-
-void MNVIC_voidSetInterruptGroupMode (MNVIC_GroupMode_t Copy_uddtGroupMode)
-{
-	SCB_AIRCR= NVIC_VECTKEY; // unlock the register first
-	SCB_AIRCR= NVIC_VECTKEY | (Copy_uddtGroupMode<<8); //shifting by 8 to can write on bit number 8 
-}
+/** ****************************************************************************
+ *
+ * @File NVIC_Program.c
+ *
+ * @brief this file contains functions related to NVIC Module
+ *
+ * @author Project Team
+ *
+ * @date 6/11/2023
+ *
+ ****************************************************************************** */
+/*******************************************************************************
+ *                          	Standard Types                                 *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "NVIC_Interface.h"
+#include "NVIC_Private.h"
+#include "NVIC_Config.h"
+
+/*******************************************************************************
+ *                          	Private Functions	                           *
+ *******************************************************************************/
+/* priority byte (upper 4 bits) of a group / sub group pair */
+static u8 MNVIC_u8EncodePriority (MNVIC_GroupMode_t Copy_uddtGroupMode,u8 Copy_u8GroupNum,u8 Copy_u8SubGroupNum)
+{
+	u8 LOC_u8PrioValue =0;
+	switch (Copy_uddtGroupMode)
+	{
+		case MNVIC_GROUPMODE_G0S16 : LOC_u8PrioValue =Copy_u8SubGroupNum;    break;
+		case MNVIC_GROUPMODE_G16S0 : LOC_u8PrioValue =Copy_u8GroupNum;       break;
+		case MNVIC_GROUPMODE_G4S4 :LOC_u8PrioValue =(Copy_u8GroupNum<<2) | Copy_u8SubGroupNum;    	break;
+		case MNVIC_GROUPMODE_G2S8 :LOC_u8PrioValue =(Copy_u8GroupNum<<3) | Copy_u8SubGroupNum; 		break;
+		case MNVIC_GROUPMODE_G8S2 :LOC_u8PrioValue =(Copy_u8GroupNum<<1) | Copy_u8SubGroupNum;		break;
+	}
+	return (u8)(LOC_u8PrioValue<<NVIC_PRIO_SHIFT);
+}
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Enable an interrupt in the NVIC.
+ *
+ * This function enables an interrupt at a specific position in the NVIC interrupt set-enable registers.
+ *
+ * @param Copy_u8IntPos The interrupt position to enable (0 to 84).
+ *
+ * @note The function sets the corresponding bit in the NVIC_ISER register based on the interrupt position.
+ */
+void MNVIC_voidEnableInterrupt (u8 Copy_u8IntPos) //there are 85 inturrept source position as there are 85 position in vector table (85 Periphral)
+{
+	if(Copy_u8IntPos<32)
+		{
+			//MNVIC_REG->ISER[0] = (1<<copy_u8IntPos);
+			SET_BIT(NVIC_P->NVIC_ISER[0],(Copy_u8IntPos));
+		}
+		else if(Copy_u8IntPos<64)
+		{
+			//MNVIC_REG->ISER[1] = (1<<(copy_u8IntPos-32));
+			SET_BIT(NVIC_P->NVIC_ISER[1],(Copy_u8IntPos-32));
+
+		}
+		else if(Copy_u8IntPos<96)
+		{
+			//MNVIC_REG->ISER[2] = (1<<(copy_u8IntPos-64));
+			SET_BIT(NVIC_P->NVIC_ISER[2],(Copy_u8IntPos-64));
+		}
+		else
+		{
+			//wrong position
+		}
+}
+/**
+ * @brief Disable an interrupt in the NVIC.
+ *
+ * This function disables an interrupt at a specific position in the NVIC interrupt clear-enable registers.
+ *
+ * @param Copy_u8IntPos The interrupt position to disable (0 to 84).
+ *
+ * @note The function clears the corresponding bit in the NVIC_ICER register based on the interrupt position.
+ */
+void MNVIC_voidDisableInterrupt (u8 Copy_u8IntPos)
+{
+	// to get the place of this position in which register and the position in this register 
+	u8 L_u8RegPos;
+	u8 L_u8BitPos;
+	L_u8RegPos=Copy_u8IntPos/32; //to know which register 
+	L_u8BitPos=Copy_u8IntPos-(32*L_u8RegPos);//to know which bit in register 
+	//Clearing NVIC Enable for This Periphral ( each bit corresponding to position)	
+	SET_BIT(NVIC_P->NVIC_ICER[L_u8RegPos],L_u8BitPos);
+	//or NVIC_P->NVIC_ICER[L_u8RegPos]=(1<<L_u8BitPos);	
+}
+/**
+ * @brief Set the pending flag for an interrupt in the NVIC.
+ *
+ * This function sets the pending flag for an interrupt at a specific position in the NVIC interrupt set-pending registers.
+ *
+ * @param Copy_u8IntPos The interrupt position to set as pending (0 to 84).
+ *
+ * @note Writing 1 to the ISPR bit corresponding to a disabled interrupt sets the state of that interrupt to pending.
+ */
+void MNVIC_voidEnableInterruptPending (u8 Copy_u8IntPos)//Writing 1 to the ISPR bit corresponding to a disabled interrupt sets the state of that interrupt to pending
+{
+	// to get the place of this position in which register and the position in this register 
+	u8 L_u8RegPos;
+	u8 L_u8BitPos;
+	L_u8RegPos=Copy_u8IntPos/32; //to know which register 
+	L_u8BitPos=Copy_u8IntPos-(32*L_u8RegPos);//to know which bit in register 
+	//Setting Pending Flag for This Periphral ( each bit corresponding to position)	
+	SET_BIT(NVIC_P->NVIC_ISPR[L_u8RegPos],L_u8BitPos);
+}
+/**
+ * @brief Clear the pending flag for an interrupt in the NVIC.
+ *
+ * This function clears the pending flag for an interrupt at a specific position in the NVIC interrupt clear-pending registers.
+ *
+ * @param Copy_u8IntPos The interrupt position to clear as pending (0 to 84).
+ *
+ * @note Writing 1 to an ICPR bit does not affect the active state of the corresponding interrupt.
+ */
+void MNVIC_voidDisableInterruptPending (u8 Copy_u8IntPos)//Writing 1 to an ICPR bit does not affect the active state of the corresponding interrupt
+{
+	// to get the place of this position in which register and the position in this register 
+	u8 L_u8RegPos;
+	u8 L_u8BitPos;
+	L_u8RegPos=Copy_u8IntPos/32; //to know which register 
+	L_u8BitPos=Copy_u8IntPos-(32*L_u8RegPos);//to know which bit in register 
+	//Setting Pending Flag for This Periphral ( each bit corresponding to position)	
+	SET_BIT(NVIC_P->NVIC_ICPR[L_u8RegPos],L_u8BitPos);
+}
+/**
+ * @brief Check if an interrupt is active.
+ *
+ * This function checks whether an interrupt is active (pending) at a specific position in the NVIC.
+ *
+ * @param Copy_u8IntPos The interrupt position to check (0 to 84).
+ *
+ * @return 1 if the interrupt is active, 0 if not.
+ */
+u8 MNVIC_u8IsInterruptActive (u8 Copy_u8IntPos)
+{
+	// to get the place of this position in which register and the position in this register 
+	u8 L_u8RegPos;
+	u8 L_u8BitPos;
+	u8 L_u8ActiveState;
+	L_u8RegPos=Copy_u8IntPos/32; //to know which register 
+	L_u8BitPos=Copy_u8IntPos-(32*L_u8RegPos);//to know which bit in register 
+	//Setting Pending Flag for This Periphral ( each bit corresponding to position)	
+	L_u8ActiveState=GET_BIT(NVIC_P->NVIC_IABR[L_u8RegPos],L_u8BitPos);
+	
+	return L_u8ActiveState;
+}
+/**
+ * @brief Set the priority of an interrupt.
+ *
+ * This function sets the priority of an interrupt at a specific position in the NVIC.
+ *
+ * @param Copy_u8IntPos The interrupt position to set the priority for (0 to 84).
+ * @param Copy_uddtGroupMode The group mode for interrupt priority grouping.
+ * @param Copy_u8GroupNum The group number (if applicable based on the group mode).
+ * @param Copy_u8SubGroupNum The sub-group number (if applicable based on the group mode).
+ *
+ * @note The function calculates the priority value based on the group mode, group number, and sub-group number.
+ *       It then sets the priority in the NVIC_IPR register.
+ */
+void MNVIC_voidSetInterruptPriority (u8 Copy_u8IntPos,MNVIC_GroupMode_t Copy_uddtGroupMode,u8 Copy_u8GroupNum,u8 Copy_u8SubGroupNum)
+{
+	NVIC_P->NVIC_IPR[Copy_u8IntPos]=MNVIC_u8EncodePriority(Copy_uddtGroupMode,Copy_u8GroupNum,Copy_u8SubGroupNum);
+}
+/**
+ * @brief Set the priority grouping.
+ *
+ * @param Copy_uddtGroupMode The split of the priority bits between groups and sub groups.
+ *
+ * @note The priorities already set are not encoded again, set the group mode first.
+ */
+void MNVIC_voidSetInterruptGroupMode (MNVIC_GroupMode_t Copy_uddtGroupMode)
+{
+	SCB_AIRCR= NVIC_VECTKEY; // unlock the register first
+	SCB_AIRCR= NVIC_VECTKEY | (Copy_uddtGroupMode<<8); //shifting by 8 to can write on bit number 8 
+}
+/**
+ * @brief Apply the grouping and the priority map of NVIC_Config.h.
+ *
+ * This function sets NVIC_GROUP_MODE, then the priority of the interrupts used
+ * by the cars (EXTI lines, USART1, USART6) and of the SysTick and PendSV exceptions.
+ *
+ * @note Call it before enabling the interrupts.
+ */
+void MNVIC_voidInit (void)
+{
+	MNVIC_voidSetInterruptGroupMode(NVIC_GROUP_MODE);
+
+	MNVIC_voidSetPriority(NVIC_EXTI0,NVIC_EXTI_GROUP,NVIC_EXTI_SUBGROUP);
+	MNVIC_voidSetPriority(NVIC_EXTI1,NVIC_EXTI_GROUP,NVIC_EXTI_SUBGROUP);
+	MNVIC_voidSetPriority(NVIC_EXTI2,NVIC_EXTI_GROUP,NVIC_EXTI_SUBGROUP);
+	MNVIC_voidSetPriority(NVIC_EXTI3,NVIC_EXTI_GROUP,NVIC_EXTI_SUBGROUP);
+	MNVIC_voidSetPriority(NVIC_EXTI4,NVIC_EXTI_GROUP,NVIC_EXTI_SUBGROUP);
+	MNVIC_voidSetPriority(NVIC_EXTI9_5,NVIC_EXTI_GROUP,NVIC_EXTI_SUBGROUP);
+	MNVIC_voidSetPriority(NVIC_EXTI15_10,NVIC_EXTI_GROUP,NVIC_EXTI_SUBGROUP);
+
+	MNVIC_voidSetPriority(NVIC_USART6,NVIC_USART6_GROUP,NVIC_USART6_SUBGROUP);
+	MNVIC_voidSetPriority(NVIC_USART1,NVIC_USART1_GROUP,NVIC_USART1_SUBGROUP);
+
+	MNVIC_voidSetSystemPriority(NVIC_SYS_SYSTICK,NVIC_SYSTICK_GROUP,NVIC_SYSTICK_SUBGROUP);
+	MNVIC_voidSetSystemPriority(NVIC_SYS_PENDSV,NVIC_PENDSV_GROUP,NVIC_PENDSV_SUBGROUP);
+}
+/**
+ * @brief Set the priority of an interrupt with the configured grouping.
+ *
+ * @param Copy_u8IntPos The interrupt position (0 to 84).
+ * @param Copy_u8GroupNum The preemption group (a lower group pre-empts a higher one).
+ * @param Copy_u8SubGroupNum The sub group (order of the pending interrupts of one group).
+ */
+void MNVIC_voidSetPriority (u8 Copy_u8IntPos,u8 Copy_u8GroupNum,u8 Copy_u8SubGroupNum)
+{
+	NVIC_P->NVIC_IPR[Copy_u8IntPos]=MNVIC_u8EncodePriority(NVIC_GROUP_MODE,Copy_u8GroupNum,Copy_u8SubGroupNum);
+}
+/**
+ * @brief Set the priority of a system exception with the configured grouping.
+ *
+ * @param Copy_u8Exception NVIC_SYS_SYSTICK or NVIC_SYS_PENDSV (exception number 4 to 15).
+ * @param Copy_u8GroupNum The preemption group.
+ * @param Copy_u8SubGroupNum The sub group.
+ */
+void MNVIC_voidSetSystemPriority (u8 Copy_u8Exception,u8 Copy_u8GroupNum,u8 Copy_u8SubGroupNum)
+{
+	if ((Copy_u8Exception >= NVIC_SHPR_FIRST) && (Copy_u8Exception <= NVIC_SYS_SYSTICK))
+	{
+		SCB_SHPR[Copy_u8Exception - NVIC_SHPR_FIRST]=MNVIC_u8EncodePriority(NVIC_GROUP_MODE,Copy_u8GroupNum,Copy_u8SubGroupNum);
+	}
+	else
+	{
+		//wrong exception (the faults 1 to 3 have a fixed priority)
+	}
+}
+/**
+ * @brief Enter a critical section against the interrupts of a group and the lower ones.
+ *
+ * BASEPRI is only raised (BASEPRI_MAX), so the sections can be nested: an inner
+ * section of a lower group keeps the mask of the outer one. The interrupts of the
+ * higher groups still pre-empt the section.
+ *
+ * @param Copy_u8GroupNum The highest group to mask (1 or more, group 0 can't be masked by BASEPRI).
+ *
+ * @return The previous mask, to give to MNVIC_voidExitCritical.
+ */
+u8 MNVIC_u8EnterCritical (u8 Copy_u8GroupNum)
+{
+	u32 L_u32Saved;
+	u32 L_u32Mask=MNVIC_u8EncodePriority(NVIC_GROUP_MODE,Copy_u8GroupNum,0);
+
+	__asm volatile ("mrs %0, basepri" : "=r" (L_u32Saved));
+	__asm volatile ("msr basepri_max, %0" : : "r" (L_u32Mask) : "memory");
+	return (u8)L_u32Saved;
+}
+/**
+ * @brief Leave a critical section.
+ *
+ * @param Copy_u8SavedState The value returned by the matching MNVIC_u8EnterCritical.
+ */
+void MNVIC_voidExitCritical (u8 Copy_u8SavedState)
+{
+	__asm volatile ("msr basepri, %0" : : "r" ((u32)Copy_u8SavedState) : "memory");
+}
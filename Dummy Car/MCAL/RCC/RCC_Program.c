@@ -1,135 +1,369 @@
-/** ****************************************************************************
- *
- * @File RCC_Program.c
- *
- * @brief this file contains functions related to RCC Module
- *
- * @author Project Team
- *
- * @date 6/11/2023
- *
- ****************************************************************************** */
-/*******************************************************************************
- *                          	Standard Types                                 *
- *******************************************************************************/
-#include "../../LIB/ITI_STD_TYPES.h"
-#include "../../LIB/BIT_MATH.h"
-/*******************************************************************************
- *                          	MCAL Components                                 *
- *******************************************************************************/
-#include "RCC_Interface.h"
-#include "RCC_Private.h"
-#include "RCC_Config.h"
-/*******************************************************************************
- *                          	APIs Implementation                            *
- *******************************************************************************/
- /**
- * @brief Initialize the RCC (Reset and Clock Control) module.
- *
- * This function configures the RCC module based on the selected clock source.
- * The clock source can be HSI, HSE, or PLL, and the AHB prescaler is also configured.
- *
- * @note This function should be called at the beginning of the program.
- */
-void MRCC_VoidInit(void)
-{
-#if 	CLOCK_TYPE == HSI
-
-	//Enable HSI Clock (y3ny b2lo feh el source da m3aya mn dmn eloptions ele mmkn a5tar mnha dmn el system clock)
-	SET_BIT(MRCC->RCC_CR,HSION);
-	// wait until HSI ready flag is on
-	//	while(GET_BIT(MRCC->RCC_CR,1) == 0);
-	//Choosing HSI as Clock Source(kda b5tar fe el mux eltany)
-	CLR_BIT(MRCC->RCC_CFGR,SW0);
-	CLR_BIT(MRCC->RCC_CFGR,SW1);
-
-
-
-#elif 	CLOCK_TYPE == HSE
-	//Enable HSE Clock (y3ny b2lo feh el source da m3aya mn dmn eloptions ele mmkn a5tar mnha dmn el system clock)
-	SET_BIT(MRCC->RCC_CR,HSEON);
-	//Choosing HSI as Clock Source(kda b5tar fe el mux eltany)
-	SET_BIT(MRCC->RCC_CFGR,SW0);
-	CLR_BIT(MRCC->RCC_CFGR,SW1);
-
-#elif	CLOCK_TYPE ==  PLL
-	/*
-	 f(VCO clock)=f(PLL clock input)*(PLLN/PLLM)    VCO hya elclock source ele 25trto ele hwa HSE OR HSI
-	 f(PLL general clock o/p)=f(VCO clock)/PLLP
-	 f(USB OTG FS, SDIO, RNG clock o/p)=f(VCO clock)/PLLQ
-	 */
-	//lazm elregister da at4t8l 3leh klo we ana 2afl enable el PLL
-
-	//Selecting which clock will be operated on in PLL ct
-	MRCC->RCC_PLLCFGR|= (PLL_INPUT_SOURCE << PLLSRC) ;
-
-	//Setting PLLP (Prescaler Value that performed on the clock that out from PLL ct  going to SYS Clock MUX as PLL clock)
-	MRCC->RCC_PLLCFGR|= PLLP_VALUE << PLLP0 ; // the value of clock freq out of this prescaler must no exceeded 84MHZ
-
-	//Setting PLLN (Multiplication Value for VCO that performed on the clock that will be operated on PLL ct this clock is either HSE or HSI)
-#if ((PLLN_VALUE >=192)&&(PLLN_VALUE <=432))
-
-	MRCC->RCC_PLLCFGR|= PLLN_VALUE << PLLN0 ;
-#else
-#error "Wrong Configuration For PLLN_VALUE"
-#endif
-	//Setting PLLM (Division Factor for VCO(main PLL input Clock) that performed on the clock that will be operated on PLL ct this clock is either HSE or HSI)
-#if ((PLLM_VALUE >=2)&&(PLLM_VALUE <=63))
-
-	MRCC->RCC_PLLCFGR|= PLLM_VALUE << PLLM0 ;
-#else
-#error "Wrong Configuration For PLLM_VALUE"
-#endif
-
-	//Enable PLL Ct (y3ny b2lo feh el source da m3aya mn dmn eloptions ele mmkn a5tar mnha dmn el system clock)
-	SET_BIT(MRCC->RCC_CR,PLLON);
-	//Choosing PLLclock as Clock Source (kda b5tar fe el mux eltany)
-	SET_BIT(MRCC->RCC_CFGR,SW0);
-	SET_BIT(MRCC->RCC_CFGR,SW1);
-
-#endif /* For Choosing Clock Type*/
-	//DETERMINING AHB PRESCALER
-	MRCC -> RCC_CFGR &= AHB_PRESCALAR_MASK;
-	MRCC -> RCC_CFGR |= (AHB_PRESCALER << 4); /*AHB clock = SYSTEM CLOCK / AHP_PRESCALAR*/
-
-}
-/**
- * @brief Enable a specific peripheral on a particular bus.
- *
- * This function enables a specific peripheral on the selected bus.
- *
- * @param Copy_U8PeriphralBus The bus to which the peripheral is connected (AHB1, AHB2, APB1, or APB2).
- * @param Copy_U8PeriphralNumber The peripheral number to enable.
- */
-void MRCC_VoidEnablePeriphral(u8 Copy_U8PeriphralBus,u8 Copy_U8PeriphralNumber)
-{
-	// First Switch on the bus to Filter the periphrals which will be operated on 
-	switch (Copy_U8PeriphralBus)
-	{
-		// after choosing the bus then going to choose the periphral number corresponding to bits of this periphral on this bus (to know which periphrals are on this bus go to memory map then go to RCC registers which enable them by knowing the bus first)
-		case AHB1_BUS: SET_BIT(MRCC->RCC_AHB1ENR,Copy_U8PeriphralNumber);   break;
-		case AHB2_BUS: SET_BIT(MRCC->RCC_AHB2ENR,Copy_U8PeriphralNumber);	break;
-		case APB1_BUS: SET_BIT(MRCC->RCC_APB1ENR,Copy_U8PeriphralNumber);	break;
-		case APB2_BUS: SET_BIT(MRCC->RCC_APB2ENR,Copy_U8PeriphralNumber);	break;
-	}
-}
-/**
- * @brief Disable a specific peripheral on a particular bus.
- *
- * This function disables a specific peripheral on the selected bus.
- *
- * @param Copy_U8PeriphralBus The bus to which the peripheral is connected (AHB1, AHB2, APB1, or APB2).
- * @param Copy_U8PeriphralNumber The peripheral number to disable.
- */
-void MRCC_VoidDisablePeriphral(u8 Copy_U8PeriphralBus,u8 Copy_U8PeriphralNumber)
-{
-	// First Switch on the bus to Filter the periphrals which will be operated on 
-	switch (Copy_U8PeriphralBus)
-	{
-		// after choosing the bus then going to choose the periphral number corresponding to bits of this periphral on this bus (to know which periphrals are on this bus go to memory map then go to RCC registers which enable them by knowing the bus first)
-		case AHB1_BUS: CLR_BIT(MRCC->RCC_AHB1ENR,Copy_U8PeriphralNumber);   break;
-		case AHB2_BUS: CLR_BIT(MRCC->RCC_AHB2ENR,Copy_U8PeriphralNumber);	break;
-		case APB1_BUS: CLR_BIT(MRCC->RCC_APB1ENR,Copy_U8PeriphralNumber);	break;
-		case APB2_BUS: CLR_BIT(MRCC->RCC_APB2ENR,Copy_U8PeriphralNumber);	break;
-	}
-}
+/** ****************************************************************************
+ *
+ * @File RCC_Program.c
+ *
+ * @brief this file contains functions related to RCC Module
+ *
+ * @author Project Team
+ *
+ * @date 6/11/2023
+ *
+ ****************************************************************************** */
+/*******************************************************************************
+ *                          	Standard Types                                 *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "RCC_Interface.h"
+#include "RCC_Config.h"
+#include "RCC_Private.h"
+/*******************************************************************************
+ *                          	Private Functions                              *
+ *******************************************************************************/
+/* set the flash wait states and wait until the flash interface uses them */
+static void MRCC_voidSetFlashLatency(u32 Copy_u32Latency)
+{
+	FLASH_ACR = (FLASH_ACR & ~(FLASH_ACR_LATENCY_MASK << LATENCY0)) | (Copy_u32Latency << LATENCY0);
+	while(((FLASH_ACR >> LATENCY0) & FLASH_ACR_LATENCY_MASK) != Copy_u32Latency);
+}
+
+/* wait states needed for an HCLK frequency */
+static u32 MRCC_u32FlashLatency(u32 Copy_u32HclkHz)
+{
+	return (Copy_u32HclkHz - 1) / RCC_FLASH_HZ_PER_WAIT_STATE;
+}
+
+/* configure the PLL from RCC_Config.h, turn it on and wait until it is locked */
+static void MRCC_voidStartPll(void)
+{
+	//the PLL input must run before the PLL
+#if PLL_INPUT_SOURCE == HSE
+	SET_BIT(MRCC->RCC_CR,HSEON);
+	while(GET_BIT(MRCC->RCC_CR,HSERDY) == 0);
+#else
+	SET_BIT(MRCC->RCC_CR,HSION);
+	while(GET_BIT(MRCC->RCC_CR,HSIRDY) == 0);
+#endif
+	//lazm elregister da at4t8l 3leh klo we ana 2afl enable el PLL
+	CLR_BIT(MRCC->RCC_CR,PLLON);
+	while(GET_BIT(MRCC->RCC_CR,PLLRDY) == 1);
+
+	//The whole register is written: the reset value of PLLM/PLLN/PLLQ would be ORed with the configuration
+	MRCC->RCC_PLLCFGR = (MRCC->RCC_PLLCFGR & RCC_PLLCFGR_RESERVED)
+			| (PLL_INPUT_SOURCE << PLLSRC)
+			| (PLLP_VALUE << PLLP0)	// the value of clock freq out of this prescaler must no exceeded 84MHZ
+			| (PLLN_VALUE << PLLN0)
+			| (PLLM_VALUE << PLLM0)
+			| (PLLQ_VALUE << PLLQ0);
+
+	//Enable PLL Ct and wait until it is locked
+	SET_BIT(MRCC->RCC_CR,PLLON);
+	while(GET_BIT(MRCC->RCC_CR,PLLRDY) == 0);
+}
+
+/* select the system clock source and wait until the switch is done (SWS reports the selected source) */
+static void MRCC_voidSelectSysClk(u8 Copy_u8Source)
+{
+	MRCC->RCC_CFGR = (MRCC->RCC_CFGR & ~RCC_CFGR_SW_MASK) | Copy_u8Source;
+	while(((MRCC->RCC_CFGR & RCC_CFGR_SWS_MASK) >> SWS0) != Copy_u8Source);
+}
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+ /**
+ * @brief Initialize the RCC (Reset and Clock Control) module.
+ *
+ * This function configures the RCC module based on the selected clock source.
+ * The clock source can be HSI, HSE, or PLL. Each oscillator is waited for until
+ * it is ready, the flash wait states, prefetch and caches are set for the new
+ * HCLK before switching to it, and the AHB, APB1 and APB2 prescalers are configured.
+ *
+ * @note This function should be called at the beginning of the program.
+ */
+void MRCC_VoidInit(void)
+{
+	//Enable the oscillator feeding the system clock or the PLL and wait until it is ready
+#if 	(CLOCK_TYPE == HSE) || ((CLOCK_TYPE == PLL) && (PLL_INPUT_SOURCE == HSE))
+	SET_BIT(MRCC->RCC_CR,HSEON);
+	while(GET_BIT(MRCC->RCC_CR,HSERDY) == 0);
+#else
+	SET_BIT(MRCC->RCC_CR,HSION);
+	while(GET_BIT(MRCC->RCC_CR,HSIRDY) == 0);
+#endif
+
+	//Flash wait states must be set before raising HCLK, with the prefetch buffer and the caches
+	CLR_BIT(FLASH_ACR,ICEN);
+	CLR_BIT(FLASH_ACR,DCEN);
+	SET_BIT(FLASH_ACR,ICRST);
+	SET_BIT(FLASH_ACR,DCRST);
+	CLR_BIT(FLASH_ACR,ICRST);
+	CLR_BIT(FLASH_ACR,DCRST);
+	MRCC_voidSetFlashLatency(RCC_FLASH_LATENCY);
+	SET_BIT(FLASH_ACR,PRFTEN);
+	SET_BIT(FLASH_ACR,ICEN);
+	SET_BIT(FLASH_ACR,DCEN);
+
+	//DETERMINING AHB, APB1 AND APB2 PRESCALERS (before the switch, so APB1 never exceeds 42 MHz)
+	MRCC -> RCC_CFGR &= AHB_PRESCALAR_MASK;
+	MRCC -> RCC_CFGR |= (AHB_PRESCALER << HPRE0); /*AHB clock = SYSTEM CLOCK / AHP_PRESCALAR*/
+	MRCC -> RCC_CFGR &= ~((RCC_CFGR_PPRE_MASK << PPRE1_0) | (RCC_CFGR_PPRE_MASK << PPRE2_0));
+	MRCC -> RCC_CFGR |= (APB1_PRESCALER << PPRE1_0) | (APB2_PRESCALER << PPRE2_0);
+
+#if 	CLOCK_TYPE ==  PLL
+	/*
+	 f(VCO clock)=f(PLL clock input)*(PLLN/PLLM)    VCO hya elclock source ele 25trto ele hwa HSE OR HSI
+	 f(PLL general clock o/p)=f(VCO clock)/PLLP
+	 f(USB OTG FS, SDIO, RNG clock o/p)=f(VCO clock)/PLLQ
+	 */
+	MRCC_voidStartPll();
+#endif
+	//Choosing the Clock Source (kda b5tar fe el mux eltany)
+	MRCC_voidSelectSysClk(CLOCK_TYPE);
+}
+
+/**
+ * @brief Change the system clock source and the AHB prescaler at run time.
+ *
+ * The flash wait states follow the new HCLK (raised before the switch, lowered
+ * after it), the PLL is started from RCC_Config.h when it is selected and
+ * stopped when it is left, and the APB prescalers are kept. The peripherals
+ * that derive a divisor from the clock tree must be updated by the caller.
+ *
+ * @param Copy_u8Source RCC_SYSCLK_HSI, RCC_SYSCLK_HSE or RCC_SYSCLK_PLL.
+ * @param Copy_u16AhbDivider 1, 2, 4, 8, 16, 64, 128, 256 or 512.
+ * @return OK, OUT_OF_RANGE for a wrong source or divider or if APB1 would exceed 42 MHz.
+ */
+u8 MRCC_u8SwitchSysClk(u8 Copy_u8Source, u16 Copy_u16AhbDivider)
+{
+	u32 Loc_u32SourceHz;
+	u32 Loc_u32HclkHz;
+	u32 Loc_u32Hpre;
+	u32 Loc_u32Ppre1;
+	u32 Loc_u32OldSource = (MRCC->RCC_CFGR & RCC_CFGR_SWS_MASK) >> SWS0;
+	u32 Loc_u32OldSourceHz = MRCC_u32GetSysClk();
+
+	switch(Copy_u16AhbDivider)
+	{
+	case 1:   Loc_u32Hpre = AHP_NO_PRESCALAR;  break;
+	case 2:   Loc_u32Hpre = AHP_2_PRESCALAR;   break;
+	case 4:   Loc_u32Hpre = AHP_4_PRESCALAR;   break;
+	case 8:   Loc_u32Hpre = AHP_8_PRESCALAR;   break;
+	case 16:  Loc_u32Hpre = AHP_16_PRESCALAR;  break;
+	case 64:  Loc_u32Hpre = AHP_64_PRESCALAR;  break;
+	case 128: Loc_u32Hpre = AHP_128_PRESCALAR; break;
+	case 256: Loc_u32Hpre = AHP_256_PRESCALAR; break;
+	case 512: Loc_u32Hpre = AHP_512_PRESCALAR; break;
+	default:  return OUT_OF_RANGE;
+	}
+	switch(Copy_u8Source)
+	{
+	case RCC_SYSCLK_HSI: Loc_u32SourceHz = HSI_CLOCK_HZ;      break;
+	case RCC_SYSCLK_HSE: Loc_u32SourceHz = HSE_CLOCK_HZ;      break;
+	case RCC_SYSCLK_PLL: Loc_u32SourceHz = RCC_PLL_OUTPUT_HZ; break;
+	default:             return OUT_OF_RANGE;
+	}
+	Loc_u32HclkHz = Loc_u32SourceHz / Copy_u16AhbDivider;
+
+	//the APB1 prescaler is kept, it must still fit the new HCLK
+	Loc_u32Ppre1 = (MRCC->RCC_CFGR >> PPRE1_0) & RCC_CFGR_PPRE_MASK;
+	if(((Loc_u32Ppre1 >= APB_2_PRESCALAR) ? (Loc_u32HclkHz >> (Loc_u32Ppre1 - APB_2_PRESCALAR + 1)) : Loc_u32HclkHz) > RCC_APB1_MAX_HZ)
+	{
+		return OUT_OF_RANGE;
+	}
+
+	//during the switch HCLK may briefly be either source with either prescaler: the wait states cover the fastest source
+	MRCC_voidSetFlashLatency(MRCC_u32FlashLatency((Loc_u32SourceHz > Loc_u32OldSourceHz) ? Loc_u32SourceHz : Loc_u32OldSourceHz));
+
+	if(Copy_u8Source == RCC_SYSCLK_PLL)
+	{
+		if(Loc_u32OldSource != RCC_SYSCLK_PLL)
+		{
+			MRCC_voidStartPll();
+		}
+	}
+	else if(Copy_u8Source == RCC_SYSCLK_HSE)
+	{
+		SET_BIT(MRCC->RCC_CR,HSEON);
+		while(GET_BIT(MRCC->RCC_CR,HSERDY) == 0);
+	}
+	else
+	{
+		SET_BIT(MRCC->RCC_CR,HSION);
+		while(GET_BIT(MRCC->RCC_CR,HSIRDY) == 0);
+	}
+
+	MRCC -> RCC_CFGR = (MRCC -> RCC_CFGR & AHB_PRESCALAR_MASK) | (Loc_u32Hpre << HPRE0);
+	MRCC_voidSelectSysClk(Copy_u8Source);
+
+	//the PLL is stopped when it is not used anymore (its current is the largest saving after the core clock)
+	if((Loc_u32OldSource == RCC_SYSCLK_PLL) && (Copy_u8Source != RCC_SYSCLK_PLL))
+	{
+		CLR_BIT(MRCC->RCC_CR,PLLON);
+	}
+
+	MRCC_voidSetFlashLatency(MRCC_u32FlashLatency(Loc_u32HclkHz));
+	return OK;
+}
+
+/**
+ * @brief Get the system clock frequency.
+ *
+ * Read from the RCC registers, so it follows any change made after MRCC_VoidInit.
+ *
+ * @return SYSCLK in Hz.
+ */
+u32 MRCC_u32GetSysClk(void)
+{
+	u32 Loc_u32SysClk = HSI_CLOCK_HZ;
+	u32 Loc_u32PllCfg;
+	u32 Loc_u32PllInput;
+
+	switch((MRCC->RCC_CFGR & RCC_CFGR_SWS_MASK) >> SWS0)
+	{
+	case HSE: Loc_u32SysClk = HSE_CLOCK_HZ; break;
+	case PLL:
+		Loc_u32PllCfg = MRCC->RCC_PLLCFGR;
+		Loc_u32PllInput = (GET_BIT(Loc_u32PllCfg,PLLSRC) == HSE) ? HSE_CLOCK_HZ : HSI_CLOCK_HZ;
+		/* divide first: the VCO output does not fit the intermediate product for every input */
+		Loc_u32SysClk = (Loc_u32PllInput / ((Loc_u32PllCfg >> PLLM0) & RCC_PLLCFGR_PLLM_MASK))
+				* ((Loc_u32PllCfg >> PLLN0) & RCC_PLLCFGR_PLLN_MASK)
+				/ (2 * (((Loc_u32PllCfg >> PLLP0) & RCC_PLLCFGR_PLLP_MASK) + 1));
+		break;
+	default: break;
+	}
+	return Loc_u32SysClk;
+}
+
+/**
+ * @brief Get the AHB clock (HCLK) frequency, also the core and SysTick clock.
+ *
+ * @return HCLK in Hz.
+ */
+u32 MRCC_u32GetAhbClk(void)
+{
+	/* HPRE 0xxx: not divided, 1000..1111: 2, 4, 8, 16, 64, 128, 256, 512 */
+	static const u8 Loc_Au8AhbShift[8] = {1, 2, 3, 4, 6, 7, 8, 9};
+	u32 Loc_u32Hpre = (MRCC->RCC_CFGR >> HPRE0) & RCC_CFGR_HPRE_MASK;
+	u32 Loc_u32Clk = MRCC_u32GetSysClk();
+
+	if(Loc_u32Hpre >= 8)
+	{
+		Loc_u32Clk >>= Loc_Au8AhbShift[Loc_u32Hpre - 8];
+	}
+	return Loc_u32Clk;
+}
+
+/**
+ * @brief Divide HCLK by an APB prescaler field (PPRE 0xx: not divided, 100..111: 2, 4, 8, 16).
+ */
+static u32 MRCC_u32ApbClk(u8 Copy_u8PpreShift)
+{
+	u32 Loc_u32Ppre = (MRCC->RCC_CFGR >> Copy_u8PpreShift) & RCC_CFGR_PPRE_MASK;
+	u32 Loc_u32Clk = MRCC_u32GetAhbClk();
+
+	if(Loc_u32Ppre >= APB_2_PRESCALAR)
+	{
+		Loc_u32Clk >>= (Loc_u32Ppre - APB_2_PRESCALAR + 1);
+	}
+	return Loc_u32Clk;
+}
+
+/**
+ * @brief Get the APB1 clock (PCLK1) frequency (USART2, TIM2..TIM5).
+ *
+ * @return PCLK1 in Hz.
+ */
+u32 MRCC_u32GetApb1Clk(void)
+{
+	return MRCC_u32ApbClk(PPRE1_0);
+}
+
+/**
+ * @brief Get the APB2 clock (PCLK2) frequency (USART1, USART6, TIM1, TIM9..TIM11).
+ *
+ * @return PCLK2 in Hz.
+ */
+u32 MRCC_u32GetApb2Clk(void)
+{
+	return MRCC_u32ApbClk(PPRE2_0);
+}
+
+/**
+ * @brief Get the counter clock of the timers on APB1.
+ *
+ * The timers run at twice PCLK1 when APB1 is prescaled.
+ *
+ * @return The timer clock in Hz.
+ */
+u32 MRCC_u32GetApb1TimerClk(void)
+{
+	u32 Loc_u32Clk = MRCC_u32GetApb1Clk();
+
+	if(((MRCC->RCC_CFGR >> PPRE1_0) & RCC_CFGR_PPRE_MASK) >= APB_2_PRESCALAR)
+	{
+		Loc_u32Clk *= 2;
+	}
+	return Loc_u32Clk;
+}
+
+/**
+ * @brief Get the counter clock of the timers on APB2.
+ *
+ * The timers run at twice PCLK2 when APB2 is prescaled.
+ *
+ * @return The timer clock in Hz.
+ */
+u32 MRCC_u32GetApb2TimerClk(void)
+{
+	u32 Loc_u32Clk = MRCC_u32GetApb2Clk();
+
+	if(((MRCC->RCC_CFGR >> PPRE2_0) & RCC_CFGR_PPRE_MASK) >= APB_2_PRESCALAR)
+	{
+		Loc_u32Clk *= 2;
+	}
+	return Loc_u32Clk;
+}
+/**
+ * @brief Enable a specific peripheral on a particular bus.
+ *
+ * This function enables a specific peripheral on the selected bus.
+ *
+ * @param Copy_U8PeriphralBus The bus to which the peripheral is connected (AHB1, AHB2, APB1, or APB2).
+ * @param Copy_U8PeriphralNumber The peripheral number to enable.
+ */
+void MRCC_VoidEnablePeriphral(u8 Copy_U8PeriphralBus,u8 Copy_U8PeriphralNumber)
+{
+	// First Switch on the bus to Filter the periphrals which will be operated on 
+	switch (Copy_U8PeriphralBus)
+	{
+		// after choosing the bus then going to choose the periphral number corresponding to bits of this periphral on this bus (to know which periphrals are on this bus go to memory map then go to RCC registers which enable them by knowing the bus first)
+		case AHB1_BUS: SET_BIT(MRCC->RCC_AHB1ENR,Copy_U8PeriphralNumber);   break;
+		case AHB2_BUS: SET_BIT(MRCC->RCC_AHB2ENR,Copy_U8PeriphralNumber);	break;
+		case APB1_BUS: SET_BIT(MRCC->RCC_APB1ENR,Copy_U8PeriphralNumber);	break;
+		case APB2_BUS: SET_BIT(MRCC->RCC_APB2ENR,Copy_U8PeriphralNumber);	break;
+	}
+}
+/**
+ * @brief Disable a specific peripheral on a particular bus.
+ *
+ * This function disables a specific peripheral on the selected bus.
+ *
+ * @param Copy_U8PeriphralBus The bus to which the peripheral is connected (AHB1, AHB2, APB1, or APB2).
+ * @param Copy_U8PeriphralNumber The peripheral number to disable.
+ */
+void MRCC_VoidDisablePeriphral(u8 Copy_U8PeriphralBus,u8 Copy_U8PeriphralNumber)
+{
+	// First Switch on the bus to Filter the periphrals which will be operated on 
+	switch (Copy_U8PeriphralBus)
+	{
+		// after choosing the bus then going to choose the periphral number corresponding to bits of this periphral on this bus (to know which periphrals are on this bus go to memory map then go to RCC registers which enable them by knowing the bus first)
+		case AHB1_BUS: CLR_BIT(MRCC->RCC_AHB1ENR,Copy_U8PeriphralNumber);   break;
+		case AHB2_BUS: CLR_BIT(MRCC->RCC_AHB2ENR,Copy_U8PeriphralNumber);	break;
+		case APB1_BUS: CLR_BIT(MRCC->RCC_APB1ENR,Copy_U8PeriphralNumber);	break;
+		case APB2_BUS: CLR_BIT(MRCC->RCC_APB2ENR,Copy_U8PeriphralNumber);	break;
+	}
+}
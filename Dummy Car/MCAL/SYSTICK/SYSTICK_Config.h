@@ -1,23 +1,30 @@
-#ifndef SYSTICK_CONFIG_H_
-#define SYSTICK_CONFIG_H_
-/** ****************************************************************************
- *
- * @File SYSTICK_Config.h
- *
- * @brief this file contains confirations related to SYSTICK Module
- *
- * @author Project Team
- *
- * @date 6/11/2023
- *
- ****************************************************************************** */
-
-/*
- *	AHB_OVER_8
- *	AHB_PROCCESOR_CLOCK
- */
-#define CLK_SOURCE 		AHB_OVER_8
-
-
-
-#endif
+#ifndef SYSTICK_CONFIG_H_
+#define SYSTICK_CONFIG_H_
+/** ****************************************************************************
+ *
+ * @File SYSTICK_Config.h
+ *
+ * @brief this file contains confirations related to SYSTICK Module
+ *
+ * @author Project Team
+ *
+ * @date 6/11/2023
+ *
+ ****************************************************************************** */
+
+/*
+ *	AHB_OVER_8
+ *	AHB_PROCCESOR_CLOCK
+ */
+#define CLK_SOURCE 		AHB_OVER_8
+
+/*
+ * frequency of the ticks given to the APIs in Hz (2 MHz: one tick is 0.5 us,
+ * the AHB/8 rate of the 16 MHz HSI the delays of the application were written for)
+ * the ticks are converted to SysTick counts from the AHB clock read from RCC
+ */
+#define MSTK_TICK_FREQ_HZ		2000000UL
+
+
+
+#endif
@@ -1,209 +1,330 @@
-/** ****************************************************************************
- *
- * @File SYSTICK_Program.c
- *
- * @brief this file contains functions related to SYSTICK Module
- *
- * @author Project Team
- *
- * @date 6/11/2023
- *
- ****************************************************************************** */
- /*******************************************************************************
- *                          	Standard Types                                 *
- *******************************************************************************/
-#include "../../LIB/ITI_STD_TYPES.h"
-#include "../../LIB/BIT_MATH.h"
-/*******************************************************************************
- *                          	MCAL Components                                 *
- *******************************************************************************/
-#include "SYSTICK_Interface.h"
-#include "SYSTICK_Private.h"
-#include "SYSTICK_Config.h"
-/*******************************************************************************
- *                          	Global Variables	                           *
- *******************************************************************************/
-static u8 MSTK_INTERVAL_MODE;
-static void (* MSTK_single)(void)=NULL;
-static void (* MSTK_periodic)(void)=NULL;
-/*******************************************************************************
- *                          	APIs Implementation                            *
- *******************************************************************************/
-/**
- * @brief Initialize the SysTick timer.
- *
- * This function configures the SysTick timer based on the selected clock source.
- * The clock source can be AHB divided by 8 or the AHB processor clock.
- * It sets the appropriate clock source bit in the STK_CTRL register.
- *
- * @note This function should be called at the beginning of the program.
- */
-void MSTK_voidInit(void)
-{
-	//chossing clock source 
-	#if 	CLK_SOURCE == AHB_OVER_8
-	CLR_BIT( MSYSTICK->STK_CTRL ,CLKSOURCE);
-	
-	#elif  	CLK_SOURCE == AHB_PROCCESOR_CLOCK
-	SET_BIT( MSYSTICK->STK_CTRL ,CLKSOURCE);
-#endif
-}
-/**
- * @brief Implement a busy-wait delay using the SysTick timer.
- *
- * This function provides a simple busy-wait delay using the SysTick timer.
- *
- * @param Copy_u32Ticks The number of ticks to wait.
- */
-void MSTK_voidSetBusyWait(u32 Copy_u32Ticks)
-{
-	MSYSTICK->STK_LOAD=0;
-	MSYSTICK->STK_VAL=0;
-
-	// setting start point first
-	MSYSTICK->STK_LOAD=Copy_u32Ticks;
-	//enable timer to move value from load reg to value reg and start counting 
-	SET_BIT( MSYSTICK->STK_CTRL ,ENABLE);
-	//waiting the falg to be sure that time has wasted 
-	while (GET_BIT(MSYSTICK->STK_CTRL ,COUNTFLAG)==0);
-	//clearing enable to stop timer from begining counting again (stops timer)
-	CLR_BIT( MSYSTICK->STK_CTRL ,ENABLE);
-	//deleting values in REGs (e7tyaty)(deleting it by writing any value in it) (clearing value reg also clearing flag)
-	MSYSTICK->STK_LOAD=0;
-	MSYSTICK->STK_VAL=0;
-}
-/**
- * @brief Set a single-shot delay using the SysTick timer.
- *
- * This function sets up a single-shot delay using the SysTick timer and associates a callback function.
- *
- * @param Copy_u32Ticks The number of ticks for the delay.
- * @param Copy_ptr A pointer to the callback function to be executed after the delay.
- */
-void MSTK_voidSetIntervalSingle  (u32 Copy_u32Ticks , void (*Copy_ptr)(void) )
-{
-	MSYSTICK->STK_LOAD=0; // da 34an lw ana d5lt hna tany b EXTI msln we mknt4 5lst el interval el awlnya flma ad5l tany abd2 mn el awl
-	MSYSTICK->STK_VAL=0;
-	// setting start point first
-	MSYSTICK->STK_LOAD=Copy_u32Ticks;
-	// setting enable for ISR 
-	SET_BIT( MSYSTICK->STK_CTRL ,TICKINT);
-	//assignment call back fun to global variable to pass it to handler  
-	MSTK_single=Copy_ptr;
-	//enable timer to move value from load reg to value reg and start counting 
-	SET_BIT( MSYSTICK->STK_CTRL ,ENABLE);
-	// this line is like a flag to check which func is called 
-	MSTK_INTERVAL_MODE=MSTK_SINGLE_INTERVAL;
-}
-/**
- * @brief Set a periodic delay using the SysTick timer.
- *
- * This function sets up a periodic delay using the SysTick timer and associates a callback function.
- *
- * @param Copy_u32Ticks The number of ticks for the delay.
- * @param Copy_ptr A pointer to the callback function to be executed periodically.
- */
-void MSTK_voidSetIntervalPeriodic(u32 Copy_u32Ticks , void (*Copy_ptr)(void) )
-{
-	MSYSTICK->STK_LOAD=0;// da 34an lw ana d5lt hna tany b EXTI msln we mknt4 5lst el interval el awlnya flma ad5l tany abd2 mn el awl
-	MSYSTICK->STK_VAL=0;
-	// setting start point first
-	MSYSTICK->STK_LOAD=Copy_u32Ticks;
-	// setting enable for ISR 
-	SET_BIT( MSYSTICK->STK_CTRL ,TICKINT);
-	//assign call back fun to global variable to pass it to handler  
-	MSTK_periodic=Copy_ptr;
-	//enable timer to move value from load reg to value reg and start counting 
-	SET_BIT( MSYSTICK->STK_CTRL ,ENABLE);
-	// this line is like a flag to check which func is called 
-	MSTK_INTERVAL_MODE=MSTK_Periodic_INTERVAL;
-}
-/**
- * @brief Stop the ongoing interval.
- *
- * This function stops the SysTick timer and clears its values registers.
- */
-void MSTK_voidStopInterval(void )
-{
-	//disable timer to stop counter from 
-	CLR_BIT( MSYSTICK->STK_CTRL ,ENABLE);
-	//deleting values in REGs (e7tyaty)(deleting it by writing any value in it)
-	MSYSTICK->STK_LOAD=0;
-	MSYSTICK->STK_VAL=0;
-}
-/**
- * @brief Get the elapsed time since the last start point.
- *
- * @return The elapsed time in ticks.
- */
-u32 MSTK_u32GetElapsedTime(void) 
-{
-	u32 Loc_startingValue;
-	u32 Loc_remainingTime;
-	u32 Loc_elapsedTime;
-	//to get remaining time just read the Value Reg 
-	Loc_remainingTime = MSYSTICK->STK_VAL;
-	//read the start value 
-	Loc_startingValue = MSYSTICK->STK_LOAD;
-	//get elapsed time 
-	Loc_elapsedTime=Loc_startingValue-Loc_remainingTime;
-
-	return Loc_elapsedTime;
-}
-/**
- * @brief Get the remaining time until the next interrupt.
- *
- * @return The remaining time in ticks.
- */
-u32 MSTK_u32GetRemainingTime(void) 
-{
-	u32 Loc_remainingTime;
-	//to get remaining time just read the Value Reg 
-	Loc_remainingTime=MSYSTICK->STK_VAL;
-	return Loc_remainingTime;
-}
-/**
- * @brief SysTick Timer Interrupt Service Routine (ISR).
- *
- * This function is called when the SysTick timer interrupt occurs.
- * It clears the flag, disables the timer, clears the values registers, and executes the associated callback function.
- */
-void SysTick_Handler (void)
-{
-	//clearing the flag 
-	u8 Loc_readingFlag;
-	Loc_readingFlag=GET_BIT(MSYSTICK->STK_CTRL,COUNTFLAG);
-	if (MSTK_INTERVAL_MODE==MSTK_SINGLE_INTERVAL)
-	{
-		//first we have to disable timer and clearing vlaues registers and disable ISR
-		//disable timer to stop counter from 
-		CLR_BIT( MSYSTICK->STK_CTRL ,ENABLE);
-		//deleting values in REGs (e7tyaty)(deleting it by writing any value in it)
-		MSYSTICK->STK_LOAD=0;
-		MSYSTICK->STK_VAL=0;
-		//disable ISR
-		CLR_BIT( MSYSTICK->STK_CTRL ,TICKINT);
-
-		//calling callback fun to implement the action of ISR
-		if (MSTK_single!=NULL)
-		{
-			MSTK_single();
-		}
-		else 
-		{
-			// error state
-		}
-	}
-		
-	else if (MSTK_INTERVAL_MODE==MSTK_Periodic_INTERVAL)
-	{
-		if (MSTK_periodic!=NULL)
-		{
-			MSTK_periodic();
-		}
-		else 
-		{
-			// error state
-		}
-	}
-}
+/** ****************************************************************************
+ *
+ * @File SYSTICK_Program.c
+ *
+ * @brief this file contains functions related to SYSTICK Module
+ *
+ * @author Project Team
+ *
+ * @date 6/11/2023
+ *
+ ****************************************************************************** */
+ /*******************************************************************************
+ *                          	Standard Types                                 *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "SYSTICK_Interface.h"
+#include "SYSTICK_Private.h"
+#include "SYSTICK_Config.h"
+#include "../RCC/RCC_Interface.h"
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../../SERVICE/Defer/Defer_Interface.h"
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+static u8 MSTK_INTERVAL_MODE;
+static void (* MSTK_single)(void)=NULL;
+static void (* MSTK_periodic)(void)=NULL;
+/* SysTick counts per API tick = MSTK_u32CountNum / MSTK_u32CountDen (reduced fraction) */
+static u32 MSTK_u32CountNum = 1;
+static u32 MSTK_u32CountDen = 1;
+/*******************************************************************************
+ *                          	Private Functions	                           *
+ *******************************************************************************/
+static u32 MSTK_u32Gcd(u32 Copy_u32A, u32 Copy_u32B)
+{
+	u32 Loc_u32Rest;
+	while (Copy_u32B != 0)
+	{
+		Loc_u32Rest = Copy_u32A % Copy_u32B;
+		Copy_u32A = Copy_u32B;
+		Copy_u32B = Loc_u32Rest;
+	}
+	return Copy_u32A;
+}
+/* API ticks to SysTick counts, split so the product does not overflow */
+static u32 MSTK_u32TicksToCounts(u32 Copy_u32Ticks)
+{
+	return (Copy_u32Ticks / MSTK_u32CountDen) * MSTK_u32CountNum
+			+ ((Copy_u32Ticks % MSTK_u32CountDen) * MSTK_u32CountNum) / MSTK_u32CountDen;
+}
+/* SysTick counts (24 bits) back to API ticks */
+static u32 MSTK_u32CountsToTicks(u32 Copy_u32Counts)
+{
+	return (Copy_u32Counts / MSTK_u32CountNum) * MSTK_u32CountDen
+			+ ((Copy_u32Counts % MSTK_u32CountNum) * MSTK_u32CountDen) / MSTK_u32CountNum;
+}
+/* interval callback, run by PendSV after the SysTick handler returns */
+static void MSTK_voidRunCallBack(u32 Copy_u32Mode)
+{
+	if ((Copy_u32Mode == MSTK_SINGLE_INTERVAL) && (MSTK_single != NULL))
+	{
+		MSTK_single();
+	}
+	else if ((Copy_u32Mode == MSTK_Periodic_INTERVAL) && (MSTK_periodic != NULL))
+	{
+		MSTK_periodic();
+	}
+}
+/* interval lengths are limited to one load of the counter */
+static u32 MSTK_u32IntervalCounts(u32 Copy_u32Ticks)
+{
+	u32 Loc_u32Counts = MSTK_u32TicksToCounts(Copy_u32Ticks);
+	if (Loc_u32Counts > MSTK_MAX_LOAD)
+	{
+		Loc_u32Counts = MSTK_MAX_LOAD;
+	}
+	return Loc_u32Counts;
+}
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Initialize the SysTick timer.
+ *
+ * This function configures the SysTick timer based on the selected clock source.
+ * The clock source can be AHB divided by 8 or the AHB processor clock.
+ * It sets the appropriate clock source bit in the STK_CTRL register, and computes
+ * the number of counts per tick of MSTK_TICK_FREQ_HZ from the AHB clock.
+ *
+ * @note This function should be called at the beginning of the program, after MRCC_VoidInit.
+ */
+void MSTK_voidInit(void)
+{
+	u32 Loc_u32CountFreq = MRCC_u32GetAhbClk();
+	u32 Loc_u32Gcd;
+
+	//chossing clock source 
+	#if 	CLK_SOURCE == AHB_OVER_8
+	CLR_BIT( MSYSTICK->STK_CTRL ,CLKSOURCE);
+	Loc_u32CountFreq /= 8;
+	
+	#elif  	CLK_SOURCE == AHB_PROCCESOR_CLOCK
+	SET_BIT( MSYSTICK->STK_CTRL ,CLKSOURCE);
+#endif
+	Loc_u32Gcd = MSTK_u32Gcd(Loc_u32CountFreq, MSTK_TICK_FREQ_HZ);
+	MSTK_u32CountNum = Loc_u32CountFreq / Loc_u32Gcd;
+	MSTK_u32CountDen = MSTK_TICK_FREQ_HZ / Loc_u32Gcd;
+}
+/**
+ * @brief Implement a busy-wait delay using the SysTick timer.
+ *
+ * This function provides a simple busy-wait delay using the SysTick timer.
+ * Delays longer than one load of the 24-bit counter are done in several loads.
+ *
+ * @param Copy_u32Ticks The number of ticks to wait (MSTK_TICK_FREQ_HZ).
+ */
+void MSTK_voidSetBusyWait(u32 Copy_u32Ticks)
+{
+	u32 Loc_u32Counts = MSTK_u32TicksToCounts(Copy_u32Ticks);
+	u32 Loc_u32Load;
+
+	while (Loc_u32Counts > 0)
+	{
+		Loc_u32Load = (Loc_u32Counts > MSTK_MAX_LOAD) ? MSTK_MAX_LOAD : Loc_u32Counts;
+		Loc_u32Counts -= Loc_u32Load;
+
+		MSYSTICK->STK_LOAD=0;
+		MSYSTICK->STK_VAL=0;
+
+		// setting start point first
+		MSYSTICK->STK_LOAD=Loc_u32Load;
+		//enable timer to move value from load reg to value reg and start counting 
+		SET_BIT( MSYSTICK->STK_CTRL ,ENABLE);
+		//waiting the falg to be sure that time has wasted 
+		while (GET_BIT(MSYSTICK->STK_CTRL ,COUNTFLAG)==0);
+		//clearing enable to stop timer from begining counting again (stops timer)
+		CLR_BIT( MSYSTICK->STK_CTRL ,ENABLE);
+		//deleting values in REGs (e7tyaty)(deleting it by writing any value in it) (clearing value reg also clearing flag)
+		MSYSTICK->STK_LOAD=0;
+		MSYSTICK->STK_VAL=0;
+	}
+}
+/**
+ * @brief Set a single-shot delay using the SysTick timer.
+ *
+ * This function sets up a single-shot delay using the SysTick timer and associates a callback function.
+ *
+ * @param Copy_u32Ticks The number of ticks for the delay (limited to one load of the counter).
+ * @param Copy_ptr A pointer to the callback function to be executed after the delay.
+ */
+void MSTK_voidSetIntervalSingle  (u32 Copy_u32Ticks , void (*Copy_ptr)(void) )
+{
+	MSYSTICK->STK_LOAD=0; // da 34an lw ana d5lt hna tany b EXTI msln we mknt4 5lst el interval el awlnya flma ad5l tany abd2 mn el awl
+	MSYSTICK->STK_VAL=0;
+	// setting start point first
+	MSYSTICK->STK_LOAD=MSTK_u32IntervalCounts(Copy_u32Ticks);
+	// setting enable for ISR 
+	SET_BIT( MSYSTICK->STK_CTRL ,TICKINT);
+	//assignment call back fun to global variable to pass it to handler  
+	MSTK_single=Copy_ptr;
+	//enable timer to move value from load reg to value reg and start counting 
+	SET_BIT( MSYSTICK->STK_CTRL ,ENABLE);
+	// this line is like a flag to check which func is called 
+	MSTK_INTERVAL_MODE=MSTK_SINGLE_INTERVAL;
+}
+/**
+ * @brief Set a periodic delay using the SysTick timer.
+ *
+ * This function sets up a periodic delay using the SysTick timer and associates a callback function.
+ *
+ * @param Copy_u32Ticks The number of ticks for the delay (limited to one load of the counter).
+ * @param Copy_ptr A pointer to the callback function to be executed periodically.
+ */
+void MSTK_voidSetIntervalPeriodic(u32 Copy_u32Ticks , void (*Copy_ptr)(void) )
+{
+	MSYSTICK->STK_LOAD=0;// da 34an lw ana d5lt hna tany b EXTI msln we mknt4 5lst el interval el awlnya flma ad5l tany abd2 mn el awl
+	MSYSTICK->STK_VAL=0;
+	// setting start point first
+	MSYSTICK->STK_LOAD=MSTK_u32IntervalCounts(Copy_u32Ticks);
+	// setting enable for ISR 
+	SET_BIT( MSYSTICK->STK_CTRL ,TICKINT);
+	//assign call back fun to global variable to pass it to handler  
+	MSTK_periodic=Copy_ptr;
+	//enable timer to move value from load reg to value reg and start counting 
+	SET_BIT( MSYSTICK->STK_CTRL ,ENABLE);
+	// this line is like a flag to check which func is called 
+	MSTK_INTERVAL_MODE=MSTK_Periodic_INTERVAL;
+}
+/**
+ * @brief Stop the ongoing interval.
+ *
+ * This function stops the SysTick timer and clears its values registers.
+ */
+void MSTK_voidStopInterval(void )
+{
+	//disable timer to stop counter from 
+	CLR_BIT( MSYSTICK->STK_CTRL ,ENABLE);
+	//deleting values in REGs (e7tyaty)(deleting it by writing any value in it)
+	MSYSTICK->STK_LOAD=0;
+	MSYSTICK->STK_VAL=0;
+}
+/**
+ * @brief Sleep (WFI) until a deadline or the first interrupt.
+ *
+ * This function loads the SysTick timer with the time left to the deadline and
+ * stops the core until its interrupt or any other enabled interrupt (USART
+ * reception, EXTI...). The interrupts are masked from the busy check to the WFI:
+ * an interrupt arriving in between stays pending, so the WFI returns at once and
+ * its handler runs when they are unmasked, it never waits for the deadline.
+ *
+ * @param Copy_u32Ticks The number of ticks to the deadline (limited to one load of the counter).
+ * @param Copy_pfIsBusy Called with the interrupts masked, the core doesn't sleep if it returns 1 (can be NULL).
+ *
+ * @note The SysTick timer must not run an interval at the same time.
+ */
+void MSTK_voidSleep(u32 Copy_u32Ticks , u8 (*Copy_pfIsBusy)(void) )
+{
+	u32 Loc_u32Counts = MSTK_u32IntervalCounts(Copy_u32Ticks);
+
+	if (Loc_u32Counts == 0)
+	{
+		return;
+	}
+	__asm volatile ("cpsid i" : : : "memory");
+	if ((Copy_pfIsBusy == NULL) || (Copy_pfIsBusy() == 0))
+	{
+		MSYSTICK->STK_LOAD=0;
+		MSYSTICK->STK_VAL=0;
+		MSYSTICK->STK_LOAD=Loc_u32Counts;
+		// the interrupt only wakes the core, there is no callback
+		MSTK_single=NULL;
+		MSTK_INTERVAL_MODE=MSTK_SINGLE_INTERVAL;
+		SET_BIT( MSYSTICK->STK_CTRL ,TICKINT);
+		SET_BIT( MSYSTICK->STK_CTRL ,ENABLE);
+
+		__asm volatile ("dsb" : : : "memory");
+		__asm volatile ("wfi");
+
+		CLR_BIT( MSYSTICK->STK_CTRL ,ENABLE);
+		CLR_BIT( MSYSTICK->STK_CTRL ,TICKINT);
+		MSYSTICK->STK_LOAD=0;
+		MSYSTICK->STK_VAL=0;
+		// woken by the deadline: nothing to run for it
+		SCB_ICSR = (1UL << PENDSTCLR);
+	}
+	__asm volatile ("cpsie i" : : : "memory");
+}
+/**
+ * @brief Get the elapsed time since the last start point.
+ *
+ * @return The elapsed time in ticks.
+ */
+u32 MSTK_u32GetElapsedTime(void) 
+{
+	u32 Loc_startingValue;
+	u32 Loc_remainingTime;
+	u32 Loc_elapsedTime;
+	//to get remaining time just read the Value Reg 
+	Loc_remainingTime = MSYSTICK->STK_VAL;
+	//read the start value 
+	Loc_startingValue = MSYSTICK->STK_LOAD;
+	//get elapsed time 
+	Loc_elapsedTime=Loc_startingValue-Loc_remainingTime;
+
+	return MSTK_u32CountsToTicks(Loc_elapsedTime);
+}
+/**
+ * @brief Get the remaining time until the next interrupt.
+ *
+ * @return The remaining time in ticks.
+ */
+u32 MSTK_u32GetRemainingTime(void) 
+{
+	u32 Loc_remainingTime;
+	//to get remaining time just read the Value Reg 
+	Loc_remainingTime=MSYSTICK->STK_VAL;
+	return MSTK_u32CountsToTicks(Loc_remainingTime);
+}
+/**
+ * @brief SysTick Timer Interrupt Service Routine (ISR).
+ *
+ * This function is called when the SysTick timer interrupt occurs.
+ * It clears the flag, disables the timer, clears the values registers, and posts the associated
+ * callback function to the deferred work queue (it runs from PendSV, not in this handler).
+ */
+void SysTick_Handler (void)
+{
+	//clearing the flag 
+	u8 Loc_readingFlag;
+	Loc_readingFlag=GET_BIT(MSYSTICK->STK_CTRL,COUNTFLAG);
+	if (MSTK_INTERVAL_MODE==MSTK_SINGLE_INTERVAL)
+	{
+		//first we have to disable timer and clearing vlaues registers and disable ISR
+		//disable timer to stop counter from 
+		CLR_BIT( MSYSTICK->STK_CTRL ,ENABLE);
+		//deleting values in REGs (e7tyaty)(deleting it by writing any value in it)
+		MSYSTICK->STK_LOAD=0;
+		MSYSTICK->STK_VAL=0;
+		//disable ISR
+		CLR_BIT( MSYSTICK->STK_CTRL ,TICKINT);
+
+		//posting callback fun to implement the action of ISR
+		if (MSTK_single!=NULL)
+		{
+			SDEF_u8Post(MSTK_voidRunCallBack, MSTK_SINGLE_INTERVAL);
+		}
+		else 
+		{
+			// error state
+		}
+	}
+		
+	else if (MSTK_INTERVAL_MODE==MSTK_Periodic_INTERVAL)
+	{
+		if (MSTK_periodic!=NULL)
+		{
+			SDEF_u8Post(MSTK_voidRunCallBack, MSTK_Periodic_INTERVAL);
+		}
+		else 
+		{
+			// error state
+		}
+	}
+}
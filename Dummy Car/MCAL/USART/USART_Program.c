@@ -1,632 +1,867 @@
-/**
- * @file USART_program.c
- *
- * @brief Implementation file for USART module.
- *
- * This file contains the implementation of USART initialization,
- * transmission, and reception functions for USART1, USART2, and USART6.
- *
- * @Author: Project Team
- *
- * @Date: November 11, 2023
- *
- */
-
-/*******************************************************************************
- *                           Standard Types                                  *
- *******************************************************************************/
-#include "../../LIB/ITI_STD_TYPES.h"
-#include "../../LIB/BIT_MATH.h"
-/*******************************************************************************
- *                          	MCAL Components                                 *
- *******************************************************************************/
-#include "USART_Interface.h"
-#include "USART_Private.h"
-#include "USART_Config.h"
-
-#define FREQ_CK  16000000UL
-
-/**
- * @brief Global variable for receiving Bluetooth orders from USART6 Interrupt.
- *        Default value is 'S', indicating the stop state.
- */
-u8 G_u8BluetoothOrder = 'S';
-
-/**
- * @brief Global variable representing the speed of Car 2 (Dummy Car).
- *        Default value is 3000.
- */
-u32 G_u32Car2_speed = 3000;
-
-/**
- * @brief Global variable indicating camera detection status.
- *        Default value is 0, indicating that the camera initially detects a person.
- */
-u8 G_u8CameraDetection = 0;
-
-/**
- * @brief Global variable indicating the status of Car 2 (Dummy Car).
- *        Default value is 0, indicating that initially, there is no car in front of the Dummy Car.
- */
-u8 G_u8Car2_status = 0;
-
-
-/**
- * @brief Initializes USART1 with the configured settings.
- *
- * This function initializes USART1 with the configured settings such as
- * baud rate, word length, stop bits, etc.
- */
-void MUSART1_voidInit(void)
-{
-	/*
-	//calculating BAUDRATE
-	f32 USARTDIV= (FREQ_CK)/((8.0*(2.0-OVER_SAMPLING_MODE)*USART1_BAUD_RATE)) ;
-
-	u16 DIV_Mantissa= (u16)USARTDIV;
-
-	f32 DIV_Fraction= (USARTDIV - DIV_Mantissa)*16.0 ;
-	//putting DIV_Mantissa in register
-	USART1->USART_BRR &=(0xFFFF000F)|(DIV_Mantissa<<4);
-	//putting DIV_Fraction in register
-	USART1->USART_BRR &=(0xFFFFFFF0)|((u16)(DIV_Fraction));
-*/
-
-	//Choosing OverSampling Mode
-#if USART1_OVER_SAMPLING_MODE ==OVER_SAMPLING_BY_8
-	SET_BIT(USART1->USART_CR1,OVER8);
-#elif USART1_OVER_SAMPLING_MODE ==OVER_SAMPLING_BY_16
-	CLR_BIT(USART1->USART_CR1,OVER8);
-#endif
-
-	//Choosing Word Length
-#if USART1_WORD_LENGTH ==_8_DATA_BITS
-	CLR_BIT(USART1->USART_CR1,M);
-#elif USART1_WORD_LENGTH ==_9_DATA_BITS
-	SET_BIT(USART1->USART_CR1,M);
-#endif
-
-	/*//Choosing Parity Enable
-#if USART1_PARITY_ENABLE_STATE ==DISABLE
-	CLR_BIT(USART1->USART_CR1,PCE);
-#elif USART1_PARITY_ENABLE_STATE ==ENABLE
-	SET_BIT(USART1->USART_CR1,PCE);
-#endif
-*/
-
-/*	//Choosing Parity Selection
-#if USART1_PARITY_SELECTION ==EVEN_PARITY
-	CLR_BIT(USART1->USART_CR1,PS);
-#elif USART1_PARITY_SELECTION ==ODD_PARITY
-	SET_BIT(USART1->USART_CR1,PS);
-#endif
-*/
-	/*//Transmition Complete Interrupt Enable
-#if USART1_TRANSMISSION_COMPLETE_INT ==DISABLE
-	CLR_BIT(USART1->USART_CR1,TCIE);
-
-#elif USART1_TRANSMISSION_COMPLETE_INT ==ENABLE
-	SET_BIT(USART1->USART_CR1,TCIE);
-#endif
-*/
-
-	//8- RECEIVING NOT EMPTY INTERRUPT ENABLE  >> receiving complete
-#if USART1_RECEIVING_COMPLETE_INT ==DISABLE
-	CLR_BIT(USART1->USART_CR1,RXNEIE);
-
-#elif USART1_RECEIVING_COMPLETE_INT ==ENABLE
-	SET_BIT(USART1->USART_CR1,RXNEIE);
-#endif
-
-	//Choosing Stop BITS
-#if USART1_STOP_BITS ==_1_STOP_BIT
-	CLR_BIT(USART1->USART_CR2,STOP);
-	CLR_BIT(USART1->USART_CR2,13);
-#elif USART1_STOP_BITS ==_2_STOP_BIT
-	CLR_BIT(USART1->USART_CR2,STOP);
-	SET_BIT(USART1->USART_CR2,13);
-#endif
-
-	//Choosing SAMPLE BIT METHOD
-#if USART1_SAMPLE_METHOD ==_3_BIT_SAMPLE_METHOD
-	CLR_BIT(USART1->USART_CR3,ONEBIT);
-#elif USART1_SAMPLE_METHOD ==_1_BIT_SAMPLE_METHOD
-	SET_BIT(USART1->USART_CR3,ONEBIT);
-#endif
-
-	//Transmitter Enable
-#if USART1_TRANSMITTER_ENABLE ==DISABLE
-	CLR_BIT(USART1->USART_CR1,TE);
-#elif USART1_TRANSMITTER_ENABLE ==ENABLE
-	SET_BIT(USART1->USART_CR1,TE);
-#endif
-
-	//receiver Enable
-#if USART1_RECIVER_ENABLE ==DISABLE
-	CLR_BIT(USART1->USART_CR1,RE);
-#elif USART1_RECIVER_ENABLE ==ENABLE
-	SET_BIT(USART1->USART_CR1,RE);
-#endif
-
-	//BAUD_RATE
-#if (USART1_BAUD_RATE == 9600)
-	USART1->USART_BRR |= 0xD06;
-#elif (USART1_BAUD_RATE == 115200)
-	USART1->USART_BRR |= 0x116;
-#elif (USART1_BAUD_RATE == 38400)
-	USART1->USART_BRR |= 0x342;
-
-#endif
-	//SEt Enable For USART
-#if USART1_STATE ==ENABLE
-	SET_BIT(USART1->USART_CR1,UE);
-//#elif USART1_STATE ==DISABLE
-	//CLR_BIT(USART1->USART_CR1,UE);
-#endif
-
-}
-/**
- * @brief Initializes USART2 with the configured settings.
- *
- * This function initializes USART2 with the configured settings such as
- * baud rate, word length, stop bits, etc.
- */
-void MUSART2_voidInit(void)
-{
-	/*
-	//calculating BAUDRATE
-	f32 USARTDIV= (FREQ_CK)/((8.0*(2.0-OVER_SAMPLING_MODE)*USART1_BAUD_RATE)) ;
-
-	u16 DIV_Mantissa= (u16)USARTDIV;
-
-	f32 DIV_Fraction= (USARTDIV - DIV_Mantissa)*16.0 ;
-	//putting DIV_Mantissa in register
-	USART2->USART_BRR &=(0xFFFF000F)|(DIV_Mantissa<<4);
-	//putting DIV_Fraction in register
-	USART2->USART_BRR &=(0xFFFFFFF0)|((u16)(DIV_Fraction));
-*/
-
-	//Choosing OverSampling Mode
-#if USART2_OVER_SAMPLING_MODE ==OVER_SAMPLING_BY_8
-	SET_BIT(USART2->USART_CR1,OVER8);
-#elif USART2_OVER_SAMPLING_MODE ==OVER_SAMPLING_BY_16
-	CLR_BIT(USART2->USART_CR1,OVER8);
-#endif
-
-	//Choosing Word Length
-#if USART2_WORD_LENGTH ==_8_DATA_BITS
-	CLR_BIT(USART2->USART_CR1,M);
-#elif USART2_WORD_LENGTH ==_9_DATA_BITS
-	SET_BIT(USART2->USART_CR1,M);
-#endif
-
-	/*//Choosing Parity Enable
-#if USART2_PARITY_ENABLE_STATE ==DISABLE
-	CLR_BIT(USART2->USART_CR1,PCE);
-#elif USART2_PARITY_ENABLE_STATE ==ENABLE
-	SET_BIT(USART2->USART_CR1,PCE);
-#endif
-*/
-
-/*	//Choosing Parity Selection
-#if USART2_PARITY_SELECTION ==EVEN_PARITY
-	CLR_BIT(USART2->USART_CR1,PS);
-#elif USART2_PARITY_SELECTION ==ODD_PARITY
-	SET_BIT(USART2>USART_CR1,PS);
-#endif
-*/
-	/*//Transmition Complete Interrupt Enable
-#if USART2_TRANSMISSION_COMPLETE_INT ==DISABLE
-	CLR_BIT(USART2->USART_CR1,TCIE);
-
-#elif USART2_TRANSMISSION_COMPLETE_INT ==ENABLE
-	SET_BIT(USART2->USART_CR1,TCIE);
-#endif
-*/
-
-	//8- RECEIVING NOT EMPTY INTERRUPT ENABLE  >> receiving complete
-#if USART2_RECEIVING_COMPLETE_INT ==DISABLE
-	CLR_BIT(USART2->USART_CR1,RXNEIE);
-
-#elif USART2_RECEIVING_COMPLETE_INT ==ENABLE
-	SET_BIT(USART2->USART_CR1,RXNEIE);
-#endif
-
-	//Choosing Stop BITS
-#if USART2_STOP_BITS ==_1_STOP_BIT
-	CLR_BIT(USART2->USART_CR2,STOP);
-	CLR_BIT(USART2->USART_CR2,13);
-#elif USART2_STOP_BITS ==_2_STOP_BIT
-	CLR_BIT(USART2->USART_CR2,STOP);
-	SET_BIT(USART2->USART_CR2,13);
-#endif
-
-	//Choosing SAMPLE BIT METHOD
-#if USART2_SAMPLE_METHOD ==_3_BIT_SAMPLE_METHOD
-	CLR_BIT(USART2->USART_CR3,ONEBIT);
-#elif USART2_SAMPLE_METHOD ==_1_BIT_SAMPLE_METHOD
-	SET_BIT(USART2->USART_CR3,ONEBIT);
-#endif
-
-	//Transmitter Enable
-#if USART2_TRANSMITTER_ENABLE ==DISABLE
-	CLR_BIT(USART2->USART_CR1,TE);
-#elif USART2_TRANSMITTER_ENABLE ==ENABLE
-	SET_BIT(USART2->USART_CR1,TE);
-#endif
-
-	//receiver Enable
-#if USART2_RECIVER_ENABLE ==DISABLE
-	CLR_BIT(USART2->USART_CR1,RE);
-#elif USART2_RECIVER_ENABLE ==ENABLE
-	SET_BIT(USART2->USART_CR1,RE);
-#endif
-
-	//BAUD_RATE
-#if (USART2_BAUD_RATE == 9600)
-	USART2->USART_BRR |= 0xD06;
-#elif (USART2_BAUD_RATE == 115200)
-	USART2->USART_BRR |= 0x116;
-#elif (USART2_BAUD_RATE == 38400)
-	USART2->USART_BRR |= 0x342;
-
-#endif
-	//SEt Enable For USART
-#if USART2_STATE ==ENABLE
-	SET_BIT(USART2->USART_CR1,UE);
-//#elif USART2_STATE ==DISABLE
-	//CLR_BIT(USART2->USART_CR1,UE);
-#endif
-
-}
-/**
- * @brief Initializes USART6 with the configured settings.
- *
- * This function initializes USART6 with the configured settings such as
- * baud rate, word length, stop bits, etc.
- */
-void MUSART6_voidInit(void)
-{
-
-	//Choosing OverSampling Mode
-#if USART6_OVER_SAMPLING_MODE ==OVER_SAMPLING_BY_8
-	SET_BIT(USART6->USART_CR1,OVER8);
-#elif USART6_OVER_SAMPLING_MODE ==OVER_SAMPLING_BY_16
-	CLR_BIT(USART6->USART_CR1,OVER8);
-#endif
-
-	//Choosing Word Length
-#if USART6_WORD_LENGTH ==_8_DATA_BITS
-	CLR_BIT(USART6->USART_CR1,M);
-#elif USART6_WORD_LENGTH ==_9_DATA_BITS
-	SET_BIT(USART6->USART_CR1,M);
-#endif
-
-	/*//Choosing Parity Enable
-#if USART6_PARITY_ENABLE_STATE ==DISABLE
-	CLR_BIT(USART6->USART_CR1,PCE);
-#elif USART6_PARITY_ENABLE_STATE ==ENABLE
-	SET_BIT(USART6->USART_CR1,PCE);
-#endif
-*/
-/*
-	//Choosing Parity Selection
-#if USART6_PARITY_SELECTION ==EVEN_PARITY
-	CLR_BIT(USART6->USART_CR1,PS);
-#elif USART6_PARITY_SELECTION ==ODD_PARITY
-	SET_BIT(USART6>USART_CR1,PS);
-#endif
-*/
-
-	//Transmition Complete Interrupt Enable
-#if USART6_TRANSMISSION_COMPLETE_INT ==DISABLE
-	CLR_BIT(USART6->USART_CR1,TCIE);
-
-#elif USART6_TRANSMISSION_COMPLETE_INT ==ENABLE
-	SET_BIT(USART6->USART_CR1,TCIE);
-#endif
-
-
-	//8- RECEIVING NOT EMPTY INTERRUPT ENABLE  >> receiving complete
-#if USART6_RECEIVING_COMPLETE_INT ==DISABLE
-	CLR_BIT(USART6->USART_CR1,RXNEIE);
-
-#elif USART6_RECEIVING_COMPLETE_INT ==ENABLE
-	SET_BIT(USART6->USART_CR1,RXNEIE);
-#endif
-
-	//Choosing Stop BITS
-#if USART6_STOP_BITS ==_1_STOP_BIT
-	CLR_BIT(USART6->USART_CR2,STOP);
-	CLR_BIT(USART6->USART_CR2,13);
-#elif USART6_STOP_BITS ==_2_STOP_BIT
-	CLR_BIT(USART6->USART_CR2,STOP);
-	SET_BIT(USART6->USART_CR2,13);
-#endif
-
-	//Choosing SAMPLE BIT METHOD
-#if USART6_SAMPLE_METHOD ==_3_BIT_SAMPLE_METHOD
-	CLR_BIT(USART6->USART_CR3,ONEBIT);
-#elif USART6_SAMPLE_METHOD ==_1_BIT_SAMPLE_METHOD
-	SET_BIT(USART6->USART_CR3,ONEBIT);
-#endif
-
-	//Transmitter Enable
-#if USART6_TRANSMITTER_ENABLE ==DISABLE
-	CLR_BIT(USART6->USART_CR1,TE);
-#elif USART6_TRANSMITTER_ENABLE ==ENABLE
-	SET_BIT(USART6->USART_CR1,TE);
-#endif
-
-	//receiver Enable
-#if USART6_RECIVER_ENABLE ==DISABLE
-	CLR_BIT(USART6->USART_CR1,RE);
-#elif USART6_RECIVER_ENABLE ==ENABLE
-	SET_BIT(USART6->USART_CR1,RE);
-#endif
-
-	//BAUD_RATE
-#if (USART6_BAUD_RATE == 9600)
-	USART6->USART_BRR |= 0xD06;
-#elif (USART6_BAUD_RATE == 115200)
-	USART6->USART_BRR |= 0x116;
-#elif (USART6_BAUD_RATE == 38400)
-	USART6->USART_BRR |= 0x342;
-
-#endif
-	//SEt Enable For USART
-#if USART6_STATE ==ENABLE
-	SET_BIT(USART6->USART_CR1,UE);
-//#elif USART6_STATE ==DISABLE
-	//CLR_BIT(USART6->USART_CR1,UE);
-#endif
-
-}
-/**
- * @brief Transmits a byte of data through USART1.
- *
- * This function transmits a byte of data through USART1.
- *
- * @param Copy_u8Data: The data byte to be transmitted.
- */
-void MUSART1_voidTransmitData(u8 Copy_u8Data)
-{
-	// Check if data reg is empty
-	while (GET_BIT(USART1->USART_SR,TXE)==0);
-	//Clearing Flag
-	//CLR_BIT(USART1->USART_SR,TXE);
-	//sending data to data reg
-	USART1->USART_DR=Copy_u8Data;
-	//Check if Transmission Completed
-	while (GET_BIT(USART1->USART_SR,TC)==0);
-	//Clearing Flag
-	CLR_BIT(USART1->USART_SR,TC);
-}
-/**
- * @brief Transmits a byte of data through USART2.
- *
- * This function transmits a byte of data through USART2.
- *
- * @param Copy_u8Data: The data byte to be transmitted.
- */
-void MUSART2_voidTransmitData(u8 Copy_u8Data)
-{
-	// Check if data reg is empty
-	while (GET_BIT(USART2->USART_SR,TXE)==0);
-	//Clearing Flag
-	//CLR_BIT(USART2->USART_SR,TXE);
-	//sending data to data reg
-	USART2->USART_DR=Copy_u8Data;
-	//Check if Transmission Completed
-	while (GET_BIT(USART2->USART_SR,TC)==0);
-	//Clearing Flag
-	CLR_BIT(USART2->USART_SR,TC);
-}
-/**
- * @brief Transmits a byte of data through USART6.
- *
- * This function transmits a byte of data through USART6.
- *
- * @param Copy_u8Data: The data byte to be transmitted.
- */
-void MUSART6_voidTransmitData(u8 Copy_u8Data)
-{
-	// Check if data reg is empty
-	while (GET_BIT(USART6->USART_SR,TXE)==0);
-	//Clearing Flag
-	//CLR_BIT(USART6->USART_SR,TXE);
-	//sending data to data reg
-	USART6->USART_DR=Copy_u8Data;
-	//Check if Transmission Completed
-	while (GET_BIT(USART6->USART_SR,TC)==0);
-	//Clearing Flag
-	CLR_BIT(USART6->USART_SR,TC);
-}
-/**
- * @brief Receives a byte of data through USART1.
- *
- * This function receives a byte of data through USART1.
- *
- * @return The received data byte.
- */
-u8 MUSART1_u8ReciveData(void)
-{
-	// Check if data reg isn't empty
-
-	while (GET_BIT(USART1->USART_SR,RXNE)==0);
-	//Clearing Flag
-	CLR_BIT(USART1->USART_SR,RXNE);
-
-	return (u8)USART1->USART_DR;
-}
-/**
- * @brief Receives a byte of data through USART2.
- *
- * This function receives a byte of data through USART2.
- *
- * @return The received data byte.
- */
-u8 MUSART2_u8ReciveData(void)
-{
-	// Check if data reg isn't empty
-	while (GET_BIT(USART2->USART_SR,RXNE)==0);
-	//Clearing Flag
-	CLR_BIT(USART2->USART_SR,RXNE);
-
-	return (u8)USART2->USART_DR;
-}
-/**
- * @brief Receives a byte of data through USART6.
- *
- * This function receives a byte of data through USART6.
- *
- * @return The received data byte.
- */
-u8 MUSART6_u8ReciveData(void)
-{
-	// Check if data reg isn't empty
-
-	while (GET_BIT(USART6->USART_SR,RXNE)==0);
-	//Clearing Flag
-	CLR_BIT(USART6->USART_SR,RXNE);
-
-	return (u8)USART6->USART_DR;
-}
-/**
- * @brief Sends a string through USART1.
- *
- * This function sends a null-terminated string through USART1.
- *
- * @param PC_String: Pointer to the string to be transmitted.
- */
-void MUSART1_voidSendString(u8* PC_String)
-{
-	u8 Loc_u8Iterator;
-	for (Loc_u8Iterator=0 ; PC_String[Loc_u8Iterator] != '\0'; Loc_u8Iterator++)
-	{
-		MUSART1_voidTransmitData(PC_String[Loc_u8Iterator]);
-	}
-	MUSART1_voidTransmitData('\0');
-
-}
-/**
- * @brief Sends a string through USART2.
- *
- * This function sends a null-terminated string through USART2.
- *
- * @param PC_String: Pointer to the string to be transmitted.
- */
-void MUSART2_voidSendString(u8* PC_String)
-{
-	u8 Loc_u8Iterator;
-	for (Loc_u8Iterator=0 ; PC_String[Loc_u8Iterator] != '\0'; Loc_u8Iterator++)
-	{
-		MUSART2_voidTransmitData(PC_String[Loc_u8Iterator]);
-	}
-	MUSART2_voidTransmitData('\0');
-}
-/**
- * @brief Sends a string through USART6.
- *
- * This function sends a null-terminated string through USART6.
- *
- * @param PC_String: Pointer to the string to be transmitted.
- */
-void MUSART6_voidSendString(u8* PC_String)
-{
-	u8 Loc_u8Iterator;
-	for (Loc_u8Iterator=0 ; PC_String[Loc_u8Iterator] != '\0'; Loc_u8Iterator++)
-	{
-		MUSART6_voidTransmitData(PC_String[Loc_u8Iterator]);
-	}
-	MUSART6_voidTransmitData('\0');
-}
-/**
- * @brief Receives a string through USART1.
- *
- * This function receives a null-terminated string through USART1.
- *
- * @param PC_String: Pointer to the buffer where the received string will be stored.
- */
-void MUSART1_voidReciveString(u8* PC_String)
-{
-	u8 Loc_u8Iterator;
-	u8 Loc_RecivedData = MUSART1_u8ReciveData();
-	for (Loc_u8Iterator=0 ; Loc_RecivedData!='\0' ; Loc_u8Iterator++ )
-	{
-		PC_String[Loc_u8Iterator]=MUSART1_u8ReciveData();
-		Loc_RecivedData = MUSART1_u8ReciveData();
-	}
-}
-/**
- * @brief Receives a string through USART2.
- *
- * This function receives a null-terminated string through USART2.
- *
- * @param PC_String: Pointer to the buffer where the received string will be stored.
- */
-void MUSART2_voidReciveString(u8* PC_String)
-{
-	u8 Loc_u8Iterator;
-	u8 Loc_RecivedData = MUSART2_u8ReciveData();
-	for (Loc_u8Iterator=0 ; Loc_RecivedData!='\0' ; Loc_u8Iterator++ )
-	{
-		PC_String[Loc_u8Iterator]=MUSART2_u8ReciveData();
-		Loc_RecivedData = MUSART2_u8ReciveData();
-	}
-}
-/**
- * @brief Receives a string through USART6.
- *
- * This function receives a null-terminated string through USART6.
- *
- * @param PC_String: Pointer to the buffer where the received string will be stored.
- */
-void MUSART6_voidReciveString(u8* PC_String)
-{
-	u8 Loc_u8Iterator;
-	u8 Loc_RecivedData = MUSART6_u8ReciveData();
-	for (Loc_u8Iterator=0 ; Loc_RecivedData!='\0' ; Loc_u8Iterator++ )
-	{
-		PC_String[Loc_u8Iterator]=MUSART6_u8ReciveData();
-		Loc_RecivedData = MUSART6_u8ReciveData();
-	}
-}
-
-/**
- * @brief USART1 interrupt handler.
- *
- * This function is the interrupt handler for USART1. It is currently empty
- * and can be expanded with specific functionality if needed.
- */
-void USART1_IRQHandler(void)
-{
-	G_u8ReceivedRequest = MUSART1_u8ReciveData();
-}
-/**
- * @brief USART2 interrupt handler.
- *
- * This function is the interrupt handler for USART2. It is currently empty
- * and can be expanded with specific functionality if needed.
- */
-
-void USART2_IRQHandler(void)
-{
-
-
-}
-
-/**
- * @brief USART6 interrupt handler.
- *
- * This function is the interrupt handler for USART6. It currently reads a
- * byte from USART6 and assigns it to the global variable G_u8BluetoothOrder.
- */
-void USART6_IRQHandler(void)
-{
-	G_u8BluetoothOrder = MUSART6_u8ReciveData();
-}
-
-
-
-
+/**
+ * @file USART_program.c
+ *
+ * @brief Implementation file for USART module.
+ *
+ * This file contains the implementation of USART initialization,
+ * transmission, and reception functions for USART1, USART2, and USART6.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ */
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "USART_Interface.h"
+#include "USART_Private.h"
+#include "USART_Config.h"
+#include "../RCC/RCC_Interface.h"
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../../SERVICE/Trace/Trace_Interface.h"
+
+/**
+ * @brief Global variable for receiving Bluetooth orders from USART6 Interrupt.
+ *        Default value is 'S', indicating the stop state.
+ */
+u8 G_u8BluetoothOrder = 'S';
+
+/**
+ * @brief Global variable representing the speed of Car 2 (Dummy Car).
+ *        Default value is 3000.
+ */
+u32 G_u32Car2_speed = 3000;
+
+/**
+ * @brief Global variable indicating the status of Car 2 (Dummy Car).
+ *        Default value is 0, indicating that initially, there is no car in front of the Dummy Car.
+ */
+u8 G_u8Car2_status = 0;
+
+/**
+ * @brief USART1 software FIFOs (Raspberry link).
+ *
+ * The receive FIFO is filled by USART1_IRQHandler and emptied by MUSART1_u8ReciveData(),
+ * the transmit FIFO is filled by the application and emptied by the TXE interrupt.
+ * Each FIFO has a single producer and a single consumer, so the free running u8
+ * indexes are enough and no interrupt masking is needed (the sizes divide 256).
+ *
+ * The urgent FIFO is sent first, but only between two blocks of the normal FIFO
+ * so a frame is never cut: the first byte of every queued block is marked.
+ */
+static volatile u8 MUSART1_Au8RxBuffer[USART1_RX_BUFFER_SIZE];
+static volatile u8 MUSART1_u8RxHead = 0;
+static volatile u8 MUSART1_u8RxTail = 0;
+static volatile u8 MUSART1_Au8TxBuffer[USART1_TX_BUFFER_SIZE];
+static volatile u8 MUSART1_Au8TxBlockStart[USART1_TX_BUFFER_SIZE / 8];
+static volatile u8 MUSART1_u8TxHead = 0;
+static volatile u8 MUSART1_u8TxTail = 0;
+static volatile u8 MUSART1_Au8TxUrgentBuffer[USART1_TX_URGENT_BUFFER_SIZE];
+static volatile u8 MUSART1_u8TxUrgentHead = 0;
+static volatile u8 MUSART1_u8TxUrgentTail = 0;
+
+/**
+ * @brief USART1 receive hooks, see MUSART1_u8AddRxCallBack().
+ */
+static u8 (*MUSART1_ApfRxCallBack[USART1_RX_HOOKS])(u8 Copy_u8Data);
+static volatile u8 MUSART1_u8RxHooks = 0;
+
+
+/**
+ * @brief Computes the BRR value of a baud rate from the clock of the USART bus.
+ *
+ * USARTDIV = f(PCLK) / (8 * (2 - OVER8) * baud rate), rounded to the nearest
+ * 1/16 (1/8 with OVER8, the fraction is then 3 bits wide).
+ *
+ * @param Copy_u32ClkHz Clock of the APB bus of the USART in Hz.
+ * @param Copy_u32BaudRate Baud rate.
+ * @param Copy_u8OverSampling OVER_SAMPLING_BY_16 or OVER_SAMPLING_BY_8.
+ * @return The value of the USART_BRR register.
+ */
+static u32 MUSART_u32CalcBRR(u32 Copy_u32ClkHz, u32 Copy_u32BaudRate, u8 Copy_u8OverSampling)
+{
+	/* USARTDIV in 1/16 (or 1/8) units */
+	u32 Loc_u32Div = (Copy_u32ClkHz + (Copy_u32BaudRate / 2)) / Copy_u32BaudRate;
+
+	if (Copy_u8OverSampling == OVER_SAMPLING_BY_8)
+	{
+		Loc_u32Div = ((Loc_u32Div >> 3) << 4) | (Loc_u32Div & 0x7);
+	}
+	return Loc_u32Div;
+}
+
+/**
+ * @brief Loads a new BRR in a running USART without breaking a byte being sent.
+ *
+ * The TXE interrupt is held while the last byte completes, so the FIFO doesn't
+ * start a new one with the old divisor. A USART that is not enabled (or not
+ * clocked) is left alone.
+ */
+static void MUSART_voidReloadBRR(volatile USART * P_Usart, u32 Copy_u32BRR)
+{
+	u8 Loc_u8TxeInt;
+
+	if (GET_BIT(P_Usart->USART_CR1, UE) == 0)
+	{
+		return;
+	}
+	Loc_u8TxeInt = GET_BIT(P_Usart->USART_CR1, TXEIE);
+	CLR_BIT(P_Usart->USART_CR1, TXEIE);
+	while (GET_BIT(P_Usart->USART_SR, TC) == 0);
+	P_Usart->USART_BRR = Copy_u32BRR;
+	if (Loc_u8TxeInt)
+	{
+		SET_BIT(P_Usart->USART_CR1, TXEIE);
+	}
+}
+
+/**
+ * @brief Initializes USART1 with the configured settings.
+ *
+ * This function initializes USART1 with the configured settings such as
+ * baud rate, word length, stop bits, etc.
+ */
+void MUSART1_voidInit(void)
+{
+	//Choosing OverSampling Mode
+#if USART1_OVER_SAMPLING_MODE ==OVER_SAMPLING_BY_8
+	SET_BIT(USART1->USART_CR1,OVER8);
+#elif USART1_OVER_SAMPLING_MODE ==OVER_SAMPLING_BY_16
+	CLR_BIT(USART1->USART_CR1,OVER8);
+#endif
+
+	//Choosing Word Length
+#if USART1_WORD_LENGTH ==_8_DATA_BITS
+	CLR_BIT(USART1->USART_CR1,M);
+#elif USART1_WORD_LENGTH ==_9_DATA_BITS
+	SET_BIT(USART1->USART_CR1,M);
+#endif
+
+	/*//Choosing Parity Enable
+#if USART1_PARITY_ENABLE_STATE ==DISABLE
+	CLR_BIT(USART1->USART_CR1,PCE);
+#elif USART1_PARITY_ENABLE_STATE ==ENABLE
+	SET_BIT(USART1->USART_CR1,PCE);
+#endif
+*/
+
+/*	//Choosing Parity Selection
+#if USART1_PARITY_SELECTION ==EVEN_PARITY
+	CLR_BIT(USART1->USART_CR1,PS);
+#elif USART1_PARITY_SELECTION ==ODD_PARITY
+	SET_BIT(USART1->USART_CR1,PS);
+#endif
+*/
+	/*//Transmition Complete Interrupt Enable
+#if USART1_TRANSMISSION_COMPLETE_INT ==DISABLE
+	CLR_BIT(USART1->USART_CR1,TCIE);
+
+#elif USART1_TRANSMISSION_COMPLETE_INT ==ENABLE
+	SET_BIT(USART1->USART_CR1,TCIE);
+#endif
+*/
+
+	//8- RECEIVING NOT EMPTY INTERRUPT ENABLE  >> receiving complete
+#if USART1_RECEIVING_COMPLETE_INT ==DISABLE
+	CLR_BIT(USART1->USART_CR1,RXNEIE);
+
+#elif USART1_RECEIVING_COMPLETE_INT ==ENABLE
+	SET_BIT(USART1->USART_CR1,RXNEIE);
+#endif
+
+	//Choosing Stop BITS
+#if USART1_STOP_BITS ==_1_STOP_BIT
+	CLR_BIT(USART1->USART_CR2,STOP);
+	CLR_BIT(USART1->USART_CR2,13);
+#elif USART1_STOP_BITS ==_2_STOP_BIT
+	CLR_BIT(USART1->USART_CR2,STOP);
+	SET_BIT(USART1->USART_CR2,13);
+#endif
+
+	//Choosing SAMPLE BIT METHOD
+#if USART1_SAMPLE_METHOD ==_3_BIT_SAMPLE_METHOD
+	CLR_BIT(USART1->USART_CR3,ONEBIT);
+#elif USART1_SAMPLE_METHOD ==_1_BIT_SAMPLE_METHOD
+	SET_BIT(USART1->USART_CR3,ONEBIT);
+#endif
+
+	//Transmitter Enable
+#if USART1_TRANSMITTER_ENABLE ==DISABLE
+	CLR_BIT(USART1->USART_CR1,TE);
+#elif USART1_TRANSMITTER_ENABLE ==ENABLE
+	SET_BIT(USART1->USART_CR1,TE);
+#endif
+
+	//receiver Enable
+#if USART1_RECIVER_ENABLE ==DISABLE
+	CLR_BIT(USART1->USART_CR1,RE);
+#elif USART1_RECIVER_ENABLE ==ENABLE
+	SET_BIT(USART1->USART_CR1,RE);
+#endif
+
+	//BAUD_RATE (from the clock of the APB2 bus)
+	USART1->USART_BRR = MUSART_u32CalcBRR(MRCC_u32GetApb2Clk(), USART1_BAUD_RATE, USART1_OVER_SAMPLING_MODE);
+	//SEt Enable For USART
+#if USART1_STATE ==ENABLE
+	SET_BIT(USART1->USART_CR1,UE);
+//#elif USART1_STATE ==DISABLE
+	//CLR_BIT(USART1->USART_CR1,UE);
+#endif
+
+}
+/**
+ * @brief Initializes USART2 with the configured settings.
+ *
+ * This function initializes USART2 with the configured settings such as
+ * baud rate, word length, stop bits, etc.
+ */
+void MUSART2_voidInit(void)
+{
+	//Choosing OverSampling Mode
+#if USART2_OVER_SAMPLING_MODE ==OVER_SAMPLING_BY_8
+	SET_BIT(USART2->USART_CR1,OVER8);
+#elif USART2_OVER_SAMPLING_MODE ==OVER_SAMPLING_BY_16
+	CLR_BIT(USART2->USART_CR1,OVER8);
+#endif
+
+	//Choosing Word Length
+#if USART2_WORD_LENGTH ==_8_DATA_BITS
+	CLR_BIT(USART2->USART_CR1,M);
+#elif USART2_WORD_LENGTH ==_9_DATA_BITS
+	SET_BIT(USART2->USART_CR1,M);
+#endif
+
+	/*//Choosing Parity Enable
+#if USART2_PARITY_ENABLE_STATE ==DISABLE
+	CLR_BIT(USART2->USART_CR1,PCE);
+#elif USART2_PARITY_ENABLE_STATE ==ENABLE
+	SET_BIT(USART2->USART_CR1,PCE);
+#endif
+*/
+
+/*	//Choosing Parity Selection
+#if USART2_PARITY_SELECTION ==EVEN_PARITY
+	CLR_BIT(USART2->USART_CR1,PS);
+#elif USART2_PARITY_SELECTION ==ODD_PARITY
+	SET_BIT(USART2>USART_CR1,PS);
+#endif
+*/
+	/*//Transmition Complete Interrupt Enable
+#if USART2_TRANSMISSION_COMPLETE_INT ==DISABLE
+	CLR_BIT(USART2->USART_CR1,TCIE);
+
+#elif USART2_TRANSMISSION_COMPLETE_INT ==ENABLE
+	SET_BIT(USART2->USART_CR1,TCIE);
+#endif
+*/
+
+	//8- RECEIVING NOT EMPTY INTERRUPT ENABLE  >> receiving complete
+#if USART2_RECEIVING_COMPLETE_INT ==DISABLE
+	CLR_BIT(USART2->USART_CR1,RXNEIE);
+
+#elif USART2_RECEIVING_COMPLETE_INT ==ENABLE
+	SET_BIT(USART2->USART_CR1,RXNEIE);
+#endif
+
+	//Choosing Stop BITS
+#if USART2_STOP_BITS ==_1_STOP_BIT
+	CLR_BIT(USART2->USART_CR2,STOP);
+	CLR_BIT(USART2->USART_CR2,13);
+#elif USART2_STOP_BITS ==_2_STOP_BIT
+	CLR_BIT(USART2->USART_CR2,STOP);
+	SET_BIT(USART2->USART_CR2,13);
+#endif
+
+	//Choosing SAMPLE BIT METHOD
+#if USART2_SAMPLE_METHOD ==_3_BIT_SAMPLE_METHOD
+	CLR_BIT(USART2->USART_CR3,ONEBIT);
+#elif USART2_SAMPLE_METHOD ==_1_BIT_SAMPLE_METHOD
+	SET_BIT(USART2->USART_CR3,ONEBIT);
+#endif
+
+	//Transmitter Enable
+#if USART2_TRANSMITTER_ENABLE ==DISABLE
+	CLR_BIT(USART2->USART_CR1,TE);
+#elif USART2_TRANSMITTER_ENABLE ==ENABLE
+	SET_BIT(USART2->USART_CR1,TE);
+#endif
+
+	//receiver Enable
+#if USART2_RECIVER_ENABLE ==DISABLE
+	CLR_BIT(USART2->USART_CR1,RE);
+#elif USART2_RECIVER_ENABLE ==ENABLE
+	SET_BIT(USART2->USART_CR1,RE);
+#endif
+
+	//BAUD_RATE (from the clock of the APB1 bus)
+	USART2->USART_BRR = MUSART_u32CalcBRR(MRCC_u32GetApb1Clk(), USART2_BAUD_RATE, USART2_OVER_SAMPLING_MODE);
+	//SEt Enable For USART
+#if USART2_STATE ==ENABLE
+	SET_BIT(USART2->USART_CR1,UE);
+//#elif USART2_STATE ==DISABLE
+	//CLR_BIT(USART2->USART_CR1,UE);
+#endif
+
+}
+/**
+ * @brief Initializes USART6 with the configured settings.
+ *
+ * This function initializes USART6 with the configured settings such as
+ * baud rate, word length, stop bits, etc.
+ */
+void MUSART6_voidInit(void)
+{
+
+	//Choosing OverSampling Mode
+#if USART6_OVER_SAMPLING_MODE ==OVER_SAMPLING_BY_8
+	SET_BIT(USART6->USART_CR1,OVER8);
+#elif USART6_OVER_SAMPLING_MODE ==OVER_SAMPLING_BY_16
+	CLR_BIT(USART6->USART_CR1,OVER8);
+#endif
+
+	//Choosing Word Length
+#if USART6_WORD_LENGTH ==_8_DATA_BITS
+	CLR_BIT(USART6->USART_CR1,M);
+#elif USART6_WORD_LENGTH ==_9_DATA_BITS
+	SET_BIT(USART6->USART_CR1,M);
+#endif
+
+	/*//Choosing Parity Enable
+#if USART6_PARITY_ENABLE_STATE ==DISABLE
+	CLR_BIT(USART6->USART_CR1,PCE);
+#elif USART6_PARITY_ENABLE_STATE ==ENABLE
+	SET_BIT(USART6->USART_CR1,PCE);
+#endif
+*/
+/*
+	//Choosing Parity Selection
+#if USART6_PARITY_SELECTION ==EVEN_PARITY
+	CLR_BIT(USART6->USART_CR1,PS);
+#elif USART6_PARITY_SELECTION ==ODD_PARITY
+	SET_BIT(USART6>USART_CR1,PS);
+#endif
+*/
+
+	//Transmition Complete Interrupt Enable
+#if USART6_TRANSMISSION_COMPLETE_INT ==DISABLE
+	CLR_BIT(USART6->USART_CR1,TCIE);
+
+#elif USART6_TRANSMISSION_COMPLETE_INT ==ENABLE
+	SET_BIT(USART6->USART_CR1,TCIE);
+#endif
+
+
+	//8- RECEIVING NOT EMPTY INTERRUPT ENABLE  >> receiving complete
+#if USART6_RECEIVING_COMPLETE_INT ==DISABLE
+	CLR_BIT(USART6->USART_CR1,RXNEIE);
+
+#elif USART6_RECEIVING_COMPLETE_INT ==ENABLE
+	SET_BIT(USART6->USART_CR1,RXNEIE);
+#endif
+
+	//Choosing Stop BITS
+#if USART6_STOP_BITS ==_1_STOP_BIT
+	CLR_BIT(USART6->USART_CR2,STOP);
+	CLR_BIT(USART6->USART_CR2,13);
+#elif USART6_STOP_BITS ==_2_STOP_BIT
+	CLR_BIT(USART6->USART_CR2,STOP);
+	SET_BIT(USART6->USART_CR2,13);
+#endif
+
+	//Choosing SAMPLE BIT METHOD
+#if USART6_SAMPLE_METHOD ==_3_BIT_SAMPLE_METHOD
+	CLR_BIT(USART6->USART_CR3,ONEBIT);
+#elif USART6_SAMPLE_METHOD ==_1_BIT_SAMPLE_METHOD
+	SET_BIT(USART6->USART_CR3,ONEBIT);
+#endif
+
+	//Transmitter Enable
+#if USART6_TRANSMITTER_ENABLE ==DISABLE
+	CLR_BIT(USART6->USART_CR1,TE);
+#elif USART6_TRANSMITTER_ENABLE ==ENABLE
+	SET_BIT(USART6->USART_CR1,TE);
+#endif
+
+	//receiver Enable
+#if USART6_RECIVER_ENABLE ==DISABLE
+	CLR_BIT(USART6->USART_CR1,RE);
+#elif USART6_RECIVER_ENABLE ==ENABLE
+	SET_BIT(USART6->USART_CR1,RE);
+#endif
+
+	//BAUD_RATE (from the clock of the APB2 bus)
+	USART6->USART_BRR = MUSART_u32CalcBRR(MRCC_u32GetApb2Clk(), USART6_BAUD_RATE, USART6_OVER_SAMPLING_MODE);
+	//SEt Enable For USART
+#if USART6_STATE ==ENABLE
+	SET_BIT(USART6->USART_CR1,UE);
+//#elif USART6_STATE ==DISABLE
+	//CLR_BIT(USART6->USART_CR1,UE);
+#endif
+
+}
+/**
+ * @brief Follows a change of the clock tree.
+ *
+ * The baud rate divisors of the enabled USARTs are computed again from the
+ * new APB clocks. A byte received during the switch may be lost.
+ */
+void MUSART_voidUpdateClock(void)
+{
+	MUSART_voidReloadBRR(USART1, MUSART_u32CalcBRR(MRCC_u32GetApb2Clk(), USART1_BAUD_RATE, USART1_OVER_SAMPLING_MODE));
+	MUSART_voidReloadBRR(USART2, MUSART_u32CalcBRR(MRCC_u32GetApb1Clk(), USART2_BAUD_RATE, USART2_OVER_SAMPLING_MODE));
+	MUSART_voidReloadBRR(USART6, MUSART_u32CalcBRR(MRCC_u32GetApb2Clk(), USART6_BAUD_RATE, USART6_OVER_SAMPLING_MODE));
+}
+
+/**
+ * @brief Transmits a byte of data through USART1.
+ *
+ * This function transmits a byte of data through USART1.
+ *
+ * @param Copy_u8Data: The data byte to be transmitted.
+ */
+void MUSART1_voidTransmitData(u8 Copy_u8Data)
+{
+	// the byte goes through the transmit FIFO so it can't cut a queued frame,
+	// wait only while the FIFO is full
+	while (MUSART1_u8QueueData(&Copy_u8Data,1) != OK);
+	//recording the byte sent to the Raspberry (handshake / V2V data)
+	STRACE_voidLog(STRACE_EVT_LINK_TX, 1, Copy_u8Data);
+}
+/**
+ * @brief Transmits a byte of data through USART2.
+ *
+ * This function transmits a byte of data through USART2.
+ *
+ * @param Copy_u8Data: The data byte to be transmitted.
+ */
+void MUSART2_voidTransmitData(u8 Copy_u8Data)
+{
+	// Check if data reg is empty
+	while (GET_BIT(USART2->USART_SR,TXE)==0);
+	//Clearing Flag
+	//CLR_BIT(USART2->USART_SR,TXE);
+	//sending data to data reg
+	USART2->USART_DR=Copy_u8Data;
+	//Check if Transmission Completed
+	while (GET_BIT(USART2->USART_SR,TC)==0);
+	//Clearing Flag
+	CLR_BIT(USART2->USART_SR,TC);
+}
+/**
+ * @brief Transmits a byte of data through USART6.
+ *
+ * This function transmits a byte of data through USART6.
+ *
+ * @param Copy_u8Data: The data byte to be transmitted.
+ */
+void MUSART6_voidTransmitData(u8 Copy_u8Data)
+{
+	// Check if data reg is empty
+	while (GET_BIT(USART6->USART_SR,TXE)==0);
+	//Clearing Flag
+	//CLR_BIT(USART6->USART_SR,TXE);
+	//sending data to data reg
+	USART6->USART_DR=Copy_u8Data;
+	//Check if Transmission Completed
+	while (GET_BIT(USART6->USART_SR,TC)==0);
+	//Clearing Flag
+	CLR_BIT(USART6->USART_SR,TC);
+}
+/**
+ * @brief Receives a byte of data through USART1.
+ *
+ * This function receives a byte of data through USART1.
+ *
+ * @return The received data byte.
+ */
+u8 MUSART1_u8ReciveData(void)
+{
+	u8 Loc_u8Data;
+#if USART1_RECEIVING_COMPLETE_INT ==ENABLE
+	// the receiving interrupt reads the data reg, wait for the FIFO
+	while (MUSART1_u8TryReciveData(&Loc_u8Data) != OK);
+#else
+	// Check if data reg isn't empty
+	while (GET_BIT(USART1->USART_SR,RXNE)==0);
+	//Clearing Flag
+	CLR_BIT(USART1->USART_SR,RXNE);
+
+	Loc_u8Data = (u8)USART1->USART_DR;
+	//recording the byte received from the Raspberry (handshake / V2V data)
+	STRACE_voidLog(STRACE_EVT_LINK_RX, 1, Loc_u8Data);
+#endif
+	return Loc_u8Data;
+}
+/**
+ * @brief Receives a byte of data through USART1 without waiting.
+ *
+ * This function takes the oldest byte of the receive FIFO, if any.
+ *
+ * @param P_u8Data: Where the received byte is written.
+ * @return OK if a byte was read, NOK if the FIFO is empty.
+ */
+u8 MUSART1_u8TryReciveData(u8* P_u8Data)
+{
+	ERROR_STATE_T Loc_ErrorState = OK;
+
+	if (P_u8Data == NULL)
+	{
+		Loc_ErrorState = NULL_PTR_ERR;
+	}
+	else if (MUSART1_u8RxHead == MUSART1_u8RxTail)
+	{
+		Loc_ErrorState = NOK;
+	}
+	else
+	{
+		*P_u8Data = MUSART1_Au8RxBuffer[MUSART1_u8RxTail & USART1_RX_INDEX_MASK];
+		MUSART1_u8RxTail++;
+		//recording the byte received from the Raspberry (handshake / V2V data)
+		STRACE_voidLog(STRACE_EVT_LINK_RX, 1, *P_u8Data);
+	}
+	return Loc_ErrorState;
+}
+/**
+ * @brief Checks the USART1 receive FIFO without reading it.
+ *
+ * @return 1 if a byte is waiting, 0 if the FIFO is empty.
+ */
+u8 MUSART1_u8IsRxPending(void)
+{
+	return (MUSART1_u8RxHead != MUSART1_u8RxTail);
+}
+/**
+ * @brief Queues a block of bytes for transmission through USART1.
+ *
+ * The bytes are copied into the transmit FIFO only if all of them fit, then the
+ * TXE interrupt is enabled to send them in the background.
+ *
+ * @param P_u8Data: Pointer to the bytes to be sent.
+ * @param Copy_u8Length: Number of bytes.
+ * @return OK if queued, NOK if there is not enough room, NULL_PTR_ERR.
+ */
+u8 MUSART1_u8QueueData(const u8* P_u8Data, u8 Copy_u8Length)
+{
+	ERROR_STATE_T Loc_ErrorState = OK;
+	u8 Loc_u8Iterator;
+	u8 Loc_u8Head = MUSART1_u8TxHead;
+
+	if (P_u8Data == NULL)
+	{
+		Loc_ErrorState = NULL_PTR_ERR;
+	}
+	else if ((u8)(USART1_TX_BUFFER_SIZE - (u8)(Loc_u8Head - MUSART1_u8TxTail)) < Copy_u8Length)
+	{
+		Loc_ErrorState = NOK;
+	}
+	else
+	{
+		for (Loc_u8Iterator = 0; Loc_u8Iterator < Copy_u8Length; Loc_u8Iterator++)
+		{
+			MUSART1_Au8TxBuffer[Loc_u8Head & USART1_TX_INDEX_MASK] = P_u8Data[Loc_u8Iterator];
+			// mark the start of the block, urgent data may be sent before it
+			if (Loc_u8Iterator == 0)
+			{
+				SET_BIT(MUSART1_Au8TxBlockStart[(Loc_u8Head & USART1_TX_INDEX_MASK) >> 3],(Loc_u8Head & 7));
+			}
+			else
+			{
+				CLR_BIT(MUSART1_Au8TxBlockStart[(Loc_u8Head & USART1_TX_INDEX_MASK) >> 3],(Loc_u8Head & 7));
+			}
+			Loc_u8Head++;
+		}
+		// publish the whole block at once then let the TXE interrupt send it
+		MUSART1_u8TxHead = Loc_u8Head;
+		SET_BIT(USART1->USART_CR1,TXEIE);
+	}
+	return Loc_ErrorState;
+}
+/**
+ * @brief Queues a block of bytes for priority transmission through USART1.
+ *
+ * Same as MUSART1_u8QueueData() with the urgent FIFO: the block is sent as soon
+ * as the block being sent from the normal FIFO is complete.
+ *
+ * @param P_u8Data: Pointer to the bytes to be sent.
+ * @param Copy_u8Length: Number of bytes.
+ * @return OK if queued, NOK if there is not enough room, NULL_PTR_ERR.
+ */
+u8 MUSART1_u8QueueUrgentData(const u8* P_u8Data, u8 Copy_u8Length)
+{
+	ERROR_STATE_T Loc_ErrorState = OK;
+	u8 Loc_u8Iterator;
+	u8 Loc_u8Head = MUSART1_u8TxUrgentHead;
+
+	if (P_u8Data == NULL)
+	{
+		Loc_ErrorState = NULL_PTR_ERR;
+	}
+	else if ((u8)(USART1_TX_URGENT_BUFFER_SIZE - (u8)(Loc_u8Head - MUSART1_u8TxUrgentTail)) < Copy_u8Length)
+	{
+		Loc_ErrorState = NOK;
+	}
+	else
+	{
+		for (Loc_u8Iterator = 0; Loc_u8Iterator < Copy_u8Length; Loc_u8Iterator++)
+		{
+			MUSART1_Au8TxUrgentBuffer[Loc_u8Head & USART1_TX_URGENT_INDEX_MASK] = P_u8Data[Loc_u8Iterator];
+			Loc_u8Head++;
+		}
+		MUSART1_u8TxUrgentHead = Loc_u8Head;
+		SET_BIT(USART1->USART_CR1,TXEIE);
+	}
+	return Loc_ErrorState;
+}
+/**
+ * @brief Adds a USART1 receive hook.
+ *
+ * @param Copy_pfRxHook: Function called with every received byte, returns 1 if it consumed it.
+ * @return OK, NOK if all the hooks are used, NULL_PTR_ERR.
+ */
+u8 MUSART1_u8AddRxCallBack(u8 (*Copy_pfRxHook)(u8 Copy_u8Data))
+{
+	ERROR_STATE_T Loc_ErrorState = OK;
+
+	if (Copy_pfRxHook == NULL)
+	{
+		Loc_ErrorState = NULL_PTR_ERR;
+	}
+	else if (MUSART1_u8RxHooks >= USART1_RX_HOOKS)
+	{
+		Loc_ErrorState = NOK;
+	}
+	else
+	{
+		// the hook is visible to the interrupt only once it is written
+		MUSART1_ApfRxCallBack[MUSART1_u8RxHooks] = Copy_pfRxHook;
+		MUSART1_u8RxHooks++;
+	}
+	return Loc_ErrorState;
+}
+/**
+ * @brief Receives a byte of data through USART2.
+ *
+ * This function receives a byte of data through USART2.
+ *
+ * @return The received data byte.
+ */
+u8 MUSART2_u8ReciveData(void)
+{
+	// Check if data reg isn't empty
+	while (GET_BIT(USART2->USART_SR,RXNE)==0);
+	//Clearing Flag
+	CLR_BIT(USART2->USART_SR,RXNE);
+
+	return (u8)USART2->USART_DR;
+}
+/**
+ * @brief Receives a byte of data through USART6.
+ *
+ * This function receives a byte of data through USART6.
+ *
+ * @return The received data byte.
+ */
+u8 MUSART6_u8ReciveData(void)
+{
+	// Check if data reg isn't empty
+
+	while (GET_BIT(USART6->USART_SR,RXNE)==0);
+	//Clearing Flag
+	CLR_BIT(USART6->USART_SR,RXNE);
+
+	return (u8)USART6->USART_DR;
+}
+/**
+ * @brief Sends a string through USART1.
+ *
+ * This function sends a null-terminated string through USART1.
+ *
+ * @param PC_String: Pointer to the string to be transmitted.
+ */
+void MUSART1_voidSendString(u8* PC_String)
+{
+	u8 Loc_u8Iterator;
+	for (Loc_u8Iterator=0 ; PC_String[Loc_u8Iterator] != '\0'; Loc_u8Iterator++)
+	{
+		MUSART1_voidTransmitData(PC_String[Loc_u8Iterator]);
+	}
+	MUSART1_voidTransmitData('\0');
+
+}
+/**
+ * @brief Sends a string through USART2.
+ *
+ * This function sends a null-terminated string through USART2.
+ *
+ * @param PC_String: Pointer to the string to be transmitted.
+ */
+void MUSART2_voidSendString(u8* PC_String)
+{
+	u8 Loc_u8Iterator;
+	for (Loc_u8Iterator=0 ; PC_String[Loc_u8Iterator] != '\0'; Loc_u8Iterator++)
+	{
+		MUSART2_voidTransmitData(PC_String[Loc_u8Iterator]);
+	}
+	MUSART2_voidTransmitData('\0');
+}
+/**
+ * @brief Sends a string through USART6.
+ *
+ * This function sends a null-terminated string through USART6.
+ *
+ * @param PC_String: Pointer to the string to be transmitted.
+ */
+void MUSART6_voidSendString(u8* PC_String)
+{
+	u8 Loc_u8Iterator;
+	for (Loc_u8Iterator=0 ; PC_String[Loc_u8Iterator] != '\0'; Loc_u8Iterator++)
+	{
+		MUSART6_voidTransmitData(PC_String[Loc_u8Iterator]);
+	}
+	MUSART6_voidTransmitData('\0');
+}
+/**
+ * @brief Receives a string through USART1.
+ *
+ * This function receives a null-terminated string through USART1.
+ *
+ * @param PC_String: Pointer to the buffer where the received string will be stored.
+ */
+void MUSART1_voidReciveString(u8* PC_String)
+{
+	u8 Loc_u8Iterator;
+	u8 Loc_RecivedData = MUSART1_u8ReciveData();
+	for (Loc_u8Iterator=0 ; Loc_RecivedData!='\0' ; Loc_u8Iterator++ )
+	{
+		PC_String[Loc_u8Iterator]=MUSART1_u8ReciveData();
+		Loc_RecivedData = MUSART1_u8ReciveData();
+	}
+}
+/**
+ * @brief Receives a string through USART2.
+ *
+ * This function receives a null-terminated string through USART2.
+ *
+ * @param PC_String: Pointer to the buffer where the received string will be stored.
+ */
+void MUSART2_voidReciveString(u8* PC_String)
+{
+	u8 Loc_u8Iterator;
+	u8 Loc_RecivedData = MUSART2_u8ReciveData();
+	for (Loc_u8Iterator=0 ; Loc_RecivedData!='\0' ; Loc_u8Iterator++ )
+	{
+		PC_String[Loc_u8Iterator]=MUSART2_u8ReciveData();
+		Loc_RecivedData = MUSART2_u8ReciveData();
+	}
+}
+/**
+ * @brief Receives a string through USART6.
+ *
+ * This function receives a null-terminated string through USART6.
+ *
+ * @param PC_String: Pointer to the buffer where the received string will be stored.
+ */
+void MUSART6_voidReciveString(u8* PC_String)
+{
+	u8 Loc_u8Iterator;
+	u8 Loc_RecivedData = MUSART6_u8ReciveData();
+	for (Loc_u8Iterator=0 ; Loc_RecivedData!='\0' ; Loc_u8Iterator++ )
+	{
+		PC_String[Loc_u8Iterator]=MUSART6_u8ReciveData();
+		Loc_RecivedData = MUSART6_u8ReciveData();
+	}
+}
+
+/**
+ * @brief USART1 interrupt handler.
+ *
+ * This function is the interrupt handler for USART1. A received byte is offered
+ * to the receive hooks first (V2V and link transport frames), then stored in the
+ * receive FIFO.
+ * When the data reg is empty, the next byte of the transmit FIFO is sent.
+ */
+void USART1_IRQHandler(void)
+{
+	u8 Loc_u8Data;
+	u8 Loc_u8Hook;
+	u8 Loc_u8Consumed = 0;
+
+	if (GET_BIT(USART1->USART_SR,RXNE)==1)
+	{
+		// reading the data reg clears RXNE (and an overrun)
+		Loc_u8Data = (u8)USART1->USART_DR;
+		for (Loc_u8Hook = 0; (Loc_u8Hook < MUSART1_u8RxHooks) && (Loc_u8Consumed == 0); Loc_u8Hook++)
+		{
+			Loc_u8Consumed = MUSART1_ApfRxCallBack[Loc_u8Hook](Loc_u8Data);
+		}
+		if (Loc_u8Consumed == 0)
+		{
+			// the byte is dropped if the application didn't read the FIFO in time
+			if ((u8)(MUSART1_u8RxHead - MUSART1_u8RxTail) < USART1_RX_BUFFER_SIZE)
+			{
+				MUSART1_Au8RxBuffer[MUSART1_u8RxHead & USART1_RX_INDEX_MASK] = Loc_u8Data;
+				MUSART1_u8RxHead++;
+			}
+		}
+	}
+
+	if ((GET_BIT(USART1->USART_CR1,TXEIE)==1) && (GET_BIT(USART1->USART_SR,TXE)==1))
+	{
+		// urgent data goes first, unless a normal block is half sent
+		if ((MUSART1_u8TxUrgentTail != MUSART1_u8TxUrgentHead) &&
+			((MUSART1_u8TxTail == MUSART1_u8TxHead) ||
+			 (GET_BIT(MUSART1_Au8TxBlockStart[(MUSART1_u8TxTail & USART1_TX_INDEX_MASK) >> 3],(MUSART1_u8TxTail & 7)) == 1)))
+		{
+			USART1->USART_DR = MUSART1_Au8TxUrgentBuffer[MUSART1_u8TxUrgentTail & USART1_TX_URGENT_INDEX_MASK];
+			MUSART1_u8TxUrgentTail++;
+		}
+		else if (MUSART1_u8TxTail != MUSART1_u8TxHead)
+		{
+			USART1->USART_DR = MUSART1_Au8TxBuffer[MUSART1_u8TxTail & USART1_TX_INDEX_MASK];
+			MUSART1_u8TxTail++;
+		}
+		else
+		{
+			// nothing left to send
+			CLR_BIT(USART1->USART_CR1,TXEIE);
+		}
+	}
+}
+/**
+ * @brief USART2 interrupt handler.
+ *
+ * This function is the interrupt handler for USART2. It is currently empty
+ * and can be expanded with specific functionality if needed.
+ */
+
+void USART2_IRQHandler(void)
+{
+
+
+}
+
+/**
+ * @brief USART6 interrupt handler.
+ *
+ * This function is the interrupt handler for USART6. It currently reads a
+ * byte from USART6 and assigns it to the global variable G_u8BluetoothOrder.
+ */
+void USART6_IRQHandler(void)
+{
+	G_u8BluetoothOrder = MUSART6_u8ReciveData();
+	STRACE_voidLog(STRACE_EVT_BT_ORDER, 0, G_u8BluetoothOrder);
+}
+
+
+
+
@@ -0,0 +1,62 @@
+/******************************************************************************
+ *
+ * @file Clock_Interface.h
+ *
+ * @brief Interface file for the Clock (peer clock synchronisation) module.
+ *
+ * Keeps, for each car heard on V2V, the offset and the drift of its
+ * microsecond timebase relative to the local one. They are measured by two
+ * way time exchanges (SERVICE/V2V): the request leaves at T1 (local clock),
+ * reaches the other car at T2 and its response leaves at T3 (other clock),
+ * and it comes back at T4 (local clock).
+ *
+ * @note Not interrupt safe: the samples are added and the times converted
+ *       from the main loop.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_CLOCK_CLOCK_INTERFACE_H_
+#define SERVICE_CLOCK_CLOCK_INTERFACE_H_
+
+/**
+ * @brief Forget all the cars.
+ */
+void SCLK_voidInit(void);
+
+/**
+ * @brief Add the result of a time exchange with another car.
+ *
+ * @param Copy_u8PeerId The other vehicle ID.
+ * @param Copy_u32T1    Local time the request was sent (us).
+ * @param Copy_u32T2    Time of the other car the request was received (us).
+ * @param Copy_u32T3    Time of the other car the response was sent (us).
+ * @param Copy_u32T4    Local time the response was received (us).
+ * @return OK, NOK for the reserved ID 0 or times out of order.
+ */
+u8 SCLK_u8AddSample(u8 Copy_u8PeerId, u32 Copy_u32T1, u32 Copy_u32T2, u32 Copy_u32T3, u32 Copy_u32T4);
+
+/**
+ * @brief Convert a time of another car to the local timebase.
+ *
+ * @param Copy_u8PeerId    The other vehicle ID.
+ * @param Copy_u32PeerTime Time of the other car (us).
+ * @param P_u32LocalTime   Where the local time is written (us).
+ * @return OK, NOK if the car is not synchronised, NULL_PTR_ERR.
+ */
+u8 SCLK_u8ToLocal(u8 Copy_u8PeerId, u32 Copy_u32PeerTime, u32 * P_u32LocalTime);
+
+/**
+ * @brief Get the clock of another car relative to the local one.
+ *
+ * @param Copy_u8PeerId   The other vehicle ID.
+ * @param P_u32Offset     Where the current offset is written (other - local, us, modulo 2^32).
+ * @param P_s32DriftPpm   Where the drift is written (ppm, positive when the other clock is faster),
+ *                        may be NULL.
+ * @return OK, NOK if the car is not synchronised, NULL_PTR_ERR.
+ */
+u8 SCLK_u8GetPeer(u8 Copy_u8PeerId, u32 * P_u32Offset, s32 * P_s32DriftPpm);
+
+#endif /* SERVICE_CLOCK_CLOCK_INTERFACE_H_ */
@@ -0,0 +1,298 @@
+/******************************************************************************
+ *
+ * @File: Clock_Program.c
+ *
+ * @Brief: Implementation of functions for the Clock Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../Trace/Trace_Interface.h"
+#include "Clock_Interface.h"
+#include "Clock_Config.h"
+#include "Clock_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+static CLK_PEER_t SCLK_AstrPeers[CLK_MAX_PEERS];
+
+/*******************************************************************************
+ *                          	Private Functions                              *
+ *******************************************************************************/
+/**
+ * @brief Find the entry of a car.
+ *
+ * @param Copy_u8Create 1 to take a free entry, or the one synchronised the
+ *                      longest time ago, when the car is unknown.
+ * @return The entry index, CLK_NONE if the car is unknown and not created.
+ */
+static u8 SCLK_u8FindPeer(u8 Copy_u8PeerId, u8 Copy_u8Create, u32 Copy_u32Now)
+{
+	u8 L_u8Index;
+	u8 L_u8Free = CLK_NONE;
+	u8 L_u8Oldest = 0;
+
+	for (L_u8Index = 0; L_u8Index < CLK_MAX_PEERS; L_u8Index++)
+	{
+		if (SCLK_AstrPeers[L_u8Index].Peer_u8Id == Copy_u8PeerId)
+		{
+			return L_u8Index;
+		}
+		if (SCLK_AstrPeers[L_u8Index].Peer_u8Id == 0)
+		{
+			L_u8Free = L_u8Index;
+		}
+		else if ((Copy_u32Now - SCLK_AstrPeers[L_u8Index].Peer_u32LastSampleTime) >
+				 (Copy_u32Now - SCLK_AstrPeers[L_u8Oldest].Peer_u32LastSampleTime))
+		{
+			L_u8Oldest = L_u8Index;
+		}
+	}
+
+	if (Copy_u8Create == 0)
+	{
+		return CLK_NONE;
+	}
+	if (L_u8Free == CLK_NONE)
+	{
+		L_u8Free = L_u8Oldest;
+	}
+	SCLK_AstrPeers[L_u8Free].Peer_u8Id = Copy_u8PeerId;
+	SCLK_AstrPeers[L_u8Free].Peer_u8Synced = 0;
+	SCLK_AstrPeers[L_u8Free].Peer_u8Count = 0;
+	SCLK_AstrPeers[L_u8Free].Peer_u8Next = 0;
+	return L_u8Free;
+}
+
+/**
+ * @brief Offset of a synchronised car at a local time, with its drift since the reference.
+ */
+static u32 SCLK_u32GetOffset(const CLK_PEER_t * P_Peer, u32 Copy_u32Now)
+{
+	s32 L_s32ElapsedMs = (s32)((Copy_u32Now - P_Peer->Peer_u32RefTime) / CLK_US_PER_MS);
+
+	/* at most CLK_HOLDOVER_MS x CLK_MAX_DRIFT_PPM, well inside s32 */
+	return P_Peer->Peer_u32Offset + (u32)((P_Peer->Peer_s32DriftPpm * L_s32ElapsedMs) / (s32)CLK_US_PER_MS);
+}
+
+/**
+ * @brief Start the measure of a car again from one sample.
+ */
+static void SCLK_voidRestart(CLK_PEER_t * P_Peer, const CLK_SAMPLE_t * P_Sample)
+{
+	P_Peer->Peer_AstrSamples[0] = *P_Sample;
+	P_Peer->Peer_u8Count = 1;
+	P_Peer->Peer_u8Next = 1 % CLK_FILTER_SIZE;
+	P_Peer->Peer_s32DriftPpm = 0;
+	P_Peer->Peer_u32DriftRefOffset = P_Sample->Sample_u32Offset;
+	P_Peer->Peer_u32DriftRefTime = P_Sample->Sample_u32Time;
+	P_Peer->Peer_u8Synced = 1;
+	P_Peer->Peer_u32Offset = P_Sample->Sample_u32Offset;
+	P_Peer->Peer_u32RefTime = P_Sample->Sample_u32Time;
+}
+
+/**
+ * @brief Correct the drift with the slope of the offset since the drift reference.
+ *
+ * @param Copy_u32Offset The new filtered offset.
+ * @param Copy_u32Time   Its local time.
+ */
+static void SCLK_voidUpdateDrift(CLK_PEER_t * P_Peer, u32 Copy_u32Offset, u32 Copy_u32Time)
+{
+	u32 L_u32ElapsedMs = (Copy_u32Time - P_Peer->Peer_u32DriftRefTime) / CLK_US_PER_MS;
+	s32 L_s32Error;
+
+	if (L_u32ElapsedMs < CLK_MIN_DRIFT_INTERVAL_MS)
+	{
+		return;
+	}
+
+	if (L_u32ElapsedMs <= (4 * CLK_MIN_DRIFT_INTERVAL_MS))
+	{
+		L_s32Error = (s32)(Copy_u32Offset - P_Peer->Peer_u32DriftRefOffset) -
+					 (P_Peer->Peer_s32DriftPpm * (s32)L_u32ElapsedMs) / (s32)CLK_US_PER_MS;
+		if ((L_s32Error <= (s32)CLK_STEP_US) && (L_s32Error >= -(s32)CLK_STEP_US))
+		{
+			/* us over ms gives ppm x 1000 */
+			P_Peer->Peer_s32DriftPpm += (L_s32Error * (s32)CLK_US_PER_MS) / (s32)L_u32ElapsedMs / CLK_DRIFT_GAIN;
+			if (P_Peer->Peer_s32DriftPpm > CLK_MAX_DRIFT_PPM)
+			{
+				P_Peer->Peer_s32DriftPpm = CLK_MAX_DRIFT_PPM;
+			}
+			else if (P_Peer->Peer_s32DriftPpm < -CLK_MAX_DRIFT_PPM)
+			{
+				P_Peer->Peer_s32DriftPpm = -CLK_MAX_DRIFT_PPM;
+			}
+		}
+	}
+	P_Peer->Peer_u32DriftRefOffset = Copy_u32Offset;
+	P_Peer->Peer_u32DriftRefTime = Copy_u32Time;
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Forget all the cars.
+ */
+void SCLK_voidInit(void)
+{
+	u8 L_u8Index;
+
+	for (L_u8Index = 0; L_u8Index < CLK_MAX_PEERS; L_u8Index++)
+	{
+		SCLK_AstrPeers[L_u8Index].Peer_u8Id = 0;
+		SCLK_AstrPeers[L_u8Index].Peer_u8Synced = 0;
+	}
+}
+
+/**
+ * @brief Add the result of a time exchange with another car.
+ *
+ * The delay is the round trip minus the time the request waited in the other
+ * car, the offset is (T2 - T1) - delay / 2, i.e. the delay is taken as
+ * symmetric. When the sample with the shortest delay of the filter is newer
+ * than the reference, 1/CLK_OFFSET_GAIN of its distance to the predicted
+ * offset is taken: what is left of the asymmetry of its delay is averaged
+ * out. A sample more than CLK_STEP_US from the prediction means the other car
+ * restarted.
+ */
+u8 SCLK_u8AddSample(u8 Copy_u8PeerId, u32 Copy_u32T1, u32 Copy_u32T2, u32 Copy_u32T3, u32 Copy_u32T4)
+{
+	CLK_PEER_t * L_pstrPeer;
+	CLK_SAMPLE_t L_strSample;
+	const CLK_SAMPLE_t * L_pstrBest;
+	u32 L_u32RoundTrip = Copy_u32T4 - Copy_u32T1;
+	u32 L_u32Turnaround = Copy_u32T3 - Copy_u32T2;
+	u32 L_u32Predicted;
+	s32 L_s32Error;
+	u8 L_u8Index;
+
+	if ((Copy_u8PeerId == 0) || (L_u32Turnaround > L_u32RoundTrip))
+	{
+		return NOK;
+	}
+
+	L_strSample.Sample_u32Delay = L_u32RoundTrip - L_u32Turnaround;
+	L_strSample.Sample_u32Offset = (Copy_u32T2 - Copy_u32T1) - (L_strSample.Sample_u32Delay / 2);
+	L_strSample.Sample_u32Time = Copy_u32T4;
+
+	L_pstrPeer = &SCLK_AstrPeers[SCLK_u8FindPeer(Copy_u8PeerId, 1, Copy_u32T4)];
+	L_pstrPeer->Peer_u32LastSampleTime = Copy_u32T4;
+
+	if ((L_pstrPeer->Peer_u8Synced == 0) ||
+		((Copy_u32T4 - L_pstrPeer->Peer_u32RefTime) > (CLK_HOLDOVER_MS * CLK_US_PER_MS)))
+	{
+		SCLK_voidRestart(L_pstrPeer, &L_strSample);
+		STRACE_voidLog(STRACE_EVT_CLOCK_SYNC, Copy_u8PeerId, 0);
+		return OK;
+	}
+
+	L_pstrPeer->Peer_AstrSamples[L_pstrPeer->Peer_u8Next] = L_strSample;
+	L_pstrPeer->Peer_u8Next = (L_pstrPeer->Peer_u8Next + 1) % CLK_FILTER_SIZE;
+	if (L_pstrPeer->Peer_u8Count < CLK_FILTER_SIZE)
+	{
+		L_pstrPeer->Peer_u8Count++;
+	}
+
+	L_pstrBest = &L_pstrPeer->Peer_AstrSamples[0];
+	for (L_u8Index = 1; L_u8Index < L_pstrPeer->Peer_u8Count; L_u8Index++)
+	{
+		if (L_pstrPeer->Peer_AstrSamples[L_u8Index].Sample_u32Delay < L_pstrBest->Sample_u32Delay)
+		{
+			L_pstrBest = &L_pstrPeer->Peer_AstrSamples[L_u8Index];
+		}
+	}
+	if ((s32)(L_pstrBest->Sample_u32Time - L_pstrPeer->Peer_u32RefTime) <= 0)
+	{
+		// the reference is still the best exchange
+		return OK;
+	}
+
+	L_u32Predicted = SCLK_u32GetOffset(L_pstrPeer, L_pstrBest->Sample_u32Time);
+	L_s32Error = (s32)(L_pstrBest->Sample_u32Offset - L_u32Predicted);
+	if ((L_s32Error > (s32)CLK_STEP_US) || (L_s32Error < -(s32)CLK_STEP_US))
+	{
+		SCLK_voidRestart(L_pstrPeer, &L_strSample);
+		STRACE_voidLog(STRACE_EVT_CLOCK_SYNC, Copy_u8PeerId, 0);
+		return OK;
+	}
+
+	L_pstrPeer->Peer_u32Offset = L_u32Predicted + (u32)(L_s32Error / CLK_OFFSET_GAIN);
+	L_pstrPeer->Peer_u32RefTime = L_pstrBest->Sample_u32Time;
+	SCLK_voidUpdateDrift(L_pstrPeer, L_pstrPeer->Peer_u32Offset, L_pstrPeer->Peer_u32RefTime);
+	STRACE_voidLog(STRACE_EVT_CLOCK_SYNC, Copy_u8PeerId, (u16)(s16)L_pstrPeer->Peer_s32DriftPpm);
+	return OK;
+}
+
+/**
+ * @brief Convert a time of another car to the local timebase.
+ *
+ * The offset is extrapolated to the current time with the drift.
+ */
+u8 SCLK_u8ToLocal(u8 Copy_u8PeerId, u32 Copy_u32PeerTime, u32 * P_u32LocalTime)
+{
+	u32 L_u32Offset;
+	u8 L_u8State;
+
+	if (P_u32LocalTime == NULL)
+	{
+		return NULL_PTR_ERR;
+	}
+	L_u8State = SCLK_u8GetPeer(Copy_u8PeerId, &L_u32Offset, NULL);
+	if (L_u8State == OK)
+	{
+		*P_u32LocalTime = Copy_u32PeerTime - L_u32Offset;
+	}
+	return L_u8State;
+}
+
+/**
+ * @brief Get the clock of another car relative to the local one.
+ */
+u8 SCLK_u8GetPeer(u8 Copy_u8PeerId, u32 * P_u32Offset, s32 * P_s32DriftPpm)
+{
+	u32 L_u32Now = MTMR_u32GetMicros();
+	u8 L_u8Index;
+
+	if (P_u32Offset == NULL)
+	{
+		return NULL_PTR_ERR;
+	}
+	if (Copy_u8PeerId == 0)
+	{
+		return NOK;
+	}
+	L_u8Index = SCLK_u8FindPeer(Copy_u8PeerId, 0, L_u32Now);
+	if ((L_u8Index == CLK_NONE) || (SCLK_AstrPeers[L_u8Index].Peer_u8Synced == 0) ||
+		((L_u32Now - SCLK_AstrPeers[L_u8Index].Peer_u32RefTime) > (CLK_HOLDOVER_MS * CLK_US_PER_MS)))
+	{
+		return NOK;
+	}
+
+	*P_u32Offset = SCLK_u32GetOffset(&SCLK_AstrPeers[L_u8Index], L_u32Now);
+	if (P_s32DriftPpm != NULL)
+	{
+		*P_s32DriftPpm = SCLK_AstrPeers[L_u8Index].Peer_s32DriftPpm;
+	}
+	return OK;
+}
@@ -0,0 +1,25 @@
+/******************************************************************************
+ *
+ * @file Defer_Config.h
+ *
+ * @brief Configuration file for the Defer (deferred work) module.
+ *
+ * The interrupt handlers post their slow work (application callbacks) to a
+ * queue, run by the PendSV handler at the lowest interrupt priority.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_DEFER_DEFER_CONFIG_H_
+#define SERVICE_DEFER_DEFER_CONFIG_H_
+
+/**
+ * @brief Number of work items waiting for PendSV (power of two, at most 128).
+ *
+ * A work item posted to a full queue is dropped and counted.
+ */
+#define DEF_QUEUE_SIZE				16
+
+#endif /* SERVICE_DEFER_DEFER_CONFIG_H_ */
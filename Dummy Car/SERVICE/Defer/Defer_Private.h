@@ -0,0 +1,39 @@
+/******************************************************************************
+ *
+ * @File: Defer_Private.h
+ *
+ * @Brief: Private definitions for the Defer Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_DEFER_DEFER_PRIVATE_H_
+#define SERVICE_DEFER_DEFER_PRIVATE_H_
+
+#if ((DEF_QUEUE_SIZE & (DEF_QUEUE_SIZE - 1)) != 0) || (DEF_QUEUE_SIZE > 128)
+#error "DEF_QUEUE_SIZE must be a power of two up to 128"
+#endif
+
+#define DEF_INDEX_MASK			(DEF_QUEUE_SIZE - 1)
+
+/* SCB interrupt control and state register, PendSV set pending bit */
+#define SCB_ICSR				(*(volatile u32*)0xE000ED04)
+#define PENDSVSET				28
+
+/**
+ * @brief One queued work item.
+ *
+ * The slot is reserved first then filled, Def_u8Ready tells PendSV the
+ * function and argument are written.
+ */
+typedef struct
+{
+	void (*Def_pfWork)(u32 Copy_u32Arg);
+	u32 Def_u32Arg;
+	volatile u8 Def_u8Ready;
+}DEF_WORK_t;
+
+#endif /* SERVICE_DEFER_DEFER_PRIVATE_H_ */
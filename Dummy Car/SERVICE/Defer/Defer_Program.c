@@ -0,0 +1,131 @@
+/******************************************************************************
+ *
+ * @File: Defer_Program.c
+ *
+ * @Brief: Implementation of functions for the Defer Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "Defer_Interface.h"
+#include "Defer_Config.h"
+#include "Defer_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+/*
+ * Free running u8 indexes (the size divides 256). The producers reserve a slot
+ * by moving the head with a compare and swap, so interrupts of any priority
+ * can post; PendSV is the only consumer.
+ */
+static DEF_WORK_t SDEF_AstrQueue[DEF_QUEUE_SIZE];
+static volatile u8 SDEF_u8Head = 0;
+static volatile u8 SDEF_u8Tail = 0;
+static volatile u32 SDEF_u32Dropped = 0;
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Initialize the module.
+ */
+void SDEF_voidInit(void)
+{
+	u8 L_u8Index;
+
+	for (L_u8Index = 0; L_u8Index < DEF_QUEUE_SIZE; L_u8Index++)
+	{
+		SDEF_AstrQueue[L_u8Index].Def_u8Ready = 0;
+	}
+	SDEF_u8Head = 0;
+	SDEF_u8Tail = 0;
+	SDEF_u32Dropped = 0;
+}
+
+/**
+ * @brief Post a work item.
+ *
+ * This function reserves the next slot, fills it, marks it ready then sets
+ * PendSV pending. PendSV can pre-empt the main loop in the middle of a post:
+ * it then stops at the reserved slot, and the main loop pends it again once
+ * the slot is ready.
+ */
+u8 SDEF_u8Post(void (*Copy_pfWork)(u32 Copy_u32Arg), u32 Copy_u32Arg)
+{
+	u8 L_u8Head;
+	DEF_WORK_t * L_pstrWork;
+
+	if (Copy_pfWork == NULL)
+	{
+		return NULL_PTR_ERR;
+	}
+
+	L_u8Head = __atomic_load_n(&SDEF_u8Head, __ATOMIC_RELAXED);
+	do
+	{
+		if ((u8)(L_u8Head - SDEF_u8Tail) >= DEF_QUEUE_SIZE)
+		{
+			__atomic_fetch_add(&SDEF_u32Dropped, 1, __ATOMIC_RELAXED);
+			return NOK;
+		}
+	} while (__atomic_compare_exchange_n(&SDEF_u8Head, &L_u8Head, (u8)(L_u8Head + 1), 1, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) == 0);
+
+	L_pstrWork = &SDEF_AstrQueue[L_u8Head & DEF_INDEX_MASK];
+	L_pstrWork->Def_pfWork = Copy_pfWork;
+	L_pstrWork->Def_u32Arg = Copy_u32Arg;
+	__atomic_store_n(&L_pstrWork->Def_u8Ready, 1, __ATOMIC_RELEASE);
+
+	SCB_ICSR = (1UL << PENDSVSET);
+	return OK;
+}
+
+/**
+ * @brief Get the number of dropped work items.
+ */
+u32 SDEF_u32GetDropCount(void)
+{
+	return SDEF_u32Dropped;
+}
+
+/**
+ * @brief PendSV exception handler.
+ *
+ * Runs the ready work items in order. The slot is released before the item
+ * runs, so an item can post again.
+ */
+void PendSV_Handler(void)
+{
+	DEF_WORK_t * L_pstrWork;
+	void (*L_pfWork)(u32 Copy_u32Arg);
+	u32 L_u32Arg;
+
+	while (SDEF_u8Tail != SDEF_u8Head)
+	{
+		L_pstrWork = &SDEF_AstrQueue[SDEF_u8Tail & DEF_INDEX_MASK];
+		if (__atomic_load_n(&L_pstrWork->Def_u8Ready, __ATOMIC_ACQUIRE) == 0)
+		{
+			// reserved by the code this handler pre-empted, it pends PendSV again
+			break;
+		}
+		L_pfWork = L_pstrWork->Def_pfWork;
+		L_u32Arg = L_pstrWork->Def_u32Arg;
+		L_pstrWork->Def_u8Ready = 0;
+		__atomic_store_n(&SDEF_u8Tail, (u8)(SDEF_u8Tail + 1), __ATOMIC_RELEASE);
+
+		L_pfWork(L_u32Arg);
+	}
+}
@@ -0,0 +1,99 @@
+/******************************************************************************
+ *
+ * @file Link_Interface.h
+ *
+ * @brief Interface file for the Link (reliable transport) module.
+ *
+ * Sliding window transport of short messages over the Raspberry link. Every
+ * message gets a sequence number, every frame carries the cumulative
+ * acknowledge of the other direction, and a message is sent again on its own
+ * when it is not acknowledged in time. Up to LNK_WINDOW_SIZE messages are in
+ * flight, so a request doesn't wait for the answer of the previous one.
+ *
+ * The messages go on logical channels. Each channel has its own numbering,
+ * windows and queues: a lost or unread message of one channel doesn't hold
+ * the messages of the others. The frames of the channels are interleaved on
+ * the UART by priority.
+ *
+ * The frames share USART1 with the V2V frames and the legacy bytes, they start
+ * with their own SYNC byte.
+ *
+ * @note Not interrupt safe: the USART1 interrupt only queues the received
+ *       frames, everything else runs from the main loop.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_LINK_LINK_INTERFACE_H_
+#define SERVICE_LINK_LINK_INTERFACE_H_
+
+/**
+ * @brief Logical channels, in priority order.
+ */
+#define SLNK_CHANNEL_V2V			0	/**< Queries to the other cars through the Raspberry ('R'). */
+#define SLNK_CHANNEL_CAMERA			1	/**< Camera queries ('C'), the answer waits for the capture. */
+#define SLNK_CHANNEL_TELEMETRY		2	/**< Status reports to the Raspberry. */
+
+/**
+ * @brief Initialize the module.
+ *
+ * Installs the USART1 receive hook and tells the other side that the sequence
+ * of every channel of this side starts again.
+ *
+ * @note USART1 and the microsecond timebase must be initialized.
+ */
+void SLNK_voidInit(void);
+
+/**
+ * @brief Send a message.
+ *
+ * The message is framed as soon as the channels before its own have nothing
+ * to send and the USART1 transmit FIFO has room.
+ *
+ * @param Copy_u8Channel The channel (SLNK_CHANNEL_...).
+ * @param P_u8Data       The message.
+ * @param Copy_u8Length  Its length, 1 to LNK_MAX_PAYLOAD.
+ * @return OK, NOK if the send window of the channel is full, OUT_OF_RANGE, NULL_PTR_ERR.
+ */
+u8 SLNK_u8Send(u8 Copy_u8Channel, const u8 * P_u8Data, u8 Copy_u8Length);
+
+/**
+ * @brief Take the oldest received message of a channel, in the order it was sent.
+ *
+ * @param Copy_u8Channel The channel (SLNK_CHANNEL_...).
+ * @param P_u8Data       Where the message is copied (LNK_MAX_PAYLOAD bytes).
+ * @param P_u8Length     Where its length is written.
+ * @return OK, NOK if no message is waiting, OUT_OF_RANGE, NULL_PTR_ERR.
+ */
+u8 SLNK_u8Receive(u8 Copy_u8Channel, u8 * P_u8Data, u8 * P_u8Length);
+
+/**
+ * @brief Periodic task.
+ *
+ * Handles the received frames, then sends by channel priority the new
+ * messages, the ones not acknowledged in time and the acknowledges.
+ */
+void SLNK_voidTask(void);
+
+/**
+ * @brief Check for received frames the task has not handled yet.
+ *
+ * @note Can be called with the interrupts masked (sleep busy check).
+ *
+ * @return 1 if a frame is waiting, 0 if not.
+ */
+u8 SLNK_u8IsRxPending(void);
+
+/**
+ * @brief Time the main loop can sleep before the task has something to do (us).
+ *
+ * @note Can be called with the interrupts masked.
+ *
+ * @return 0 if a frame, a message or an acknowledge is waiting, the time to the next
+ *         retransmission otherwise (0xFFFFFFFF if nothing is in flight).
+ */
+u32 SLNK_u32GetIdleTime(void);
+
+#endif /* SERVICE_LINK_LINK_INTERFACE_H_ */
@@ -0,0 +1,135 @@
+/******************************************************************************
+ *
+ * @File: Link_Private.h
+ *
+ * @Brief: Private definitions for the Link (reliable transport) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_LINK_LINK_PRIVATE_H_
+#define SERVICE_LINK_LINK_PRIVATE_H_
+
+#if (LNK_CHANNEL_COUNT < 1) || (LNK_CHANNEL_COUNT > 16)
+#error "LNK_CHANNEL_COUNT must be 1 to 16"
+#endif
+
+#if ((LNK_WINDOW_SIZE & (LNK_WINDOW_SIZE - 1)) != 0) || (LNK_WINDOW_SIZE > 64)
+#error "LNK_WINDOW_SIZE must be a power of two, at most 64"
+#endif
+
+#if ((LNK_RX_QUEUE_SIZE & (LNK_RX_QUEUE_SIZE - 1)) != 0)
+#error "LNK_RX_QUEUE_SIZE must be a power of two"
+#endif
+
+#if ((LNK_RX_FRAMES & (LNK_RX_FRAMES - 1)) != 0)
+#error "LNK_RX_FRAMES must be a power of two"
+#endif
+
+/**
+ * @brief Frame format on the Raspberry link.
+ *
+ * SYNC | TYPE | CHANNEL | SEQ | ACK | LENGTH | PAYLOAD (LENGTH bytes) | CHECKSUM
+ *
+ * SEQ numbers the DATA frames of the channel, ACK is the next sequence of the
+ * channel expected from the other side (all the ones before are received).
+ * The checksum is the XOR of TYPE to the last payload byte. The SYNC byte
+ * differs from the V2V one and the legacy handshake bytes are all below 0x80.
+ */
+#define LNK_SYNC_BYTE			0xA5
+#define LNK_FRAME_OVERHEAD		7
+
+/**
+ * @brief Frame types.
+ *
+ * A RESET tells that the sender restarts the sequence of the channel at SEQ:
+ * the receiver drops what it kept out of order and expects SEQ next.
+ */
+#define LNK_TYPE_DATA			0x01
+#define LNK_TYPE_ACK			0x02
+#define LNK_TYPE_RESET			0x03
+
+#define LNK_WINDOW_MASK			(LNK_WINDOW_SIZE - 1)
+#define LNK_RX_QUEUE_MASK		(LNK_RX_QUEUE_SIZE - 1)
+#define LNK_RX_FRAMES_MASK		(LNK_RX_FRAMES - 1)
+
+#define LNK_US_PER_MS			1000UL
+#define LNK_NO_DEADLINE			0xFFFFFFFFUL
+
+/**
+ * @brief Receive parser states.
+ */
+typedef enum
+{
+	LNK_RX_SYNC,
+	LNK_RX_TYPE,
+	LNK_RX_CHANNEL,
+	LNK_RX_SEQ,
+	LNK_RX_ACK,
+	LNK_RX_LENGTH,
+	LNK_RX_PAYLOAD,
+	LNK_RX_CHECKSUM
+
+}LNK_RX_STATE_t;
+
+/**
+ * @brief Received frame, from the USART1 interrupt to the task.
+ */
+typedef struct
+{
+	u8 Frame_u8Type;
+	u8 Frame_u8Channel;
+	u8 Frame_u8Seq;
+	u8 Frame_u8Ack;
+	u8 Frame_u8Length;
+	u8 Frame_Au8Payload[LNK_MAX_PAYLOAD];
+}LNK_FRAME_t;
+
+/**
+ * @brief Message of the send window, kept until it is acknowledged.
+ */
+typedef struct
+{
+	u8  Tx_u8Length;
+	u8  Tx_u8Retries;
+	u32 Tx_u32SentTime;
+	u8  Tx_Au8Payload[LNK_MAX_PAYLOAD];
+}LNK_TX_SLOT_t;
+
+/**
+ * @brief Received message, in the receive window or the queue of the application.
+ */
+typedef struct
+{
+	u8 Msg_u8Length;
+	u8 Msg_Au8Payload[LNK_MAX_PAYLOAD];
+}LNK_MSG_t;
+
+/**
+ * @brief State of a channel.
+ *
+ * Send window: Chn_u8TxBase is the oldest message not acknowledged, the ones
+ * up to Chn_u8TxSent were framed once, the ones up to Chn_u8TxNext wait for
+ * their turn. Receive window: the messages after a missing one,
+ * Chn_u8RxExpected is the missing one.
+ */
+typedef struct
+{
+	LNK_TX_SLOT_t Chn_AstrTxWindow[LNK_WINDOW_SIZE];
+	u8 Chn_u8TxBase;
+	u8 Chn_u8TxSent;
+	u8 Chn_u8TxNext;
+	u8 Chn_u8ResetPending;
+	LNK_MSG_t Chn_AstrRxWindow[LNK_WINDOW_SIZE];
+	u8 Chn_Au8RxValid[LNK_WINDOW_SIZE];
+	u8 Chn_u8RxExpected;
+	u8 Chn_u8AckPending;
+	LNK_MSG_t Chn_AstrRxQueue[LNK_RX_QUEUE_SIZE];
+	u8 Chn_u8RxQueueHead;
+	u8 Chn_u8RxQueueTail;
+}LNK_CHANNEL_t;
+
+#endif /* SERVICE_LINK_LINK_PRIVATE_H_ */
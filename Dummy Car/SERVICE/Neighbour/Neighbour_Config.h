@@ -0,0 +1,53 @@
+/******************************************************************************
+ *
+ * @file Neighbour_Config.h
+ *
+ * @brief Configuration file for the Neighbour table module.
+ *
+ * The table keeps the latest beacon of the surrounding vehicles, keyed by
+ * vehicle ID, and answers the lane queries of the overtake and blind spot logic.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_NEIGHBOUR_NEIGHBOUR_CONFIG_H_
+#define SERVICE_NEIGHBOUR_NEIGHBOUR_CONFIG_H_
+
+/**
+ * @brief Number of vehicles kept (at most 254).
+ *
+ * When the table is full, the vehicle that was heard from the longest time ago
+ * is replaced.
+ */
+#define NBR_CAPACITY				8
+
+/**
+ * @brief Age after which a vehicle is stale (ms).
+ *
+ * Stale vehicles are ignored by the queries and removed from the table.
+ */
+#define NBR_STALE_TIMEOUT_MS		1000
+
+/**
+ * @brief Lane width in cm.
+ *
+ * Lane 0 is centered on Y = 0, the lanes on the left have a positive number.
+ */
+#define NBR_LANE_WIDTH_CM			40
+
+/**
+ * @brief Number of lane lists (power of two).
+ *
+ * Each vehicle is linked in the list of its lane (lane number & (NBR_LANE_BUCKETS - 1)),
+ * so a lane query only visits the vehicles of that lane.
+ */
+#define NBR_LANE_BUCKETS			4
+
+/**
+ * @brief Half length of the zone beside the car checked by the adjacent lane query (cm).
+ */
+#define NBR_SIDE_WINDOW_CM			60
+
+#endif /* SERVICE_NEIGHBOUR_NEIGHBOUR_CONFIG_H_ */
@@ -0,0 +1,49 @@
+/******************************************************************************
+ *
+ * @File: Neighbour_Private.h
+ *
+ * @Brief: Private definitions for the Neighbour table Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_NEIGHBOUR_NEIGHBOUR_PRIVATE_H_
+#define SERVICE_NEIGHBOUR_NEIGHBOUR_PRIVATE_H_
+
+#if ((NBR_LANE_BUCKETS & (NBR_LANE_BUCKETS - 1)) != 0)
+#error "NBR_LANE_BUCKETS must be a power of two"
+#endif
+
+#if (NBR_CAPACITY > 254)
+#error "NBR_CAPACITY must fit an u8 slot index"
+#endif
+
+/**
+ * @brief Empty link / unknown vehicle.
+ */
+#define NBR_NONE				0xFF
+
+#define NBR_BUCKET_MASK			(NBR_LANE_BUCKETS - 1)
+#define NBR_US_PER_MS			1000UL
+#define NBR_MS_PER_S			1000UL
+
+/**
+ * @brief One vehicle of the table.
+ *
+ * Every used entry is linked in the LRU list (most recently updated first) and
+ * in the list of its lane bucket. Free entries are chained with the LRU links.
+ */
+typedef struct
+{
+	SV2V_BEACON_t Nbr_strBeacon;	/**< Latest beacon, Beacon_u32RxTime is the last update. */
+	s8 Nbr_s8Lane;					/**< Lane computed from the beacon position. */
+	u8 Nbr_u8LruPrev;
+	u8 Nbr_u8LruNext;
+	u8 Nbr_u8LanePrev;
+	u8 Nbr_u8LaneNext;
+}NBR_ENTRY_t;
+
+#endif /* SERVICE_NEIGHBOUR_NEIGHBOUR_PRIVATE_H_ */
@@ -0,0 +1,57 @@
+/******************************************************************************
+ *
+ * @file Odometry_Config.h
+ *
+ * @brief Configuration file for the Odometry (dead reckoning) module.
+ *
+ * The pose of the car is integrated from the command of the wheels of each
+ * side (HAL/DC_Motor): the car has no wheel encoder, the wheel speeds are
+ * estimated from the PWM compare values.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_ODOMETRY_ODOMETRY_CONFIG_H_
+#define SERVICE_ODOMETRY_ODOMETRY_CONFIG_H_
+
+/**
+ * @brief Integration step in milliseconds.
+ *
+ * The pose is brought up to date in steps of this length, and with a last
+ * shorter step before each change of the wheel command.
+ */
+#define ODO_PERIOD_MS				10
+
+/**
+ * @brief Speed of the wheels of a side for one speed level (1000 of PWM compare) in mm/s.
+ */
+#define ODO_SPEED_LEVEL_MM_S		100
+
+/**
+ * @brief Distance between the left and right wheels in mm.
+ */
+#define ODO_TRACK_WIDTH_MM			140
+
+/**
+ * @brief Part of the ideal turn rate the car really turns (/256).
+ *
+ * The four wheels skid when the sides go at different speeds, so the car
+ * turns slower than two wheels on an axle would.
+ */
+#define ODO_TURN_FACTOR_Q8			192
+
+/**
+ * @brief Start pose of this car on the track.
+ *
+ * All the cars share the same frame: X along the road, Y across it (left is
+ * positive, lane 0 centered on Y = 0). The heading is in degrees from the X
+ * axis, positive to the left. The dummy car starts ahead of the main car, in
+ * the same lane.
+ */
+#define ODO_START_X_MM				1500
+#define ODO_START_Y_MM				0
+#define ODO_START_HEADING_DEG		0
+
+#endif /* SERVICE_ODOMETRY_ODOMETRY_CONFIG_H_ */
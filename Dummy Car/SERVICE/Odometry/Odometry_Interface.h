@@ -0,0 +1,88 @@
+/******************************************************************************
+ *
+ * @file Odometry_Interface.h
+ *
+ * @brief Interface file for the Odometry (dead reckoning) module.
+ *
+ * Integrates the speeds of the left and right wheels into the pose of the car
+ * (position and heading) at a fixed step, in fixed point: the position in um,
+ * the heading as a binary angle. The application ends its manoeuvres on the
+ * pose, and the V2V beacons publish it.
+ *
+ * The pose is integrated lazily: the task, a pose query and every change of
+ * the wheel command bring it up to date, so the main loop can sleep without
+ * losing steps.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_ODOMETRY_ODOMETRY_INTERFACE_H_
+#define SERVICE_ODOMETRY_ODOMETRY_INTERFACE_H_
+
+/**
+ * @brief Binary angle of a heading in degrees (65536 is a full turn).
+ */
+#define SODO_DEG_TO_ANGLE(DEG)		((u16)(((s32)(DEG) * 65536L) / 360))
+
+/**
+ * @brief Pose of the car.
+ */
+typedef struct
+{
+	s32 Pose_s32X;					/**< Position along the road in mm. */
+	s32 Pose_s32Y;					/**< Position across the road in mm (left is positive). */
+	u16 Pose_u16Heading;			/**< Heading, binary angle (65536 is a full turn, positive to the left). */
+	s16 Pose_s16Speed;				/**< Speed in mm/s, negative backward. */
+	s32 Pose_s32Travel;				/**< Distance driven since the start in mm, backward counts negative. */
+	u32 Pose_u32Time;				/**< Local time of the pose in us. */
+}SODO_POSE_t;
+
+/**
+ * @brief Start the integration from the configured start pose.
+ *
+ * Installs the wheel command hook of the DC motor driver.
+ *
+ * @note The microsecond timebase must be running.
+ */
+void SODO_voidInit(void);
+
+/**
+ * @brief Periodic task, to be called from the main loop.
+ *
+ * Integrates the steps elapsed since the last update.
+ */
+void SODO_voidTask(void);
+
+/**
+ * @brief Get the pose of the car, brought up to date.
+ *
+ * @param P_Pose Where the pose is copied.
+ * @return OK, NULL_PTR_ERR.
+ */
+u8 SODO_u8GetPose(SODO_POSE_t * P_Pose);
+
+/**
+ * @brief Get the heading of the car in degrees (0 to 359).
+ *
+ * @return The heading of the last update.
+ */
+u16 SODO_u16GetHeadingDeg(void);
+
+/**
+ * @brief Sine of a binary angle (65536 is a full turn).
+ *
+ * @param Copy_u16Angle The angle.
+ * @return The sine in Q15 (32767 is 1).
+ */
+s16 SODO_s16Sine(u16 Copy_u16Angle);
+
+/**
+ * @brief Get the speed of the car in cm/s.
+ *
+ * @return The magnitude of the speed of the current wheel command.
+ */
+u16 SODO_u16GetSpeedCmS(void);
+
+#endif /* SERVICE_ODOMETRY_ODOMETRY_INTERFACE_H_ */
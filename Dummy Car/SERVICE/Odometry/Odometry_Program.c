@@ -0,0 +1,251 @@
+/******************************************************************************
+ *
+ * @File: Odometry_Program.c
+ *
+ * @Brief: Implementation of functions for the Odometry (dead reckoning) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+
+/*******************************************************************************
+ *                          	HAL Components                                 *
+ *******************************************************************************/
+#include "../../HAL/DC_Motor/DC_Motor_Interface.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "Odometry_Interface.h"
+#include "Odometry_Config.h"
+#include "Odometry_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+/* sin(i x 90 / 64 degrees) in Q15 */
+static const s16 SODO_As16Sine[ODO_SINE_POINTS] =
+{
+	0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739, 9512,
+	10278, 11039, 11793, 12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+	18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594, 23170, 23731, 24279,
+	24811, 25329, 25832, 26319, 26790, 27245, 27683, 28105, 28510, 28898, 29268,
+	29621, 29956, 30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971, 32137,
+	32285, 32412, 32521, 32609, 32678, 32728, 32757, 32767
+};
+
+/* pose in um and binary angle (2^32 is a full turn) */
+static s32 SODO_s32X = 0;
+static s32 SODO_s32Y = 0;
+static u32 SODO_u32Heading = 0;
+static s32 SODO_s32Travel = 0;
+static u32 SODO_u32LastTime = 0;
+
+/* set while the pose is integrated, the command hook may run in an interrupt */
+static volatile u8 SODO_u8Updating = 0;
+
+/*******************************************************************************
+ *                          	Private Functions	                           *
+ *******************************************************************************/
+/**
+ * @brief Sine of a binary angle in Q15, interpolated in the quarter table.
+ */
+static s32 SODO_s32Sine(u32 Copy_u32Angle)
+{
+	u32 L_u32Quadrant = (Copy_u32Angle >> 30) & 3;
+	u32 L_u32Position = Copy_u32Angle & (ODO_QUARTER - 1);
+	u32 L_u32Index;
+	s32 L_s32Fraction;
+	s32 L_s32Value;
+
+	if (L_u32Quadrant & 1)
+	{
+		L_u32Position = ODO_QUARTER - L_u32Position;
+	}
+	L_u32Index = L_u32Position >> 24;
+	L_s32Fraction = (s32)((L_u32Position >> 16) & 0xFF);
+	L_s32Value = SODO_As16Sine[L_u32Index];
+	if (L_u32Index < (ODO_SINE_POINTS - 1))
+	{
+		L_s32Value += ((SODO_As16Sine[L_u32Index + 1] - SODO_As16Sine[L_u32Index]) * L_s32Fraction) / 256;
+	}
+	return (L_u32Quadrant & 2) ? -L_s32Value : L_s32Value;
+}
+
+/**
+ * @brief Speed of the wheels of a side in mm/s for its command.
+ */
+static s32 SODO_s32WheelSpeed(s16 Copy_s16Command)
+{
+	return ((s32)Copy_s16Command * ODO_SPEED_LEVEL_MM_S) / 1000;
+}
+
+/**
+ * @brief Integrate one step of the wheel speeds.
+ *
+ * The travel of the car is taken along the heading of the middle of the step,
+ * which is exact on an arc.
+ */
+static void SODO_voidStep(s32 Copy_s32Left, s32 Copy_s32Right, u32 Copy_u32Time)
+{
+	s32 L_s32LeftUm = (Copy_s32Left * (s32)Copy_u32Time) / ODO_US_PER_MS;
+	s32 L_s32RightUm = (Copy_s32Right * (s32)Copy_u32Time) / ODO_US_PER_MS;
+	s32 L_s32Travel = (L_s32LeftUm + L_s32RightUm) / 2;
+	s32 L_s32Turn = (L_s32RightUm - L_s32LeftUm) * ODO_ANGLE_PER_UM;
+	u32 L_u32Middle = SODO_u32Heading + (u32)(L_s32Turn / 2);
+
+	SODO_s32X += (L_s32Travel * SODO_s32Sine(L_u32Middle + ODO_QUARTER)) / 32768;
+	SODO_s32Y += (L_s32Travel * SODO_s32Sine(L_u32Middle)) / 32768;
+	SODO_s32Travel += L_s32Travel;
+	SODO_u32Heading += (u32)L_s32Turn;
+}
+
+/**
+ * @brief Bring the pose up to now with the command applied to the wheels.
+ *
+ * Whole steps are integrated, the rest of the time waits for the next update
+ * unless Copy_u8Flush is set. An update interrupted by the command hook is not
+ * nested: the interrupted one ends with the previous command, the next one
+ * takes the new command from there.
+ */
+static void SODO_voidUpdate(u8 Copy_u8Flush)
+{
+	s16 L_s16Left;
+	s16 L_s16Right;
+	s32 L_s32Left;
+	s32 L_s32Right;
+	u32 L_u32Now;
+	u32 L_u32Elapsed;
+
+	if (SODO_u8Updating)
+	{
+		return;
+	}
+	SODO_u8Updating = 1;
+
+	HDCM_voidGetWheelCommand(&L_s16Left, &L_s16Right);
+	L_s32Left = SODO_s32WheelSpeed(L_s16Left);
+	L_s32Right = SODO_s32WheelSpeed(L_s16Right);
+	L_u32Now = MTMR_u32GetMicros();
+	L_u32Elapsed = L_u32Now - SODO_u32LastTime;
+
+	while (L_u32Elapsed >= (ODO_PERIOD_MS * ODO_US_PER_MS))
+	{
+		SODO_voidStep(L_s32Left, L_s32Right, ODO_PERIOD_MS * ODO_US_PER_MS);
+		SODO_u32LastTime += ODO_PERIOD_MS * ODO_US_PER_MS;
+		L_u32Elapsed -= ODO_PERIOD_MS * ODO_US_PER_MS;
+	}
+	if (Copy_u8Flush && (L_u32Elapsed > 0))
+	{
+		SODO_voidStep(L_s32Left, L_s32Right, L_u32Elapsed);
+		SODO_u32LastTime = L_u32Now;
+	}
+
+	SODO_u8Updating = 0;
+}
+
+/**
+ * @brief Called by the DC motor driver before the wheel command changes.
+ */
+static void SODO_voidCommandHook(void)
+{
+	SODO_voidUpdate(1);
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Start the integration from the configured start pose.
+ */
+void SODO_voidInit(void)
+{
+	SODO_s32X = ODO_START_X_MM * ODO_UM_PER_MM;
+	SODO_s32Y = ODO_START_Y_MM * ODO_UM_PER_MM;
+	SODO_u32Heading = (u32)SODO_DEG_TO_ANGLE(ODO_START_HEADING_DEG) << 16;
+	SODO_s32Travel = 0;
+	SODO_u32LastTime = MTMR_u32GetMicros();
+	SODO_u8Updating = 0;
+	HDCM_voidSetCommandCallBack(SODO_voidCommandHook);
+}
+
+/**
+ * @brief Periodic task.
+ */
+void SODO_voidTask(void)
+{
+	SODO_voidUpdate(0);
+}
+
+/**
+ * @brief Get the pose of the car, brought up to date.
+ */
+u8 SODO_u8GetPose(SODO_POSE_t * P_Pose)
+{
+	s16 L_s16Left;
+	s16 L_s16Right;
+
+	if (P_Pose == NULL)
+	{
+		return NULL_PTR_ERR;
+	}
+
+	SODO_voidUpdate(1);
+	HDCM_voidGetWheelCommand(&L_s16Left, &L_s16Right);
+
+	P_Pose->Pose_s32X = SODO_s32X / ODO_UM_PER_MM;
+	P_Pose->Pose_s32Y = SODO_s32Y / ODO_UM_PER_MM;
+	P_Pose->Pose_u16Heading = (u16)(SODO_u32Heading >> 16);
+	P_Pose->Pose_s16Speed = (s16)((SODO_s32WheelSpeed(L_s16Left) + SODO_s32WheelSpeed(L_s16Right)) / 2);
+	P_Pose->Pose_s32Travel = SODO_s32Travel / ODO_UM_PER_MM;
+	P_Pose->Pose_u32Time = SODO_u32LastTime;
+	return OK;
+}
+
+/**
+ * @brief Get the heading of the car in degrees (0 to 359).
+ */
+u16 SODO_u16GetHeadingDeg(void)
+{
+	return (u16)(((u32)(u16)(SODO_u32Heading >> 16) * 360UL) >> 16);
+}
+
+/**
+ * @brief Sine of a binary angle (65536 is a full turn).
+ */
+s16 SODO_s16Sine(u16 Copy_u16Angle)
+{
+	return (s16)SODO_s32Sine((u32)Copy_u16Angle << 16);
+}
+
+/**
+ * @brief Get the speed of the car in cm/s.
+ */
+u16 SODO_u16GetSpeedCmS(void)
+{
+	s16 L_s16Left;
+	s16 L_s16Right;
+	s32 L_s32Speed;
+
+	HDCM_voidGetWheelCommand(&L_s16Left, &L_s16Right);
+	L_s32Speed = (SODO_s32WheelSpeed(L_s16Left) + SODO_s32WheelSpeed(L_s16Right)) / 2;
+	if (L_s32Speed < 0)
+	{
+		L_s32Speed = -L_s32Speed;
+	}
+	return (u16)(L_s32Speed / 10);
+}
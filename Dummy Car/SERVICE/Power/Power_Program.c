@@ -0,0 +1,143 @@
+/******************************************************************************
+ *
+ * @File: Power_Program.c
+ *
+ * @Brief: Implementation of functions for the Power Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/RCC/RCC_Interface.h"
+#include "../../MCAL/SYSTICK/SYSTICK_Interface.h"
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+#include "../../MCAL/USART/USART_Interface.h"
+#include "../../HAL/Ultrasonic/Ultrasonic_Interface.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../Trace/Trace_Interface.h"
+#include "Power_Interface.h"
+#include "Power_Config.h"
+#include "Power_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+static const PWR_PROFILE_t SPWR_AstrProfiles[PWR_PROFILE_COUNT] =
+{
+	{PWR_PARKED_CLOCK,    PWR_PARKED_AHB_DIVIDER},
+	{PWR_CRUISE_CLOCK,    PWR_CRUISE_AHB_DIVIDER},
+	{PWR_MANOEUVRE_CLOCK, PWR_MANOEUVRE_AHB_DIVIDER}
+};
+
+static u8 SPWR_u8Profile = PWR_PROFILE_NONE;
+
+/*******************************************************************************
+ *                          	Private Functions                              *
+ *******************************************************************************/
+static void SPWR_voidGateBus(u8 Copy_u8Bus, u32 Copy_u32Mask)
+{
+	u8 L_u8Bit;
+
+	for (L_u8Bit = 0; L_u8Bit < 32; L_u8Bit++)
+	{
+		if (GET_BIT(Copy_u32Mask, L_u8Bit))
+		{
+			MRCC_VoidDisablePeriphral(Copy_u8Bus, L_u8Bit);
+		}
+	}
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Stop the clock of the unused peripherals and enter the parked profile.
+ */
+void SPWR_voidInit(void)
+{
+	SPWR_voidGateBus(AHB1_BUS, PWR_UNUSED_AHB1);
+	SPWR_voidGateBus(APB1_BUS, PWR_UNUSED_APB1);
+	SPWR_voidGateBus(APB2_BUS, PWR_UNUSED_APB2);
+
+	SPWR_u8SetProfile(SPWR_PROFILE_PARKED);
+}
+
+/**
+ * @brief Change the power profile.
+ *
+ * The motor timer is clocked before the switch and gated after it, so its
+ * prescaler is always computed while it runs. The SysTick, timer and USART
+ * divisors are derived again from the new clock tree. The switch waits for the
+ * end of an ultrasonic echo, the timer that times it gets a new prescaler.
+ */
+u8 SPWR_u8SetProfile(u8 Copy_u8Profile)
+{
+	u8 L_u8ErrorState;
+
+	if (Copy_u8Profile >= PWR_PROFILE_COUNT)
+	{
+		return OUT_OF_RANGE;
+	}
+	if (Copy_u8Profile == SPWR_u8Profile)
+	{
+		return OK;
+	}
+	if (HUS_u8IsMeasuring() != 0)
+	{
+		return NOK;
+	}
+
+#if PWR_PARKED_GATE_MOTOR_TIMER == 1
+	/* the motor timer is clocked again before its prescaler is computed */
+	if (Copy_u8Profile != SPWR_PROFILE_PARKED)
+	{
+		MRCC_VoidEnablePeriphral(APB1_BUS, RCC_APB1_TIMER2);
+	}
+#endif
+
+	L_u8ErrorState = MRCC_u8SwitchSysClk(SPWR_AstrProfiles[Copy_u8Profile].Pwr_u8Source,
+										 SPWR_AstrProfiles[Copy_u8Profile].Pwr_u16AhbDivider);
+	if (L_u8ErrorState != OK)
+	{
+		return NOK;
+	}
+
+	/* same delays, timer frequencies and baud rates with the new clock */
+	MSTK_voidInit();
+	MTMR_voidUpdateClock();
+	MUSART_voidUpdateClock();
+
+#if PWR_PARKED_GATE_MOTOR_TIMER == 1
+	if (Copy_u8Profile == SPWR_PROFILE_PARKED)
+	{
+		MRCC_VoidDisablePeriphral(APB1_BUS, RCC_APB1_TIMER2);
+	}
+#endif
+
+	SPWR_u8Profile = Copy_u8Profile;
+	STRACE_voidLog(STRACE_EVT_POWER_PROFILE, Copy_u8Profile, (u16)(MRCC_u32GetAhbClk() / PWR_HZ_PER_MHZ));
+	return OK;
+}
+
+/**
+ * @brief Get the active power profile.
+ */
+u8 SPWR_u8GetProfile(void)
+{
+	return SPWR_u8Profile;
+}
@@ -0,0 +1,106 @@
+/******************************************************************************
+ *
+ * @file Scan_Config.h
+ *
+ * @brief Configuration file for the Scan (ultrasonic sensor ring) module.
+ *
+ * The sensors are fired by time slots: the sensors of one slot are triggered
+ * together, the slots follow each other. Sensors facing opposite directions
+ * don't hear each other and share a slot, so a sweep of the four sensors takes
+ * two echo times instead of four.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_SCAN_SCAN_CONFIG_H_
+#define SERVICE_SCAN_SCAN_CONFIG_H_
+
+/**
+ * @brief Sensors of each slot (SSCAN_SENSOR masks), slots 0 to SCAN_SLOT_COUNT - 1.
+ *
+ * Every sensor must be in one slot. Sensors that can hear each other's ping
+ * (adjacent directions) must be in different slots.
+ */
+#define SCAN_SLOT_COUNT				2
+#define SCAN_SLOT0_SENSORS			(SSCAN_SENSOR(FORWARD_US) | SSCAN_SENSOR(BACKWARD_US))
+#define SCAN_SLOT1_SENSORS			(SSCAN_SENSOR(LEFT_US) | SSCAN_SENSOR(RIGHT_US))
+#define SCAN_SLOT2_SENSORS			0
+#define SCAN_SLOT3_SENSORS			0
+
+/**
+ * @brief Shortest time between the triggers of two slots (us).
+ *
+ * A slot starts when the previous one has all its echoes and this time has
+ * passed, so the late reflections of the previous pings (about 2 m) have faded.
+ */
+#define SCAN_STAGGER_US				12000UL
+
+/**
+ * @brief Crosstalk window of each pair of sensors (cm), 0 for the pairs never fired together.
+ *
+ * When two sensors fired together report distances closer than the window,
+ * one may have heard the other's ping. A reading is then rejected if it also
+ * jumped more than SCAN_MAX_JUMP_CM from the previous reading of its sensor.
+ */
+#define SCAN_CROSSTALK_WINDOW_CM	{ \
+	/*           FORWARD  LEFT  RIGHT  BACKWARD */	\
+	/* FORWARD  */ { 0,     0,    0,     5 },		\
+	/* LEFT     */ { 0,     0,    5,     0 },		\
+	/* RIGHT    */ { 0,     5,    0,     0 },		\
+	/* BACKWARD */ { 5,     0,    0,     0 }		\
+}
+
+#define SCAN_MAX_JUMP_CM			30
+
+/**
+ * @brief Readings beyond this distance (cm) are never taken for crosstalk.
+ *
+ * The sensors without echo all report the same timeout distance.
+ */
+#define SCAN_CROSSTALK_RANGE_CM		400
+
+/**
+ * @brief Ping period of each sensor in each mode (us), index [mode][sensor - 1].
+ *
+ * 0 turns the sensor off (it still answers SSCAN_voidRequest), SCAN_BY_SPEED
+ * pings it every SCAN_TRAVEL_CM travelled.
+ */
+#define SCAN_MODE_PERIODS_US		{ \
+	/*              FORWARD          LEFT        RIGHT       BACKWARD */	\
+	/* PARKED     */ { 500000UL,      0,          0,          0 },		\
+	/* CRUISE     */ { SCAN_BY_SPEED, 0,          0,          0 },		\
+	/* LEFT_SIDE  */ { SCAN_BY_SPEED, 30000UL,    0,          0 },		\
+	/* RIGHT_SIDE */ { SCAN_BY_SPEED, 0,          30000UL,    0 }		\
+}
+
+/**
+ * @brief Speed driven period: the sensor is pinged every SCAN_TRAVEL_CM, the period
+ *        stays between SCAN_MIN_PERIOD_US and SCAN_MAX_PERIOD_US (also used when stopped).
+ */
+#define SCAN_TRAVEL_CM				5
+#define SCAN_MIN_PERIOD_US			30000UL
+#define SCAN_MAX_PERIOD_US			500000UL
+
+/**
+ * @brief Range gate of each sensor (cm, 0 for the full range).
+ *
+ * A measurement ends as soon as the echo is beyond the gate, set it just above
+ * the farthest distance the application decides on. The dummy car reports
+ * an object within 200 cm ahead.
+ */
+#define SCAN_GATE_FORWARD_CM		250
+#define SCAN_GATE_LEFT_CM			60
+#define SCAN_GATE_RIGHT_CM			60
+#define SCAN_GATE_BACKWARD_CM		0
+
+/**
+ * @brief Idle time given while a slot waits for its echoes (us).
+ *
+ * The echo edges wake the core, this only bounds the wait for a sensor that
+ * never answers.
+ */
+#define SCAN_PENDING_POLL_US		1000UL
+
+#endif /* SERVICE_SCAN_SCAN_CONFIG_H_ */
@@ -0,0 +1,427 @@
+/******************************************************************************
+ *
+ * @File: Scan_Program.c
+ *
+ * @Brief: Implementation of functions for the Scan Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+
+/*******************************************************************************
+ *                          	HAL Components                                 *
+ *******************************************************************************/
+#include "../../HAL/Ultrasonic/Ultrasonic_Interface.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../Trace/Trace_Interface.h"
+#include "Scan_Interface.h"
+#include "Scan_Config.h"
+#include "Scan_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+static const u8 SSCAN_Au8Slots[4] =
+{
+	SCAN_SLOT0_SENSORS, SCAN_SLOT1_SENSORS, SCAN_SLOT2_SENSORS, SCAN_SLOT3_SENSORS
+};
+static const u8 SSCAN_Au8CrosstalkCm[SCAN_SENSOR_COUNT][SCAN_SENSOR_COUNT] = SCAN_CROSSTALK_WINDOW_CM;
+static const u32 SSCAN_Au32Periods[SCAN_MODE_COUNT][SCAN_SENSOR_COUNT] = SCAN_MODE_PERIODS_US;
+static const u16 SSCAN_Au16Gates[SCAN_SENSOR_COUNT] =
+{
+	SCAN_GATE_FORWARD_CM, SCAN_GATE_LEFT_CM, SCAN_GATE_RIGHT_CM, SCAN_GATE_BACKWARD_CM
+};
+
+static SCAN_SENSOR_t SSCAN_AstrSensors[SCAN_SENSOR_COUNT];
+static u8 SSCAN_u8Slot = 0;
+/* sensors pinged in the current slot, only their readings are checked and accepted */
+static u8 SSCAN_u8Fired = 0;
+/* sensors of the current slot still measuring */
+static u8 SSCAN_u8Pending = 0;
+static u32 SSCAN_u32SlotStart = 0;
+static u32 SSCAN_u32Sweeps = 0;
+
+/*******************************************************************************
+ *                          	Private Functions                              *
+ *******************************************************************************/
+static f32 SSCAN_f32Diff(f32 Copy_f32A, f32 Copy_f32B)
+{
+	return (Copy_f32A > Copy_f32B) ? (Copy_f32A - Copy_f32B) : (Copy_f32B - Copy_f32A);
+}
+
+/**
+ * @brief Check the readings of a finished slot and keep the plausible ones.
+ *
+ * Copy_u8Sensors are the sensors pinged in the slot: the others (not due,
+ * busy or not fitted) keep their raw value of an older slot, which is neither
+ * accepted again nor compared. A reading is suspect when a sensor fired with
+ * it reports about the same distance (crosstalk window of the pair), a
+ * suspect reading far from the previous one of its sensor is rejected.
+ */
+static void SSCAN_voidAccept(u8 Copy_u8Sensors, u32 Copy_u32Time)
+{
+	u8 L_u8Suspect = 0;
+	u8 L_u8I;
+	u8 L_u8J;
+
+	for (L_u8I = 0; L_u8I < SCAN_SENSOR_COUNT; L_u8I++)
+	{
+		for (L_u8J = L_u8I + 1; L_u8J < SCAN_SENSOR_COUNT; L_u8J++)
+		{
+			f32 L_f32RawI = SSCAN_AstrSensors[L_u8I].Scan_f32Raw;
+			f32 L_f32RawJ = SSCAN_AstrSensors[L_u8J].Scan_f32Raw;
+
+			if ((GET_BIT(Copy_u8Sensors, L_u8I) != 0) && (GET_BIT(Copy_u8Sensors, L_u8J) != 0) &&
+				(L_f32RawI < SCAN_CROSSTALK_RANGE_CM) && (L_f32RawJ < SCAN_CROSSTALK_RANGE_CM) &&
+				(SSCAN_f32Diff(L_f32RawI, L_f32RawJ) < SSCAN_Au8CrosstalkCm[L_u8I][L_u8J]))
+			{
+				SET_BIT(L_u8Suspect, L_u8I);
+				SET_BIT(L_u8Suspect, L_u8J);
+			}
+		}
+	}
+
+	for (L_u8I = 0; L_u8I < SCAN_SENSOR_COUNT; L_u8I++)
+	{
+		SCAN_SENSOR_t * L_pSensor = &SSCAN_AstrSensors[L_u8I];
+
+		if (GET_BIT(Copy_u8Sensors, L_u8I) == 0)
+		{
+			continue;
+		}
+		if ((GET_BIT(L_u8Suspect, L_u8I) != 0) && (L_pSensor->Scan_u8Valid != 0) &&
+			(SSCAN_f32Diff(L_pSensor->Scan_f32Raw, L_pSensor->Scan_f32Distance) > SCAN_MAX_JUMP_CM))
+		{
+			STRACE_voidLog(STRACE_EVT_US_CROSSTALK, L_u8I + 1, (u16)L_pSensor->Scan_f32Raw);
+			continue;
+		}
+		L_pSensor->Scan_f32Distance = L_pSensor->Scan_f32Raw;
+		L_pSensor->Scan_u32Time = Copy_u32Time;
+		L_pSensor->Scan_u8Valid = 1;
+		L_pSensor->Scan_u8New = 1;
+		L_pSensor->Scan_u8Requested = 0;
+	}
+}
+
+/**
+ * @brief Sensors of a slot that must be pinged now.
+ */
+static u8 SSCAN_u8GetDue(u8 Copy_u8Slot, u32 Copy_u32Now)
+{
+	u8 L_u8Due = 0;
+	u8 L_u8Sensor;
+
+	for (L_u8Sensor = 0; L_u8Sensor < SCAN_SENSOR_COUNT; L_u8Sensor++)
+	{
+		const SCAN_SENSOR_t * L_pSensor = &SSCAN_AstrSensors[L_u8Sensor];
+
+		if ((GET_BIT(SSCAN_Au8Slots[Copy_u8Slot], L_u8Sensor) != 0) &&
+			((L_pSensor->Scan_u8Requested != 0) ||
+			 ((L_pSensor->Scan_u32Period != 0) && ((Copy_u32Now - L_pSensor->Scan_u32LastTrigger) >= L_pSensor->Scan_u32Period))))
+		{
+			SET_BIT(L_u8Due, L_u8Sensor);
+		}
+	}
+	return L_u8Due;
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Forget the readings and start a new sweep.
+ */
+void SSCAN_voidInit(void)
+{
+	u8 L_u8Sensor;
+
+	u32 L_u32Now = MTMR_u32GetMicros();
+
+	for (L_u8Sensor = 0; L_u8Sensor < SCAN_SENSOR_COUNT; L_u8Sensor++)
+	{
+		SSCAN_AstrSensors[L_u8Sensor].Scan_u8Valid = 0;
+		SSCAN_AstrSensors[L_u8Sensor].Scan_u8New = 0;
+		SSCAN_AstrSensors[L_u8Sensor].Scan_u8Requested = 0;
+		// every sensor that is on is due at once
+		SSCAN_AstrSensors[L_u8Sensor].Scan_u32LastTrigger = L_u32Now - SCAN_MAX_PERIOD_US;
+		HUS_u8SetRangeGate(L_u8Sensor + 1, SSCAN_Au16Gates[L_u8Sensor]);
+	}
+	SSCAN_u8SetMode(SSCAN_MODE_PARKED, 0);
+	// the next slot is slot 0
+	SSCAN_u8Slot = SCAN_SLOT_COUNT - 1;
+	SSCAN_u8Fired = 0;
+	SSCAN_u8Pending = 0;
+	SSCAN_u32SlotStart = L_u32Now - SCAN_STAGGER_US;
+	SSCAN_u32Sweeps = 0;
+}
+
+/**
+ * @brief Set the ping periods from what the car is doing.
+ */
+u8 SSCAN_u8SetMode(u8 Copy_u8Mode, u16 Copy_u16SpeedCmS)
+{
+	u8 L_u8Sensor;
+	u32 L_u32Period;
+
+	if (Copy_u8Mode >= SCAN_MODE_COUNT)
+	{
+		return OUT_OF_RANGE;
+	}
+
+	for (L_u8Sensor = 0; L_u8Sensor < SCAN_SENSOR_COUNT; L_u8Sensor++)
+	{
+		L_u32Period = SSCAN_Au32Periods[Copy_u8Mode][L_u8Sensor];
+		if (L_u32Period == SCAN_BY_SPEED)
+		{
+			// one ping every SCAN_TRAVEL_CM
+			L_u32Period = SCAN_MAX_PERIOD_US;
+			if (Copy_u16SpeedCmS != 0)
+			{
+				L_u32Period = (SCAN_TRAVEL_CM * SCAN_US_PER_S) / Copy_u16SpeedCmS;
+			}
+			if (L_u32Period < SCAN_MIN_PERIOD_US)
+			{
+				L_u32Period = SCAN_MIN_PERIOD_US;
+			}
+			else if (L_u32Period > SCAN_MAX_PERIOD_US)
+			{
+				L_u32Period = SCAN_MAX_PERIOD_US;
+			}
+		}
+		SSCAN_AstrSensors[L_u8Sensor].Scan_u32Period = L_u32Period;
+	}
+	return OK;
+}
+
+/**
+ * @brief Ping a sensor in the next slot that has it.
+ */
+void SSCAN_voidRequest(USNUM_t Copy_Sensor)
+{
+	if ((Copy_Sensor >= FORWARD_US) && (Copy_Sensor <= BACKWARD_US))
+	{
+		SSCAN_AstrSensors[Copy_Sensor - 1].Scan_u8Requested = 1;
+	}
+}
+
+/**
+ * @brief Collect the echoes of the current slot, start the next slot when it is time.
+ */
+void SSCAN_voidTask(void)
+{
+	u8 L_u8Sensor;
+	u8 L_u8Slot;
+	u8 L_u8Count;
+	u8 L_u8Due = 0;
+	u32 L_u32Now;
+
+	if (SSCAN_u8Pending != 0)
+	{
+		for (L_u8Sensor = 0; L_u8Sensor < SCAN_SENSOR_COUNT; L_u8Sensor++)
+		{
+			if ((GET_BIT(SSCAN_u8Pending, L_u8Sensor) != 0) &&
+				(HUS_u8GetDistance(L_u8Sensor + 1, &SSCAN_AstrSensors[L_u8Sensor].Scan_f32Raw) == OK))
+			{
+				CLR_BIT(SSCAN_u8Pending, L_u8Sensor);
+			}
+		}
+		if (SSCAN_u8Pending != 0)
+		{
+			return;
+		}
+		SSCAN_voidAccept(SSCAN_u8Fired, SSCAN_u32SlotStart);
+		SSCAN_u8Fired = 0;
+	}
+
+	L_u32Now = MTMR_u32GetMicros();
+	if ((L_u32Now - SSCAN_u32SlotStart) < SCAN_STAGGER_US)
+	{
+		return;
+	}
+
+	// next slot with a sensor to ping, the slots with nothing due are skipped
+	L_u8Slot = SSCAN_u8Slot;
+	for (L_u8Count = 0; L_u8Count < SCAN_SLOT_COUNT; L_u8Count++)
+	{
+		L_u8Slot++;
+		if (L_u8Slot >= SCAN_SLOT_COUNT)
+		{
+			L_u8Slot = 0;
+		}
+		L_u8Due = SSCAN_u8GetDue(L_u8Slot, L_u32Now);
+		if (L_u8Due != 0)
+		{
+			break;
+		}
+	}
+	if (L_u8Due == 0)
+	{
+		return;
+	}
+
+	if (L_u8Slot <= SSCAN_u8Slot)
+	{
+		SSCAN_u32Sweeps++;
+	}
+	SSCAN_u8Slot = L_u8Slot;
+	SSCAN_u32SlotStart = L_u32Now;
+	for (L_u8Sensor = 0; L_u8Sensor < SCAN_SENSOR_COUNT; L_u8Sensor++)
+	{
+		// a sensor still busy with a gated echo is due again at the next slot
+		if ((GET_BIT(L_u8Due, L_u8Sensor) != 0) && (HUS_u8StartMeasure(L_u8Sensor + 1) == OK))
+		{
+			SSCAN_AstrSensors[L_u8Sensor].Scan_u32LastTrigger = L_u32Now;
+			SET_BIT(SSCAN_u8Fired, L_u8Sensor);
+			SET_BIT(SSCAN_u8Pending, L_u8Sensor);
+		}
+	}
+}
+
+/**
+ * @brief Get the latest accepted distance of a sensor.
+ */
+u8 SSCAN_u8GetDistance(USNUM_t Copy_Sensor, f32 * P_f32Distance)
+{
+	if (P_f32Distance == NULL)
+	{
+		return NULL_PTR_ERR;
+	}
+	if ((Copy_Sensor < FORWARD_US) || (Copy_Sensor > BACKWARD_US))
+	{
+		return OUT_OF_RANGE;
+	}
+	if (SSCAN_AstrSensors[Copy_Sensor - 1].Scan_u8Valid == 0)
+	{
+		return NOK;
+	}
+	*P_f32Distance = SSCAN_AstrSensors[Copy_Sensor - 1].Scan_f32Distance;
+	return OK;
+}
+
+/**
+ * @brief Get the latest accepted distance of a sensor if it was not read yet.
+ */
+u8 SSCAN_u8GetNewDistance(USNUM_t Copy_Sensor, f32 * P_f32Distance)
+{
+	u8 L_u8ErrorState = SSCAN_u8GetDistance(Copy_Sensor, P_f32Distance);
+
+	if (L_u8ErrorState != OK)
+	{
+		return L_u8ErrorState;
+	}
+	if (SSCAN_AstrSensors[Copy_Sensor - 1].Scan_u8New == 0)
+	{
+		return NOK;
+	}
+	SSCAN_AstrSensors[Copy_Sensor - 1].Scan_u8New = 0;
+	return OK;
+}
+
+/**
+ * @brief Get the latest accepted distance of a sensor with its trigger time.
+ */
+u8 SSCAN_u8GetReading(USNUM_t Copy_Sensor, f32 * P_f32Distance, u32 * P_u32Time)
+{
+	u8 L_u8ErrorState;
+
+	if (P_u32Time == NULL)
+	{
+		return NULL_PTR_ERR;
+	}
+	L_u8ErrorState = SSCAN_u8GetDistance(Copy_Sensor, P_f32Distance);
+	if (L_u8ErrorState == OK)
+	{
+		*P_u32Time = SSCAN_AstrSensors[Copy_Sensor - 1].Scan_u32Time;
+	}
+	return L_u8ErrorState;
+}
+
+/**
+ * @brief Age of the latest accepted distance of a sensor.
+ */
+u32 SSCAN_u32GetAge(USNUM_t Copy_Sensor)
+{
+	if ((Copy_Sensor < FORWARD_US) || (Copy_Sensor > BACKWARD_US) ||
+		(SSCAN_AstrSensors[Copy_Sensor - 1].Scan_u8Valid == 0))
+	{
+		return 0xFFFFFFFF;
+	}
+	return MTMR_u32GetMicros() - SSCAN_AstrSensors[Copy_Sensor - 1].Scan_u32Time;
+}
+
+/**
+ * @brief Range gate of a sensor.
+ */
+u16 SSCAN_u16GetRangeGate(USNUM_t Copy_Sensor)
+{
+	if ((Copy_Sensor < FORWARD_US) || (Copy_Sensor > BACKWARD_US))
+	{
+		return 0;
+	}
+	return SSCAN_Au16Gates[Copy_Sensor - 1];
+}
+
+/**
+ * @brief Number of complete sweeps since SSCAN_voidInit.
+ */
+u32 SSCAN_u32GetSweepCount(void)
+{
+	return SSCAN_u32Sweeps;
+}
+
+/**
+ * @brief Time the main loop can sleep before the task has something to do.
+ */
+u32 SSCAN_u32GetIdleTime(void)
+{
+	u32 L_u32Now = MTMR_u32GetMicros();
+	u32 L_u32Idle = 0xFFFFFFFF;
+	u32 L_u32Elapsed;
+	u8 L_u8Sensor;
+
+	if (SSCAN_u8Pending != 0)
+	{
+		return SCAN_PENDING_POLL_US;
+	}
+
+	for (L_u8Sensor = 0; L_u8Sensor < SCAN_SENSOR_COUNT; L_u8Sensor++)
+	{
+		const SCAN_SENSOR_t * L_pSensor = &SSCAN_AstrSensors[L_u8Sensor];
+
+		L_u32Elapsed = L_u32Now - L_pSensor->Scan_u32LastTrigger;
+		if ((L_pSensor->Scan_u8Requested != 0) ||
+			((L_pSensor->Scan_u32Period != 0) && (L_u32Elapsed >= L_pSensor->Scan_u32Period)))
+		{
+			L_u32Idle = 0;
+		}
+		else if ((L_pSensor->Scan_u32Period != 0) && ((L_pSensor->Scan_u32Period - L_u32Elapsed) < L_u32Idle))
+		{
+			L_u32Idle = L_pSensor->Scan_u32Period - L_u32Elapsed;
+		}
+	}
+
+	// the next slot can't start before the stagger time
+	L_u32Elapsed = L_u32Now - SSCAN_u32SlotStart;
+	if ((L_u32Idle != 0xFFFFFFFF) && (L_u32Elapsed < SCAN_STAGGER_US) && ((SCAN_STAGGER_US - L_u32Elapsed) > L_u32Idle))
+	{
+		L_u32Idle = SCAN_STAGGER_US - L_u32Elapsed;
+	}
+	return L_u32Idle;
+}
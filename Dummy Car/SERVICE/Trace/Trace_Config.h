@@ -0,0 +1,32 @@
+/******************************************************************************
+ *
+ * @file Trace_Config.h
+ *
+ * @brief Configuration file for the Trace (flight recorder) module.
+ *
+ * This file defines the size of the RAM ring buffer used to record the last
+ * events of the car before an incident.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_TRACE_TRACE_CONFIG_H_
+#define SERVICE_TRACE_TRACE_CONFIG_H_
+
+/**
+ * @brief Number of events kept in the ring buffer.
+ *
+ * Each event takes 8 bytes of SRAM. The value must be a power of two so the
+ * write index can be wrapped with a mask instead of a division.
+ * 1024 events (8 KB) hold a few seconds of driving at the usual event rate.
+ */
+#define TRACE_BUFFER_SIZE		1024
+
+/**
+ * @brief Bluetooth order that stops the car and dumps the recorder over USART6.
+ */
+#define TRACE_DUMP_ORDER		'T'
+
+#endif /* SERVICE_TRACE_TRACE_CONFIG_H_ */
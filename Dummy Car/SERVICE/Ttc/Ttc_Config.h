@@ -0,0 +1,53 @@
+/******************************************************************************
+ *
+ * @file Ttc_Config.h
+ *
+ * @brief Configuration file for the Ttc (time to collision) module.
+ *
+ * Each ultrasonic direction has a range tracker (alpha-beta filter) fed with
+ * the readings of the scanner. The range rate of the tracker is combined with
+ * the speeds of this car and of the car ahead (V2V) to give the time to
+ * collision.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_TTC_TTC_CONFIG_H_
+#define SERVICE_TTC_TTC_CONFIG_H_
+
+/**
+ * @brief Filter gains (/256).
+ *
+ * ALPHA: part of the range error taken by the range, BETA: by the range rate.
+ */
+#define TTC_ALPHA_Q8				128
+#define TTC_BETA_Q8					64
+
+/**
+ * @brief Readings before the range rate of a track is trusted.
+ */
+#define TTC_MIN_SAMPLES				3
+
+/**
+ * @brief A track is restarted when its readings are further apart (ms).
+ */
+#define TTC_MAX_GAP_MS				600
+
+/**
+ * @brief Largest range rate kept by the filter (cm/s), the rest is noise.
+ */
+#define TTC_MAX_RATE_CM_S			500
+
+/**
+ * @brief Weight of the V2V closing speed when the range rate is known too (/256).
+ */
+#define TTC_V2V_WEIGHT_Q8			128
+
+/**
+ * @brief Slowest closing speed that gives a time to collision (cm/s).
+ */
+#define TTC_MIN_CLOSING_CM_S		2
+
+#endif /* SERVICE_TTC_TTC_CONFIG_H_ */
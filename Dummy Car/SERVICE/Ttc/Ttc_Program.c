@@ -0,0 +1,277 @@
+/******************************************************************************
+ *
+ * @File: Ttc_Program.c
+ *
+ * @Brief: Implementation of functions for the Ttc Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+
+/*******************************************************************************
+ *                          	HAL Components                                 *
+ *******************************************************************************/
+#include "../../HAL/Ultrasonic/Ultrasonic_Interface.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../V2V/V2V_Interface.h"
+#include "../Neighbour/Neighbour_Interface.h"
+#include "../Scan/Scan_Interface.h"
+#include "Ttc_Interface.h"
+#include "Ttc_Config.h"
+#include "Ttc_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+static TTC_TRACK_t STTC_AstrTracks[TTC_SENSOR_COUNT];
+static u16 STTC_u16OwnSpeed = 0;
+
+/*******************************************************************************
+ *                          	Private Functions                              *
+ *******************************************************************************/
+static s32 STTC_s32Clamp(s32 Copy_s32Value, s32 Copy_s32Limit)
+{
+	if (Copy_s32Value > Copy_s32Limit)
+	{
+		return Copy_s32Limit;
+	}
+	if (Copy_s32Value < -Copy_s32Limit)
+	{
+		return -Copy_s32Limit;
+	}
+	return Copy_s32Value;
+}
+
+/**
+ * @brief Add a reading to a track (alpha-beta filter).
+ *
+ * @param Copy_s32Range The reading (1/16 cm).
+ * @param Copy_u32Time  Its time (us).
+ */
+static void STTC_voidFilter(TTC_TRACK_t * P_Track, s32 Copy_s32Range, u32 Copy_u32Time)
+{
+	u32 L_u32DtMs = (Copy_u32Time - P_Track->Ttc_u32Time) / TTC_US_PER_MS;
+	s32 L_s32Predicted;
+	s32 L_s32Error;
+	s32 L_s32RateError;
+
+	if ((P_Track->Ttc_u8Samples == 0) || (L_u32DtMs > TTC_MAX_GAP_MS))
+	{
+		// new target: the rate is unknown
+		P_Track->Ttc_s32Range = Copy_s32Range;
+		P_Track->Ttc_s32Rate = 0;
+		P_Track->Ttc_u32Time = Copy_u32Time;
+		P_Track->Ttc_u8Samples = 1;
+		P_Track->Ttc_u8Track++;
+		return;
+	}
+	if (L_u32DtMs == 0)
+	{
+		L_u32DtMs = 1;
+	}
+
+	L_s32Predicted = P_Track->Ttc_s32Range + (P_Track->Ttc_s32Rate * (s32)L_u32DtMs) / TTC_MS_PER_S;
+	L_s32Error = Copy_s32Range - L_s32Predicted;
+	P_Track->Ttc_s32Range = L_s32Predicted + (L_s32Error * TTC_ALPHA_Q8) / TTC_Q8_ONE;
+
+	L_s32RateError = STTC_s32Clamp((L_s32Error * TTC_MS_PER_S) / (s32)L_u32DtMs, TTC_MAX_RATE_CM_S * TTC_ONE);
+	P_Track->Ttc_s32Rate = STTC_s32Clamp(P_Track->Ttc_s32Rate + (L_s32RateError * TTC_BETA_Q8) / TTC_Q8_ONE,
+										 TTC_MAX_RATE_CM_S * TTC_ONE);
+
+	P_Track->Ttc_u32Time = Copy_u32Time;
+	if (P_Track->Ttc_u8Samples < 0xFF)
+	{
+		P_Track->Ttc_u8Samples++;
+	}
+}
+
+/**
+ * @brief Closing speed of a direction (1/16 cm/s), 0 if unknown.
+ */
+static s32 STTC_s32GetClosing(u8 Copy_u8Index)
+{
+	const TTC_TRACK_t * L_pTrack = &STTC_AstrTracks[Copy_u8Index];
+	SV2V_BEACON_t L_strAhead;
+	s32 L_s32Tracked = 0;
+	s32 L_s32Predicted = 0;
+	u8 L_u8HasTracked;
+	u8 L_u8HasPredicted = 0;
+
+	if (L_pTrack->Ttc_u8Samples == 0)
+	{
+		return 0;
+	}
+
+	L_u8HasTracked = (L_pTrack->Ttc_u8Samples >= TTC_MIN_SAMPLES);
+	if (L_u8HasTracked)
+	{
+		L_s32Tracked = -L_pTrack->Ttc_s32Rate;
+	}
+
+	// ahead, the speeds are known from V2V
+	if ((Copy_u8Index + 1) == FORWARD_US)
+	{
+		if (SNBR_u8GetNearestAhead(&L_strAhead) == OK)
+		{
+			L_s32Predicted = ((s32)STTC_u16OwnSpeed - (L_strAhead.Beacon_u8Brake ? 0 : (s32)L_strAhead.Beacon_u16Speed)) * TTC_ONE;
+			L_u8HasPredicted = 1;
+		}
+		else if (!L_u8HasTracked)
+		{
+			// no V2V car: taken as a fixed obstacle until the range rate is known
+			L_s32Predicted = (s32)STTC_u16OwnSpeed * TTC_ONE;
+			L_u8HasPredicted = 1;
+		}
+	}
+
+	if (L_u8HasTracked && L_u8HasPredicted)
+	{
+		return (L_s32Tracked * (TTC_Q8_ONE - TTC_V2V_WEIGHT_Q8) + L_s32Predicted * TTC_V2V_WEIGHT_Q8) / TTC_Q8_ONE;
+	}
+	return L_u8HasTracked ? L_s32Tracked : L_s32Predicted;
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Forget the tracks.
+ */
+void STTC_voidInit(void)
+{
+	u8 L_u8Index;
+
+	for (L_u8Index = 0; L_u8Index < TTC_SENSOR_COUNT; L_u8Index++)
+	{
+		STTC_AstrTracks[L_u8Index].Ttc_u8Samples = 0;
+		STTC_AstrTracks[L_u8Index].Ttc_u32Seen = 0;
+	}
+	STTC_u16OwnSpeed = 0;
+}
+
+/**
+ * @brief Take the new readings of the scanner into the tracks.
+ */
+void STTC_voidTask(u16 Copy_u16OwnSpeedCmS)
+{
+	u32 L_u32Time;
+	u16 L_u16Gate;
+	f32 L_f32Distance;
+	u8 L_u8Index;
+
+	STTC_u16OwnSpeed = Copy_u16OwnSpeedCmS;
+
+	for (L_u8Index = 0; L_u8Index < TTC_SENSOR_COUNT; L_u8Index++)
+	{
+		TTC_TRACK_t * L_pTrack = &STTC_AstrTracks[L_u8Index];
+
+		if (SSCAN_u8GetReading(L_u8Index + 1, &L_f32Distance, &L_u32Time) != OK)
+		{
+			continue;
+		}
+		// the scanner keeps the latest reading: it is new when its trigger time changes
+		if (L_u32Time == L_pTrack->Ttc_u32Seen)
+		{
+			continue;
+		}
+		L_pTrack->Ttc_u32Seen = L_u32Time;
+
+		// a reading cut at the range gate: nothing in range
+		L_u16Gate = SSCAN_u16GetRangeGate(L_u8Index + 1);
+		if ((L_u16Gate != 0) && (L_f32Distance >= L_u16Gate))
+		{
+			L_pTrack->Ttc_u8Samples = 0;
+			continue;
+		}
+		STTC_voidFilter(L_pTrack, (s32)(L_f32Distance * TTC_ONE), L_u32Time);
+	}
+}
+
+/**
+ * @brief Get the time to collision in a direction.
+ */
+u32 STTC_u32GetTtc(USNUM_t Copy_Sensor)
+{
+	const TTC_TRACK_t * L_pTrack;
+	s32 L_s32Closing;
+	u32 L_u32TtcMs;
+	u32 L_u32AgeMs;
+
+	if ((Copy_Sensor < FORWARD_US) || (Copy_Sensor > BACKWARD_US))
+	{
+		return STTC_NO_COLLISION;
+	}
+	L_pTrack = &STTC_AstrTracks[Copy_Sensor - 1];
+	L_s32Closing = STTC_s32GetClosing(Copy_Sensor - 1);
+	if ((L_pTrack->Ttc_u8Samples == 0) || (L_s32Closing < (TTC_MIN_CLOSING_CM_S * TTC_ONE)))
+	{
+		return STTC_NO_COLLISION;
+	}
+
+	// from the last reading, minus the time gone since
+	L_u32TtcMs = (u32)((L_pTrack->Ttc_s32Range * TTC_MS_PER_S) / L_s32Closing);
+	L_u32AgeMs = (MTMR_u32GetMicros() - L_pTrack->Ttc_u32Time) / TTC_US_PER_MS;
+	return (L_u32TtcMs > L_u32AgeMs) ? (L_u32TtcMs - L_u32AgeMs) : 0;
+}
+
+/**
+ * @brief Get the closing speed used for the time to collision.
+ */
+s16 STTC_s16GetClosingSpeed(USNUM_t Copy_Sensor)
+{
+	if ((Copy_Sensor < FORWARD_US) || (Copy_Sensor > BACKWARD_US))
+	{
+		return 0;
+	}
+	return (s16)(STTC_s32GetClosing(Copy_Sensor - 1) / TTC_ONE);
+}
+
+/**
+ * @brief Get the filtered range of the target in a direction.
+ */
+u8 STTC_u8GetRange(USNUM_t Copy_Sensor, STTC_RANGE_t * P_strRange)
+{
+	ERROR_STATE_T Loc_ErrorState = OK;
+	const TTC_TRACK_t * L_pTrack;
+
+	if (P_strRange == NULL)
+	{
+		Loc_ErrorState = NULL_PTR_ERR;
+	}
+	else if ((Copy_Sensor < FORWARD_US) || (Copy_Sensor > BACKWARD_US))
+	{
+		Loc_ErrorState = OUT_OF_RANGE;
+	}
+	else
+	{
+		L_pTrack = &STTC_AstrTracks[Copy_Sensor - 1];
+		if (L_pTrack->Ttc_u8Samples == 0)
+		{
+			Loc_ErrorState = NOK;
+		}
+		else
+		{
+			P_strRange->Range_u16Cm = (L_pTrack->Ttc_s32Range > 0) ? (u16)(L_pTrack->Ttc_s32Range / TTC_ONE) : 0;
+			P_strRange->Range_u32Time = L_pTrack->Ttc_u32Time;
+			P_strRange->Range_u8Track = L_pTrack->Ttc_u8Track;
+		}
+	}
+	return Loc_ErrorState;
+}
@@ -0,0 +1,80 @@
+/******************************************************************************
+ *
+ * @file V2V_Config.h
+ *
+ * @brief Configuration file for the V2V (vehicle status beacon) module.
+ *
+ * Each car publishes its status periodically over the Raspberry link and feeds
+ * the beacons received from the other cars to the neighbour table.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_V2V_V2V_CONFIG_H_
+#define SERVICE_V2V_V2V_CONFIG_H_
+
+/**
+ * @brief Vehicle ID of this car (must be unique on the network, 0 is reserved).
+ */
+#define V2V_OWN_ID					2
+
+/**
+ * @brief Color reported in the beacons of this car (1 = red).
+ */
+#define V2V_OWN_COLOR				1
+
+/**
+ * @brief Beacon period in milliseconds.
+ *
+ * One beacon takes 23 bytes, about 24 ms of the 9600 baud link.
+ */
+#define V2V_BEACON_PERIOD_MS		200
+
+/**
+ * @brief Time request period in milliseconds.
+ *
+ * Each car answers with a time response (9 + 18 bytes on the link), the
+ * offset and the drift of its clock are measured from them (SERVICE/Clock).
+ */
+#define V2V_SYNC_PERIOD_MS			1000
+
+/**
+ * @brief Emergency retransmission.
+ *
+ * An emergency that is not acknowledged after V2V_EMERGENCY_RETRY_MS is sent
+ * again, at most V2V_EMERGENCY_RETRIES times.
+ */
+#define V2V_EMERGENCY_RETRY_MS		50
+#define V2V_EMERGENCY_RETRIES		3
+
+/**
+ * @brief Overtake negotiation retransmission.
+ *
+ * An overtake request or release that is not acknowledged after
+ * V2V_OVERTAKE_RETRY_MS is sent again, at most V2V_OVERTAKE_RETRIES times.
+ * A request still not acknowledged then ends as SV2V_OVERTAKE_NO_ANSWER.
+ */
+#define V2V_OVERTAKE_RETRY_MS		60
+#define V2V_OVERTAKE_RETRIES		3
+
+/**
+ * @brief Number of checked frames waiting for PendSV (power of two).
+ *
+ * The USART1 interrupt checks the frames, PendSV decodes them right after the
+ * interrupts return. A frame is dropped if the queue is full. The emergency
+ * warnings don't wait in it.
+ */
+#define V2V_RX_FRAMES				4
+
+/**
+ * @brief Number of received beacons waiting for the task (power of two).
+ *
+ * PendSV decodes the beacons, the task moves them to the
+ * neighbour table. A beacon is dropped if the queue is full. The received time
+ * responses have a queue of the same size.
+ */
+#define V2V_RX_QUEUE_SIZE			4
+
+#endif /* SERVICE_V2V_V2V_CONFIG_H_ */
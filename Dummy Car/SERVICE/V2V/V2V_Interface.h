@@ -0,0 +1,215 @@
+/******************************************************************************
+ *
+ * @file V2V_Interface.h
+ *
+ * @brief Interface file for the V2V (vehicle status beacon) module.
+ *
+ * Every car broadcasts a status beacon each V2V_BEACON_PERIOD_MS over the
+ * Raspberry link (the Pis forward it to the other cars), and keeps the latest
+ * beacon of each neighbour in the neighbour table (SERVICE/Neighbour).
+ * Decisions then use data that is already local instead of polling the other
+ * car through two Raspberry Pis.
+ *
+ * The cars also exchange time requests and responses (SERVICE/Clock), so the
+ * time a beacon was sampled is known in the local timebase and its data is
+ * extrapolated to the time of the query.
+ *
+ * Before an overtake the passing car asks the lead car to hold its speed at
+ * or below a cap, the lead car acknowledges, and the passing car releases it
+ * when it is back in the lane, so the pass is planned with a speed the lead
+ * car won't exceed.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_V2V_V2V_INTERFACE_H_
+#define SERVICE_V2V_V2V_INTERFACE_H_
+
+/**
+ * @brief Status published by a car.
+ */
+typedef struct
+{
+	u8  Beacon_u8Id;				/**< Sender vehicle ID. */
+	u8  Beacon_u8Color;				/**< Sender color (1 = red). */
+	s16 Beacon_s16PosX;				/**< Position estimate along the road in cm. */
+	s16 Beacon_s16PosY;				/**< Position estimate across the road in cm. */
+	u16 Beacon_u16Speed;			/**< Speed in cm/s. */
+	u16 Beacon_u16Heading;			/**< Heading in degrees, 0 is along the road. */
+	u8  Beacon_u8Brake;				/**< 1 when the car is stopping / stopped. */
+	u16 Beacon_u16FrontDistance;	/**< Distance to the obstacle in front of the sender in cm. */
+	u32 Beacon_u32Timestamp;		/**< Sender time the status was sampled in us. */
+	s16 Beacon_s16Accel;			/**< Acceleration in cm/s2, negative when slowing down. */
+	u32 Beacon_u32RxTime;			/**< Local time of reception in us (not transmitted). */
+	u32 Beacon_u32CaptureTime;		/**< Beacon_u32Timestamp in the local timebase, Beacon_u32RxTime
+										 while the sender clock is not synchronised (not transmitted). */
+}SV2V_BEACON_t;
+
+/**
+ * @brief Emergency kinds.
+ */
+#define SV2V_EMERGENCY_BRAKE		1	/**< The sender is braking hard / stopped by an obstacle. */
+#define SV2V_EMERGENCY_HAZARD		2	/**< Hazard ahead of the sender. */
+
+/**
+ * @brief Overtake negotiation states of the passing car (SV2V_u8GetOvertakeState).
+ */
+#define SV2V_OVERTAKE_IDLE			0	/**< Nothing asked, or the last overtake is released. */
+#define SV2V_OVERTAKE_PENDING		1	/**< Request sent, no answer yet. */
+#define SV2V_OVERTAKE_GRANTED		2	/**< The lead car holds its speed at or below the cap. */
+#define SV2V_OVERTAKE_REFUSED		3	/**< The lead car already holds its speed for another car. */
+#define SV2V_OVERTAKE_NO_ANSWER		4	/**< No acknowledge after V2V_OVERTAKE_RETRIES (e.g. older firmware). */
+
+/**
+ * @brief Initialize the module.
+ *
+ * Clears the neighbour table and installs the USART1 receive hook that
+ * extracts the V2V frames from the Raspberry link.
+ *
+ * @note USART1, the microsecond timebase and the odometry must be initialized.
+ */
+void SV2V_voidInit(void);
+
+/**
+ * @brief Update the status of this car published in the next beacons.
+ *
+ * The position, heading and speed are taken from the odometry
+ * (SERVICE/Odometry) when the beacon is built.
+ *
+ * @param Copy_u8Brake          1 when the car is stopping / stopped.
+ * @param Copy_u16FrontDistance Distance to the obstacle in front in cm.
+ */
+void SV2V_voidSetOwnState(u8 Copy_u8Brake, u16 Copy_u16FrontDistance);
+
+/**
+ * @brief Periodic task, to be called from the main loop.
+ *
+ * Takes the pose of the odometry, updates the clocks of the other cars with
+ * the received time responses, moves the received beacons to the neighbour
+ * table, drops the stale neighbours, answers the time requests and the
+ * overtake messages, repeats the unanswered overtake messages, and queues a
+ * beacon every V2V_BEACON_PERIOD_MS and a time request every
+ * V2V_SYNC_PERIOD_MS. It never waits for the link.
+ */
+void SV2V_voidTask(void);
+
+/**
+ * @brief Get the latest beacon of a neighbour.
+ *
+ * The position and the front distance are extrapolated from the capture time
+ * to now with the speed of the neighbour (SNBR_u8Get).
+ *
+ * @param Copy_u8Id  The neighbour vehicle ID.
+ * @param P_Beacon   Where the beacon is copied.
+ * @return OK if a beacon younger than NBR_STALE_TIMEOUT_MS is known,
+ *         NOK if not, NULL_PTR_ERR.
+ */
+u8 SV2V_u8GetNeighbour(u8 Copy_u8Id, SV2V_BEACON_t * P_Beacon);
+
+/**
+ * @brief Send an emergency warning to the other cars.
+ *
+ * The frame is queued in the urgent transmit FIFO of USART1, so it jumps ahead
+ * of the beacons and the handshake bytes. It is sent again by SV2V_voidTask()
+ * until a car acknowledges it (V2V_EMERGENCY_RETRIES at most).
+ *
+ * @param Copy_u8Kind SV2V_EMERGENCY_BRAKE or SV2V_EMERGENCY_HAZARD.
+ * @return OK if queued, NOK if the urgent FIFO is full (the task retries).
+ */
+u8 SV2V_u8SendEmergency(u8 Copy_u8Kind);
+
+/**
+ * @brief Set the function called when an emergency warning is received.
+ *
+ * The handler runs from PendSV, right after the stop function set with
+ * SV2V_voidSetEmergencyStopCallBack: it can look at the neighbour table and
+ * keep or undo the stop. A warning sent again by its sender is acknowledged
+ * but not given to the handler twice.
+ *
+ * @param Copy_pfHandler Called with the sender vehicle ID and the emergency kind.
+ */
+void SV2V_voidSetEmergencyCallBack(void (*Copy_pfHandler)(u8 Copy_u8SenderId, u8 Copy_u8Kind));
+
+/**
+ * @brief Set the function that stops the car on an emergency warning.
+ *
+ * The stop function is called by the USART1 interrupt itself as soon as the
+ * frame is checked, so only the echo edges and the bluetooth orders can
+ * delay it. It must be short (stop the motors), the rest belongs to the
+ * handler set with SV2V_voidSetEmergencyCallBack. It is called once per
+ * warning, like the handler.
+ *
+ * @param Copy_pfStop Called with the sender vehicle ID and the emergency kind.
+ */
+void SV2V_voidSetEmergencyStopCallBack(void (*Copy_pfStop)(u8 Copy_u8SenderId, u8 Copy_u8Kind));
+
+/**
+ * @brief Get the one way latency of the last acknowledged emergency.
+ *
+ * Measured from the queuing of the warning to its reception by the other car,
+ * through both Raspberry Pis. It is also recorded in the trace
+ * (STRACE_EVT_EMERGENCY_LATENCY).
+ *
+ * @return The latency in us, 0 if no emergency was acknowledged yet.
+ */
+u32 SV2V_u32GetEmergencyLatency(void);
+
+/**
+ * @brief Ask the lead car to hold its speed while this car passes it.
+ *
+ * The request is sent to the lead car only, and sent again by
+ * SV2V_voidTask() until it is acknowledged (V2V_OVERTAKE_RETRIES at most).
+ * The lead car keeps its speed at or below the cap until
+ * SV2V_voidCompleteOvertake() or the end of the hold time, whichever comes
+ * first, so a lost release doesn't slow it down for ever.
+ *
+ * @param Copy_u8LeadId       The vehicle ID of the car to pass.
+ * @param Copy_u16SpeedCap    The highest speed the lead car may drive at in cm/s.
+ * @param Copy_u16HoldTime    The longest time the cap applies in ms.
+ * @return OK if sent or queued for the task, NOK if an overtake is already being
+ *         negotiated, OUT_OF_RANGE for an invalid ID.
+ */
+u8 SV2V_u8RequestOvertake(u8 Copy_u8LeadId, u16 Copy_u16SpeedCap, u16 Copy_u16HoldTime);
+
+/**
+ * @brief Get the answer of the lead car to the last overtake request.
+ *
+ * @param P_u16SpeedCap Where the cap granted by the lead car is written (cm/s), may be NULL.
+ * @return SV2V_OVERTAKE_IDLE, SV2V_OVERTAKE_PENDING, SV2V_OVERTAKE_GRANTED,
+ *         SV2V_OVERTAKE_REFUSED or SV2V_OVERTAKE_NO_ANSWER.
+ */
+u8 SV2V_u8GetOvertakeState(u16 * P_u16SpeedCap);
+
+/**
+ * @brief Tell the lead car the overtake is over, it may speed up again.
+ *
+ * The release is sent again by SV2V_voidTask() until it is acknowledged
+ * (V2V_OVERTAKE_RETRIES at most). Does nothing when no overtake was asked.
+ */
+void SV2V_voidCompleteOvertake(void);
+
+/**
+ * @brief Get the speed cap asked by a car passing this one.
+ *
+ * The application polls it from the main loop and limits its own speed while
+ * it is held. The cap ends with the release of the passing car or after the
+ * hold time it asked for.
+ *
+ * @param P_u16SpeedCap Where the cap is written in cm/s.
+ * @return OK while a cap is held, NOK if not, NULL_PTR_ERR.
+ */
+u8 SV2V_u8GetSpeedCap(u16 * P_u16SpeedCap);
+
+/**
+ * @brief Get the time left before SV2V_voidTask() has something to do.
+ *
+ * The next beacon, the next time request, the next emergency or overtake
+ * retry, or 0 when a received beacon, time response or acknowledgement is waiting. Used by the main loop to sleep until then.
+ *
+ * @return The time in us.
+ */
+u32 SV2V_u32GetIdleTime(void);
+
+#endif /* SERVICE_V2V_V2V_INTERFACE_H_ */
@@ -0,0 +1,1151 @@
+/******************************************************************************
+ *
+ * @File: V2V_Program.c
+ *
+ * @Brief: Implementation of functions for the V2V (vehicle status beacon) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+#include "../../MCAL/USART/USART_Interface.h"
+#include "../../MCAL/NVIC/NVIC_Interface.h"
+#include "../../MCAL/NVIC/NVIC_Config.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../Trace/Trace_Interface.h"
+#include "../Defer/Defer_Interface.h"
+#include "V2V_Interface.h"
+#include "../Neighbour/Neighbour_Interface.h"
+#include "../Clock/Clock_Interface.h"
+#include "../Odometry/Odometry_Interface.h"
+#include "V2V_Config.h"
+#include "V2V_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+static SV2V_BEACON_t SV2V_strOwn;
+
+/* checked frames, decoded by the receive work (PendSV) */
+static V2V_FRAME_t SV2V_AstrRxFrames[V2V_RX_FRAMES];
+static volatile u8 SV2V_u8FrameHead = 0;
+static volatile u8 SV2V_u8FrameTail = 0;
+
+/* beacons decoded by the receive work, moved to the neighbour table by the task */
+static volatile SV2V_BEACON_t SV2V_AstrRxQueue[V2V_RX_QUEUE_SIZE];
+static volatile u8 SV2V_u8RxHead = 0;
+static volatile u8 SV2V_u8RxTail = 0;
+
+/* own clock in ms, built from the microsecond timebase so it doesn't jump when it wraps */
+static u32 SV2V_u32Millis = 0;
+static u32 SV2V_u32LastMicros = 0;
+static u32 SV2V_u32MicrosRest = 0;
+static u32 SV2V_u32LastBeaconMs = 0;
+static u32 SV2V_u32LastSyncMs = 0;
+
+/* speed and pose time of the last beacon, the acceleration is measured from them */
+static u16 SV2V_u16BeaconSpeed = 0;
+static u32 SV2V_u32BeaconPoseTime = 0;
+
+/* emergency sent by this car */
+static u8  SV2V_u8EmergencyKind = 0;
+static u8  SV2V_u8EmergencySequence = 0;
+static u8  SV2V_u8EmergencyRetries = 0;
+static u32 SV2V_u32EmergencySentTime = 0;
+static volatile u8  SV2V_u8EmergencyAcked = 1;
+static volatile u32 SV2V_u32EmergencyLatency = 0;
+
+/* emergency received from another car, acknowledged by the task */
+static void (*SV2V_pfEmergencyStop)(u8 Copy_u8SenderId, u8 Copy_u8Kind) = NULL;
+static void (*SV2V_pfEmergencyHandler)(u8 Copy_u8SenderId, u8 Copy_u8Kind) = NULL;
+static u8 SV2V_Au8LastEmergencySequence[256];
+static V2V_ACK_t SV2V_strAck;
+static volatile u8 SV2V_u8AckPending = 0;
+
+/* overtake of this car, asked to the car in front of it */
+static volatile u8  SV2V_u8OvertakeState = SV2V_OVERTAKE_IDLE;
+static u8  SV2V_u8OvertakeLead = 0;
+static u8  SV2V_u8OvertakeSequence = 0;
+static u8  SV2V_u8OvertakeRetries = 0;
+static u16 SV2V_u16OvertakeHold = 0;
+static volatile u16 SV2V_u16OvertakeCap = 0;
+static u32 SV2V_u32OvertakeSentTime = 0;
+
+/* speed cap held for a car passing this one, set by the receive work */
+static volatile u8  SV2V_u8CapHolder = 0;
+static volatile u16 SV2V_u16Cap = 0;
+static volatile u32 SV2V_u32CapStart = 0;
+static volatile u32 SV2V_u32CapHold = 0;
+static u8 SV2V_u8ReleasedId = 0;
+static u8 SV2V_u8ReleasedSequence = 0;
+static V2V_OVERTAKE_ACK_t SV2V_strOvertakeAck;
+static volatile u8 SV2V_u8OvertakeAckPending = 0;
+
+/* time request to answer, time responses waiting for the task */
+static V2V_TIME_t SV2V_strTimeAnswer;
+static volatile u8 SV2V_u8TimeAnswerPending = 0;
+static volatile V2V_TIME_t SV2V_AstrTimeQueue[V2V_RX_QUEUE_SIZE];
+static volatile u8 SV2V_u8TimeHead = 0;
+static volatile u8 SV2V_u8TimeTail = 0;
+
+/* receive parser, runs in the USART1 interrupt */
+static V2V_RX_STATE_t SV2V_RxState = V2V_RX_SYNC;
+static u8 SV2V_u8RxType;
+static u8 SV2V_u8RxLength;
+static u8 SV2V_u8RxIndex;
+static u8 SV2V_u8RxChecksum;
+static u8 SV2V_Au8RxPayload[V2V_MAX_PAYLOAD];
+
+/*******************************************************************************
+ *                          	Private Functions                              *
+ *******************************************************************************/
+static u16 SV2V_u16GetU16(const u8 * P_u8Data)
+{
+	return (u16)(P_u8Data[0] | ((u16)P_u8Data[1] << 8));
+}
+
+static void SV2V_voidPutU16(u8 * P_u8Data, u16 Copy_u16Value)
+{
+	P_u8Data[0] = (u8)Copy_u16Value;
+	P_u8Data[1] = (u8)(Copy_u16Value >> 8);
+}
+
+static u32 SV2V_u32GetU32(const u8 * P_u8Data)
+{
+	return SV2V_u16GetU16(P_u8Data) | ((u32)SV2V_u16GetU16(&P_u8Data[2]) << 16);
+}
+
+static void SV2V_voidPutU32(u8 * P_u8Data, u32 Copy_u32Value)
+{
+	SV2V_voidPutU16(P_u8Data, (u16)Copy_u32Value);
+	SV2V_voidPutU16(&P_u8Data[2], (u16)(Copy_u32Value >> 16));
+}
+
+/**
+ * @brief Frame a payload and queue it on the Raspberry link.
+ *
+ * @param Copy_u8Urgent 1 to use the urgent transmit FIFO.
+ * @return The result of the USART1 queuing.
+ */
+static u8 SV2V_u8SendFrame(u8 Copy_u8Type, const u8 * P_u8Payload, u8 Copy_u8Length, u8 Copy_u8Urgent)
+{
+	u8 L_Au8Frame[V2V_MAX_PAYLOAD + V2V_FRAME_OVERHEAD];
+	u8 L_u8Checksum = Copy_u8Type ^ Copy_u8Length;
+	u8 L_u8Index;
+
+	L_Au8Frame[0] = V2V_SYNC_BYTE;
+	L_Au8Frame[1] = Copy_u8Type;
+	L_Au8Frame[2] = Copy_u8Length;
+	for (L_u8Index = 0; L_u8Index < Copy_u8Length; L_u8Index++)
+	{
+		L_Au8Frame[3 + L_u8Index] = P_u8Payload[L_u8Index];
+		L_u8Checksum ^= P_u8Payload[L_u8Index];
+	}
+	L_Au8Frame[3 + Copy_u8Length] = L_u8Checksum;
+
+	if (Copy_u8Urgent)
+	{
+		return MUSART1_u8QueueUrgentData(L_Au8Frame, Copy_u8Length + V2V_FRAME_OVERHEAD);
+	}
+	return MUSART1_u8QueueData(L_Au8Frame, Copy_u8Length + V2V_FRAME_OVERHEAD);
+}
+
+/**
+ * @brief Send the pending emergency of this car with the current time.
+ */
+static u8 SV2V_u8TransmitEmergency(void)
+{
+	u8 L_Au8Payload[V2V_EMERGENCY_LENGTH];
+
+	SV2V_u32EmergencySentTime = MTMR_u32GetMicros();
+	L_Au8Payload[0] = V2V_OWN_ID;
+	L_Au8Payload[1] = SV2V_u8EmergencyKind;
+	L_Au8Payload[2] = SV2V_u8EmergencySequence;
+	SV2V_voidPutU32(&L_Au8Payload[3], SV2V_u32EmergencySentTime);
+
+	return SV2V_u8SendFrame(V2V_TYPE_EMERGENCY, L_Au8Payload, V2V_EMERGENCY_LENGTH, 1);
+}
+
+/**
+ * @brief Give a new emergency of another car to the application (PendSV).
+ *
+ * @param Copy_u32Emergency Sender ID, kind and sequence, one byte each from bit 16.
+ */
+static void SV2V_voidEmergencyWork(u32 Copy_u32Emergency)
+{
+	u8 L_u8Id = (u8)(Copy_u32Emergency >> 16);
+	u8 L_u8Kind = (u8)(Copy_u32Emergency >> 8);
+
+	STRACE_voidLog(STRACE_EVT_EMERGENCY_RX, L_u8Id, (u16)Copy_u32Emergency);
+	if (SV2V_pfEmergencyHandler != NULL)
+	{
+		SV2V_pfEmergencyHandler(L_u8Id, L_u8Kind);
+	}
+}
+
+/**
+ * @brief Handle an emergency of another car (interrupt context).
+ *
+ * Only the stop function of the application runs in this interrupt, so the
+ * motors react without waiting for the main loop or the lower priority
+ * handlers. The handler of the application runs from PendSV, the acknowledge
+ * is left to the task.
+ */
+static void SV2V_voidReceiveEmergency(const u8 * P_u8Payload)
+{
+	u8 L_u8Id = P_u8Payload[0];
+	u32 L_u32Emergency;
+
+	if ((L_u8Id == 0) || (L_u8Id == V2V_OWN_ID))
+	{
+		return;
+	}
+
+	if (SV2V_Au8LastEmergencySequence[L_u8Id] != P_u8Payload[2])
+	{
+		SV2V_Au8LastEmergencySequence[L_u8Id] = P_u8Payload[2];
+		if (SV2V_pfEmergencyStop != NULL)
+		{
+			SV2V_pfEmergencyStop(L_u8Id, P_u8Payload[1]);
+		}
+		L_u32Emergency = ((u32)L_u8Id << 16) | ((u32)P_u8Payload[1] << 8) | P_u8Payload[2];
+		// with the queue full the stop must still be held or undone
+		if (SDEF_u8Post(SV2V_voidEmergencyWork, L_u32Emergency) != OK)
+		{
+			SV2V_voidEmergencyWork(L_u32Emergency);
+		}
+	}
+
+	// one acknowledge at a time, the sender retries if this one is lost
+	if (SV2V_u8AckPending == 0)
+	{
+		SV2V_strAck.Ack_u8Sender = L_u8Id;
+		SV2V_strAck.Ack_u8Sequence = P_u8Payload[2];
+		SV2V_strAck.Ack_u32SenderTime = SV2V_u32GetU32(&P_u8Payload[3]);
+		SV2V_strAck.Ack_u32RxTime = MTMR_u32GetMicros();
+		SV2V_u8AckPending = 1;
+	}
+}
+
+/**
+ * @brief Handle the acknowledge of an emergency of this car (PendSV).
+ */
+static void SV2V_voidReceiveEmergencyAck(const u8 * P_u8Payload, u32 Copy_u32RxTime)
+{
+	u32 L_u32RoundTrip;
+	u32 L_u32Turnaround;
+	u32 L_u32Latency;
+
+	if ((P_u8Payload[1] != V2V_OWN_ID) || (P_u8Payload[2] != SV2V_u8EmergencySequence))
+	{
+		return;
+	}
+
+	L_u32RoundTrip = Copy_u32RxTime - SV2V_u32GetU32(&P_u8Payload[3]);
+	L_u32Turnaround = SV2V_u32GetU32(&P_u8Payload[7]);
+	L_u32Latency = (L_u32RoundTrip > L_u32Turnaround) ? ((L_u32RoundTrip - L_u32Turnaround) / 2) : 0;
+
+	SV2V_u32EmergencyLatency = L_u32Latency;
+	SV2V_u8EmergencyAcked = 1;
+
+	L_u32Latency /= V2V_LATENCY_UNIT_US;
+	STRACE_voidLog(STRACE_EVT_EMERGENCY_LATENCY, P_u8Payload[0], (L_u32Latency > 0xFFFF) ? 0xFFFF : (u16)L_u32Latency);
+}
+
+/**
+ * @brief Send the overtake request or release of this car with its current sequence.
+ */
+static u8 SV2V_u8TransmitOvertake(void)
+{
+	u8 L_Au8Payload[V2V_OVERTAKE_LENGTH];
+
+	SV2V_u32OvertakeSentTime = MTMR_u32GetMicros();
+	L_Au8Payload[0] = V2V_OWN_ID;
+	L_Au8Payload[1] = SV2V_u8OvertakeLead;
+	L_Au8Payload[2] = (SV2V_u8OvertakeState == V2V_OVERTAKE_COMPLETING) ? V2V_OVERTAKE_COMPLETE : V2V_OVERTAKE_REQUEST;
+	L_Au8Payload[3] = SV2V_u8OvertakeSequence;
+	SV2V_voidPutU16(&L_Au8Payload[4], SV2V_u16OvertakeCap);
+	SV2V_voidPutU16(&L_Au8Payload[6], SV2V_u16OvertakeHold);
+
+	return SV2V_u8SendFrame(V2V_TYPE_OVERTAKE, L_Au8Payload, V2V_OVERTAKE_LENGTH, 0);
+}
+
+/**
+ * @brief Check if the speed cap held for a passing car is still running.
+ *
+ * @note Can be called with the interrupts masked.
+ */
+static u8 SV2V_u8IsCapHeld(void)
+{
+	return (SV2V_u8CapHolder != 0) && ((MTMR_u32GetMicros() - SV2V_u32CapStart) < SV2V_u32CapHold);
+}
+
+/**
+ * @brief Handle an overtake request or release sent to this car (PendSV).
+ *
+ * The cap is granted when no other car holds one, a request of the car that
+ * already holds it (a retry or a new overtake) starts it again. A retry of a
+ * request that arrives after its release is dropped. The release is
+ * acknowledged even when the cap is already over, the acknowledge of the
+ * first one may be the one that got lost. The acknowledge is left to the task.
+ */
+static void SV2V_voidReceiveOvertake(const u8 * P_u8Payload, u32 Copy_u32RxTime)
+{
+	u8 L_u8Id = P_u8Payload[0];
+	u8 L_u8Result;
+
+	if ((L_u8Id == 0) || (L_u8Id == V2V_OWN_ID) || (P_u8Payload[1] != V2V_OWN_ID))
+	{
+		return;
+	}
+
+	if (P_u8Payload[2] == V2V_OVERTAKE_REQUEST)
+	{
+		if ((L_u8Id == SV2V_u8ReleasedId) && (P_u8Payload[3] == SV2V_u8ReleasedSequence))
+		{
+			return;
+		}
+		if (SV2V_u8IsCapHeld() && (SV2V_u8CapHolder != L_u8Id))
+		{
+			L_u8Result = V2V_OVERTAKE_REFUSED;
+		}
+		else
+		{
+			if (SV2V_u8IsCapHeld() == 0)
+			{
+				STRACE_voidLog(STRACE_EVT_OVERTAKE, L_u8Id,
+							   (u16)((SV2V_OVERTAKE_GRANTED << 12) | (SV2V_u16GetU16(&P_u8Payload[4]) & 0xFFF)));
+			}
+			SV2V_u16Cap = SV2V_u16GetU16(&P_u8Payload[4]);
+			SV2V_u32CapHold = SV2V_u16GetU16(&P_u8Payload[6]) * V2V_US_PER_MS;
+			SV2V_u32CapStart = Copy_u32RxTime;
+			SV2V_u8CapHolder = L_u8Id;
+			L_u8Result = V2V_OVERTAKE_GRANTED;
+		}
+	}
+	else if (P_u8Payload[2] == V2V_OVERTAKE_COMPLETE)
+	{
+		if (SV2V_u8CapHolder == L_u8Id)
+		{
+			SV2V_u8CapHolder = 0;
+			STRACE_voidLog(STRACE_EVT_OVERTAKE, L_u8Id, (u16)(SV2V_OVERTAKE_IDLE << 12));
+		}
+		SV2V_u8ReleasedId = L_u8Id;
+		SV2V_u8ReleasedSequence = P_u8Payload[3];
+		L_u8Result = V2V_OVERTAKE_RELEASED;
+	}
+	else
+	{
+		return;
+	}
+
+	// one acknowledge at a time, the requester retries if this one is lost
+	if (SV2V_u8OvertakeAckPending == 0)
+	{
+		SV2V_strOvertakeAck.OvtAck_u8Requester = L_u8Id;
+		SV2V_strOvertakeAck.OvtAck_u8Sequence = P_u8Payload[3];
+		SV2V_strOvertakeAck.OvtAck_u8Result = L_u8Result;
+		SV2V_strOvertakeAck.OvtAck_u16Cap = (L_u8Result == V2V_OVERTAKE_GRANTED) ? SV2V_u16Cap : 0;
+		SV2V_u8OvertakeAckPending = 1;
+	}
+}
+
+/**
+ * @brief Handle the answer of the lead car to the overtake of this car (PendSV).
+ */
+static void SV2V_voidReceiveOvertakeAck(const u8 * P_u8Payload)
+{
+	u8 L_u8State = SV2V_u8OvertakeState;
+
+	if ((P_u8Payload[0] != SV2V_u8OvertakeLead) || (P_u8Payload[1] != V2V_OWN_ID) ||
+		(P_u8Payload[2] != SV2V_u8OvertakeSequence))
+	{
+		return;
+	}
+
+	if ((L_u8State == SV2V_OVERTAKE_PENDING) && (P_u8Payload[3] == V2V_OVERTAKE_GRANTED))
+	{
+		SV2V_u16OvertakeCap = SV2V_u16GetU16(&P_u8Payload[4]);
+		L_u8State = SV2V_OVERTAKE_GRANTED;
+	}
+	else if ((L_u8State == SV2V_OVERTAKE_PENDING) && (P_u8Payload[3] == V2V_OVERTAKE_REFUSED))
+	{
+		L_u8State = SV2V_OVERTAKE_REFUSED;
+	}
+	else if ((L_u8State == V2V_OVERTAKE_COMPLETING) && (P_u8Payload[3] == V2V_OVERTAKE_RELEASED))
+	{
+		L_u8State = SV2V_OVERTAKE_IDLE;
+	}
+	else
+	{
+		return;
+	}
+
+	SV2V_u8OvertakeState = L_u8State;
+	STRACE_voidLog(STRACE_EVT_OVERTAKE, P_u8Payload[0], (u16)((L_u8State << 12) | (SV2V_u16OvertakeCap & 0xFFF)));
+}
+
+/**
+ * @brief Take a time request of another car (PendSV).
+ *
+ * The reception time is T2, the response is framed by the task. One request
+ * at a time, the requester asks again in V2V_SYNC_PERIOD_MS.
+ */
+static void SV2V_voidReceiveTimeRequest(const u8 * P_u8Payload, u32 Copy_u32RxTime)
+{
+	if ((P_u8Payload[0] == 0) || (P_u8Payload[0] == V2V_OWN_ID) || SV2V_u8TimeAnswerPending)
+	{
+		return;
+	}
+	SV2V_strTimeAnswer.Time_u8Peer = P_u8Payload[0];
+	SV2V_strTimeAnswer.Time_u32T1 = SV2V_u32GetU32(&P_u8Payload[1]);
+	SV2V_strTimeAnswer.Time_u32T2 = Copy_u32RxTime;
+	SV2V_u8TimeAnswerPending = 1;
+}
+
+/**
+ * @brief Queue the response to a time request of this car for the task (PendSV).
+ */
+static void SV2V_voidReceiveTimeResponse(const u8 * P_u8Payload, u32 Copy_u32RxTime)
+{
+	volatile V2V_TIME_t * L_pstrTime;
+	u8 L_u8Head = SV2V_u8TimeHead;
+
+	if ((P_u8Payload[1] != V2V_OWN_ID) || (P_u8Payload[0] == 0) || (P_u8Payload[0] == V2V_OWN_ID))
+	{
+		return;
+	}
+	if ((u8)(L_u8Head - SV2V_u8TimeTail) >= V2V_RX_QUEUE_SIZE)
+	{
+		return;
+	}
+
+	L_pstrTime = &SV2V_AstrTimeQueue[L_u8Head & V2V_RX_QUEUE_MASK];
+	L_pstrTime->Time_u8Peer = P_u8Payload[0];
+	L_pstrTime->Time_u32T1 = SV2V_u32GetU32(&P_u8Payload[2]);
+	L_pstrTime->Time_u32T2 = SV2V_u32GetU32(&P_u8Payload[6]);
+	L_pstrTime->Time_u32T3 = SV2V_u32GetU32(&P_u8Payload[10]);
+	L_pstrTime->Time_u32T4 = Copy_u32RxTime;
+
+	SV2V_u8TimeHead = L_u8Head + 1;
+}
+
+/**
+ * @brief Give the received time responses to the clock of their sender.
+ */
+static void SV2V_voidDrainTimeResponses(void)
+{
+	V2V_TIME_t L_strTime;
+
+	while (SV2V_u8TimeTail != SV2V_u8TimeHead)
+	{
+		L_strTime = SV2V_AstrTimeQueue[SV2V_u8TimeTail & V2V_RX_QUEUE_MASK];
+		SV2V_u8TimeTail++;
+
+		SCLK_u8AddSample(L_strTime.Time_u8Peer, L_strTime.Time_u32T1, L_strTime.Time_u32T2,
+						 L_strTime.Time_u32T3, L_strTime.Time_u32T4);
+	}
+}
+
+/**
+ * @brief Queue a received beacon for the task (PendSV).
+ */
+static void SV2V_voidStoreBeacon(const u8 * P_u8Payload, u32 Copy_u32RxTime)
+{
+	volatile SV2V_BEACON_t * L_pstrBeacon;
+	u8 L_u8Head = SV2V_u8RxHead;
+
+	if ((P_u8Payload[0] == 0) || (P_u8Payload[0] == V2V_OWN_ID))
+	{
+		return;
+	}
+	if ((u8)(L_u8Head - SV2V_u8RxTail) >= V2V_RX_QUEUE_SIZE)
+	{
+		return;
+	}
+
+	L_pstrBeacon = &SV2V_AstrRxQueue[L_u8Head & V2V_RX_QUEUE_MASK];
+	L_pstrBeacon->Beacon_u8Id = P_u8Payload[0];
+	L_pstrBeacon->Beacon_u8Color = P_u8Payload[1];
+	L_pstrBeacon->Beacon_s16PosX = (s16)SV2V_u16GetU16(&P_u8Payload[2]);
+	L_pstrBeacon->Beacon_s16PosY = (s16)SV2V_u16GetU16(&P_u8Payload[4]);
+	L_pstrBeacon->Beacon_u16Speed = SV2V_u16GetU16(&P_u8Payload[6]);
+	L_pstrBeacon->Beacon_u16Heading = SV2V_u16GetU16(&P_u8Payload[8]);
+	L_pstrBeacon->Beacon_u8Brake = P_u8Payload[10];
+	L_pstrBeacon->Beacon_u16FrontDistance = SV2V_u16GetU16(&P_u8Payload[11]);
+	L_pstrBeacon->Beacon_u32Timestamp = SV2V_u32GetU32(&P_u8Payload[13]);
+	L_pstrBeacon->Beacon_s16Accel = (s16)SV2V_u16GetU16(&P_u8Payload[17]);
+	L_pstrBeacon->Beacon_u32RxTime = Copy_u32RxTime;
+	L_pstrBeacon->Beacon_u32CaptureTime = L_pstrBeacon->Beacon_u32RxTime;
+
+	SV2V_u8RxHead = L_u8Head + 1;
+}
+
+/**
+ * @brief Move the received beacons to the neighbour table.
+ *
+ * The capture time is the sender timestamp in the local timebase when the
+ * sender clock is synchronised. A capture time after the reception (clock not
+ * settled yet) is replaced by the reception time.
+ *
+ * The emergency handler reads the table from PendSV, the table is only
+ * changed with PendSV masked.
+ */
+static void SV2V_voidDrainBeacons(void)
+{
+	SV2V_BEACON_t L_strBeacon;
+	u32 L_u32CaptureTime;
+	u8 L_u8Mask;
+
+	while (SV2V_u8RxTail != SV2V_u8RxHead)
+	{
+		L_strBeacon = SV2V_AstrRxQueue[SV2V_u8RxTail & V2V_RX_QUEUE_MASK];
+		SV2V_u8RxTail++;
+
+		if ((SCLK_u8ToLocal(L_strBeacon.Beacon_u8Id, L_strBeacon.Beacon_u32Timestamp, &L_u32CaptureTime) == OK) &&
+			((s32)(L_strBeacon.Beacon_u32RxTime - L_u32CaptureTime) >= 0))
+		{
+			L_strBeacon.Beacon_u32CaptureTime = L_u32CaptureTime;
+		}
+
+		STRACE_voidLog(STRACE_EVT_BEACON_STATUS, L_strBeacon.Beacon_u8Id,
+					   (u16)(((u16)(L_strBeacon.Beacon_u8Color & 0x0F) << 12) | ((u16)(L_strBeacon.Beacon_u8Brake & 1) << 11) |
+							 (L_strBeacon.Beacon_u16Speed & 0x7FF)));
+		STRACE_voidLog(STRACE_EVT_BEACON_DISTANCE, L_strBeacon.Beacon_u8Id, L_strBeacon.Beacon_u16FrontDistance);
+		STRACE_voidLog(STRACE_EVT_BEACON_POS_X, L_strBeacon.Beacon_u8Id, (u16)L_strBeacon.Beacon_s16PosX);
+		STRACE_voidLog(STRACE_EVT_BEACON_POS_Y, L_strBeacon.Beacon_u8Id, (u16)L_strBeacon.Beacon_s16PosY);
+
+		L_u8Mask = MNVIC_u8EnterCritical(NVIC_PENDSV_GROUP);
+		SNBR_u8Update(&L_strBeacon);
+		MNVIC_voidExitCritical(L_u8Mask);
+	}
+}
+
+/**
+ * @brief Decode the checked frames (PendSV).
+ *
+ * PendSV is the only consumer of the frame queue, the slot is released once
+ * its frame is decoded.
+ *
+ * @param Copy_u32Arg Not used.
+ */
+static void SV2V_voidFrameWork(u32 Copy_u32Arg)
+{
+	const V2V_FRAME_t * L_pFrame;
+
+	while (SV2V_u8FrameTail != SV2V_u8FrameHead)
+	{
+		L_pFrame = &SV2V_AstrRxFrames[SV2V_u8FrameTail & V2V_RX_FRAMES_MASK];
+
+		if ((L_pFrame->Frame_u8Type == V2V_TYPE_BEACON) && (L_pFrame->Frame_u8Length == V2V_BEACON_LENGTH))
+		{
+			SV2V_voidStoreBeacon(L_pFrame->Frame_Au8Payload, L_pFrame->Frame_u32RxTime);
+		}
+		else if ((L_pFrame->Frame_u8Type == V2V_TYPE_EMERGENCY_ACK) && (L_pFrame->Frame_u8Length == V2V_EMERGENCY_ACK_LENGTH))
+		{
+			SV2V_voidReceiveEmergencyAck(L_pFrame->Frame_Au8Payload, L_pFrame->Frame_u32RxTime);
+		}
+		else if ((L_pFrame->Frame_u8Type == V2V_TYPE_TIME_REQUEST) && (L_pFrame->Frame_u8Length == V2V_TIME_REQUEST_LENGTH))
+		{
+			SV2V_voidReceiveTimeRequest(L_pFrame->Frame_Au8Payload, L_pFrame->Frame_u32RxTime);
+		}
+		else if ((L_pFrame->Frame_u8Type == V2V_TYPE_TIME_RESPONSE) && (L_pFrame->Frame_u8Length == V2V_TIME_RESPONSE_LENGTH))
+		{
+			SV2V_voidReceiveTimeResponse(L_pFrame->Frame_Au8Payload, L_pFrame->Frame_u32RxTime);
+		}
+		else if ((L_pFrame->Frame_u8Type == V2V_TYPE_OVERTAKE) && (L_pFrame->Frame_u8Length == V2V_OVERTAKE_LENGTH))
+		{
+			SV2V_voidReceiveOvertake(L_pFrame->Frame_Au8Payload, L_pFrame->Frame_u32RxTime);
+		}
+		else if ((L_pFrame->Frame_u8Type == V2V_TYPE_OVERTAKE_ACK) && (L_pFrame->Frame_u8Length == V2V_OVERTAKE_ACK_LENGTH))
+		{
+			SV2V_voidReceiveOvertakeAck(L_pFrame->Frame_Au8Payload);
+		}
+		SV2V_u8FrameTail++;
+	}
+}
+
+/**
+ * @brief Queue the frame just checked for the receive work (interrupt context).
+ *
+ * The reception time is taken here, the time exchanges don't see the wait
+ * for PendSV. A frame is dropped if the queue is full. If the work can't be
+ * posted the task posts it again.
+ */
+static void SV2V_voidQueueFrame(void)
+{
+	V2V_FRAME_t * L_pFrame;
+	u8 L_u8Head = SV2V_u8FrameHead;
+	u8 L_u8Index;
+
+	if ((u8)(L_u8Head - SV2V_u8FrameTail) >= V2V_RX_FRAMES)
+	{
+		return;
+	}
+
+	L_pFrame = &SV2V_AstrRxFrames[L_u8Head & V2V_RX_FRAMES_MASK];
+	L_pFrame->Frame_u8Type = SV2V_u8RxType;
+	L_pFrame->Frame_u8Length = SV2V_u8RxLength;
+	L_pFrame->Frame_u32RxTime = MTMR_u32GetMicros();
+	for (L_u8Index = 0; L_u8Index < SV2V_u8RxLength; L_u8Index++)
+	{
+		L_pFrame->Frame_Au8Payload[L_u8Index] = SV2V_Au8RxPayload[L_u8Index];
+	}
+	SV2V_u8FrameHead = L_u8Head + 1;
+
+	SDEF_u8Post(SV2V_voidFrameWork, 0);
+}
+
+/**
+ * @brief USART1 receive hook (interrupt context).
+ *
+ * @return 1 if the byte belongs to a V2V frame, 0 if it is a legacy byte.
+ */
+static u8 SV2V_u8RxHook(u8 Copy_u8Data)
+{
+	u8 L_u8Consumed = 1;
+
+	switch (SV2V_RxState)
+	{
+	case V2V_RX_SYNC:
+		if (Copy_u8Data == V2V_SYNC_BYTE)
+		{
+			SV2V_RxState = V2V_RX_TYPE;
+		}
+		else
+		{
+			L_u8Consumed = 0;
+		}
+		break;
+
+	case V2V_RX_TYPE:
+		SV2V_u8RxType = Copy_u8Data;
+		SV2V_u8RxChecksum = Copy_u8Data;
+		SV2V_RxState = V2V_RX_LENGTH;
+		break;
+
+	case V2V_RX_LENGTH:
+		SV2V_u8RxLength = Copy_u8Data;
+		SV2V_u8RxChecksum ^= Copy_u8Data;
+		SV2V_u8RxIndex = 0;
+		if (Copy_u8Data > V2V_MAX_PAYLOAD)
+		{
+			SV2V_RxState = V2V_RX_SYNC;
+		}
+		else if (Copy_u8Data == 0)
+		{
+			SV2V_RxState = V2V_RX_CHECKSUM;
+		}
+		else
+		{
+			SV2V_RxState = V2V_RX_PAYLOAD;
+		}
+		break;
+
+	case V2V_RX_PAYLOAD:
+		SV2V_Au8RxPayload[SV2V_u8RxIndex++] = Copy_u8Data;
+		SV2V_u8RxChecksum ^= Copy_u8Data;
+		if (SV2V_u8RxIndex >= SV2V_u8RxLength)
+		{
+			SV2V_RxState = V2V_RX_CHECKSUM;
+		}
+		break;
+
+	case V2V_RX_CHECKSUM:
+		if (Copy_u8Data == SV2V_u8RxChecksum)
+		{
+			if ((SV2V_u8RxType == V2V_TYPE_EMERGENCY) && (SV2V_u8RxLength == V2V_EMERGENCY_LENGTH))
+			{
+				SV2V_voidReceiveEmergency(SV2V_Au8RxPayload);
+			}
+			else
+			{
+				SV2V_voidQueueFrame();
+			}
+		}
+		SV2V_RxState = V2V_RX_SYNC;
+		break;
+
+	default:
+		SV2V_RxState = V2V_RX_SYNC;
+		break;
+	}
+	return L_u8Consumed;
+}
+
+/**
+ * @brief Advance the own ms clock.
+ */
+static void SV2V_voidUpdateClock(void)
+{
+	u32 L_u32Now = MTMR_u32GetMicros();
+
+	SV2V_u32MicrosRest += L_u32Now - SV2V_u32LastMicros;
+	SV2V_u32LastMicros = L_u32Now;
+	SV2V_u32Millis += SV2V_u32MicrosRest / V2V_US_PER_MS;
+	SV2V_u32MicrosRest %= V2V_US_PER_MS;
+}
+
+/**
+ * @brief Take the own position, heading and speed from the odometry.
+ *
+ * @return The local time of the pose in us.
+ */
+static u32 SV2V_u32UpdatePose(void)
+{
+	SODO_POSE_t L_strPose;
+
+	SODO_u8GetPose(&L_strPose);
+	SV2V_strOwn.Beacon_s16PosX = (s16)(L_strPose.Pose_s32X / V2V_MM_PER_CM);
+	SV2V_strOwn.Beacon_s16PosY = (s16)(L_strPose.Pose_s32Y / V2V_MM_PER_CM);
+	SV2V_strOwn.Beacon_u16Heading = SODO_u16GetHeadingDeg();
+	SV2V_strOwn.Beacon_u16Speed = SODO_u16GetSpeedCmS();
+	return L_strPose.Pose_u32Time;
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Initialize the module.
+ *
+ * This function clears the own status, the neighbour table and the clocks of
+ * the other cars, then installs the USART1 receive hook.
+ */
+void SV2V_voidInit(void)
+{
+	u16 L_u16Index;
+
+	SNBR_voidInit();
+	SCLK_voidInit();
+	for (L_u16Index = 0; L_u16Index < 256; L_u16Index++)
+	{
+		SV2V_Au8LastEmergencySequence[L_u16Index] = 0;
+	}
+
+	SV2V_strOwn.Beacon_u8Id = V2V_OWN_ID;
+	SV2V_strOwn.Beacon_u8Color = V2V_OWN_COLOR;
+	SV2V_strOwn.Beacon_u8Brake = 1;
+	SV2V_strOwn.Beacon_u16FrontDistance = 0;
+
+	SV2V_u32LastMicros = MTMR_u32GetMicros();
+	SV2V_u8FrameHead = 0;
+	SV2V_u8FrameTail = 0;
+	SV2V_u8RxHead = 0;
+	SV2V_u8RxTail = 0;
+	SV2V_u8TimeHead = 0;
+	SV2V_u8TimeTail = 0;
+	SV2V_u8TimeAnswerPending = 0;
+	SV2V_u8OvertakeState = SV2V_OVERTAKE_IDLE;
+	SV2V_u8CapHolder = 0;
+	SV2V_u8ReleasedId = 0;
+	SV2V_u8OvertakeAckPending = 0;
+	SV2V_RxState = V2V_RX_SYNC;
+	MUSART1_u8AddRxCallBack(SV2V_u8RxHook);
+}
+
+/**
+ * @brief Update the status of this car published in the next beacons.
+ */
+void SV2V_voidSetOwnState(u8 Copy_u8Brake, u16 Copy_u16FrontDistance)
+{
+	SV2V_strOwn.Beacon_u8Brake = Copy_u8Brake;
+	SV2V_strOwn.Beacon_u16FrontDistance = Copy_u16FrontDistance;
+}
+
+/**
+ * @brief Periodic task.
+ *
+ * This function updates the clocks of the other cars, the neighbour table and
+ * the own pose, acknowledges the received emergency, repeats the own emergency if needed,
+ * answers the overtake message and the time request, repeats the own overtake
+ * message if needed, then queues a time request every
+ * V2V_SYNC_PERIOD_MS and a beacon frame every V2V_BEACON_PERIOD_MS. When the
+ * transmit FIFO is full the request or the beacon is skipped, the next one
+ * carries fresher data anyway.
+ *
+ * T1 and T3 are taken when the frames are queued, the time they wait in the
+ * FIFO makes the exchange longer and the clock filter drops it.
+ */
+void SV2V_voidTask(void)
+{
+	u8 L_Au8Payload[V2V_MAX_PAYLOAD];
+	u32 L_u32PoseTime;
+	u32 L_u32Dt;
+	s32 L_s32Accel;
+	u8 L_u8Mask;
+
+	SV2V_voidUpdateClock();
+	// frames left when the queue of PendSV was full
+	if (SV2V_u8FrameTail != SV2V_u8FrameHead)
+	{
+		SDEF_u8Post(SV2V_voidFrameWork, 0);
+	}
+	SV2V_voidDrainTimeResponses();
+	SV2V_voidDrainBeacons();
+	L_u32PoseTime = SV2V_u32UpdatePose();
+	// the emergency handler places the sender with the table (PendSV)
+	L_u8Mask = MNVIC_u8EnterCritical(NVIC_PENDSV_GROUP);
+	SNBR_voidPurge();
+	SNBR_voidSetOwnPosition(SV2V_strOwn.Beacon_s16PosX, SV2V_strOwn.Beacon_s16PosY);
+	MNVIC_voidExitCritical(L_u8Mask);
+
+	// acknowledge the emergency received by the interrupt
+	if (SV2V_u8AckPending)
+	{
+		L_Au8Payload[0] = V2V_OWN_ID;
+		L_Au8Payload[1] = SV2V_strAck.Ack_u8Sender;
+		L_Au8Payload[2] = SV2V_strAck.Ack_u8Sequence;
+		SV2V_voidPutU32(&L_Au8Payload[3], SV2V_strAck.Ack_u32SenderTime);
+		SV2V_voidPutU32(&L_Au8Payload[7], MTMR_u32GetMicros() - SV2V_strAck.Ack_u32RxTime);
+		if (SV2V_u8SendFrame(V2V_TYPE_EMERGENCY_ACK, L_Au8Payload, V2V_EMERGENCY_ACK_LENGTH, 1) == OK)
+		{
+			SV2V_u8AckPending = 0;
+		}
+	}
+
+	// send our emergency again until a car acknowledges it
+	if ((SV2V_u8EmergencyAcked == 0) && (SV2V_u8EmergencyRetries > 0) &&
+		((MTMR_u32GetMicros() - SV2V_u32EmergencySentTime) >= (V2V_EMERGENCY_RETRY_MS * V2V_US_PER_MS)))
+	{
+		SV2V_u8EmergencyRetries--;
+		SV2V_u8TransmitEmergency();
+	}
+
+	// answer the overtake request or release received by the receive work
+	if (SV2V_u8OvertakeAckPending)
+	{
+		L_Au8Payload[0] = V2V_OWN_ID;
+		L_Au8Payload[1] = SV2V_strOvertakeAck.OvtAck_u8Requester;
+		L_Au8Payload[2] = SV2V_strOvertakeAck.OvtAck_u8Sequence;
+		L_Au8Payload[3] = SV2V_strOvertakeAck.OvtAck_u8Result;
+		SV2V_voidPutU16(&L_Au8Payload[4], SV2V_strOvertakeAck.OvtAck_u16Cap);
+		if (SV2V_u8SendFrame(V2V_TYPE_OVERTAKE_ACK, L_Au8Payload, V2V_OVERTAKE_ACK_LENGTH, 0) == OK)
+		{
+			SV2V_u8OvertakeAckPending = 0;
+		}
+	}
+
+	// send our overtake request or release again until the lead car answers it,
+	// the answer may arrive meanwhile (receive work)
+	L_u8Mask = MNVIC_u8EnterCritical(NVIC_PENDSV_GROUP);
+	if (((SV2V_u8OvertakeState == SV2V_OVERTAKE_PENDING) || (SV2V_u8OvertakeState == V2V_OVERTAKE_COMPLETING)) &&
+		((MTMR_u32GetMicros() - SV2V_u32OvertakeSentTime) >= (V2V_OVERTAKE_RETRY_MS * V2V_US_PER_MS)))
+	{
+		if (SV2V_u8OvertakeRetries > 0)
+		{
+			SV2V_u8OvertakeRetries--;
+			SV2V_u8TransmitOvertake();
+		}
+		else
+		{
+			// nobody answers: the lead car drops its cap at the end of the hold time anyway
+			SV2V_u8OvertakeState = (SV2V_u8OvertakeState == SV2V_OVERTAKE_PENDING) ? SV2V_OVERTAKE_NO_ANSWER : SV2V_OVERTAKE_IDLE;
+			STRACE_voidLog(STRACE_EVT_OVERTAKE, SV2V_u8OvertakeLead, (u16)(SV2V_u8OvertakeState << 12));
+		}
+	}
+	MNVIC_voidExitCritical(L_u8Mask);
+
+	// answer the time request received by the receive work
+	if (SV2V_u8TimeAnswerPending)
+	{
+		L_Au8Payload[0] = V2V_OWN_ID;
+		L_Au8Payload[1] = SV2V_strTimeAnswer.Time_u8Peer;
+		SV2V_voidPutU32(&L_Au8Payload[2], SV2V_strTimeAnswer.Time_u32T1);
+		SV2V_voidPutU32(&L_Au8Payload[6], SV2V_strTimeAnswer.Time_u32T2);
+		SV2V_voidPutU32(&L_Au8Payload[10], MTMR_u32GetMicros());
+		if (SV2V_u8SendFrame(V2V_TYPE_TIME_RESPONSE, L_Au8Payload, V2V_TIME_RESPONSE_LENGTH, 0) == OK)
+		{
+			SV2V_u8TimeAnswerPending = 0;
+		}
+	}
+
+	if ((SV2V_u32Millis - SV2V_u32LastSyncMs) >= V2V_SYNC_PERIOD_MS)
+	{
+		SV2V_u32LastSyncMs = SV2V_u32Millis;
+		L_Au8Payload[0] = V2V_OWN_ID;
+		SV2V_voidPutU32(&L_Au8Payload[1], MTMR_u32GetMicros());
+		SV2V_u8SendFrame(V2V_TYPE_TIME_REQUEST, L_Au8Payload, V2V_TIME_REQUEST_LENGTH, 0);
+	}
+
+	if ((SV2V_u32Millis - SV2V_u32LastBeaconMs) < V2V_BEACON_PERIOD_MS)
+	{
+		return;
+	}
+	SV2V_u32LastBeaconMs = SV2V_u32Millis;
+
+	// acceleration since the previous beacon
+	L_u32Dt = (L_u32PoseTime - SV2V_u32BeaconPoseTime) / V2V_US_PER_MS;
+	if (L_u32Dt > 0)
+	{
+		L_s32Accel = (((s32)SV2V_strOwn.Beacon_u16Speed - (s32)SV2V_u16BeaconSpeed) * V2V_MS_PER_S) / (s32)L_u32Dt;
+		if (L_s32Accel > V2V_MAX_ACCEL)
+		{
+			L_s32Accel = V2V_MAX_ACCEL;
+		}
+		else if (L_s32Accel < -V2V_MAX_ACCEL)
+		{
+			L_s32Accel = -V2V_MAX_ACCEL;
+		}
+		SV2V_strOwn.Beacon_s16Accel = (s16)L_s32Accel;
+	}
+	SV2V_u16BeaconSpeed = SV2V_strOwn.Beacon_u16Speed;
+	SV2V_u32BeaconPoseTime = L_u32PoseTime;
+
+	L_Au8Payload[0] = SV2V_strOwn.Beacon_u8Id;
+	L_Au8Payload[1] = SV2V_strOwn.Beacon_u8Color;
+	SV2V_voidPutU16(&L_Au8Payload[2], (u16)SV2V_strOwn.Beacon_s16PosX);
+	SV2V_voidPutU16(&L_Au8Payload[4], (u16)SV2V_strOwn.Beacon_s16PosY);
+	SV2V_voidPutU16(&L_Au8Payload[6], SV2V_strOwn.Beacon_u16Speed);
+	SV2V_voidPutU16(&L_Au8Payload[8], SV2V_strOwn.Beacon_u16Heading);
+	L_Au8Payload[10] = SV2V_strOwn.Beacon_u8Brake;
+	SV2V_voidPutU16(&L_Au8Payload[11], SV2V_strOwn.Beacon_u16FrontDistance);
+	SV2V_voidPutU32(&L_Au8Payload[13], L_u32PoseTime);
+	SV2V_voidPutU16(&L_Au8Payload[17], (u16)SV2V_strOwn.Beacon_s16Accel);
+
+	SV2V_u8SendFrame(V2V_TYPE_BEACON, L_Au8Payload, V2V_BEACON_LENGTH, 0);
+}
+
+/**
+ * @brief Get the latest beacon of a neighbour.
+ */
+u8 SV2V_u8GetNeighbour(u8 Copy_u8Id, SV2V_BEACON_t * P_Beacon)
+{
+	return SNBR_u8Get(Copy_u8Id, P_Beacon);
+}
+
+/**
+ * @brief Send an emergency warning to the other cars.
+ */
+u8 SV2V_u8SendEmergency(u8 Copy_u8Kind)
+{
+	// sequence 0 is never used, it is the initial value of the receivers
+	SV2V_u8EmergencySequence++;
+	if (SV2V_u8EmergencySequence == 0)
+	{
+		SV2V_u8EmergencySequence = 1;
+	}
+	SV2V_u8EmergencyKind = Copy_u8Kind;
+	SV2V_u8EmergencyRetries = V2V_EMERGENCY_RETRIES;
+	SV2V_u8EmergencyAcked = 0;
+
+	STRACE_voidLog(STRACE_EVT_EMERGENCY_TX, Copy_u8Kind, SV2V_u8EmergencySequence);
+	return SV2V_u8TransmitEmergency();
+}
+
+/**
+ * @brief Set the function called when an emergency warning is received.
+ */
+void SV2V_voidSetEmergencyCallBack(void (*Copy_pfHandler)(u8 Copy_u8SenderId, u8 Copy_u8Kind))
+{
+	SV2V_pfEmergencyHandler = Copy_pfHandler;
+}
+
+/**
+ * @brief Set the function called by the USART1 interrupt when an emergency warning is received.
+ */
+void SV2V_voidSetEmergencyStopCallBack(void (*Copy_pfStop)(u8 Copy_u8SenderId, u8 Copy_u8Kind))
+{
+	SV2V_pfEmergencyStop = Copy_pfStop;
+}
+
+/**
+ * @brief Get the one way latency of the last acknowledged emergency.
+ */
+u32 SV2V_u32GetEmergencyLatency(void)
+{
+	return SV2V_u32EmergencyLatency;
+}
+
+/**
+ * @brief Ask the lead car to hold its speed while this car passes it.
+ *
+ * A refused, unanswered or granted overtake may be asked again, a new
+ * sequence tells the answers of the old one apart. The request is set up with
+ * the receive work (PendSV) masked, it matches the answers against it.
+ */
+u8 SV2V_u8RequestOvertake(u8 Copy_u8LeadId, u16 Copy_u16SpeedCap, u16 Copy_u16HoldTime)
+{
+	u8 L_u8State;
+	u8 L_u8Mask;
+
+	if ((Copy_u8LeadId == 0) || (Copy_u8LeadId == V2V_OWN_ID))
+	{
+		return OUT_OF_RANGE;
+	}
+	L_u8Mask = MNVIC_u8EnterCritical(NVIC_PENDSV_GROUP);
+	L_u8State = SV2V_u8OvertakeState;
+	if ((L_u8State == SV2V_OVERTAKE_PENDING) || (L_u8State == V2V_OVERTAKE_COMPLETING))
+	{
+		MNVIC_voidExitCritical(L_u8Mask);
+		return NOK;
+	}
+
+	SV2V_u8OvertakeSequence++;
+	SV2V_u8OvertakeLead = Copy_u8LeadId;
+	SV2V_u16OvertakeCap = Copy_u16SpeedCap;
+	SV2V_u16OvertakeHold = Copy_u16HoldTime;
+	SV2V_u8OvertakeRetries = V2V_OVERTAKE_RETRIES;
+	SV2V_u8OvertakeState = SV2V_OVERTAKE_PENDING;
+	MNVIC_voidExitCritical(L_u8Mask);
+
+	STRACE_voidLog(STRACE_EVT_OVERTAKE, Copy_u8LeadId, (u16)((SV2V_OVERTAKE_PENDING << 12) | (Copy_u16SpeedCap & 0xFFF)));
+	// a full FIFO is a lost frame, the task sends it again
+	SV2V_u8TransmitOvertake();
+	return OK;
+}
+
+/**
+ * @brief Get the answer of the lead car to the last overtake request.
+ *
+ * The release in progress is reported as SV2V_OVERTAKE_IDLE, the
+ * application has nothing left to wait for. The state and the cap are read
+ * together, the answer of the lead car sets both in the receive work (PendSV).
+ */
+u8 SV2V_u8GetOvertakeState(u16 * P_u16SpeedCap)
+{
+	u8 L_u8Mask = MNVIC_u8EnterCritical(NVIC_PENDSV_GROUP);
+	u8 L_u8State = SV2V_u8OvertakeState;
+
+	if (P_u16SpeedCap != NULL)
+	{
+		*P_u16SpeedCap = SV2V_u16OvertakeCap;
+	}
+	MNVIC_voidExitCritical(L_u8Mask);
+	return (L_u8State == V2V_OVERTAKE_COMPLETING) ? SV2V_OVERTAKE_IDLE : L_u8State;
+}
+
+/**
+ * @brief Tell the lead car the overtake is over.
+ *
+ * A refused overtake holds nothing, but the lead car may have granted a retry
+ * whose acknowledge was lost, so every asked overtake is released.
+ */
+void SV2V_voidCompleteOvertake(void)
+{
+	// an answer of the lead car must not land between the check and the release
+	u8 L_u8Mask = MNVIC_u8EnterCritical(NVIC_PENDSV_GROUP);
+
+	if ((SV2V_u8OvertakeState == SV2V_OVERTAKE_IDLE) || (SV2V_u8OvertakeState == V2V_OVERTAKE_COMPLETING))
+	{
+		MNVIC_voidExitCritical(L_u8Mask);
+		return;
+	}
+
+	SV2V_u8OvertakeState = V2V_OVERTAKE_COMPLETING;
+	SV2V_u8OvertakeRetries = V2V_OVERTAKE_RETRIES;
+	MNVIC_voidExitCritical(L_u8Mask);
+	SV2V_u8TransmitOvertake();
+}
+
+/**
+ * @brief Get the speed cap asked by a car passing this one.
+ *
+ * The holder, the hold time and the cap are set by the receive work (PendSV),
+ * they are read with it masked so a new request doesn't mix with the old one.
+ */
+u8 SV2V_u8GetSpeedCap(u16 * P_u16SpeedCap)
+{
+	u8 L_u8Mask;
+	u8 L_u8Result = OK;
+
+	if (P_u16SpeedCap == NULL)
+	{
+		return NULL_PTR_ERR;
+	}
+	L_u8Mask = MNVIC_u8EnterCritical(NVIC_PENDSV_GROUP);
+	if (SV2V_u8IsCapHeld() == 0)
+	{
+		L_u8Result = NOK;
+	}
+	else
+	{
+		*P_u16SpeedCap = SV2V_u16Cap;
+	}
+	MNVIC_voidExitCritical(L_u8Mask);
+	return L_u8Result;
+}
+
+/**
+ * @brief Get the time left before the task has something to do.
+ *
+ * The beacon and time request deadlines are computed like the task does,
+ * from the ms clock plus the us not counted yet, so the task always sends
+ * when this returns 0.
+ *
+ * @note Can be called with the interrupts masked.
+ */
+u32 SV2V_u32GetIdleTime(void)
+{
+	u32 L_u32Now = MTMR_u32GetMicros();
+	u32 L_u32Pending;
+	u32 L_u32Due = 0;
+	u32 L_u32Idle;
+
+	if ((SV2V_u8FrameHead != SV2V_u8FrameTail) || (SV2V_u8RxHead != SV2V_u8RxTail) ||
+		(SV2V_u8TimeHead != SV2V_u8TimeTail) || SV2V_u8AckPending ||
+		SV2V_u8TimeAnswerPending || SV2V_u8OvertakeAckPending)
+	{
+		return 0;
+	}
+
+	if ((SV2V_u32Millis - SV2V_u32LastBeaconMs) < V2V_BEACON_PERIOD_MS)
+	{
+		L_u32Due = (V2V_BEACON_PERIOD_MS - (SV2V_u32Millis - SV2V_u32LastBeaconMs)) * V2V_US_PER_MS;
+	}
+	if ((SV2V_u32Millis - SV2V_u32LastSyncMs) >= V2V_SYNC_PERIOD_MS)
+	{
+		L_u32Due = 0;
+	}
+	else if (((V2V_SYNC_PERIOD_MS - (SV2V_u32Millis - SV2V_u32LastSyncMs)) * V2V_US_PER_MS) < L_u32Due)
+	{
+		L_u32Due = (V2V_SYNC_PERIOD_MS - (SV2V_u32Millis - SV2V_u32LastSyncMs)) * V2V_US_PER_MS;
+	}
+	L_u32Pending = (L_u32Now - SV2V_u32LastMicros) + SV2V_u32MicrosRest;
+	L_u32Idle = (L_u32Due > L_u32Pending) ? (L_u32Due - L_u32Pending) : 0;
+
+	if ((SV2V_u8EmergencyAcked == 0) && (SV2V_u8EmergencyRetries > 0))
+	{
+		L_u32Pending = L_u32Now - SV2V_u32EmergencySentTime;
+		L_u32Due = V2V_EMERGENCY_RETRY_MS * V2V_US_PER_MS;
+		if (L_u32Pending >= L_u32Due)
+		{
+			L_u32Idle = 0;
+		}
+		else if ((L_u32Due - L_u32Pending) < L_u32Idle)
+		{
+			L_u32Idle = L_u32Due - L_u32Pending;
+		}
+	}
+
+	if ((SV2V_u8OvertakeState == SV2V_OVERTAKE_PENDING) || (SV2V_u8OvertakeState == V2V_OVERTAKE_COMPLETING))
+	{
+		L_u32Pending = L_u32Now - SV2V_u32OvertakeSentTime;
+		L_u32Due = V2V_OVERTAKE_RETRY_MS * V2V_US_PER_MS;
+		if (L_u32Pending >= L_u32Due)
+		{
+			L_u32Idle = 0;
+		}
+		else if ((L_u32Due - L_u32Pending) < L_u32Idle)
+		{
+			L_u32Idle = L_u32Due - L_u32Pending;
+		}
+	}
+	return L_u32Idle;
+}
@@ -1,247 +1,552 @@
-/**
- * @file main.c
- *
- * @brief Main source file for the Dummy Car system.
- *
- * This file contains the primary functionality for the Dummy Car. The Dummy Car is designed
- * to move ahead of the main car and provide essential data, including its color, the presence
- * of an object in front of it, and its current speed. The data is sent to the main car upon request.
- *
- * @Author: Project team
- *
- * @Date: November 11, 2023
- */
-/*******************************************************************************
- *                          	Standard Types                                 *
- *******************************************************************************/
-
-#include "../../LIB/ITI_STD_TYPES.h"
-#include "../../LIB/BIT_MATH.h"
-
-/*******************************************************************************
- *                          	MCAL Components                                 *
- *******************************************************************************/
-
-#include "MCAL/RCC/RCC_Interface.h"
-#include "MCAL/GPIOx/GPIO_Interface.h"
-#include "MCAL/SYSTICK/SYSTICK_Interface.h"
-#include "MCAL/GPTimer/TIMER_interface.h"
-#include "MCAL/NVIC/NVIC_Interface.h"
-#include "MCAL/USART/USART_Interface.h"
-
-/*******************************************************************************
- *                          	HAL Components                                 *
- *******************************************************************************/
-#include "HAL/DC_Motor/DC_Motor_Interface.h"
-#include "HAL/Ultrasonic/Ultrasonic_Interface.h"
-
-
-
-/**
- * @brief Macro defining the color red for the Dummy Car.
- */
-#define RED 						    1
-
-/**
- * @brief Macro indicating that an object is detected.
- */
-#define OBJECT_DETECTED  				1
-
-/**
- * @brief Macro indicating that no object is detected.
- */
-#define OBJECT_NOT_DETECTED	 			0
-
-/**
- * @brief Structure representing the Dummy Car's data, including color, speed, and object detection status.
- */
-typedef struct
-{
-	u8 car_u8color; /**< Color of the Dummy Car. */
-	u8 car_u8speed; /**< Speed of the Dummy Car. */
-	u8 car_u8objectDetected; /**< Object detection status of the Dummy Car. */
-
-}CAR_t;
-
-/**
- * @brief Enumeration representing the direction for overtaking.
- */
-typedef enum
-{
-	RIGHT_OVT, /**< Right-side overtaking direction. */
-	LEFT_OVT   /**< Left-side overtaking direction. */
-
-}OVER_TAKE_DIR_t;
-
-/**
- * @brief Global variable for receiving Bluetooth orders from USART6 interrupt.
- */
-extern u8 G_u8BluetoothOrder;
-
-/**
- * @brief Global variable indicating the received request from the dummy's Raspberry Pi.
- */
-extern u8 G_u8ReceivedRequest;
-
-/**
- * @brief Global variable representing the distance obtained from the ultrasonic sensor.
- */
-u32 G_u32USDistance;
-
-/**
- * @brief Global variable representing the speed indicator.
- */
-extern u32 G_u32SpeedIndicator;
-
-
-/**
- * @brief Initialization data for the Dummy Car.
- */
-CAR_t DummyCar = {RED, '4', OBJECT_NOT_DETECTED};
-
-/*******************************************************************************
- *                          	Entry Function                                 *
- *******************************************************************************/
-void main (void)
-{
-	/**
-	 * @brief Variable to store Raspberry Pi data.
-	 */
-
-	u8 L_u8Raspberry_Data= 0;
-	// RCC Initialization >> 'INTERNAL CLOCK'
-	MRCC_VoidInit();
-	MSTK_voidInit();
-	 // ENABLE GPIOA + DC MOTOR Initialization
-	HDCM_u8Init();
-
-	// ENABLE  GPIOB
-	MRCC_VoidEnablePeriphral(AHB1_BUS,GPIO_PORTB);
-
-	// ENABLE TIMER 2
-	MRCC_VoidEnablePeriphral(APB1_BUS,RCC_APB1_TIMER2);
-
-	// TIMER2 channel 1  PINS
-	MGPIO_voidSetPinMode(GPIO_PORTA,CH1_PIN,GPIO_MODE_ALTF);
-	MGPIO_voidSetPinAltFun(GPIO_PORTA,CH1_PIN,GPIO_ALTFN_1);
-	// TIMER2 channel 2  PINS
-	MGPIO_voidSetPinMode(GPIO_PORTA,CH2_PIN,GPIO_MODE_ALTF);
-	MGPIO_voidSetPinAltFun(GPIO_PORTA,CH2_PIN,GPIO_ALTFN_1);
-
-	// DC MOTOR Starting
-	HDCM_voidStart();
-	// ULTRASONIC INITIALIZATION
-	HUS_voidInit();
-
-	//ENABLE USART1
-	MRCC_VoidEnablePeriphral(APB2_BUS,RCC_APB2_USART1);
-	//ENABLE USART6
-	MRCC_VoidEnablePeriphral(APB2_BUS,RCC_APB2_USART6);
-
-	// ENABLE USART1  INTERRUPT
-	MNVIC_voidEnableInterrupt(NVIC_USART1);
-	// ENABLE USART6  INTERRUPT
-	MNVIC_voidEnableInterrupt(NVIC_USART6);
-
-	//USART1  PINS
-	MGPIO_voidSetPinMode(MUSART1_PORT,MUSART1_TX_PIN,GPIO_MODE_ALTF); //TX
-	MGPIO_voidSetPinAltFun(MUSART1_PORT,MUSART1_TX_PIN,MUSART1_ALF);
-	MGPIO_voidSetPinMode(MUSART1_PORT,MUSART1_RX_PIN,GPIO_MODE_ALTF); //RX
-	MGPIO_voidSetPinAltFun(MUSART1_PORT,MUSART1_RX_PIN,MUSART1_ALF);
-
-	//USART6  PINS
-	MGPIO_voidSetPinMode(MUSART6_PORT,MUSART6_TX_PIN,GPIO_MODE_ALTF); //TX
-	MGPIO_voidSetPinAltFun(MUSART6_PORT,MUSART6_TX_PIN,MUSART6_ALF);
-	MGPIO_voidSetPinMode(MUSART6_PORT,MUSART6_RX_PIN,GPIO_MODE_ALTF); //RX
-	MGPIO_voidSetPinAltFun(MUSART6_PORT,MUSART6_RX_PIN,MUSART6_ALF);
-
-	// USART1 Initialization  >> for Raspberry
-	MUSART1_voidInit();
-	// USART6 Initialization  >> for Bluetooth
-	MUSART6_voidInit();
-
-
-	while (1)
-	{
-
-		//CONTROL THE SPEED AND DIRECTION OF THE Dummy CAR
-
-		if ((G_u8BluetoothOrder >='0' && G_u8BluetoothOrder<='9')||(G_u8BluetoothOrder=='q'))
-		{
-			HDCM_u8ChangeSpeed(G_u8BluetoothOrder);
-		}
-		else
-		{
-			HDCM_u8CarState(G_u8BluetoothOrder);
-		}
-
-		if (G_u8BluetoothOrder=='S')
-		{
-			DummyCar.car_u8speed=0;
-		}
-
-		else
-		{
-			switch(G_u32SpeedIndicator)
-			{
-			case 0     : DummyCar.car_u8speed=0; 		break;
-			case 1000  : DummyCar.car_u8speed=1; 		break;
-			case 2000  : DummyCar.car_u8speed=2;     	break;
-			case 3000  : DummyCar.car_u8speed=3; 		break;
-			case 4000  : DummyCar.car_u8speed=4;     	break;
-			case 5000  : DummyCar.car_u8speed=5; 		break;
-			case 6000  : DummyCar.car_u8speed=6;     	break;
-			case 7000  : DummyCar.car_u8speed=7; 		break;
-			case 8000  : DummyCar.car_u8speed=8;     	break;
-			case 9000  : DummyCar.car_u8speed=9; 		break;
-			case 10000 : DummyCar.car_u8speed=9; 		break;
-			default   :                                 break;
-			}
-		}
-		if (G_u8BluetoothOrder=='F')
-		{
-			G_u32USDistance = HUS_f32CalcDistance(FORWARD_US);
-			if(G_u32USDistance < 20)
-			{
-				// Stop dummy car
-				G_u8BluetoothOrder = 'S';
-			}
-		}
-
-		if(G_u8ReceivedRequest== 'R')
-		{
-			G_u32USDistance = HUS_f32CalcDistance(FORWARD_US);
-			if(G_u32USDistance < 20)
-			{
-				DummyCar.car_u8objectDetected=OBJECT_DETECTED;
-				// Stop dummy car
-				G_u8BluetoothOrder = 'S';
-			}
-			// check ,in front of dummy car
-			else if(G_u32USDistance < 200)
-			{
-				// My Camera will detect if there is an object or a car
-				DummyCar.car_u8objectDetected=OBJECT_DETECTED;
-			}
-
-			else
-			{
-				// There is no thing in front of the car within mentioned range
-				DummyCar.car_u8objectDetected=OBJECT_NOT_DETECTED;
-			}
-
-			// To send dummy data in one message
-			L_u8Raspberry_Data=L_u8Raspberry_Data*10+DummyCar.car_u8color;
-			L_u8Raspberry_Data=L_u8Raspberry_Data*10+DummyCar.car_u8objectDetected;
-			L_u8Raspberry_Data=L_u8Raspberry_Data*10+(DummyCar.car_u8speed);
-
-			//Send Dummy car data to its Raspberry
-			MUSART1_voidTransmitData(L_u8Raspberry_Data);
-			//TO prevent sending data without a request
-			G_u8ReceivedRequest=0;
-		}
-		//To prevent data corruption
-		L_u8Raspberry_Data=0;
-	}
-}
-
+/**
+ * @file main.c
+ *
+ * @brief Main source file for the Dummy Car system.
+ *
+ * This file contains the primary functionality for the Dummy Car. The Dummy Car is designed
+ * to move ahead of the main car and provide essential data, including its color, the presence
+ * of an object in front of it, and its current speed. The data is sent to the main car upon request.
+ *
+ * @Author: Project team
+ *
+ * @Date: November 11, 2023
+ */
+/*******************************************************************************
+ *                          	Standard Types                                 *
+ *******************************************************************************/
+
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+
+#include "MCAL/RCC/RCC_Interface.h"
+#include "MCAL/GPIOx/GPIO_Interface.h"
+#include "MCAL/SYSTICK/SYSTICK_Interface.h"
+#include "MCAL/SYSTICK/SYSTICK_Config.h"
+#include "MCAL/GPTimer/TIMER_interface.h"
+#include "MCAL/NVIC/NVIC_Interface.h"
+#include "MCAL/USART/USART_Interface.h"
+
+/*******************************************************************************
+ *                          	HAL Components                                 *
+ *******************************************************************************/
+#include "HAL/DC_Motor/DC_Motor_Interface.h"
+#include "HAL/Ultrasonic/Ultrasonic_Interface.h"
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "SERVICE/Trace/Trace_Interface.h"
+#include "SERVICE/Trace/Trace_Config.h"
+#include "SERVICE/V2V/V2V_Interface.h"
+#include "SERVICE/V2V/V2V_Config.h"
+#include "SERVICE/Neighbour/Neighbour_Interface.h"
+#include "SERVICE/Odometry/Odometry_Interface.h"
+#include "SERVICE/Odometry/Odometry_Config.h"
+#include "SERVICE/Power/Power_Interface.h"
+#include "SERVICE/Defer/Defer_Interface.h"
+#include "SERVICE/Scan/Scan_Interface.h"
+#include "SERVICE/Ttc/Ttc_Interface.h"
+#include "SERVICE/Link/Link_Interface.h"
+#include "SERVICE/Link/Link_Config.h"
+
+
+
+/**
+ * @brief Macro defining the color red for the Dummy Car.
+ */
+#define RED 						    1
+
+/**
+ * @brief Macro indicating that an object is detected.
+ */
+#define OBJECT_DETECTED  				1
+
+/**
+ * @brief Macro indicating that no object is detected.
+ */
+#define OBJECT_NOT_DETECTED	 			0
+
+/**
+ * @brief The car also brakes when the obstacle ahead will be reached in this time (ms),
+ *        earlier than BRAKE_DISTANCE_CM above 40 cm/s.
+ */
+#define BRAKE_TTC_MS					500
+
+/**
+ * @brief The car brakes when the obstacle ahead is this close whatever the speed (cm),
+ *        also without a time to collision (too few readings, track just reset).
+ */
+#define BRAKE_DISTANCE_CM				20
+
+/**
+ * @brief An emergency brake of the car ahead stops this one when it is at most this far (cm),
+ *        a farther one leaves time to the own obstacle checks.
+ */
+#define EMERGENCY_BRAKE_RANGE_CM		150
+
+/**
+ * @brief The manoeuvre profile is entered below this distance ahead (cm) and left above
+ *        POWER_NEAR_EXIT_CM, a reading around one limit doesn't switch the clock back and forth.
+ */
+#define POWER_NEAR_ENTER_CM				20
+#define POWER_NEAR_EXIT_CM				30
+
+/**
+ * @brief SysTick ticks per microsecond, to give the sleep time to MSTK_voidSleep.
+ */
+#define STK_TICKS_PER_US				(MSTK_TICK_FREQ_HZ / 1000000UL)
+
+/**
+ * @brief Request of the main car for the dummy car data, answered with 'R' then the data.
+ */
+#define REQ_FOR_DUMMY_DATA				'R'
+
+/**
+ * @brief Structure representing the Dummy Car's data, including color, speed, and object detection status.
+ */
+typedef struct
+{
+	u8 car_u8color; /**< Color of the Dummy Car. */
+	u8 car_u8speed; /**< Speed of the Dummy Car. */
+	u8 car_u8objectDetected; /**< Object detection status of the Dummy Car. */
+
+}CAR_t;
+
+/**
+ * @brief Enumeration representing the direction for overtaking.
+ */
+typedef enum
+{
+	RIGHT_OVT, /**< Right-side overtaking direction. */
+	LEFT_OVT   /**< Left-side overtaking direction. */
+
+}OVER_TAKE_DIR_t;
+
+/**
+ * @brief Global variable for receiving Bluetooth orders from USART6 interrupt.
+ */
+extern u8 G_u8BluetoothOrder;
+
+/**
+ * @brief Global variable indicating the received request from the dummy's Raspberry Pi.
+ */
+u8 G_u8ReceivedRequest = 0;
+
+/**
+ * @brief Global variable representing the distance obtained from the ultrasonic sensor.
+ */
+u32 G_u32USDistance;
+
+/**
+ * @brief Global variable representing the speed indicator.
+ */
+extern u32 G_u32SpeedIndicator;
+
+/**
+ * @brief Last order given to the motors, an order is applied once and not on every pass.
+ */
+u8 G_u8AppliedOrder = 0;
+
+/**
+ * @brief Speed order given back when a passing car releases its speed cap, 0 while none is held back.
+ */
+u8 G_u8HeldSpeedOrder = 0;
+
+/**
+ * @brief 1 while the obstacle ahead is close enough for the manoeuvre profile (with hysteresis).
+ */
+u8 G_u8ObstacleNear = 0;
+
+/**
+ * @brief Initialization data for the Dummy Car.
+ */
+CAR_t DummyCar = {RED, '4', OBJECT_NOT_DETECTED};
+
+/**
+ * @brief Stopping the motors on an emergency warning of another car.
+ *
+ * Called from the USART1 interrupt that received the warning, so the motors
+ * don't wait for the main loop or the lower priority handlers. Whether the
+ * warning concerns this car is decided right after, from PendSV, by
+ * APP_voidEmergencyHandler.
+ *
+ * @param Copy_u8SenderId The vehicle ID of the warning car.
+ * @param Copy_u8Kind SV2V_EMERGENCY_BRAKE or SV2V_EMERGENCY_HAZARD, other kinds are ignored.
+ *
+ */
+void APP_voidEmergencyStop(u8 Copy_u8SenderId , u8 Copy_u8Kind)
+{
+	if ((Copy_u8Kind == SV2V_EMERGENCY_BRAKE) || (Copy_u8Kind == SV2V_EMERGENCY_HAZARD))
+	{
+		HDCM_voidStop();
+	}
+}
+/**
+ * @brief Holding or undoing the stop of an emergency warning of another car.
+ *
+ * Called from PendSV after APP_voidEmergencyStop. The stop order holds the car
+ * stopped until the driver sends a new order.
+ *
+ * Both warnings concern the cars behind the sender in its lane: the car only
+ * stays stopped when the neighbour table puts the sender ahead in the same
+ * lane, and for a brake warning only within EMERGENCY_BRAKE_RANGE_CM, else it
+ * drives on with its command. A sender the table doesn't know (no beacon yet,
+ * or stale) can't be placed, the car stays stopped.
+ *
+ * @param Copy_u8SenderId The vehicle ID of the warning car.
+ * @param Copy_u8Kind SV2V_EMERGENCY_BRAKE or SV2V_EMERGENCY_HAZARD, other kinds are ignored.
+ *
+ */
+void APP_voidEmergencyHandler(u8 Copy_u8SenderId , u8 Copy_u8Kind)
+{
+	s8 L_s8LaneOffset;
+	s32 L_s32Gap;
+
+	if ((Copy_u8Kind != SV2V_EMERGENCY_BRAKE) && (Copy_u8Kind != SV2V_EMERGENCY_HAZARD))
+	{
+		return;
+	}
+	if (SNBR_u8GetRelativePosition(Copy_u8SenderId, &L_s8LaneOffset, &L_s32Gap) == OK)
+	{
+		// another lane, behind this car, or a brake too far ahead
+		if ((L_s8LaneOffset != 0) || (L_s32Gap <= 0) ||
+			((Copy_u8Kind == SV2V_EMERGENCY_BRAKE) && (L_s32Gap > EMERGENCY_BRAKE_RANGE_CM)))
+		{
+			HDCM_voidResume();
+			return;
+		}
+	}
+
+	G_u8BluetoothOrder = 'S';
+	// the main loop may be driving the motors: make it apply the stop again
+	G_u8AppliedOrder = 0;
+}
+
+/**
+ * @brief Keeping the speed at or below the cap asked by a car passing this one.
+ *
+ * The speed order in force is held back while the cap is lower and given
+ * back when the passing car releases it (or its hold time ends). A new speed
+ * order of the driver replaces the one held back, it is capped too.
+ */
+void APP_voidApplySpeedCap(void)
+{
+	u16 L_u16Cap;
+	u8 L_u8CapLevel;
+
+	if (SV2V_u8GetSpeedCap(&L_u16Cap) == OK)
+	{
+		L_u16Cap /= (ODO_SPEED_LEVEL_MM_S / 10);
+		L_u8CapLevel = (L_u16Cap > 9) ? 9 : (u8)L_u16Cap;
+		if (G_u32SpeedIndicator > (L_u8CapLevel * 1000UL))
+		{
+			if (G_u8HeldSpeedOrder == 0)
+			{
+				G_u8HeldSpeedOrder = (G_u32SpeedIndicator >= 10000) ? 'q' : (u8)('0' + (G_u32SpeedIndicator / 1000));
+			}
+			HDCM_u8ChangeSpeed(L_u8CapLevel);
+		}
+	}
+	else if (G_u8HeldSpeedOrder != 0)
+	{
+		HDCM_u8ChangeSpeed(G_u8HeldSpeedOrder);
+		G_u8HeldSpeedOrder = 0;
+	}
+}
+
+/**
+ * @brief Checking for work that came while the main loop was going to sleep.
+ *
+ * Called by MSTK_voidSleep with the interrupts masked: a new bluetooth order,
+ * a request of the raspberry or V2V work keeps the core awake.
+ *
+ * @return 1 if the main loop has something to do, 0 if not.
+ */
+u8 APP_u8IsBusy(void)
+{
+	return (G_u8BluetoothOrder != G_u8AppliedOrder) || SLNK_u8IsRxPending() || (SV2V_u32GetIdleTime() == 0);
+}
+
+/**
+ * @brief Checking whether the car must brake for the obstacle ahead.
+ *
+ * Always within BRAKE_DISTANCE_CM, as before the time to collision, which
+ * only makes the car brake earlier at speed.
+ *
+ * @return 1 if the car must brake, 0 if not.
+ */
+u8 APP_u8MustBrake(void)
+{
+	return (G_u32USDistance < BRAKE_DISTANCE_CM) || (STTC_u32GetTtc(FORWARD_US) < BRAKE_TTC_MS);
+}
+
+/**
+ * @brief Choosing the power profile from what the car is doing.
+ *
+ * Parked when stopped, manoeuvre while turning or close to an obstacle,
+ * cruise otherwise. The obstacle is close from POWER_NEAR_ENTER_CM until it is
+ * farther than POWER_NEAR_EXIT_CM.
+ *
+ * @return SPWR_PROFILE_PARKED, SPWR_PROFILE_CRUISE or SPWR_PROFILE_MANOEUVRE.
+ */
+u8 APP_u8PowerProfile(void)
+{
+	if ((G_u8BluetoothOrder == 'S') || (G_u8BluetoothOrder == TRACE_DUMP_ORDER))
+	{
+		return SPWR_PROFILE_PARKED;
+	}
+	if (G_u32USDistance < POWER_NEAR_ENTER_CM)
+	{
+		G_u8ObstacleNear = 1;
+	}
+	else if (G_u32USDistance > POWER_NEAR_EXIT_CM)
+	{
+		G_u8ObstacleNear = 0;
+	}
+	if ((G_u8BluetoothOrder == 'R') || (G_u8BluetoothOrder == 'L') || (G_u8ObstacleNear != 0))
+	{
+		return SPWR_PROFILE_MANOEUVRE;
+	}
+	return SPWR_PROFILE_CRUISE;
+}
+
+/*******************************************************************************
+ *                          	Entry Function                                 *
+ *******************************************************************************/
+void main (void)
+{
+	/**
+	 * @brief Variable to store Raspberry Pi data.
+	 */
+
+	u8 L_u8Raspberry_Data= 0;
+	u8 L_Au8Message[LNK_MAX_PAYLOAD];
+	u8 L_u8Length;
+	u32 L_u32IdleUs;
+	u32 L_u32ScanIdleUs;
+	u32 L_u32LinkIdleUs;
+	f32 L_f32Distance;
+	// RCC Initialization >> 'INTERNAL CLOCK'
+	MRCC_VoidInit();
+	MSTK_voidInit();
+	//ENABLE TIMER5 (microsecond timebase) + flight recorder
+	MRCC_VoidEnablePeriphral(APB1_BUS,RCC_APB1_TIMER5);
+	MTMR_voidTimeBaseInit();
+	STRACE_voidInit();
+	 // ENABLE GPIOA + DC MOTOR Initialization
+	HDCM_u8Init();
+	// pose of the car from the wheel command
+	SODO_voidInit();
+
+	// ENABLE  GPIOB
+	MRCC_VoidEnablePeriphral(AHB1_BUS,GPIO_PORTB);
+
+	// ENABLE TIMER 2
+	MRCC_VoidEnablePeriphral(APB1_BUS,RCC_APB1_TIMER2);
+
+	// TIMER2 channel 1  PINS
+	MGPIO_voidSetPinMode(GPIO_PORTA,CH1_PIN,GPIO_MODE_ALTF);
+	MGPIO_voidSetPinAltFun(GPIO_PORTA,CH1_PIN,GPIO_ALTFN_1);
+	// TIMER2 channel 2  PINS
+	MGPIO_voidSetPinMode(GPIO_PORTA,CH2_PIN,GPIO_MODE_ALTF);
+	MGPIO_voidSetPinAltFun(GPIO_PORTA,CH2_PIN,GPIO_ALTFN_1);
+
+	// DC MOTOR Starting
+	HDCM_voidStart();
+	// ULTRASONIC INITIALIZATION
+	HUS_voidInit();
+	SSCAN_voidInit();
+	STTC_voidInit();
+	// the beacons and the requests need a front distance from the start
+	while (SSCAN_u8GetDistance(FORWARD_US, &L_f32Distance) != OK)
+	{
+		SSCAN_voidTask();
+	}
+	G_u32USDistance = L_f32Distance;
+
+	//ENABLE USART1
+	MRCC_VoidEnablePeriphral(APB2_BUS,RCC_APB2_USART1);
+	//ENABLE USART6
+	MRCC_VoidEnablePeriphral(APB2_BUS,RCC_APB2_USART6);
+
+	// interrupt priorities: echo edges, then bluetooth orders, then the raspberry link
+	MNVIC_voidInit();
+	// the slow part of the handlers runs from PendSV
+	SDEF_voidInit();
+	// ENABLE USART1  INTERRUPT
+	MNVIC_voidEnableInterrupt(NVIC_USART1);
+	// ENABLE USART6  INTERRUPT
+	MNVIC_voidEnableInterrupt(NVIC_USART6);
+
+	//USART1  PINS
+	MGPIO_voidSetPinMode(MUSART1_PORT,MUSART1_TX_PIN,GPIO_MODE_ALTF); //TX
+	MGPIO_voidSetPinAltFun(MUSART1_PORT,MUSART1_TX_PIN,MUSART1_ALF);
+	MGPIO_voidSetPinMode(MUSART1_PORT,MUSART1_RX_PIN,GPIO_MODE_ALTF); //RX
+	MGPIO_voidSetPinAltFun(MUSART1_PORT,MUSART1_RX_PIN,MUSART1_ALF);
+
+	//USART6  PINS
+	MGPIO_voidSetPinMode(MUSART6_PORT,MUSART6_TX_PIN,GPIO_MODE_ALTF); //TX
+	MGPIO_voidSetPinAltFun(MUSART6_PORT,MUSART6_TX_PIN,MUSART6_ALF);
+	MGPIO_voidSetPinMode(MUSART6_PORT,MUSART6_RX_PIN,GPIO_MODE_ALTF); //RX
+	MGPIO_voidSetPinAltFun(MUSART6_PORT,MUSART6_RX_PIN,MUSART6_ALF);
+
+	// USART1 Initialization  >> for Raspberry
+	MUSART1_voidInit();
+	// USART6 Initialization  >> for Bluetooth
+	MUSART6_voidInit();
+	// V2V beacons over the raspberry link
+	SV2V_voidInit();
+	SV2V_voidSetEmergencyStopCallBack(APP_voidEmergencyStop);
+	SV2V_voidSetEmergencyCallBack(APP_voidEmergencyHandler);
+	// requests of the main car over the raspberry link
+	SLNK_voidInit();
+	// stop the unused clocks, the car starts parked
+	SPWR_voidInit();
+
+
+	while (1)
+	{
+		// lowest clock for what the car is doing, before driving the motors
+		SPWR_u8SetProfile(APP_u8PowerProfile());
+
+		// request coming from the raspberry (polling of the main car)
+		SLNK_voidTask();
+		if ((SLNK_u8Receive(SLNK_CHANNEL_V2V, L_Au8Message, &L_u8Length) == OK) && (L_u8Length == 1))
+		{
+			G_u8ReceivedRequest = L_Au8Message[0];
+		}
+
+		//CONTROL THE SPEED AND DIRECTION OF THE Dummy CAR
+
+		if (G_u8BluetoothOrder == TRACE_DUMP_ORDER)
+		{
+			// stop the car then send the flight recorder content to the phone
+			HDCM_voidStop();
+			STRACE_voidDump();
+			G_u8BluetoothOrder = 'S';
+			G_u8AppliedOrder = 'S';
+		}
+		else if (G_u8AppliedOrder == G_u8BluetoothOrder)
+		{
+			// the motors keep their state, they are driven again only on a new order
+		}
+		else if ((G_u8BluetoothOrder >='0' && G_u8BluetoothOrder<='9')||(G_u8BluetoothOrder=='q'))
+		{
+			G_u8AppliedOrder = G_u8BluetoothOrder;
+			HDCM_u8ChangeSpeed(G_u8AppliedOrder);
+			G_u8HeldSpeedOrder = 0;
+		}
+		else
+		{
+			G_u8AppliedOrder = G_u8BluetoothOrder;
+			HDCM_u8CarState(G_u8AppliedOrder);
+		}
+
+		if (G_u8BluetoothOrder=='S')
+		{
+			DummyCar.car_u8speed=0;
+		}
+
+		else
+		{
+			switch(G_u32SpeedIndicator)
+			{
+			case 0     : DummyCar.car_u8speed=0; 		break;
+			case 1000  : DummyCar.car_u8speed=1; 		break;
+			case 2000  : DummyCar.car_u8speed=2;     	break;
+			case 3000  : DummyCar.car_u8speed=3; 		break;
+			case 4000  : DummyCar.car_u8speed=4;     	break;
+			case 5000  : DummyCar.car_u8speed=5; 		break;
+			case 6000  : DummyCar.car_u8speed=6;     	break;
+			case 7000  : DummyCar.car_u8speed=7; 		break;
+			case 8000  : DummyCar.car_u8speed=8;     	break;
+			case 9000  : DummyCar.car_u8speed=9; 		break;
+			case 10000 : DummyCar.car_u8speed=9; 		break;
+			default   :                                 break;
+			}
+		}
+		// the front distance is measured every few cm travelled (slowly when parked), it is published in the beacons
+		SSCAN_u8SetMode((G_u8BluetoothOrder == 'S') ? SSCAN_MODE_PARKED : SSCAN_MODE_CRUISE, SODO_u16GetSpeedCmS());
+		SSCAN_voidTask();
+		STTC_voidTask(SODO_u16GetSpeedCmS());
+		if (SSCAN_u8GetNewDistance(FORWARD_US, &L_f32Distance) == OK)
+		{
+			G_u32USDistance = L_f32Distance;
+		}
+		SODO_voidTask();
+		SV2V_voidSetOwnState((G_u8BluetoothOrder == 'S'), (u16)G_u32USDistance);
+		SV2V_voidTask();
+		// a car passing this one may ask it to hold its speed
+		APP_voidApplySpeedCap();
+
+		if (G_u8BluetoothOrder=='F')
+		{
+			if(APP_u8MustBrake())
+			{
+				// Stop dummy car and warn the main car at once, it doesn't wait for its next 'R' request
+				G_u8BluetoothOrder = 'S';
+				SV2V_u8SendEmergency(SV2V_EMERGENCY_BRAKE);
+			}
+		}
+
+		if(G_u8ReceivedRequest== REQ_FOR_DUMMY_DATA)
+		{
+			if(APP_u8MustBrake())
+			{
+				DummyCar.car_u8objectDetected=OBJECT_DETECTED;
+				if (G_u8BluetoothOrder != 'S')
+				{
+					SV2V_u8SendEmergency(SV2V_EMERGENCY_BRAKE);
+				}
+				// Stop dummy car
+				G_u8BluetoothOrder = 'S';
+			}
+			// check ,in front of dummy car
+			else if(G_u32USDistance < 200)
+			{
+				// My Camera will detect if there is an object or a car
+				DummyCar.car_u8objectDetected=OBJECT_DETECTED;
+			}
+
+			else
+			{
+				// There is no thing in front of the car within mentioned range
+				DummyCar.car_u8objectDetected=OBJECT_NOT_DETECTED;
+			}
+
+			// To send dummy data in one message
+			L_u8Raspberry_Data=L_u8Raspberry_Data*10+DummyCar.car_u8color;
+			L_u8Raspberry_Data=L_u8Raspberry_Data*10+DummyCar.car_u8objectDetected;
+			L_u8Raspberry_Data=L_u8Raspberry_Data*10+(DummyCar.car_u8speed);
+
+			//Send Dummy car data to its Raspberry, after the request it answers
+			L_Au8Message[0] = REQ_FOR_DUMMY_DATA;
+			L_Au8Message[1] = L_u8Raspberry_Data;
+			SLNK_u8Send(SLNK_CHANNEL_V2V, L_Au8Message, 2);
+			//TO prevent sending data without a request
+			G_u8ReceivedRequest=0;
+		}
+		//To prevent data corruption
+		L_u8Raspberry_Data=0;
+
+		// sleep until the next beacon, ping or retransmission, a bluetooth order, a raspberry frame
+		// or an echo edge wakes the core at once with its interrupt
+		L_u32IdleUs = SV2V_u32GetIdleTime();
+		L_u32ScanIdleUs = SSCAN_u32GetIdleTime();
+		if (L_u32ScanIdleUs < L_u32IdleUs)
+		{
+			L_u32IdleUs = L_u32ScanIdleUs;
+		}
+		L_u32LinkIdleUs = SLNK_u32GetIdleTime();
+		if (L_u32LinkIdleUs < L_u32IdleUs)
+		{
+			L_u32IdleUs = L_u32LinkIdleUs;
+		}
+		MSTK_voidSleep(L_u32IdleUs * STK_TICKS_PER_US, APP_u8IsBusy);
+	}
+}
+
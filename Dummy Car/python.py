@@ -1,7 +1,195 @@
 import serial
 import socket
+import threading
+import queue
+import time
 ser = serial.Serial('/dev/serial0', baudrate=9600)  # Adjust the baud rate as needed
 ser.timeout = None
+
+# V2V frames (status beacons, emergencies, time requests and responses, overtake
+# negotiation) share the serial link with the handshake bytes:
+# SYNC(0xAA) | TYPE | LENGTH | PAYLOAD | CHECKSUM (xor of TYPE, LENGTH, PAYLOAD).
+# The frames coming from the STM are broadcast to the other cars over UDP and the
+# frames of the other cars are written to the STM, the other bytes keep their old path.
+V2V_SYNC = 0xAA
+V2V_MAX_PAYLOAD = 24
+V2V_PORT = 12346
+ser_lock = threading.Lock()
+legacy_bytes = queue.Queue()
+own_ids = set()
+v2v_socket = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+v2v_socket.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+v2v_socket.setsockopt(socket.SOL_SOCKET, socket.SO_BROADCAST, 1)
+v2v_socket.bind(('', V2V_PORT))
+
+def ser_write(data):
+	with ser_lock:
+		ser.write(data)
+
+# Link frames carry the request / answer messages of the STM, several at once:
+# SYNC(0xA5) | TYPE | CHANNEL | SEQ | ACK | LENGTH | PAYLOAD | CHECKSUM (xor of TYPE to PAYLOAD).
+# Each channel is numbered on its own: DATA frames are numbered, ACK is the next number
+# expected from the other side (all the ones before are received), a message not
+# acknowledged in time is sent again alone. A lost message only holds its own channel.
+LINK_SYNC = 0xA5
+LINK_DATA = 1
+LINK_ACK = 2
+LINK_RESET = 3
+LINK_WINDOW = 4
+LINK_MAX_PAYLOAD = 8
+LINK_RETRY_S = 0.08
+LINK_MAX_RETRIES = 5
+LINK_CHANNEL_V2V = 0
+LINK_CHANNEL_CAMERA = 1
+LINK_CHANNEL_TELEMETRY = 2
+LINK_CHANNEL_COUNT = 3
+
+def link_frame_is_valid(frame):
+	if len(frame) < 7 or frame[0] != LINK_SYNC or frame[5] != len(frame) - 7 or frame[2] >= LINK_CHANNEL_COUNT:
+		return False
+	checksum = 0
+	for byte in frame[1:-1]:
+		checksum ^= byte
+	return checksum == frame[-1]
+
+class LinkChannel:
+	def __init__(self):
+		self.tx_base = 0
+		self.tx_next = 0
+		self.tx_slots = {}      # sequence : [message, sent time, retries]
+		self.rx_expected = 0
+		self.rx_window = {}     # sequence : message received after a missing one
+		self.messages = queue.Queue()
+
+class Link:
+	def __init__(self):
+		self.lock = threading.Condition()
+		self.channels = [LinkChannel() for i in range(LINK_CHANNEL_COUNT)]
+
+	def write(self, kind, channel, seq, payload):
+		frame = bytes([kind, channel, seq, self.channels[channel].rx_expected, len(payload)]) + payload
+		checksum = 0
+		for byte in frame:
+			checksum ^= byte
+		ser_write(bytes([LINK_SYNC]) + frame + bytes([checksum]))
+
+	# drop the messages in flight on a channel, the other side expects tx_next next
+	def reset(self, channel):
+		with self.lock:
+			state = self.channels[channel]
+			state.tx_base = state.tx_next
+			state.tx_slots.clear()
+			self.write(LINK_RESET, channel, state.tx_next, b'')
+			self.lock.notify_all()
+
+	def reset_all(self):
+		for channel in range(LINK_CHANNEL_COUNT):
+			self.reset(channel)
+
+	def send(self, channel, message):
+		with self.lock:
+			state = self.channels[channel]
+			while ((state.tx_next - state.tx_base) & 0xFF) >= LINK_WINDOW:
+				self.lock.wait()
+			seq = state.tx_next
+			state.tx_slots[seq] = [message, time.monotonic(), 0]
+			state.tx_next = (seq + 1) & 0xFF
+			self.write(LINK_DATA, channel, seq, message)
+
+	def receive(self, channel):
+		return self.channels[channel].messages.get()
+
+	def on_frame(self, frame):
+		kind, channel, seq, ack, length = frame[1], frame[2], frame[3], frame[4], frame[5]
+		with self.lock:
+			state = self.channels[channel]
+			if ((ack - state.tx_base) & 0xFF) <= ((state.tx_next - state.tx_base) & 0xFF):
+				while state.tx_base != ack:
+					state.tx_slots.pop(state.tx_base, None)
+					state.tx_base = (state.tx_base + 1) & 0xFF
+				self.lock.notify_all()
+			if kind == LINK_RESET:
+				state.rx_expected = seq
+				state.rx_window.clear()
+				self.write(LINK_ACK, channel, 0, b'')
+			elif kind == LINK_DATA:
+				if ((seq - state.rx_expected) & 0xFF) < LINK_WINDOW:
+					state.rx_window[seq] = frame[6:6 + length]
+				while state.rx_expected in state.rx_window:
+					state.messages.put(state.rx_window.pop(state.rx_expected))
+					state.rx_expected = (state.rx_expected + 1) & 0xFF
+				self.write(LINK_ACK, channel, 0, b'')
+
+	# send again the messages whose own timeout passed
+	def retry_task(self):
+		while True:
+			time.sleep(LINK_RETRY_S / 4)
+			with self.lock:
+				now = time.monotonic()
+				for channel, state in enumerate(self.channels):
+					for seq, slot in list(state.tx_slots.items()):
+						if now - slot[1] < LINK_RETRY_S:
+							continue
+						if slot[2] >= LINK_MAX_RETRIES:
+							self.reset(channel)
+							break
+						slot[1] = now
+						slot[2] += 1
+						self.write(LINK_DATA, channel, seq, slot[0])
+
+link = Link()
+
+def ser_read():
+	return legacy_bytes.get()
+
+def frame_is_valid(frame):
+	if len(frame) < 4 or frame[0] != V2V_SYNC or frame[2] != len(frame) - 4:
+		return False
+	checksum = 0
+	for byte in frame[1:-1]:
+		checksum ^= byte
+	return checksum == frame[-1]
+
+# Split the bytes coming from the STM into link frames, V2V frames and handshake bytes
+def serial_reader_task():
+	while True :
+		byte = ser.read()
+		if byte[0] == LINK_SYNC :
+			header = ser.read(5)
+			if header[4] > LINK_MAX_PAYLOAD :
+				continue
+			frame = byte + header + ser.read(header[4] + 1)
+			if link_frame_is_valid(frame) :
+				link.on_frame(frame)
+			continue
+		if byte[0] != V2V_SYNC :
+			legacy_bytes.put(byte)
+			continue
+		header = ser.read(2)
+		if header[1] > V2V_MAX_PAYLOAD :
+			continue
+		frame = byte + header + ser.read(header[1] + 1)
+		if frame_is_valid(frame) :
+			if header[1] > 0 :
+				own_ids.add(frame[3])
+			v2v_socket.sendto(frame, ('<broadcast>', V2V_PORT))
+
+# Give the frames of the other cars to the STM
+def v2v_receive_task():
+	while True :
+		frame, address = v2v_socket.recvfrom(64)
+		if frame_is_valid(frame) and (frame[2] == 0 or frame[3] not in own_ids) :
+			ser_write(frame)
+
+serial_thread = threading.Thread(target=serial_reader_task)
+v2v_thread = threading.Thread(target=v2v_receive_task)
+retry_thread = threading.Thread(target=link.retry_task)
+serial_thread.start()
+v2v_thread.start()
+retry_thread.start()
+# the STM expects our sequence from 0
+link.reset_all()
+
 #Define the host and port for the server
 host = '0.0.0.0'  # Leave it empty to accept connections from any IP address
 port = 12345  # You can choose any available port
@@ -18,19 +206,21 @@ server_socket.listen(1)
 #Accept a connection and get the client socket
 client_socket, client_address = server_socket.accept()
 response_ack='0'
+
 while True :
 	# Receive request from main car WIFI
 	comRequestMessage = client_socket.recv(1024).decode()
 	#print("1 " + comRequestMessage)
 	if comRequestMessage == 'R' :
 		#Send request to dummy car stm
-		ser.write(comRequestMessage.encode())
-		# Receive data from dummy car stm
-		dummyCarResponse = ser.read()
-		dummyCarResponse = dummyCarResponse.decode()
-		#print("2 " + dummyCarResponse)
+		link.send(LINK_CHANNEL_V2V, comRequestMessage.encode())
+		# Receive data from dummy car stm: 'R' then the data
+		dummyCarResponse = link.receive(LINK_CHANNEL_V2V)
+		while dummyCarResponse[:1] != b'R' :
+			dummyCarResponse = link.receive(LINK_CHANNEL_V2V)
+		#print("2 " + str(dummyCarResponse[1]))
 		# Send dummy data to main car WIFI
-		client_socket.send(dummyCarResponse.encode())
+		client_socket.send(dummyCarResponse[1:2])
 #Close the sockets
 client_socket.close()
 server_socket.close()
@@ -0,0 +1,51 @@
+/******************************************************************************
+ *
+ * @file Led_Config.h
+ *
+ * @brief Configuration file for the warning LED module.
+ *
+ * The blind spot LEDs are driven by the PWM channels of TIM4, so they blink
+ * and pulse without any software toggling. Both LEDs share the PWM period.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef HAL_LED_LED_CONFIG_H_
+#define HAL_LED_LED_CONFIG_H_
+
+/**
+ * @brief GPIO port and pins of the LEDs, with their TIM4 channels (alternate function 2).
+ *
+ * PB8 is TIM4 channel 3, PB9 is TIM4 channel 4. They are the pins of the
+ * backward ultrasonic sensor, which is left out of US_FITTED_SENSORS.
+ */
+#define LED_PORT				GPIO_PORTB
+#define LED_RIGHT_PIN			GPIO_PIN8
+#define LED_RIGHT_CHANNEL		CH3
+#define LED_LEFT_PIN			GPIO_PIN9
+#define LED_LEFT_CHANNEL		CH4
+#define LED_ALTFN				GPIO_ALTFN_2
+
+/**
+ * @brief Counting frequency of TIM4 in Hz.
+ *
+ * The prescaler is computed from the RCC clock tree, the patterns keep their
+ * timing with any clock profile.
+ */
+#define LED_TIMER_FREQ_HZ		10000UL
+
+/**
+ * @brief Period of the blink and pulse patterns in ms (at most 6500).
+ */
+#define LED_PERIOD_MS			500
+
+/**
+ * @brief On time of the pulse pattern in ms, a short flash every period.
+ *
+ * The blink pattern is on half of the period.
+ */
+#define LED_PULSE_MS			60
+
+#endif /* HAL_LED_LED_CONFIG_H_ */
@@ -0,0 +1,52 @@
+/******************************************************************************
+ *
+ * @file Led_Interface.h
+ *
+ * @brief Interface file for the warning LED module.
+ *
+ * Each LED is on a PWM channel of TIM4 (PWM mode 1, the output is on while
+ * the counter is below the compare value). A pattern is a compare value: 0 for
+ * off, above the period for steady, half of it for blink, a short part of it
+ * for pulse. Once set, the timer runs the pattern on its own.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef HAL_LED_LED_INTERFACE_H_
+#define HAL_LED_LED_INTERFACE_H_
+
+/**
+ * @brief The LEDs.
+ */
+#define HLED_RIGHT				0	/**< PB8, right blind spot. */
+#define HLED_LEFT				1	/**< PB9, left blind spot. */
+
+/**
+ * @brief The patterns.
+ */
+#define HLED_OFF				0
+#define HLED_STEADY				1
+#define HLED_BLINK				2	/**< On half of LED_PERIOD_MS. */
+#define HLED_PULSE				3	/**< On LED_PULSE_MS every LED_PERIOD_MS. */
+
+/**
+ * @brief Initialize the LEDs, both off.
+ *
+ * Sets the pins to their TIM4 alternate function and starts TIM4.
+ *
+ * @note GPIOB and TIM4 must be clocked.
+ */
+void HLED_voidInit(void);
+
+/**
+ * @brief Set the pattern of a LED.
+ *
+ * @param Copy_u8Led     HLED_RIGHT or HLED_LEFT.
+ * @param Copy_u8Pattern HLED_OFF, HLED_STEADY, HLED_BLINK or HLED_PULSE.
+ * @return OK, OUT_OF_RANGE for a wrong LED or pattern.
+ */
+u8 HLED_u8SetPattern(u8 Copy_u8Led, u8 Copy_u8Pattern);
+
+#endif /* HAL_LED_LED_INTERFACE_H_ */
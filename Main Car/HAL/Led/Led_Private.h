@@ -0,0 +1,33 @@
+/******************************************************************************
+ *
+ * @File: Led_Private.h
+ *
+ * @Brief: Private definitions for the warning LED Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef HAL_LED_LED_PRIVATE_H_
+#define HAL_LED_LED_PRIVATE_H_
+
+#if ((LED_TIMER_FREQ_HZ * LED_PERIOD_MS) / 1000) > 65535
+#error "The LED period must fit the 16 bit TIM4 counter"
+#endif
+
+#if (LED_PULSE_MS >= LED_PERIOD_MS)
+#error "LED_PULSE_MS must be shorter than LED_PERIOD_MS"
+#endif
+
+#define LED_MS_PER_S			1000UL
+
+/* counts of the PWM period, of the blink and of the pulse on times */
+#define LED_PERIOD_COUNTS		((LED_TIMER_FREQ_HZ * LED_PERIOD_MS) / LED_MS_PER_S)
+#define LED_BLINK_COUNTS		(LED_PERIOD_COUNTS / 2)
+#define LED_PULSE_COUNTS		((LED_TIMER_FREQ_HZ * LED_PULSE_MS) / LED_MS_PER_S)
+
+#define LED_COUNT				2
+
+#endif /* HAL_LED_LED_PRIVATE_H_ */
@@ -0,0 +1,78 @@
+/******************************************************************************
+ *
+ * @File: Led_Program.c
+ *
+ * @Brief: Implementation of functions for the warning LED Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                          	Standard Types                                 *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/GPIOx/GPIO_Interface.h"
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+
+/*******************************************************************************
+ *                          	HAL Components                                *
+ *******************************************************************************/
+#include "Led_Interface.h"
+#include "Led_Config.h"
+#include "Led_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+static const CHN_t HLED_AChannels[LED_COUNT] = { LED_RIGHT_CHANNEL, LED_LEFT_CHANNEL };
+
+/* compare value of each pattern */
+static const u32 HLED_Au32Compare[] = { 0, LED_PERIOD_COUNTS + 1, LED_BLINK_COUNTS, LED_PULSE_COUNTS };
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Initialize the LEDs, both off.
+ */
+void HLED_voidInit(void)
+{
+	MGPIO_voidSetPinMode(LED_PORT,LED_RIGHT_PIN,GPIO_MODE_ALTF);
+	MGPIO_voidSetPinAltFun(LED_PORT,LED_RIGHT_PIN,LED_ALTFN);
+	MGPIO_voidSetPinMode(LED_PORT,LED_LEFT_PIN,GPIO_MODE_ALTF);
+	MGPIO_voidSetPinAltFun(LED_PORT,LED_LEFT_PIN,LED_ALTFN);
+
+	// the period is one pattern cycle, the compare values are loaded at its end
+	MTMR_voidSetCountFrequency(TMR_4,LED_TIMER_FREQ_HZ);
+	MTMR_voidSetARR(TMR_4,LED_PERIOD_COUNTS - 1);
+	MTMR_voidSetCMPVal(TMR_4,LED_RIGHT_CHANNEL,0);
+	MTMR_voidSetCMPVal(TMR_4,LED_LEFT_CHANNEL,0);
+	MTMR_voidSetChannelOutput(TMR_4,PWM_MODE1,LED_RIGHT_CHANNEL);
+	MTMR_voidSetChannelOutput(TMR_4,PWM_MODE1,LED_LEFT_CHANNEL);
+	MTMR_voidStart(TMR_4);
+}
+
+/**
+ * @brief Set the pattern of a LED.
+ *
+ * The new pattern starts at the next period, a blinking LED doesn't flicker.
+ */
+u8 HLED_u8SetPattern(u8 Copy_u8Led, u8 Copy_u8Pattern)
+{
+	if ((Copy_u8Led >= LED_COUNT) || (Copy_u8Pattern > HLED_PULSE))
+	{
+		return OUT_OF_RANGE;
+	}
+
+	MTMR_voidSetCMPVal(TMR_4,HLED_AChannels[Copy_u8Led],HLED_Au32Compare[Copy_u8Pattern]);
+	return OK;
+}
@@ -1,69 +1,98 @@
-/******************************************************************************
- *
- * @file Ultrasonic_Config.h
- *
- * @brief Configuration file for Ultrasonic module
- *
- * This file contains the configuration parameters for the Ultrasonic module,
- * including GPIO pins for trigger and echo, and related port and pin assignments.
- *
- * @Author: Project Team 
- *
- * @Date: November 11, 2023
- *
- *****************************************************************************/
-#ifndef HAL_ULTRASONIC_ULTRASONIC_CONFIG_H_
-#define HAL_ULTRASONIC_ULTRASONIC_CONFIG_H_
-
-#include "../../MCAL/GPIOx/GPIO_Interface.h"
-/**
- * @defgroup Ultrasonic_Config Ultrasonic Configuration
- * @{
- */
-
-/**
- * @name Forward Ultrasonic Sensor (US1) Configuration
- * @{
- */
-#define TRIGGER_PORT1   GPIO_PORTB  /**< GPIO Port for the trigger pin of the forward sensor (US1) */
-#define TRIGGER_PIN1    GPIO_PIN0   /**< GPIO Pin for the trigger pin of the forward sensor (US1) */
-#define ECHO_PORT1      GPIO_PORTB  /**< GPIO Port for the echo pin of the forward sensor (US1) */
-#define ECHO_PIN1       GPIO_PIN1   /**< GPIO Pin for the echo pin of the forward sensor (US1) */
-/** @} */
-
-
-/**
- * @name Left Ultrasonic Sensor (US2) Configuration
- * @{
- */
-#define TRIGGER_PORT2   GPIO_PORTB  /**< GPIO Port for the trigger pin of the left sensor (US2) */
-#define TRIGGER_PIN2    GPIO_PIN2   /**< GPIO Pin for the trigger pin of the left sensor (US2) */
-#define ECHO_PORT2      GPIO_PORTB  /**< GPIO Port for the echo pin of the left sensor (US2) */
-#define ECHO_PIN2       GPIO_PIN3   /**< GPIO Pin for the echo pin of the left sensor (US2) */
-/** @} */
-
-/**
- * @name Right Ultrasonic Sensor (US3) Configuration
- * @{
- */
-#define TRIGGER_PORT3   GPIO_PORTB  /**< GPIO Port for the trigger pin of the right sensor (US3) */
-#define TRIGGER_PIN3    GPIO_PIN4   /**< GPIO Pin for the trigger pin of the right sensor (US3) */
-#define ECHO_PORT3      GPIO_PORTB  /**< GPIO Port for the echo pin of the right sensor (US3) */
-#define ECHO_PIN3       GPIO_PIN5   /**< GPIO Pin for the echo pin of the right sensor (US3) */
-/** @} */
-
-/**
- * @name Backward Ultrasonic Sensor (US4) Configuration
- * @{
- */
-#define TRIGGER_PORT4   GPIO_PORTB  /**< GPIO Port for the trigger pin of the backward sensor (US4) */
-#define TRIGGER_PIN4    GPIO_PIN8   /**< GPIO Pin for the trigger pin of the backward sensor (US4) */
-#define ECHO_PORT4      GPIO_PORTB  /**< GPIO Port for the echo pin of the backward sensor (US4) */
-#define ECHO_PIN4       GPIO_PIN9   /**< GPIO Pin for the echo pin of the backward sensor (US4) */
-/** @} */
-
-/** @} */ // End of Ultrasonic_Config group
-
-
-#endif /* HAL_ULTRASONIC_ULTRASONIC_CONFIG_H_ */
-
+/******************************************************************************
+ *
+ * @file Ultrasonic_Config.h
+ *
+ * @brief Configuration file for Ultrasonic module
+ *
+ * This file contains the configuration parameters for the Ultrasonic module,
+ * including GPIO pins for trigger and echo, and related port and pin assignments.
+ *
+ * @Author: Project Team 
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef HAL_ULTRASONIC_ULTRASONIC_CONFIG_H_
+#define HAL_ULTRASONIC_ULTRASONIC_CONFIG_H_
+
+#include "../../MCAL/GPIOx/GPIO_Interface.h"
+/**
+ * @defgroup Ultrasonic_Config Ultrasonic Configuration
+ * @{
+ */
+
+/**
+ * @name Forward Ultrasonic Sensor (US1) Configuration
+ * @{
+ */
+#define TRIGGER_PORT1   GPIO_PORTB  /**< GPIO Port for the trigger pin of the forward sensor (US1) */
+#define TRIGGER_PIN1    GPIO_PIN0   /**< GPIO Pin for the trigger pin of the forward sensor (US1) */
+#define ECHO_PORT1      GPIO_PORTB  /**< GPIO Port for the echo pin of the forward sensor (US1) */
+#define ECHO_PIN1       GPIO_PIN1   /**< GPIO Pin for the echo pin of the forward sensor (US1) */
+/** @} */
+
+
+/**
+ * @name Left Ultrasonic Sensor (US2) Configuration
+ * @{
+ */
+#define TRIGGER_PORT2   GPIO_PORTB  /**< GPIO Port for the trigger pin of the left sensor (US2) */
+#define TRIGGER_PIN2    GPIO_PIN2   /**< GPIO Pin for the trigger pin of the left sensor (US2) */
+#define ECHO_PORT2      GPIO_PORTB  /**< GPIO Port for the echo pin of the left sensor (US2) */
+#define ECHO_PIN2       GPIO_PIN3   /**< GPIO Pin for the echo pin of the left sensor (US2) */
+/** @} */
+
+/**
+ * @name Right Ultrasonic Sensor (US3) Configuration
+ * @{
+ */
+#define TRIGGER_PORT3   GPIO_PORTB  /**< GPIO Port for the trigger pin of the right sensor (US3) */
+#define TRIGGER_PIN3    GPIO_PIN4   /**< GPIO Pin for the trigger pin of the right sensor (US3) */
+#define ECHO_PORT3      GPIO_PORTB  /**< GPIO Port for the echo pin of the right sensor (US3) */
+#define ECHO_PIN3       GPIO_PIN5   /**< GPIO Pin for the echo pin of the right sensor (US3) */
+/** @} */
+
+/**
+ * @name Backward Ultrasonic Sensor (US4) Configuration
+ * @{
+ */
+#define TRIGGER_PORT4   GPIO_PORTB  /**< GPIO Port for the trigger pin of the backward sensor (US4) */
+#define TRIGGER_PIN4    GPIO_PIN8   /**< GPIO Pin for the trigger pin of the backward sensor (US4) */
+#define ECHO_PORT4      GPIO_PORTB  /**< GPIO Port for the echo pin of the backward sensor (US4) */
+#define ECHO_PIN4       GPIO_PIN9   /**< GPIO Pin for the echo pin of the backward sensor (US4) */
+/** @} */
+
+/**
+ * @brief Sensors fitted on the car (HUS_SENSOR masks).
+ *
+ * Only these sensors get their pins and echo interrupt set up, the others
+ * refuse the measurements and their pins are left to other uses.
+ *
+ * The main car has no backward sensor: PB8 and PB9 drive the blind spot
+ * LEDs (HAL/Led, TIM4), the EXTI line 9 of its echo pin must stay off.
+ */
+#define US_FITTED_SENSORS	(HUS_SENSOR(FORWARD_US) | HUS_SENSOR(LEFT_US) | HUS_SENSOR(RIGHT_US))
+
+/**
+ * @brief How the echo pulse is measured.
+ *
+ * US_BACKEND_POLLING : the echo pin is read in a loop, one sensor at a time.
+ * US_BACKEND_EXTI    : the echo pins interrupt on both edges (EXTI line = pin number,
+ *                      so the echo pins must have different numbers) and the edges are
+ *                      time stamped with the microsecond timebase, the sensors can
+ *                      measure at the same time and nothing waits for the echo.
+ */
+#define US_BACKEND			US_BACKEND_EXTI
+
+/**
+ * @brief Longest echo waited for, in microseconds (about 5 m).
+ *
+ * A measurement without echo ends after this time with the matching distance.
+ */
+#define US_ECHO_TIMEOUT_US	30000UL
+
+/** @} */ // End of Ultrasonic_Config group
+
+
+#endif /* HAL_ULTRASONIC_ULTRASONIC_CONFIG_H_ */
+
@@ -1,51 +1,109 @@
-/******************************************************************************
- *
- * @file Ultrasonic_Interface.h
- *
- * @brief Interface file for Ultrasonic module
- *
- * This file contains function prototypes and enumerations for the Ultrasonic module.
- *
- * @Author: Project Team 
- *
- * @Date: November 11, 2023
- *
- *****************************************************************************/
-#ifndef HAL_ULTRASONIC_ULTRASONIC_INTERFACE_H_
-#define HAL_ULTRASONIC_ULTRASONIC_INTERFACE_H_
-
-/**
- * @defgroup Ultrasonic_Interface Ultrasonic Interface
- * @{
- */
-
-/**
- * @brief Enumeration for Ultrasonic sensors.
- */
-typedef enum
-{
-    FORWARD_US = 1, /**< Forward Ultrasonic Sensor */
-    LEFT_US,        /**< Left Ultrasonic Sensor */
-    RIGHT_US,       /**< Right Ultrasonic Sensor */
-    BACKWARD_US     /**< Backward Ultrasonic Sensor */
-} USNUM_t;
-/**
- * @brief Initialize the Ultrasonic module.
- *
- * This function initializes the Ultrasonic module by configuring GPIO pins.
- */
-void HUS_voidInit(void);
-
-/**
- * @brief Calculate the distance measured by the Ultrasonic sensor.
- *
- * @param[in] A_USNUM_t_Ultrasonic_Num The Ultrasonic sensor to calculate the distance for.
- * @return Distance measured by the Ultrasonic sensor in centimeters.
- */
-f32 HUS_f32CalcDistance(USNUM_t A_USNUM_t_Ultrasonic_Num);
-
-/** @} */ // End of Ultrasonic_Interface group
-
-
-
-#endif /* HAL_ULTRASONIC_INTERFACE_H_ */
+/******************************************************************************
+ *
+ * @file Ultrasonic_Interface.h
+ *
+ * @brief Interface file for Ultrasonic module
+ *
+ * This file contains function prototypes and enumerations for the Ultrasonic module.
+ *
+ * @Author: Project Team 
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef HAL_ULTRASONIC_ULTRASONIC_INTERFACE_H_
+#define HAL_ULTRASONIC_ULTRASONIC_INTERFACE_H_
+
+/**
+ * @defgroup Ultrasonic_Interface Ultrasonic Interface
+ * @{
+ */
+
+/**
+ * @brief Enumeration for Ultrasonic sensors.
+ */
+typedef enum
+{
+    FORWARD_US = 1, /**< Forward Ultrasonic Sensor */
+    LEFT_US,        /**< Left Ultrasonic Sensor */
+    RIGHT_US,       /**< Right Ultrasonic Sensor */
+    BACKWARD_US     /**< Backward Ultrasonic Sensor */
+} USNUM_t;
+
+/**
+ * @brief Mask of a sensor in US_FITTED_SENSORS.
+ */
+#define HUS_SENSOR(US)		(1U << ((US) - 1))
+
+/**
+ * @brief Initialize the Ultrasonic module.
+ *
+ * This function initializes the Ultrasonic module by configuring GPIO pins.
+ */
+void HUS_voidInit(void);
+
+/**
+ * @brief Calculate the distance measured by the Ultrasonic sensor.
+ *
+ * @param[in] A_USNUM_t_Ultrasonic_Num The Ultrasonic sensor to calculate the distance for.
+ * @return Distance measured by the Ultrasonic sensor in centimeters, 0 for a sensor
+ *         that is not in US_FITTED_SENSORS.
+ */
+f32 HUS_f32CalcDistance(USNUM_t A_USNUM_t_Ultrasonic_Num);
+
+/**
+ * @brief Start a measurement without waiting for it.
+ *
+ * With the EXTI backend the sensor is triggered and the echo is timed by the
+ * interrupt, several sensors can measure at the same time. With the polling
+ * backend the measurement is done before returning.
+ *
+ * @param[in] A_USNUM_t_Ultrasonic_Num The Ultrasonic sensor to trigger.
+ * @return OK, NOK if the sensor is still measuring, its echo has not ended or it is not
+ *         in US_FITTED_SENSORS, OUT_OF_RANGE for a wrong sensor.
+ */
+u8 HUS_u8StartMeasure(USNUM_t A_USNUM_t_Ultrasonic_Num);
+
+/**
+ * @brief Get the result of the measurement started by HUS_u8StartMeasure.
+ *
+ * The result is given once, a measurement without echo ends after
+ * US_ECHO_TIMEOUT_US, a measurement longer than the range gate ends with the
+ * gate distance.
+ *
+ * @param[in]  A_USNUM_t_Ultrasonic_Num The Ultrasonic sensor.
+ * @param[out] P_f32Distance Distance in centimeters.
+ * @return OK, NOK while the sensor measures (or was not started), NULL_PTR_ERR, OUT_OF_RANGE.
+ */
+u8 HUS_u8GetDistance(USNUM_t A_USNUM_t_Ultrasonic_Num, f32 * P_f32Distance);
+
+/**
+ * @brief Set the range gate of a sensor.
+ *
+ * A measurement ends as soon as the echo is longer than the gate, and gives
+ * the gate distance: nothing is waited for beyond the distance the caller
+ * decides on. The sensor itself stays busy until its echo ends,
+ * HUS_u8StartMeasure refuses it until then.
+ *
+ * @param[in] A_USNUM_t_Ultrasonic_Num The Ultrasonic sensor.
+ * @param[in] Copy_u16RangeCm Gate distance in cm, 0 for the full range.
+ * @return OK, OUT_OF_RANGE for a wrong sensor.
+ */
+u8 HUS_u8SetRangeGate(USNUM_t A_USNUM_t_Ultrasonic_Num, u16 Copy_u16RangeCm);
+
+/**
+ * @brief Tell if an echo is being timed.
+ *
+ * The echo is timed with the microsecond timer, a clock switch changes its
+ * prescaler and would corrupt the measurement in flight. The polling backend
+ * times the echo inside HUS_u8StartMeasure and never has one in flight.
+ *
+ * @return 1 while a started measurement waits for or times its echo, 0 otherwise.
+ */
+u8 HUS_u8IsMeasuring(void);
+
+/** @} */ // End of Ultrasonic_Interface group
+
+
+
+#endif /* HAL_ULTRASONIC_INTERFACE_H_ */
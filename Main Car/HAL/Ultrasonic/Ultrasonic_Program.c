@@ -1,191 +1,373 @@
-/******************************************************************************
- *
- * @File: Ultrasonic_Program.c
- *
- * @Brief: Implementation of functions for the Ultrasonic Module
- *
- * @Author: Project Team 
- *
- * @Date: November 11, 2023
- *
- ******************************************************************************/
-
-
-/*******************************************************************************
- *                           Standard Types                                  *
- *******************************************************************************/
-#include "../../LIB/ITI_STD_Types.h"
-#include "../../LIB/BIT_Math.h"
-#include "../../LIB/ERROR_STATE.h"
-
-/*******************************************************************************
- *                          	MCAL Components                                 *
- *******************************************************************************/
-#include "../../MCAL/RCC/RCC_Interface.h"
-#include "../../MCAL/GPIOx/GPIO_Interface.h"
-#include "../../MCAL/SYSTICK/SYSTICK_Interface.h"
-#include"../../MCAL/NVIC/NVIC_Interface.h"
-#include "../../MCAL/EXTI/EXTI_Interface.h"
-/** @} */ // end of MCAL Components
-/*******************************************************************************
- *                          	HAL Components                                 *
- *******************************************************************************/
-#include"../../HAL/Ultrasonic/Ultrasonic_Interface.h"
-#include"../../HAL/Ultrasonic/Ultrasonic_Config.h"
-
-/**
- * @brief Initialize Ultrasonic module.
- *
- * This function initializes the GPIO pins for Ultrasonic Trigger and Echo.
- */
-void HUS_voidInit(void)
-{
-	MGPIO_voidSetPinMode(TRIGGER_PORT1,TRIGGER_PIN1,GPIO_MODE_OUTPUT);  //for TRIGGER_PIN1  --> output   forward
-	MGPIO_voidSetOutPutMode(TRIGGER_PORT1,TRIGGER_PIN1,GPIO_OUTPUT_TYPE_PUSH_PULL);
-	MGPIO_voidSetOutputSpeed(TRIGGER_PORT1,TRIGGER_PIN1,GPIO_OUTPUT_SPEED_LOW);
-	MGPIO_voidSetPinMode(ECHO_PORT1,ECHO_PIN1,GPIO_MODE_INPUT);  //for ECHO_PIN1  --> input
-	MGPIO_voidSetPullState(ECHO_PORT1,ECHO_PIN1,GPIO_PULL_PULL_DOWN);
-
-	MGPIO_voidSetPinMode(TRIGGER_PORT2,TRIGGER_PIN2,GPIO_MODE_OUTPUT);  //for TRIGGER_PIN2  --> output    left
-	MGPIO_voidSetOutPutMode(TRIGGER_PORT2,TRIGGER_PIN2,GPIO_OUTPUT_TYPE_PUSH_PULL);
-	MGPIO_voidSetOutputSpeed(TRIGGER_PORT2,TRIGGER_PIN2,GPIO_OUTPUT_SPEED_LOW);
-	MGPIO_voidSetPinMode(ECHO_PORT2,ECHO_PIN2,GPIO_MODE_INPUT);  //for ECHO_PIN2 --> input
-	MGPIO_voidSetPullState(ECHO_PORT2,ECHO_PIN2,GPIO_PULL_PULL_DOWN);
-
-	MGPIO_voidSetPinMode(TRIGGER_PORT3,TRIGGER_PIN3,GPIO_MODE_OUTPUT);  //for TRIGGER_PIN3  --> output    right
-	MGPIO_voidSetOutPutMode(TRIGGER_PORT3,TRIGGER_PIN3,GPIO_OUTPUT_TYPE_PUSH_PULL);
-	MGPIO_voidSetOutputSpeed(TRIGGER_PORT3,TRIGGER_PIN3,GPIO_OUTPUT_SPEED_LOW);
-	MGPIO_voidSetPinMode(ECHO_PORT3,ECHO_PIN3,GPIO_MODE_INPUT);  //for ECHO_PIN3  --> input
-	MGPIO_voidSetPullState(ECHO_PORT3,ECHO_PIN3,GPIO_PULL_PULL_DOWN);
-
-	MGPIO_voidSetPinMode(TRIGGER_PORT4,TRIGGER_PIN4,GPIO_MODE_OUTPUT);  //for TRIGGER_PIN4  --> output    backward
-	MGPIO_voidSetOutPutMode(TRIGGER_PORT4,TRIGGER_PIN4,GPIO_OUTPUT_TYPE_PUSH_PULL);
-	MGPIO_voidSetOutputSpeed(TRIGGER_PORT4,TRIGGER_PIN4,GPIO_OUTPUT_SPEED_LOW);
-	MGPIO_voidSetPinMode(ECHO_PORT4,ECHO_PIN4,GPIO_MODE_INPUT);  //for ECHO_PIN4  --> input
-	MGPIO_voidSetPullState(ECHO_PORT4,ECHO_PIN4,GPIO_PULL_PULL_DOWN);
-}
-
-/**
- * @brief Calculate distance using Ultrasonic sensors.
- *
- * This function triggers Ultrasonic pulses based on the specified Ultrasonic sensor,
- * measures the echo duration, and calculates the distance based on the speed of sound.
- *
- * @param A_USNUM_t_Ultrasonic_Num The Ultrasonic sensor number (1-4) to calculate distance for.
- * @return The calculated distance in centimeters.
- */
-
-f32 HUS_f32CalcDistance (USNUM_t A_USNUM_t_Ultrasonic_Num)
-{
-	u32 L_u32TicksNumber = 0   ;
-	f32 L_f32Distance    = 0.0 ;
-
-	/*trig pulse to trigger pin
-	 * 3us low
-	 * 10us high
-	 * then low
-	 */
-
-	if(A_USNUM_t_Ultrasonic_Num == 1)
-	{ // Forward US
-		MGPIO_voidSetPinValue(TRIGGER_PORT1,TRIGGER_PIN1,GPIO_LOW);
-		MSTK_voidSetBusyWait(6) ;
-		MGPIO_voidSetPinValue(TRIGGER_PORT1,TRIGGER_PIN1,GPIO_HIGH);
-		MSTK_voidSetBusyWait(20) ;
-		MGPIO_voidSetPinValue(TRIGGER_PORT1,TRIGGER_PIN1,GPIO_LOW);
-
-		//wait to generate 8 pulses (40KHZ)/
-		MSTK_voidSetBusyWait(500);
-
-		//wait until generating rising edge for echo pin/
-		while (MGPIO_u8GetPinValue(ECHO_PORT1, ECHO_PIN1) == 0);
-		while (MGPIO_u8GetPinValue(ECHO_PORT1, ECHO_PIN1) == 1)
-		{
-			//each iteration takes 2.45 us/
-			L_u32TicksNumber ++;
-			MSTK_voidSetBusyWait(4);   // why busy wait ?
-		}
-	}
-
-	else if(A_USNUM_t_Ultrasonic_Num == 2)
-	{ // Left US
-		MGPIO_voidSetPinValue(TRIGGER_PORT2,TRIGGER_PIN2,GPIO_LOW);
-		MSTK_voidSetBusyWait(6) ;
-		MGPIO_voidSetPinValue(TRIGGER_PORT2,TRIGGER_PIN2,GPIO_HIGH);
-		MSTK_voidSetBusyWait(20) ;
-		MGPIO_voidSetPinValue(TRIGGER_PORT2,TRIGGER_PIN2,GPIO_LOW);
-
-		//wait to generate 8 pulses (40KHZ)/
-		MSTK_voidSetBusyWait(500);
-
-		//wait until generating rising edge for echo pin/
-		while (MGPIO_u8GetPinValue(ECHO_PORT2, ECHO_PIN2) == 0);
-		while (MGPIO_u8GetPinValue(ECHO_PORT2, ECHO_PIN2) == 1)
-		{
-			//each iteration takes 2.45 us/
-			L_u32TicksNumber ++;
-			MSTK_voidSetBusyWait(4);
-		}
-	}
-
-	else if(A_USNUM_t_Ultrasonic_Num == 3)
-	{ // Right US
-		MGPIO_voidSetPinValue(TRIGGER_PORT3,TRIGGER_PIN3,GPIO_LOW);
-		MSTK_voidSetBusyWait(6) ;
-		MGPIO_voidSetPinValue(TRIGGER_PORT3,TRIGGER_PIN3,GPIO_HIGH);
-		MSTK_voidSetBusyWait(20) ;
-		MGPIO_voidSetPinValue(TRIGGER_PORT3,TRIGGER_PIN3,GPIO_LOW);
-
-		//wait to generate 8 pulses (40KHZ)/
-		MSTK_voidSetBusyWait(500);
-
-		//wait until generating rising edge for echo pin/
-		while (MGPIO_u8GetPinValue(ECHO_PORT3, ECHO_PIN3) == 0);
-		while (MGPIO_u8GetPinValue(ECHO_PORT3, ECHO_PIN3) == 1)
-		{
-			//each iteration takes 2.45 us/
-			L_u32TicksNumber++;
-			MSTK_voidSetBusyWait(4);
-		}
-	}
-	else if(A_USNUM_t_Ultrasonic_Num == 4)
-	{ // backward US
-		MGPIO_voidSetPinValue(TRIGGER_PORT4,TRIGGER_PIN4,GPIO_LOW);
-		MSTK_voidSetBusyWait(6) ;
-		MGPIO_voidSetPinValue(TRIGGER_PORT4,TRIGGER_PIN4,GPIO_HIGH);
-		MSTK_voidSetBusyWait(20) ;
-		MGPIO_voidSetPinValue(TRIGGER_PORT4,TRIGGER_PIN4,GPIO_LOW);
-
-		//wait to generate 8 pulses (40KHZ)/
-		MSTK_voidSetBusyWait(500);
-
-		//wait until generating rising edge for echo pin/
-		while (MGPIO_u8GetPinValue(ECHO_PORT4, ECHO_PIN4) == 0);
-		while (MGPIO_u8GetPinValue(ECHO_PORT4, ECHO_PIN4) == 1)
-		{
-			//each iteration takes 2.45 us/
-			L_u32TicksNumber++;
-			MSTK_voidSetBusyWait(4);
-		}
-	}
-
-	else
-	{
-		// do nothing
-	}
-
-	L_f32Distance = ((float)L_u32TicksNumber)*(6.125)*(0.0343) ;   // how to get time of iteration
-	L_f32Distance = L_f32Distance / 2 ;
-
-	//initialize L_u32TicksNumber for next read/
-	L_u32TicksNumber = 0 ;
-	return L_f32Distance ;
-}
-
-
-
-
-
-
-
-
+/******************************************************************************
+ *
+ * @File: Ultrasonic_Program.c
+ *
+ * @Brief: Implementation of functions for the Ultrasonic Module
+ *
+ * @Author: Project Team 
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_Types.h"
+#include "../../LIB/BIT_Math.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/RCC/RCC_Interface.h"
+#include "../../MCAL/GPIOx/GPIO_Interface.h"
+#include "../../MCAL/SYSTICK/SYSTICK_Interface.h"
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+#include"../../MCAL/NVIC/NVIC_Interface.h"
+#include "../../MCAL/EXTI/EXTI_Interface.h"
+/** @} */ // end of MCAL Components
+/*******************************************************************************
+ *                          	HAL Components                                 *
+ *******************************************************************************/
+#include"../../HAL/Ultrasonic/Ultrasonic_Interface.h"
+#include"../../HAL/Ultrasonic/Ultrasonic_Config.h"
+#include"../../HAL/Ultrasonic/Ultrasonic_Private.h"
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../../SERVICE/Trace/Trace_Interface.h"
+
+/**
+ * @brief Pins of the sensors, index = sensor number - 1.
+ */
+static const US_PINS_t HUS_AstrPins[US_SENSOR_COUNT] =
+{
+	{TRIGGER_PORT1, TRIGGER_PIN1, ECHO_PORT1, ECHO_PIN1},		/* forward */
+	{TRIGGER_PORT2, TRIGGER_PIN2, ECHO_PORT2, ECHO_PIN2},		/* left */
+	{TRIGGER_PORT3, TRIGGER_PIN3, ECHO_PORT3, ECHO_PIN3},		/* right */
+	{TRIGGER_PORT4, TRIGGER_PIN4, ECHO_PORT4, ECHO_PIN4}		/* backward */
+};
+
+static US_ECHO_t HUS_AstrEcho[US_SENSOR_COUNT];
+
+#if (US_BACKEND == US_BACKEND_EXTI)
+/**
+ * @brief Echo pin edge (EXTI callback), the context is the measurement of the sensor.
+ *
+ * The pin level tells the edge: high is the start of the echo, low its end.
+ */
+static void HUS_voidEchoEdge(void * P_pvContext)
+{
+	US_ECHO_t * L_pEcho = (US_ECHO_t *)P_pvContext;
+	const US_PINS_t * L_pPins = &HUS_AstrPins[L_pEcho - HUS_AstrEcho];
+	u32 L_u32Now = MTMR_u32GetMicros();
+
+	if (MGPIO_u8GetPinValue(L_pPins->Us_u8EchoPort, L_pPins->Us_u8EchoPin) == GPIO_HIGH)
+	{
+		if (L_pEcho->Us_State == US_WAIT_RISE)
+		{
+			L_pEcho->Us_u32RiseTime = L_u32Now;
+			L_pEcho->Us_State = US_ECHO_HIGH;
+		}
+	}
+	else if (L_pEcho->Us_State == US_ECHO_HIGH)
+	{
+		L_pEcho->Us_u32EchoUs = L_u32Now - L_pEcho->Us_u32RiseTime;
+		L_pEcho->Us_State = US_DONE;
+	}
+	else
+	{
+		// end of an echo that was not waited for
+	}
+}
+#endif
+
+/**
+ * @brief Send the 10 us trigger pulse of a sensor.
+ */
+static void HUS_voidTrigger(const US_PINS_t * P_Pins)
+{
+	/*trig pulse to trigger pin
+	 * 3us low
+	 * 10us high
+	 * then low
+	 */
+	MGPIO_voidSetPinValue(P_Pins->Us_u8TriggerPort,P_Pins->Us_u8TriggerPin,GPIO_LOW);
+	MSTK_voidSetBusyWait(6) ;
+	MGPIO_voidSetPinValue(P_Pins->Us_u8TriggerPort,P_Pins->Us_u8TriggerPin,GPIO_HIGH);
+	MSTK_voidSetBusyWait(20) ;
+	MGPIO_voidSetPinValue(P_Pins->Us_u8TriggerPort,P_Pins->Us_u8TriggerPin,GPIO_LOW);
+}
+
+/**
+ * @brief Convert an echo width to centimeters and record it.
+ */
+static f32 HUS_f32ToDistance(USNUM_t A_USNUM_t_Ultrasonic_Num, u32 Copy_u32EchoUs)
+{
+	f32 L_f32Distance = ((f32)Copy_u32EchoUs) * (US_CM_PER_US) ;   // speed of sound 0.0343 cm/us
+	L_f32Distance = L_f32Distance / US_ROUND_TRIP ;
+
+	// record the result as the application sees it (integer centimeters)
+	STRACE_voidLog(STRACE_EVT_US_DISTANCE, A_USNUM_t_Ultrasonic_Num, (L_f32Distance < 65535.0) ? (u16)L_f32Distance : 0xFFFF);
+
+	return L_f32Distance ;
+}
+
+/**
+ * @brief Initialize Ultrasonic module.
+ *
+ * This function initializes the GPIO pins for Ultrasonic Trigger and Echo, and
+ * with the EXTI backend the echo interrupts (both edges).
+ */
+void HUS_voidInit(void)
+{
+	u8 L_u8Sensor;
+
+	for (L_u8Sensor = 0; L_u8Sensor < US_SENSOR_COUNT; L_u8Sensor++)
+	{
+		const US_PINS_t * L_pPins = &HUS_AstrPins[L_u8Sensor];
+
+		HUS_AstrEcho[L_u8Sensor].Us_State = US_IDLE;
+		HUS_AstrEcho[L_u8Sensor].Us_u32GateUs = US_ECHO_TIMEOUT_US;
+		if ((US_FITTED_SENSORS & (1U << L_u8Sensor)) == 0)
+		{
+			continue;
+		}
+
+		MGPIO_voidSetPinMode(L_pPins->Us_u8TriggerPort,L_pPins->Us_u8TriggerPin,GPIO_MODE_OUTPUT);
+		MGPIO_voidSetOutPutMode(L_pPins->Us_u8TriggerPort,L_pPins->Us_u8TriggerPin,GPIO_OUTPUT_TYPE_PUSH_PULL);
+		MGPIO_voidSetOutputSpeed(L_pPins->Us_u8TriggerPort,L_pPins->Us_u8TriggerPin,GPIO_OUTPUT_SPEED_LOW);
+		MGPIO_voidSetPinMode(L_pPins->Us_u8EchoPort,L_pPins->Us_u8EchoPin,GPIO_MODE_INPUT);
+		MGPIO_voidSetPullState(L_pPins->Us_u8EchoPort,L_pPins->Us_u8EchoPin,GPIO_PULL_PULL_DOWN);
+	}
+
+#if (US_BACKEND == US_BACKEND_EXTI)
+	MRCC_VoidEnablePeriphral(APB2_BUS,RCC_APB2_SYSCFG);
+	for (L_u8Sensor = 0; L_u8Sensor < US_SENSOR_COUNT; L_u8Sensor++)
+	{
+		const US_PINS_t * L_pPins = &HUS_AstrPins[L_u8Sensor];
+		// GPIO ports A to E have the same number in SYSCFG, H is 7
+		MEXTI_PORT_t L_Port = (L_pPins->Us_u8EchoPort == GPIO_PORTH) ? MEXTI_PORTH : (MEXTI_PORT_t)L_pPins->Us_u8EchoPort;
+
+		if ((US_FITTED_SENSORS & (1U << L_u8Sensor)) == 0)
+		{
+			continue;
+		}
+
+		MEXTI_voidSetEXTIConfig((MEXTI_LINE_t)L_pPins->Us_u8EchoPin, L_Port);
+		MEXTI_voidSetTriggerSource((MEXTI_LINE_t)L_pPins->Us_u8EchoPin, MEXTI_ON_CHANGE);
+		MEXTI_u8SetCallBack((MEXTI_LINE_t)L_pPins->Us_u8EchoPin, HUS_voidEchoEdge, &HUS_AstrEcho[L_u8Sensor]);
+		MEXTI_voidEnableEXTI((MEXTI_LINE_t)L_pPins->Us_u8EchoPin);
+
+		if (L_pPins->Us_u8EchoPin <= GPIO_PIN4)
+		{
+			MNVIC_voidEnableInterrupt(NVIC_EXTI0 + L_pPins->Us_u8EchoPin);
+		}
+		else if (L_pPins->Us_u8EchoPin <= GPIO_PIN9)
+		{
+			MNVIC_voidEnableInterrupt(NVIC_EXTI9_5);
+		}
+		else
+		{
+			MNVIC_voidEnableInterrupt(NVIC_EXTI15_10);
+		}
+	}
+#endif
+}
+
+/**
+ * @brief Start a measurement without waiting for it.
+ */
+u8 HUS_u8StartMeasure(USNUM_t A_USNUM_t_Ultrasonic_Num)
+{
+	US_ECHO_t * L_pEcho;
+	const US_PINS_t * L_pPins;
+
+	if ((A_USNUM_t_Ultrasonic_Num < FORWARD_US) || (A_USNUM_t_Ultrasonic_Num > BACKWARD_US))
+	{
+		return OUT_OF_RANGE;
+	}
+	if ((US_FITTED_SENSORS & HUS_SENSOR(A_USNUM_t_Ultrasonic_Num)) == 0)
+	{
+		return NOK;
+	}
+	L_pEcho = &HUS_AstrEcho[A_USNUM_t_Ultrasonic_Num - 1];
+	L_pPins = &HUS_AstrPins[A_USNUM_t_Ultrasonic_Num - 1];
+
+	// a sensor ignores the trigger while it still listens to the echo of a gated measurement
+	if ((L_pEcho->Us_State == US_WAIT_RISE) || (L_pEcho->Us_State == US_ECHO_HIGH) ||
+		(MGPIO_u8GetPinValue(L_pPins->Us_u8EchoPort, L_pPins->Us_u8EchoPin) == GPIO_HIGH))
+	{
+		return NOK;
+	}
+
+#if (US_BACKEND == US_BACKEND_EXTI)
+	// armed before the pulse, the echo starts about 500 us after it
+	L_pEcho->Us_u32TriggerTime = MTMR_u32GetMicros();
+	L_pEcho->Us_State = US_WAIT_RISE;
+	HUS_voidTrigger(L_pPins);
+#else
+	HUS_voidTrigger(L_pPins);
+
+	//wait to generate 8 pulses (40KHZ)/
+	MSTK_voidSetBusyWait(500);
+
+	L_pEcho->Us_u32TriggerTime = MTMR_u32GetMicros();
+	L_pEcho->Us_u32EchoUs = L_pEcho->Us_u32GateUs;
+
+	//wait until generating rising edge for echo pin/
+	while (MGPIO_u8GetPinValue(L_pPins->Us_u8EchoPort, L_pPins->Us_u8EchoPin) == 0)
+	{
+		if ((MTMR_u32GetMicros() - L_pEcho->Us_u32TriggerTime) >= US_ECHO_TIMEOUT_US)
+		{
+			break;
+		}
+	}
+	//echo width from the microsecond timebase (independent of the clock profile)/
+	L_pEcho->Us_u32RiseTime = MTMR_u32GetMicros();
+	while (MGPIO_u8GetPinValue(L_pPins->Us_u8EchoPort, L_pPins->Us_u8EchoPin) == 1)
+	{
+		// range gate: the echo is already longer than the caller needs
+		if ((MTMR_u32GetMicros() - L_pEcho->Us_u32RiseTime) >= L_pEcho->Us_u32GateUs)
+		{
+			break;
+		}
+	}
+	if ((L_pEcho->Us_u32RiseTime - L_pEcho->Us_u32TriggerTime) < US_ECHO_TIMEOUT_US)
+	{
+		L_pEcho->Us_u32EchoUs = MTMR_u32GetMicros() - L_pEcho->Us_u32RiseTime;
+	}
+	L_pEcho->Us_State = US_DONE;
+#endif
+
+	return OK;
+}
+
+/**
+ * @brief Get the result of the measurement started by HUS_u8StartMeasure.
+ */
+u8 HUS_u8GetDistance(USNUM_t A_USNUM_t_Ultrasonic_Num, f32 * P_f32Distance)
+{
+	US_ECHO_t * L_pEcho;
+
+	if (P_f32Distance == NULL)
+	{
+		return NULL_PTR_ERR;
+	}
+	if ((A_USNUM_t_Ultrasonic_Num < FORWARD_US) || (A_USNUM_t_Ultrasonic_Num > BACKWARD_US))
+	{
+		return OUT_OF_RANGE;
+	}
+	L_pEcho = &HUS_AstrEcho[A_USNUM_t_Ultrasonic_Num - 1];
+
+	switch (L_pEcho->Us_State)
+	{
+		case US_DONE:
+			break;
+		case US_WAIT_RISE:
+			// no echo
+			if ((MTMR_u32GetMicros() - L_pEcho->Us_u32TriggerTime) < US_ECHO_TIMEOUT_US)
+			{
+				return NOK;
+			}
+			L_pEcho->Us_u32EchoUs = L_pEcho->Us_u32GateUs;
+			break;
+		case US_ECHO_HIGH:
+			// echo longer than the range gate, the end of the echo is not waited for
+			if ((MTMR_u32GetMicros() - L_pEcho->Us_u32RiseTime) < L_pEcho->Us_u32GateUs)
+			{
+				return NOK;
+			}
+			L_pEcho->Us_u32EchoUs = L_pEcho->Us_u32GateUs;
+			break;
+		default:
+			return NOK;
+	}
+	L_pEcho->Us_State = US_IDLE;
+	if (L_pEcho->Us_u32EchoUs > L_pEcho->Us_u32GateUs)
+	{
+		L_pEcho->Us_u32EchoUs = L_pEcho->Us_u32GateUs;
+	}
+
+	*P_f32Distance = HUS_f32ToDistance(A_USNUM_t_Ultrasonic_Num, L_pEcho->Us_u32EchoUs);
+	return OK;
+}
+
+/**
+ * @brief Set the range gate of a sensor.
+ */
+u8 HUS_u8SetRangeGate(USNUM_t A_USNUM_t_Ultrasonic_Num, u16 Copy_u16RangeCm)
+{
+	u32 L_u32GateUs = (u32)Copy_u16RangeCm * US_US_PER_CM;
+
+	if ((A_USNUM_t_Ultrasonic_Num < FORWARD_US) || (A_USNUM_t_Ultrasonic_Num > BACKWARD_US))
+	{
+		return OUT_OF_RANGE;
+	}
+	if ((L_u32GateUs == 0) || (L_u32GateUs > US_ECHO_TIMEOUT_US))
+	{
+		L_u32GateUs = US_ECHO_TIMEOUT_US;
+	}
+	HUS_AstrEcho[A_USNUM_t_Ultrasonic_Num - 1].Us_u32GateUs = L_u32GateUs;
+	return OK;
+}
+
+/**
+ * @brief Tell if an echo is being timed.
+ */
+u8 HUS_u8IsMeasuring(void)
+{
+	u8 L_u8Sensor;
+
+	for (L_u8Sensor = 0; L_u8Sensor < US_SENSOR_COUNT; L_u8Sensor++)
+	{
+		if ((HUS_AstrEcho[L_u8Sensor].Us_State == US_WAIT_RISE) ||
+			(HUS_AstrEcho[L_u8Sensor].Us_State == US_ECHO_HIGH))
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief Calculate distance using Ultrasonic sensors.
+ *
+ * This function triggers Ultrasonic pulses based on the specified Ultrasonic sensor,
+ * measures the echo duration, and calculates the distance based on the speed of sound.
+ * It waits for the result, HUS_u8StartMeasure / HUS_u8GetDistance don't.
+ *
+ * @param A_USNUM_t_Ultrasonic_Num The Ultrasonic sensor number (1-4) to calculate distance for.
+ * @return The calculated distance in centimeters, 0 for a wrong sensor.
+ */
+
+f32 HUS_f32CalcDistance (USNUM_t A_USNUM_t_Ultrasonic_Num)
+{
+	f32 L_f32Distance    = 0.0 ;
+	u8  L_u8State ;
+
+	if (((A_USNUM_t_Ultrasonic_Num < FORWARD_US) || (A_USNUM_t_Ultrasonic_Num > BACKWARD_US)) ||
+		((US_FITTED_SENSORS & HUS_SENSOR(A_USNUM_t_Ultrasonic_Num)) == 0))
+	{
+		return L_f32Distance ;
+	}
+
+	do
+	{
+		L_u8State = HUS_u8StartMeasure(A_USNUM_t_Ultrasonic_Num);
+		if (L_u8State == NOK)
+		{
+			// busy: end the measurement in progress (its result is dropped) or wait for the end of its echo
+			HUS_u8GetDistance(A_USNUM_t_Ultrasonic_Num, &L_f32Distance);
+		}
+	}while (L_u8State == NOK);
+
+	if (L_u8State == OK)
+	{
+		while (HUS_u8GetDistance(A_USNUM_t_Ultrasonic_Num, &L_f32Distance) != OK);
+	}
+
+	return L_f32Distance ;
+}
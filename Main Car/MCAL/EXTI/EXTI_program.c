@@ -1,212 +1,250 @@
-/** ****************************************************************************
- *
- * @File EXTI_Program.c
- *
- * @brief this file contains functions related to External Interrupt Module
- *
- * @author Project Team
- *
- * @date 6/11/2023
- *
- ****************************************************************************** */
- 
-/*******************************************************************************
- *                          	Standard Types                                 *
- *******************************************************************************/
-
-#include "../../LIB/ITI_STD_TYPES.h"
-#include "../../LIB/BIT_MATH.h"
-
-/*******************************************************************************
- *                          	MCAL Components                                 *
- *******************************************************************************/
-#include "EXTI_Config.h"
-#include "EXTI_Interface.h"
-#include "EXTI_Private.h"
-
-/*******************************************************************************
- *                           	   Definitions                                 *
- *******************************************************************************/
- static void (*EXTI0_CallBack)(void) = 0;
- static void (*EXTI1_CallBack)(void) = 0;
- static void (*EXTI8_CallBack)(void) = 0;
- 
-/*******************************************************************************
- *                          	APIs Implementation                            *
- *******************************************************************************/
- /**
- * @brief Enable an external interrupt line.
- *
- * This function enables an external interrupt line for a specified line number.
- *
- * @param Copy_uddtLineNum The line number to enable (e.g., MEXTI_LINE_0, MEXTI_LINE_1).
- *
- * @note The function sets the corresponding bit in the EXTI_IMR register to enable the interrupt line.
- */
- 
-void MEXTI_voidEnableEXTI(MEXTI_LINE_t Copy_uddtLineNum)
-{
-	SET_BIT(MEXTI->EXTI_IMR, Copy_uddtLineNum);
-}
-/**
- * @brief Disable an external interrupt line.
- *
- * This function disables an external interrupt line for a specified line number.
- *
- * @param Copy_uddtLineNum The line number to disable (e.g., MEXTI_LINE_0, MEXTI_LINE_1).
- *
- * @note The function clears the corresponding bit in the EXTI_IMR register to disable the interrupt line.
- */
-void MEXTI_voidDisableEXTI(MEXTI_LINE_t Copy_uddtLineNum)
-{
-	CLR_BIT(MEXTI->EXTI_IMR, Copy_uddtLineNum);
-}
-/**
- * @brief Generate a software interrupt on an external interrupt line.
- *
- * This function generates a software interrupt on a specified external interrupt line.
- *
- * @param Copy_uddtLineNum The line number to generate the software interrupt (e.g., MEXTI_LINE_0, MEXTI_LINE_1).
- *
- * @note The function sets the corresponding bit in the EXTI_SWIER register to trigger a software interrupt on the line.
- */
-void MEXTI_voidSoftwareInterrupt(MEXTI_LINE_t Copy_uddtLineNum)
-{
-	SET_BIT(MEXTI->EXTI_SWIER, Copy_uddtLineNum);
-}
-/**
- * @brief Set the trigger source for an external interrupt line.
- *
- * This function configures the trigger source (rising edge, falling edge, or both) for a specified external interrupt line.
- *
- * @param Copy_uddtLineNum The line number to configure the trigger source for (e.g., MEXTI_LINE_0, MEXTI_LINE_1).
- * @param Copy_uddtTriggerMode The trigger mode to set (e.g., MEXTI_RISING_EDGE, MEXTI_FALLING_EDGE, MEXTI_ON_CHANGE).
- *
- * @note The function configures the EXTI_RTSR and EXTI_FTSR registers based on the provided trigger mode.
- */
-void MEXTI_voidSetTriggerSource(MEXTI_LINE_t Copy_uddtLineNum, MEXTI_TRIGGER_MODE_t Copy_uddtTriggerMode)
-{
-	switch(Copy_uddtTriggerMode)
-	{
-		case MEXTI_RISING_EDGE  : SET_BIT(MEXTI->EXTI_RTSR, Copy_uddtLineNum); break;
-		case MEXTI_FALLING_EDGE : SET_BIT(MEXTI->EXTI_FTSR, Copy_uddtLineNum); break;
-		case MEXTI_ON_CHANGE    : SET_BIT(MEXTI->EXTI_RTSR, Copy_uddtLineNum);
-								  SET_BIT(MEXTI->EXTI_FTSR, Copy_uddtLineNum); 		
-								  break;
-	}
-}
-/**
- * @brief Configure the EXTI line to a specific GPIO port.
- *
- * This function configures an EXTI line to use a specific GPIO port.
- *
- * @param Copy_uddtLineNum The EXTI line number to configure (e.g., MEXTI_LINE_0, MEXTI_LINE_1).
- * @param Copy_uddtGPIOPortNum The GPIO port to associate with the EXTI line.
- *
- * @note The function configures the SYSCFG_EXTICR registers based on the provided EXTI line number and GPIO port.
- */
-void MEXTI_voidSetEXTIConfig(MEXTI_LINE_t Copy_uddtLineNum, MEXTI_PORT_t Copy_uddtGPIOPortNum) ////////********* leh b3ml and m3 FFFFF kda ana bktb fe elreserved 
-{
-	// this fun to configure which pin to be setted 
-	switch(Copy_uddtLineNum)
-	{
-		// PIN0x will be configured on EXTI0 only and so on
-		// there is 4 registers and each register is responsible for 4 lines or 4 pins in each port
-		case MEXTI_LINE_0 : MSYSCFG->SYSCFG_EXTICR1 = (((MSYSCFG->SYSCFG_EXTICR1) & 0xFFFFFFF0) | (Copy_uddtGPIOPortNum << 0)); //the correct MSYSCFG->SYSCFG_EXTICR1 = ((u16)(MSYSCFG->SYSCFG_EXTICR1) & 0xFFF0 | (Copy_uddtGPIOPortNum << 0));
-						    break;
-		case MEXTI_LINE_1 : MSYSCFG->SYSCFG_EXTICR1 = (((MSYSCFG->SYSCFG_EXTICR1) & 0xFFFFFF0F) | (Copy_uddtGPIOPortNum << 4));
-						    break;
-		case MEXTI_LINE_2 : MSYSCFG->SYSCFG_EXTICR1 = (((MSYSCFG->SYSCFG_EXTICR1) & 0xFFFFF0FF) | (Copy_uddtGPIOPortNum << 8));
-						    break;
-		case MEXTI_LINE_3 : MSYSCFG->SYSCFG_EXTICR1 = (((MSYSCFG->SYSCFG_EXTICR1) & 0xFFFF0FFF) | (Copy_uddtGPIOPortNum << 12));
-						    break;
-		case MEXTI_LINE_4 : MSYSCFG->SYSCFG_EXTICR2 = (((MSYSCFG->SYSCFG_EXTICR2) & 0xFFFFFFF0) | (Copy_uddtGPIOPortNum << 0));
-						    break;
-		case MEXTI_LINE_5 : MSYSCFG->SYSCFG_EXTICR2 = (((MSYSCFG->SYSCFG_EXTICR2) & 0xFFFFFF0F) | (Copy_uddtGPIOPortNum << 4));
-						    break;
-		case MEXTI_LINE_6 : MSYSCFG->SYSCFG_EXTICR2 = (((MSYSCFG->SYSCFG_EXTICR2) & 0xFFFFF0FF) | (Copy_uddtGPIOPortNum << 8));
-						    break;
-		case MEXTI_LINE_7 : MSYSCFG->SYSCFG_EXTICR2 = (((MSYSCFG->SYSCFG_EXTICR2) & 0xFFFF0FFF) | (Copy_uddtGPIOPortNum << 12));
-						    break;
-		case MEXTI_LINE_8 : MSYSCFG->SYSCFG_EXTICR3 = (((MSYSCFG->SYSCFG_EXTICR3) & 0xFFFFFFF0) | (Copy_uddtGPIOPortNum << 0));
-						    break;
-		case MEXTI_LINE_9 : MSYSCFG->SYSCFG_EXTICR3 = (((MSYSCFG->SYSCFG_EXTICR3) & 0xFFFFFF0F) | (Copy_uddtGPIOPortNum << 4));
-						    break;
-		case MEXTI_LINE_10: MSYSCFG->SYSCFG_EXTICR3 = (((MSYSCFG->SYSCFG_EXTICR3) & 0xFFFFF0FF) | (Copy_uddtGPIOPortNum << 8));
-						    break;
-		case MEXTI_LINE_11: MSYSCFG->SYSCFG_EXTICR3 = (((MSYSCFG->SYSCFG_EXTICR3) & 0xFFFF0FFF) | (Copy_uddtGPIOPortNum << 12));
-						    break;
-		case MEXTI_LINE_12: MSYSCFG->SYSCFG_EXTICR4 = (((MSYSCFG->SYSCFG_EXTICR4) & 0xFFFFFFF0) | (Copy_uddtGPIOPortNum << 0));
-						    break;
-		case MEXTI_LINE_13: MSYSCFG->SYSCFG_EXTICR4 = (((MSYSCFG->SYSCFG_EXTICR4) & 0xFFFFFF0F) | (Copy_uddtGPIOPortNum << 4));
-						    break;
-		case MEXTI_LINE_14: MSYSCFG->SYSCFG_EXTICR4 = (((MSYSCFG->SYSCFG_EXTICR4) & 0xFFFFF0FF) | (Copy_uddtGPIOPortNum << 8));
-						    break;
-		case MEXTI_LINE_15: MSYSCFG->SYSCFG_EXTICR4 = (((MSYSCFG->SYSCFG_EXTICR4) & 0xFFFF0FFF) | (Copy_uddtGPIOPortNum << 12));
-						    break;
-		default  		  : break;
-	}
-}
-/**
- * @brief Call back function for external line 0.
- *
- * This function to assign address of function to be implemnted in ISR.
- *
- * @param (void (*ptr) (void)) The function to be implemented.
- *
- */
-void MEXTI_voidSetCallBack_EXTI0(void (*ptr) (void)) //elmfroof ykon feh mnha 16 as there is 16 extenal interrupt line 
-{
-	EXTI0_CallBack = ptr;
-
-}
-/**
- * @brief Call back function for external line 1.
- *
- * This function to assign address of function to be implemnted in ISR.
- *
- * @param (void (*ptr) (void)) The function to be implemented.
- *
- */
-void MEXTI_voidSetCallBack_EXTI1(void (*ptr) (void))
-{
-	EXTI1_CallBack = ptr;
-}
-/**
- * @brief Call back function for external line 8.
- *
- * This function to assign address of function to be implemnted in ISR.
- *
- * @param (void (*ptr) (void)) The function to be implemented.
- *
- */
-void MEXTI_voidSetCallBack_EXTI8(void (*ptr) (void))
-{
-	EXTI8_CallBack = ptr;
-}
-
-void EXTI0_IRQHandler(void)  //elmfroof ykon feh mnha 16 as there is 16 extenal interrupt line
-{
-	// clear PR Flag for EXTI0 by writing 1 on it, without clearing it will do interrupt always
-	// we may need to leave the flag without clearing, to avoid sniffing on the system, and keep system in thread
-	SET_BIT(MEXTI->EXTI_PR, 0);
-	EXTI0_CallBack();
-	//SET_BIT(MEXTI->EXTI_PR, 0);
-}
-
-void EXTI1_IRQHandler(void)
-{
-	// clear PR Flag for EXTI1 by writing 1 on it, without clearing it will do interrupt always
-	// we may need to leave the flag without clearing, to avoid sniffing on the system, and keep system in thread
-	SET_BIT(MEXTI->EXTI_PR, 1); 
-	EXTI1_CallBack();
-}
-
-void EXTI9_5_IRQHandler(void)
-{
-	// clear PR Flag for EXTI1 by writing 1 on it, without clearing it will do interrupt always
-	// we may need to leave the flag without clearing, to avoid sniffing on the system, and keep system in thread
-	SET_BIT(MEXTI->EXTI_PR, 8);
-	EXTI8_CallBack();
-}
-
+/** ****************************************************************************
+ *
+ * @File EXTI_Program.c
+ *
+ * @brief this file contains functions related to External Interrupt Module
+ *
+ * @author Project Team
+ *
+ * @date 6/11/2023
+ *
+ ****************************************************************************** */
+ 
+/*******************************************************************************
+ *                          	Standard Types                                 *
+ *******************************************************************************/
+
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "EXTI_Config.h"
+#include "EXTI_Interface.h"
+#include "EXTI_Private.h"
+
+/*******************************************************************************
+ *                           	   Definitions                                 *
+ *******************************************************************************/
+/* call back function and its context for each line */
+static void (*MEXTI_ApfCallBack[EXTI_LINE_COUNT])(void * P_pvContext);
+static void * MEXTI_ApvContext[EXTI_LINE_COUNT];
+
+/*******************************************************************************
+ *                          	Private Functions	                           *
+ *******************************************************************************/
+/**
+ * @brief Call the functions of the pending lines of a vector.
+ *
+ * Each pending line is found with count leading zeros (one instruction), its PR
+ * flag is cleared by writing 1 on its own bit only (a read modify write would
+ * clear the edges of the other lines), then its function is called.
+ *
+ * @param Copy_u32Lines The lines of the vector.
+ */
+static void MEXTI_voidDispatch(u32 Copy_u32Lines)
+{
+	u32 Loc_u32Pending = MEXTI->EXTI_PR & Copy_u32Lines;
+	u8 Loc_u8Line;
+
+	while (Loc_u32Pending != 0)
+	{
+		Loc_u8Line = (u8)(31 - __builtin_clz(Loc_u32Pending));
+		Loc_u32Pending &= ~(1UL << Loc_u8Line);
+		MEXTI->EXTI_PR = (1UL << Loc_u8Line);
+		if (MEXTI_ApfCallBack[Loc_u8Line] != NULL)
+		{
+			MEXTI_ApfCallBack[Loc_u8Line](MEXTI_ApvContext[Loc_u8Line]);
+		}
+	}
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+ /**
+ * @brief Enable an external interrupt line.
+ *
+ * This function enables an external interrupt line for a specified line number.
+ *
+ * @param Copy_uddtLineNum The line number to enable (e.g., MEXTI_LINE_0, MEXTI_LINE_1).
+ *
+ * @note The function sets the corresponding bit in the EXTI_IMR register to enable the interrupt line.
+ */
+ 
+void MEXTI_voidEnableEXTI(MEXTI_LINE_t Copy_uddtLineNum)
+{
+	SET_BIT(MEXTI->EXTI_IMR, Copy_uddtLineNum);
+}
+/**
+ * @brief Disable an external interrupt line.
+ *
+ * This function disables an external interrupt line for a specified line number.
+ *
+ * @param Copy_uddtLineNum The line number to disable (e.g., MEXTI_LINE_0, MEXTI_LINE_1).
+ *
+ * @note The function clears the corresponding bit in the EXTI_IMR register to disable the interrupt line.
+ */
+void MEXTI_voidDisableEXTI(MEXTI_LINE_t Copy_uddtLineNum)
+{
+	CLR_BIT(MEXTI->EXTI_IMR, Copy_uddtLineNum);
+}
+/**
+ * @brief Generate a software interrupt on an external interrupt line.
+ *
+ * This function generates a software interrupt on a specified external interrupt line.
+ *
+ * @param Copy_uddtLineNum The line number to generate the software interrupt (e.g., MEXTI_LINE_0, MEXTI_LINE_1).
+ *
+ * @note The function sets the corresponding bit in the EXTI_SWIER register to trigger a software interrupt on the line.
+ */
+void MEXTI_voidSoftwareInterrupt(MEXTI_LINE_t Copy_uddtLineNum)
+{
+	SET_BIT(MEXTI->EXTI_SWIER, Copy_uddtLineNum);
+}
+/**
+ * @brief Set the trigger source for an external interrupt line.
+ *
+ * This function configures the trigger source (rising edge, falling edge, or both) for a specified external interrupt line.
+ *
+ * @param Copy_uddtLineNum The line number to configure the trigger source for (e.g., MEXTI_LINE_0, MEXTI_LINE_1).
+ * @param Copy_uddtTriggerMode The trigger mode to set (e.g., MEXTI_RISING_EDGE, MEXTI_FALLING_EDGE, MEXTI_ON_CHANGE).
+ *
+ * @note The function configures the EXTI_RTSR and EXTI_FTSR registers based on the provided trigger mode.
+ */
+void MEXTI_voidSetTriggerSource(MEXTI_LINE_t Copy_uddtLineNum, MEXTI_TRIGGER_MODE_t Copy_uddtTriggerMode)
+{
+	switch(Copy_uddtTriggerMode)
+	{
+		case MEXTI_RISING_EDGE  : SET_BIT(MEXTI->EXTI_RTSR, Copy_uddtLineNum);
+								  CLR_BIT(MEXTI->EXTI_FTSR, Copy_uddtLineNum);
+								  break;
+		case MEXTI_FALLING_EDGE : CLR_BIT(MEXTI->EXTI_RTSR, Copy_uddtLineNum);
+								  SET_BIT(MEXTI->EXTI_FTSR, Copy_uddtLineNum);
+								  break;
+		case MEXTI_ON_CHANGE    : SET_BIT(MEXTI->EXTI_RTSR, Copy_uddtLineNum);
+								  SET_BIT(MEXTI->EXTI_FTSR, Copy_uddtLineNum); 		
+								  break;
+	}
+}
+/**
+ * @brief Configure the EXTI line to a specific GPIO port.
+ *
+ * This function configures an EXTI line to use a specific GPIO port.
+ *
+ * @param Copy_uddtLineNum The EXTI line number to configure (e.g., MEXTI_LINE_0, MEXTI_LINE_1).
+ * @param Copy_uddtGPIOPortNum The GPIO port to associate with the EXTI line.
+ *
+ * @note The function configures the SYSCFG_EXTICR registers based on the provided EXTI line number and GPIO port.
+ */
+void MEXTI_voidSetEXTIConfig(MEXTI_LINE_t Copy_uddtLineNum, MEXTI_PORT_t Copy_uddtGPIOPortNum) ////////********* leh b3ml and m3 FFFFF kda ana bktb fe elreserved 
+{
+	// this fun to configure which pin to be setted 
+	switch(Copy_uddtLineNum)
+	{
+		// PIN0x will be configured on EXTI0 only and so on
+		// there is 4 registers and each register is responsible for 4 lines or 4 pins in each port
+		case MEXTI_LINE_0 : MSYSCFG->SYSCFG_EXTICR1 = (((MSYSCFG->SYSCFG_EXTICR1) & 0xFFFFFFF0) | (Copy_uddtGPIOPortNum << 0)); //the correct MSYSCFG->SYSCFG_EXTICR1 = ((u16)(MSYSCFG->SYSCFG_EXTICR1) & 0xFFF0 | (Copy_uddtGPIOPortNum << 0));
+						    break;
+		case MEXTI_LINE_1 : MSYSCFG->SYSCFG_EXTICR1 = (((MSYSCFG->SYSCFG_EXTICR1) & 0xFFFFFF0F) | (Copy_uddtGPIOPortNum << 4));
+						    break;
+		case MEXTI_LINE_2 : MSYSCFG->SYSCFG_EXTICR1 = (((MSYSCFG->SYSCFG_EXTICR1) & 0xFFFFF0FF) | (Copy_uddtGPIOPortNum << 8));
+						    break;
+		case MEXTI_LINE_3 : MSYSCFG->SYSCFG_EXTICR1 = (((MSYSCFG->SYSCFG_EXTICR1) & 0xFFFF0FFF) | (Copy_uddtGPIOPortNum << 12));
+						    break;
+		case MEXTI_LINE_4 : MSYSCFG->SYSCFG_EXTICR2 = (((MSYSCFG->SYSCFG_EXTICR2) & 0xFFFFFFF0) | (Copy_uddtGPIOPortNum << 0));
+						    break;
+		case MEXTI_LINE_5 : MSYSCFG->SYSCFG_EXTICR2 = (((MSYSCFG->SYSCFG_EXTICR2) & 0xFFFFFF0F) | (Copy_uddtGPIOPortNum << 4));
+						    break;
+		case MEXTI_LINE_6 : MSYSCFG->SYSCFG_EXTICR2 = (((MSYSCFG->SYSCFG_EXTICR2) & 0xFFFFF0FF) | (Copy_uddtGPIOPortNum << 8));
+						    break;
+		case MEXTI_LINE_7 : MSYSCFG->SYSCFG_EXTICR2 = (((MSYSCFG->SYSCFG_EXTICR2) & 0xFFFF0FFF) | (Copy_uddtGPIOPortNum << 12));
+						    break;
+		case MEXTI_LINE_8 : MSYSCFG->SYSCFG_EXTICR3 = (((MSYSCFG->SYSCFG_EXTICR3) & 0xFFFFFFF0) | (Copy_uddtGPIOPortNum << 0));
+						    break;
+		case MEXTI_LINE_9 : MSYSCFG->SYSCFG_EXTICR3 = (((MSYSCFG->SYSCFG_EXTICR3) & 0xFFFFFF0F) | (Copy_uddtGPIOPortNum << 4));
+						    break;
+		case MEXTI_LINE_10: MSYSCFG->SYSCFG_EXTICR3 = (((MSYSCFG->SYSCFG_EXTICR3) & 0xFFFFF0FF) | (Copy_uddtGPIOPortNum << 8));
+						    break;
+		case MEXTI_LINE_11: MSYSCFG->SYSCFG_EXTICR3 = (((MSYSCFG->SYSCFG_EXTICR3) & 0xFFFF0FFF) | (Copy_uddtGPIOPortNum << 12));
+						    break;
+		case MEXTI_LINE_12: MSYSCFG->SYSCFG_EXTICR4 = (((MSYSCFG->SYSCFG_EXTICR4) & 0xFFFFFFF0) | (Copy_uddtGPIOPortNum << 0));
+						    break;
+		case MEXTI_LINE_13: MSYSCFG->SYSCFG_EXTICR4 = (((MSYSCFG->SYSCFG_EXTICR4) & 0xFFFFFF0F) | (Copy_uddtGPIOPortNum << 4));
+						    break;
+		case MEXTI_LINE_14: MSYSCFG->SYSCFG_EXTICR4 = (((MSYSCFG->SYSCFG_EXTICR4) & 0xFFFFF0FF) | (Copy_uddtGPIOPortNum << 8));
+						    break;
+		case MEXTI_LINE_15: MSYSCFG->SYSCFG_EXTICR4 = (((MSYSCFG->SYSCFG_EXTICR4) & 0xFFFF0FFF) | (Copy_uddtGPIOPortNum << 12));
+						    break;
+		default  		  : break;
+	}
+}
+/**
+ * @brief Set the call back function of an external interrupt line.
+ *
+ * This function assigns the function called by the ISR of the line and the context
+ * given to it (e.g. the sensor the line belongs to).
+ *
+ * @param Copy_uddtLineNum The line number (MEXTI_LINE_0 to MEXTI_LINE_15).
+ * @param Copy_pfCallBack The function to be implemented, NULL to remove it.
+ * @param P_pvContext The pointer given to the function.
+ *
+ * @return OK, OUT_OF_RANGE for a wrong line.
+ */
+u8 MEXTI_u8SetCallBack(MEXTI_LINE_t Copy_uddtLineNum, void (*Copy_pfCallBack) (void * P_pvContext), void * P_pvContext)
+{
+	ERROR_STATE_T Loc_ErrorState = OK;
+
+	if ((u32)Copy_uddtLineNum >= EXTI_LINE_COUNT)
+	{
+		Loc_ErrorState = OUT_OF_RANGE;
+	}
+	else
+	{
+		// the context first, the ISR may run as soon as the function is set
+		MEXTI_ApfCallBack[Copy_uddtLineNum] = NULL;
+		MEXTI_ApvContext[Copy_uddtLineNum] = P_pvContext;
+		MEXTI_ApfCallBack[Copy_uddtLineNum] = Copy_pfCallBack;
+	}
+	return Loc_ErrorState;
+}
+
+/*******************************************************************************
+ *                          	ISRs Implementation                            *
+ *******************************************************************************/
+void EXTI0_IRQHandler(void)
+{
+	MEXTI_voidDispatch(1UL << MEXTI_LINE_0);
+}
+
+void EXTI1_IRQHandler(void)
+{
+	MEXTI_voidDispatch(1UL << MEXTI_LINE_1);
+}
+
+void EXTI2_IRQHandler(void)
+{
+	MEXTI_voidDispatch(1UL << MEXTI_LINE_2);
+}
+
+void EXTI3_IRQHandler(void)
+{
+	MEXTI_voidDispatch(1UL << MEXTI_LINE_3);
+}
+
+void EXTI4_IRQHandler(void)
+{
+	MEXTI_voidDispatch(1UL << MEXTI_LINE_4);
+}
+
+void EXTI9_5_IRQHandler(void)
+{
+	MEXTI_voidDispatch(EXTI_LINES_9_5);
+}
+
+void EXTI15_10_IRQHandler(void)
+{
+	MEXTI_voidDispatch(EXTI_LINES_15_10);
+}
@@ -1,18 +1,18 @@
-#ifndef GPIO_CONFIG_H_
-#define GPIO_CONFIG_H_
-
-/** ****************************************************************************
- *
- * @File GPIO_Config.h
- *
- * @brief this file contains confirations related to GPIO Module
- *
- * @author Project Team
- *
- * @date 6/11/2023
- *
- ****************************************************************************** */
-
-#define STMmodel   STM32F401cc
-
+#ifndef GPIO_CONFIG_H_
+#define GPIO_CONFIG_H_
+
+/** ****************************************************************************
+ *
+ * @File GPIO_Config.h
+ *
+ * @brief this file contains confirations related to GPIO Module
+ *
+ * @author Project Team
+ *
+ * @date 6/11/2023
+ *
+ ****************************************************************************** */
+
+#define STMmodel   STM32F401cc
+
 #endif
\ No newline at end of file
@@ -1,15 +1,23 @@
-#ifndef TMR_CONFIG_H_
-#define TMR_CONFIG_H_
-/** ****************************************************************************
- *
- * @File TIMER_Config.h
- *
- * @brief this file contains configrations related to TIMER Module
- *
- * @author Project Team
- *
- * @date 6/11/2023
- *
- ****************************************************************************** */
-
-#endif /* TMR_CONFIG_H_ */
+#ifndef TMR_CONFIG_H_
+#define TMR_CONFIG_H_
+/** ****************************************************************************
+ *
+ * @File TIMER_Config.h
+ *
+ * @brief this file contains configrations related to TIMER Module
+ *
+ * @author Project Team
+ *
+ * @date 6/11/2023
+ *
+ ****************************************************************************** */
+
+/*
+ * Free running timer used as the microsecond timebase of the system
+ * (32-bit timers only)
+ *	TMR_2
+ *	TMR_5
+ */
+#define TMR_TIMEBASE				TMR_5
+
+#endif /* TMR_CONFIG_H_ */
@@ -1,65 +1,95 @@
-#ifndef RCC_CONFIG_H_
-#define RCC_CONFIG_H_
-
-/** ****************************************************************************
- *
- * @File RCC_Config.h
- *
- * @brief this file contains confirations related to RCC Module
- *
- * @author Project Team
- *
- * @date 6/11/2023
- *
- ****************************************************************************** */
- 
-/*
-	HSI
-	HSE
-	PLL
-*/
-#define CLOCK_TYPE  HSI
-
-
-
-/*
- * _2_Prescaler
- * _4_Prescaler
- * _6_Prescaler
- * _8_Prescaler
- */
-#define PLLP_VALUE		_2_Prescaler
-
-
-
-/* this Configuration must be 192 <= PLLN <=432 */
-#define PLLN_VALUE		192
-
-
-
-/* this Configuration must be 2 <= PLLM <=63 */
-#define PLLM_VALUE    2
-
-/*
- *	HSI
- *	HSE
- */
-#define PLL_INPUT_SOURCE	HSI
-
-/*
-  	AHP_NO_PRESCALAR
-    AHP_2_PRESCALAR
-    AHP_4_PRESCALAR
-    AHP_8_PRESCALAR
-    AHP_16_PRESCALAR
-    AHP_64_PRESCALAR
-    AHP_128_PRESCALAR
-    AHP_256_PRESCALAR
-    AHP_512_PRESCALAR
-
- */
-
-#define AHB_PRESCALER    AHP_NO_PRESCALAR
-
-
-#endif 
+#ifndef RCC_CONFIG_H_
+#define RCC_CONFIG_H_
+
+/** ****************************************************************************
+ *
+ * @File RCC_Config.h
+ *
+ * @brief this file contains confirations related to RCC Module
+ *
+ * @author Project Team
+ *
+ * @date 6/11/2023
+ *
+ ****************************************************************************** */
+ 
+/*
+	HSI
+	HSE
+	PLL
+*/
+#define CLOCK_TYPE  PLL
+
+/* frequency of the external crystal in Hz (used when HSE feeds the system or the PLL) */
+#define HSE_CLOCK_HZ	25000000UL
+
+
+
+/*
+ * _2_Prescaler
+ * _4_Prescaler
+ * _6_Prescaler
+ * _8_Prescaler
+ */
+/*
+ * 84 MHz profile from HSI:
+ * VCO input  = 16 MHz / PLLM(16)   = 1 MHz    (must be 1 to 2 MHz)
+ * VCO output = 1 MHz * PLLN(336)   = 336 MHz  (must be 192 to 432 MHz)
+ * SYSCLK     = 336 MHz / PLLP(4)   = 84 MHz   (must not exceed 84 MHz)
+ * PLL48CK    = 336 MHz / PLLQ(7)   = 48 MHz
+ */
+#define PLLP_VALUE		_4_Prescaler
+
+
+
+/* this Configuration must be 192 <= PLLN <=432 */
+#define PLLN_VALUE		336
+
+
+
+/* this Configuration must be 2 <= PLLM <=63 */
+#define PLLM_VALUE    16
+
+
+
+/* this Configuration must be 2 <= PLLQ <=15 */
+#define PLLQ_VALUE    7
+
+/*
+ *	HSI
+ *	HSE
+ */
+#define PLL_INPUT_SOURCE	HSI
+
+/*
+  	AHP_NO_PRESCALAR
+    AHP_2_PRESCALAR
+    AHP_4_PRESCALAR
+    AHP_8_PRESCALAR
+    AHP_16_PRESCALAR
+    AHP_64_PRESCALAR
+    AHP_128_PRESCALAR
+    AHP_256_PRESCALAR
+    AHP_512_PRESCALAR
+
+ */
+
+#define AHB_PRESCALER    AHP_NO_PRESCALAR
+
+
+
+/*
+ * APB1 must not exceed 42 MHz, APB2 must not exceed 84 MHz
+ * (the timers of a prescaled bus run at twice the bus clock)
+ *
+ 	APB_NO_PRESCALAR
+ 	APB_2_PRESCALAR
+ 	APB_4_PRESCALAR
+ 	APB_8_PRESCALAR
+ 	APB_16_PRESCALAR
+ */
+#define APB1_PRESCALER   APB_2_PRESCALAR
+#define APB2_PRESCALER   APB_NO_PRESCALAR
+
+
+#endif 
@@ -1,39 +1,70 @@
-#ifndef RCC_INTERFACE_H_
-#define RCC_INTERFACE_H_
-/** ****************************************************************************
- *
- * @File RCC_Interface.h
- *
- * @brief this file contains prototypes functions for RCC Module
- *
- * @author Project Team
- *
- * @date 6/11/2023
- ******************************************************************************* */
-void MRCC_VoidInit(void);
-
-void MRCC_VoidEnablePeriphral(u8 Copy_U8PeriphralBus,u8 Copy_U8PeriphralNumber);
-
-void MRCC_VoidDisablePeriphral(u8 Copy_U8PeriphralBus,u8 Copy_U8PeriphralNumber);
-
-// for the 4 kinds of bus in the ARM MP
-#define AHB1_BUS	0
-#define AHB2_BUS	1
-#define APB1_BUS	2
-#define APB2_BUS	3
-
-#define RCC_APB1_TIMER2    0
-
-
-
-#define RCC_APB2_USART1    4
-#define RCC_APB2_USART6    5
-#define RCC_APB1_USART2    17
-
-
-
-
-
-#define SPI1_PERIPHRAL		12
-
-#endif 
+#ifndef RCC_INTERFACE_H_
+#define RCC_INTERFACE_H_
+/** ****************************************************************************
+ *
+ * @File RCC_Interface.h
+ *
+ * @brief this file contains prototypes functions for RCC Module
+ *
+ * @author Project Team
+ *
+ * @date 6/11/2023
+ ******************************************************************************* */
+void MRCC_VoidInit(void);
+
+void MRCC_VoidEnablePeriphral(u8 Copy_U8PeriphralBus,u8 Copy_U8PeriphralNumber);
+
+void MRCC_VoidDisablePeriphral(u8 Copy_U8PeriphralBus,u8 Copy_U8PeriphralNumber);
+
+// system clock sources for MRCC_u8SwitchSysClk
+#define RCC_SYSCLK_HSI	0
+#define RCC_SYSCLK_HSE	1
+#define RCC_SYSCLK_PLL	2
+
+u8 MRCC_u8SwitchSysClk(u8 Copy_u8Source, u16 Copy_u16AhbDivider);
+
+// clock tree, read from the RCC registers (in Hz)
+u32 MRCC_u32GetSysClk(void);
+
+u32 MRCC_u32GetAhbClk(void);
+
+u32 MRCC_u32GetApb1Clk(void);
+
+u32 MRCC_u32GetApb2Clk(void);
+
+u32 MRCC_u32GetApb1TimerClk(void);
+
+u32 MRCC_u32GetApb2TimerClk(void);
+
+// for the 4 kinds of bus in the ARM MP
+#define AHB1_BUS	0
+#define AHB2_BUS	1
+#define APB1_BUS	2
+#define APB2_BUS	3
+
+#define RCC_AHB1_GPIOA     0
+#define RCC_AHB1_GPIOB     1
+#define RCC_AHB1_GPIOC     2
+#define RCC_AHB1_GPIOD     3
+#define RCC_AHB1_GPIOE     4
+#define RCC_AHB1_GPIOH     7
+
+#define RCC_APB1_TIMER2    0
+#define RCC_APB1_TIMER3    1
+#define RCC_APB1_TIMER4    2
+#define RCC_APB1_TIMER5    3
+
+
+
+#define RCC_APB2_USART1    4
+#define RCC_APB2_USART6    5
+#define RCC_APB2_SYSCFG    14
+#define RCC_APB1_USART2    17
+
+
+
+
+
+#define SPI1_PERIPHRAL		12
+
+#endif 
@@ -1,173 +1,296 @@
-#ifndef RCC_PRIVATE_H_
-#define RCC_PRIVATE_H_
-
-/** ****************************************************************************
- *
- * @File RCC_Private.h
- *
- * @brief this file contains private addresses and configurations related to RCC Module
- *
- * @author Project Team
- *
- * @date 6/11/2023	
- *
- ****************************************************************************** */
-
-#define BASE_ADDRESS  0x40023800
-
-// each periphral i make for it struct and base address and the same steps
-typedef struct 
-{
-	volatile u32 RCC_CR;
-	volatile u32 RCC_PLLCFGR;
-	volatile u32 RCC_CFGR;
-	volatile u32 RCC_CIR;
-	volatile u32 RCC_AHB1RSTR;
-	volatile u32 RCC_AHB2RSTR;
-	
-    volatile u32 Reserved1;
-    volatile u32 Reserved2;
-	
-    volatile u32 RCC_APB1RSTR;
-    volatile u32 RCC_APB2RSTR;
-	
-	volatile u32 Reserved3;
-    volatile u32 Reserved4;
-	
-    volatile u32 RCC_AHB1ENR;
-    volatile u32 RCC_AHB2ENR;
-	
-	volatile u32 Reserved5;
-	volatile u32 Reserved6;
-	
-	volatile u32 RCC_APB1ENR;
-	volatile u32 RCC_APB2ENR;
-	
-	volatile u32 Reserved7;
-	volatile u32 Reserved8;
-	
-	volatile u32 RCC_AHB1LPENR;
-	volatile u32 RCC_AHB2LPENR;
-	
-	volatile u32 Reserved9;
-	volatile u32 Reserved10;
-	
-	volatile u32 RCC_APB1LPENR;
-	volatile u32 RCC_APB2LPENR;
-	
-	volatile u32 Reserved11;
-	volatile u32 Reserved12;
-	
-	volatile u32 RCC_BDCR;
-	volatile u32 RCC_CSR;
-	
-	volatile u32 Reserved13;
-	volatile u32 Reserved14;
-	
-	volatile u32 RCC_SSCGR;
-	volatile u32 RCC_PLLI2SCFGR;
-}RCC;
-
-#define MRCC  ((volatile RCC *)BASE_ADDRESS) //MRCC is pointer to struct 
-
-//for sourse of clock  
-#define HSI 0
-#define HSE 1
-#define PLL 2
-
-
-//  Bits in RCC_CR register
-#define HSION  0
-#define HSEON  16
-#define PLLON  24
-
-
-//  Bits in RCC_PLLCFGR register
-#define PLLSRC 22
-#define PLLP0  16
-#define PLLN0  6
-#define PLLM0  0
-
-
-// PLLP values
-#define _2_Prescaler   	0
-#define _4_Prescaler	1
-#define _6_Prescaler	2
-#define _8_Prescaler	3
-
-// First 2 Bits in RCC_CFGR register 
-#define SW0    0
-#define SW1    1
-
-
-// for the 4 kinds of bus in the ARM MP
-#define AHB1_BUS	0
-#define AHB2_BUS	1
-#define APB1_BUS	2
-#define APB2_BUS	3
-
-
-//Peripheral Clock Enable For APB1 Bus  
-/*
-#define    TIM2_RCC         0
-#define    TIM3_RCC         1
-#define    TIM4_RCC         2
-#define    TIM5_RCC         3
-#define    TIM6_RCC         4
-#define    TIM7_RCC         5
-#define    TIM12_RCC        6
-#define    TIM13_RCC        7
-#define    TIM14_RCC        8
-#define    WWDG_RCC         11
-#define    SPI2_RCC         14
-#define    SPI3_RCC         15
-#define    USART2_RCC       17
-#define    USART3_RCC       18
-#define    UART4_RCC        19
-#define    UART5_RCC        20
-#define    I2C1_RCC         21
-#define    I2C2_RCC         22
-#define    USB_RCC          23
-#define    CAN_RCC          25
-#define    BKP_RCC          27
-#define    PWR_RCC          28
-#define    DAC_RCC          29
-
-
-//Peripheral Clock Enable For APB2 Bus
-#define    AFIO_RCC         0
-#define    GPIOA_RCC        2
-#define    GPIOB_RCC        3
-#define    GPIOC_RCC        4
-#define    GPIOD_RCC        5
-#define    GPIOE_RCC        6
-#define    GPIOF_RCC        7
-#define    GPIOG_RCC        8
-#define    ADC1_RCC         9
-#define    ADC2_RCC         10
-#define    TIM1_RCC         11
-#define    SPI1_RCC         12
-#define    TIM8_RCC         13
-#define    USART1_RCC       14
-#define    ADC3_RCC         15
-#define    TIM9_RCC         19
-#define    TIM10_RCC        20
-#define    TIM11_RCC        21
-
-*/
-
-//AHB PRESCALER OPTIONS
-#define AHP_NO_PRESCALAR	      7
-#define AHP_2_PRESCALAR 	      8
-#define AHP_4_PRESCALAR 	      9
-#define AHP_8_PRESCALAR 	      10
-#define AHP_16_PRESCALAR 	      11
-#define AHP_64_PRESCALAR 	      12
-#define AHP_128_PRESCALAR       13
-#define AHP_256_PRESCALAR       14
-#define AHP_512_PRESCALAR       15
-
-
-#define AHB_PRESCALAR_MASK 0xFFFFFF0F
-
-#endif 
+#ifndef RCC_PRIVATE_H_
+#define RCC_PRIVATE_H_
+
+/** ****************************************************************************
+ *
+ * @File RCC_Private.h
+ *
+ * @brief this file contains private addresses and configurations related to RCC Module
+ *
+ * @author Project Team
+ *
+ * @date 6/11/2023	
+ *
+ ****************************************************************************** */
+
+#define BASE_ADDRESS  0x40023800
+
+// each periphral i make for it struct and base address and the same steps
+typedef struct 
+{
+	volatile u32 RCC_CR;
+	volatile u32 RCC_PLLCFGR;
+	volatile u32 RCC_CFGR;
+	volatile u32 RCC_CIR;
+	volatile u32 RCC_AHB1RSTR;
+	volatile u32 RCC_AHB2RSTR;
+	
+    volatile u32 Reserved1;
+    volatile u32 Reserved2;
+	
+    volatile u32 RCC_APB1RSTR;
+    volatile u32 RCC_APB2RSTR;
+	
+	volatile u32 Reserved3;
+    volatile u32 Reserved4;
+	
+    volatile u32 RCC_AHB1ENR;
+    volatile u32 RCC_AHB2ENR;
+	
+	volatile u32 Reserved5;
+	volatile u32 Reserved6;
+	
+	volatile u32 RCC_APB1ENR;
+	volatile u32 RCC_APB2ENR;
+	
+	volatile u32 Reserved7;
+	volatile u32 Reserved8;
+	
+	volatile u32 RCC_AHB1LPENR;
+	volatile u32 RCC_AHB2LPENR;
+	
+	volatile u32 Reserved9;
+	volatile u32 Reserved10;
+	
+	volatile u32 RCC_APB1LPENR;
+	volatile u32 RCC_APB2LPENR;
+	
+	volatile u32 Reserved11;
+	volatile u32 Reserved12;
+	
+	volatile u32 RCC_BDCR;
+	volatile u32 RCC_CSR;
+	
+	volatile u32 Reserved13;
+	volatile u32 Reserved14;
+	
+	volatile u32 RCC_SSCGR;
+	volatile u32 RCC_PLLI2SCFGR;
+}RCC;
+
+#define MRCC  ((volatile RCC *)BASE_ADDRESS) //MRCC is pointer to struct 
+
+//for sourse of clock  
+#define HSI 0
+#define HSE 1
+#define PLL 2
+
+
+//  Bits in RCC_CR register
+#define HSION  0
+#define HSEON  16
+#define PLLON  24
+
+
+//  Bits in RCC_PLLCFGR register
+#define PLLSRC 22
+#define PLLP0  16
+#define PLLN0  6
+#define PLLM0  0
+
+
+// PLLP values
+#define _2_Prescaler   	0
+#define _4_Prescaler	1
+#define _6_Prescaler	2
+#define _8_Prescaler	3
+
+// First 2 Bits in RCC_CFGR register 
+#define SW0    0
+#define SW1    1
+
+
+// for the 4 kinds of bus in the ARM MP
+#define AHB1_BUS	0
+#define AHB2_BUS	1
+#define APB1_BUS	2
+#define APB2_BUS	3
+
+
+//Peripheral Clock Enable For APB1 Bus  
+/*
+#define    TIM2_RCC         0
+#define    TIM3_RCC         1
+#define    TIM4_RCC         2
+#define    TIM5_RCC         3
+#define    TIM6_RCC         4
+#define    TIM7_RCC         5
+#define    TIM12_RCC        6
+#define    TIM13_RCC        7
+#define    TIM14_RCC        8
+#define    WWDG_RCC         11
+#define    SPI2_RCC         14
+#define    SPI3_RCC         15
+#define    USART2_RCC       17
+#define    USART3_RCC       18
+#define    UART4_RCC        19
+#define    UART5_RCC        20
+#define    I2C1_RCC         21
+#define    I2C2_RCC         22
+#define    USB_RCC          23
+#define    CAN_RCC          25
+#define    BKP_RCC          27
+#define    PWR_RCC          28
+#define    DAC_RCC          29
+
+
+//Peripheral Clock Enable For APB2 Bus
+#define    AFIO_RCC         0
+#define    GPIOA_RCC        2
+#define    GPIOB_RCC        3
+#define    GPIOC_RCC        4
+#define    GPIOD_RCC        5
+#define    GPIOE_RCC        6
+#define    GPIOF_RCC        7
+#define    GPIOG_RCC        8
+#define    ADC1_RCC         9
+#define    ADC2_RCC         10
+#define    TIM1_RCC         11
+#define    SPI1_RCC         12
+#define    TIM8_RCC         13
+#define    USART1_RCC       14
+#define    ADC3_RCC         15
+#define    TIM9_RCC         19
+#define    TIM10_RCC        20
+#define    TIM11_RCC        21
+
+*/
+
+//AHB PRESCALER OPTIONS
+#define AHP_NO_PRESCALAR	      7
+#define AHP_2_PRESCALAR 	      8
+#define AHP_4_PRESCALAR 	      9
+#define AHP_8_PRESCALAR 	      10
+#define AHP_16_PRESCALAR 	      11
+#define AHP_64_PRESCALAR 	      12
+#define AHP_128_PRESCALAR       13
+#define AHP_256_PRESCALAR       14
+#define AHP_512_PRESCALAR       15
+
+
+#define AHB_PRESCALAR_MASK 0xFFFFFF0F
+
+//APB PRESCALER OPTIONS
+#define APB_NO_PRESCALAR	      0
+#define APB_2_PRESCALAR 	      4
+#define APB_4_PRESCALAR 	      5
+#define APB_8_PRESCALAR 	      6
+#define APB_16_PRESCALAR 	      7
+
+//  Ready flags in RCC_CR register
+#define HSIRDY 1
+#define HSERDY 17
+#define PLLRDY 25
+
+//  Fields in RCC_CFGR register
+#define SWS0   2
+#define HPRE0  4
+#define PPRE1_0 10
+#define PPRE2_0 13
+#define RCC_CFGR_SW_MASK       0x3
+#define RCC_CFGR_SWS_MASK      0xC
+#define RCC_CFGR_HPRE_MASK     0xF
+#define RCC_CFGR_PPRE_MASK     0x7
+
+//  Fields in RCC_PLLCFGR register
+#define PLLQ0  24
+#define RCC_PLLCFGR_PLLM_MASK  0x3F
+#define RCC_PLLCFGR_PLLN_MASK  0x1FF
+#define RCC_PLLCFGR_PLLP_MASK  0x3
+#define RCC_PLLCFGR_RESERVED   0xF0BC8000 /* bits kept at their reset value */
+
+#define HSI_CLOCK_HZ  16000000UL
+
+// Flash interface (wait states, prefetch and caches)
+#define FLASH_BASE_ADDRESS  0x40023C00
+#define FLASH_ACR   (*(volatile u32 *)FLASH_BASE_ADDRESS)
+
+//  Bits in FLASH_ACR register
+#define LATENCY0  0
+#define PRFTEN    8
+#define ICEN      9
+#define DCEN      10
+#define ICRST     11
+#define DCRST     12
+#define FLASH_ACR_LATENCY_MASK  0xF
+
+// limit of the APB1 bus
+#define RCC_APB1_MAX_HZ  42000000UL
+
+/*
+ * Clock tree of the configuration, checked at compile time
+ * (RCC_Config.h is included first)
+ */
+#if PLL_INPUT_SOURCE == HSI
+#define RCC_PLL_INPUT_HZ  HSI_CLOCK_HZ
+#else
+#define RCC_PLL_INPUT_HZ  HSE_CLOCK_HZ
+#endif
+#define RCC_VCO_INPUT_HZ   (RCC_PLL_INPUT_HZ / PLLM_VALUE)
+#define RCC_VCO_OUTPUT_HZ  (RCC_VCO_INPUT_HZ * PLLN_VALUE)
+#define RCC_PLL_OUTPUT_HZ  (RCC_VCO_OUTPUT_HZ / (2 * (PLLP_VALUE + 1)))
+
+/* the PLL can also be selected at run time (MRCC_u8SwitchSysClk), it is always checked */
+#if !((PLLN_VALUE >=192)&&(PLLN_VALUE <=432))
+#error "Wrong Configuration For PLLN_VALUE"
+#endif
+#if !((PLLM_VALUE >=2)&&(PLLM_VALUE <=63))
+#error "Wrong Configuration For PLLM_VALUE"
+#endif
+#if !((PLLQ_VALUE >=2)&&(PLLQ_VALUE <=15))
+#error "Wrong Configuration For PLLQ_VALUE"
+#endif
+#if ((RCC_VCO_INPUT_HZ < 1000000UL) || (RCC_VCO_INPUT_HZ > 2000000UL))
+#error "PLL input / PLLM must be between 1 and 2 MHz"
+#endif
+#if ((RCC_VCO_OUTPUT_HZ < 192000000UL) || (RCC_VCO_OUTPUT_HZ > 432000000UL))
+#error "PLL VCO output must be between 192 and 432 MHz"
+#endif
+#if RCC_PLL_OUTPUT_HZ > 84000000UL
+#error "The PLL output must not exceed 84 MHz"
+#endif
+
+#if CLOCK_TYPE == HSI
+#define RCC_SYSCLK_HZ  HSI_CLOCK_HZ
+#elif CLOCK_TYPE == HSE
+#define RCC_SYSCLK_HZ  HSE_CLOCK_HZ
+#elif CLOCK_TYPE == PLL
+#define RCC_SYSCLK_HZ  RCC_PLL_OUTPUT_HZ
+#endif
+
+#if   AHB_PRESCALER == AHP_NO_PRESCALAR
+#define RCC_HCLK_HZ  (RCC_SYSCLK_HZ)
+#elif AHB_PRESCALER == AHP_2_PRESCALAR
+#define RCC_HCLK_HZ  (RCC_SYSCLK_HZ / 2)
+#elif AHB_PRESCALER == AHP_4_PRESCALAR
+#define RCC_HCLK_HZ  (RCC_SYSCLK_HZ / 4)
+#elif AHB_PRESCALER == AHP_8_PRESCALAR
+#define RCC_HCLK_HZ  (RCC_SYSCLK_HZ / 8)
+#elif AHB_PRESCALER == AHP_16_PRESCALAR
+#define RCC_HCLK_HZ  (RCC_SYSCLK_HZ / 16)
+#elif AHB_PRESCALER == AHP_64_PRESCALAR
+#define RCC_HCLK_HZ  (RCC_SYSCLK_HZ / 64)
+#elif AHB_PRESCALER == AHP_128_PRESCALAR
+#define RCC_HCLK_HZ  (RCC_SYSCLK_HZ / 128)
+#elif AHB_PRESCALER == AHP_256_PRESCALAR
+#define RCC_HCLK_HZ  (RCC_SYSCLK_HZ / 256)
+#else
+#define RCC_HCLK_HZ  (RCC_SYSCLK_HZ / 512)
+#endif
+
+#if ((APB1_PRESCALER == APB_NO_PRESCALAR) && (RCC_HCLK_HZ > 42000000UL)) || \
+    ((APB1_PRESCALER == APB_2_PRESCALAR) && (RCC_HCLK_HZ > 84000000UL))
+#error "APB1 must not exceed 42 MHz"
+#endif
+
+/* flash wait states for a 2.7 V to 3.6 V supply: one per 30 MHz of HCLK */
+#define RCC_FLASH_HZ_PER_WAIT_STATE  30000000UL
+#if   RCC_HCLK_HZ <= 30000000UL
+#define RCC_FLASH_LATENCY  0
+#elif RCC_HCLK_HZ <= 60000000UL
+#define RCC_FLASH_LATENCY  1
+#else
+#define RCC_FLASH_LATENCY  2
+#endif
+
+#endif 
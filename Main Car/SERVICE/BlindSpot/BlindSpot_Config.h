@@ -0,0 +1,40 @@
+/******************************************************************************
+ *
+ * @file BlindSpot_Config.h
+ *
+ * @brief Configuration file for the BlindSpot (side monitor) module.
+ *
+ * Each side keeps an occupancy state from the readings of its ultrasonic
+ * sensor, pinged in the background by the scanner (SERVICE/Scan), and from
+ * the neighbour table (SERVICE/Neighbour). The state drives the LED of the
+ * side (HAL/Led).
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_BLINDSPOT_BLINDSPOT_CONFIG_H_
+#define SERVICE_BLINDSPOT_BLINDSPOT_CONFIG_H_
+
+/**
+ * @brief Hysteresis of the side distance (cm).
+ *
+ * A side becomes occupied after BSM_ENTER_READINGS readings in a row below
+ * BSM_OCCUPIED_CM, and clear again after BSM_EXIT_READINGS readings in a row
+ * at or above BSM_CLEAR_CM. BSM_CLEAR_CM must be below the range gate of the
+ * side sensors (SCAN_GATE_LEFT_CM, SCAN_GATE_RIGHT_CM).
+ */
+#define BSM_OCCUPIED_CM				20
+#define BSM_CLEAR_CM				30
+#define BSM_ENTER_READINGS			2
+#define BSM_EXIT_READINGS			3
+
+/**
+ * @brief A side without reading for this time is unknown (ms).
+ *
+ * Must be longer than the slowest background ping period of the side sensors.
+ */
+#define BSM_STALE_MS				1200
+
+#endif /* SERVICE_BLINDSPOT_BLINDSPOT_CONFIG_H_ */
@@ -0,0 +1,65 @@
+/******************************************************************************
+ *
+ * @file BlindSpot_Interface.h
+ *
+ * @brief Interface file for the BlindSpot (side monitor) module.
+ *
+ * Watches both sides all the time, not only while the car turns. The side
+ * sensors are pinged in the background by the scanner, the task only takes
+ * their new readings, so it never waits. A side is occupied after a few
+ * close readings in a row and clear after a few far ones (hysteresis), or
+ * reported when the neighbour table has a car beside in that lane.
+ *
+ * The LED of a side (HAL/Led) is steady while the side is occupied, pulses
+ * while a car is only reported by V2V, and blinks when the car turns toward
+ * an occupied or reported side. The patterns run on the timer, the task only
+ * changes them on a state change.
+ *
+ * @note Include Ultrasonic_Interface.h before this file. Not interrupt safe:
+ *       the task and the queries run in the main loop, after SSCAN_voidTask
+ *       and SV2V_voidTask.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_BLINDSPOT_BLINDSPOT_INTERFACE_H_
+#define SERVICE_BLINDSPOT_BLINDSPOT_INTERFACE_H_
+
+/**
+ * @brief States of a side.
+ */
+#define SBSM_STATE_UNKNOWN			0	/**< No recent reading of the side sensor. */
+#define SBSM_STATE_CLEAR			1
+#define SBSM_STATE_REPORTED			2	/**< The sensor is clear, a neighbour is beside in that lane (V2V). */
+#define SBSM_STATE_OCCUPIED			3	/**< The sensor sees something close. */
+
+/**
+ * @brief No turn, for SBSM_voidTask.
+ */
+#define SBSM_NO_TURN				0
+
+/**
+ * @brief Forget the sides (unknown) and turn the LEDs off.
+ *
+ * @note HLED_voidInit must be called before.
+ */
+void SBSM_voidInit(void);
+
+/**
+ * @brief Take the new side readings, update the states and the LEDs.
+ *
+ * @param Copy_u8TurnSide LEFT_US or RIGHT_US while the car turns to that side, SBSM_NO_TURN otherwise.
+ */
+void SBSM_voidTask(u8 Copy_u8TurnSide);
+
+/**
+ * @brief Get the state of a side.
+ *
+ * @param Copy_Side LEFT_US or RIGHT_US.
+ * @return SBSM_STATE_..., SBSM_STATE_UNKNOWN for a wrong side.
+ */
+u8 SBSM_u8GetState(USNUM_t Copy_Side);
+
+#endif /* SERVICE_BLINDSPOT_BLINDSPOT_INTERFACE_H_ */
@@ -0,0 +1,42 @@
+/******************************************************************************
+ *
+ * @File: BlindSpot_Private.h
+ *
+ * @Brief: Private definitions for the BlindSpot (side monitor) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_BLINDSPOT_BLINDSPOT_PRIVATE_H_
+#define SERVICE_BLINDSPOT_BLINDSPOT_PRIVATE_H_
+
+#if (BSM_CLEAR_CM < BSM_OCCUPIED_CM)
+#error "BSM_CLEAR_CM must be at least BSM_OCCUPIED_CM"
+#endif
+
+#if (BSM_ENTER_READINGS < 1) || (BSM_EXIT_READINGS < 1)
+#error "BSM_ENTER_READINGS and BSM_EXIT_READINGS must be at least 1"
+#endif
+
+#define BSM_SIDE_COUNT			2
+#define BSM_US_PER_MS			1000UL
+
+/**
+ * @brief State of a side.
+ */
+typedef struct
+{
+	USNUM_t Bsm_Sensor;			/**< Ultrasonic sensor of the side. */
+	s8  Bsm_s8Lane;				/**< Lane of the side in the neighbour table. */
+	u8  Bsm_u8Led;				/**< LED of the side. */
+	u32 Bsm_u32Trigger;			/**< us, trigger time of the last reading taken. */
+	u8  Bsm_u8SensorState;		/**< SBSM_STATE_UNKNOWN, CLEAR or OCCUPIED from the sensor alone. */
+	u8  Bsm_u8Count;			/**< Readings in a row against the sensor state. */
+	u8  Bsm_u8State;			/**< State given to the application. */
+	u8  Bsm_u8Pattern;			/**< Pattern of the LED. */
+}BSM_SIDE_t;
+
+#endif /* SERVICE_BLINDSPOT_BLINDSPOT_PRIVATE_H_ */
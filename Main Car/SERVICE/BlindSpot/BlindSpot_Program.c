@@ -0,0 +1,198 @@
+/******************************************************************************
+ *
+ * @File: BlindSpot_Program.c
+ *
+ * @Brief: Implementation of functions for the BlindSpot Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+
+/*******************************************************************************
+ *                          	HAL Components                                 *
+ *******************************************************************************/
+#include "../../HAL/Ultrasonic/Ultrasonic_Interface.h"
+#include "../../HAL/Led/Led_Interface.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../Trace/Trace_Interface.h"
+#include "../V2V/V2V_Interface.h"
+#include "../Neighbour/Neighbour_Interface.h"
+#include "../Scan/Scan_Interface.h"
+#include "BlindSpot_Interface.h"
+#include "BlindSpot_Config.h"
+#include "BlindSpot_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+static BSM_SIDE_t SBSM_AstrSides[BSM_SIDE_COUNT] =
+{
+	{ LEFT_US,  SNBR_LEFT_LANE,  HLED_LEFT,  0, SBSM_STATE_UNKNOWN, 0, SBSM_STATE_UNKNOWN, HLED_OFF },
+	{ RIGHT_US, SNBR_RIGHT_LANE, HLED_RIGHT, 0, SBSM_STATE_UNKNOWN, 0, SBSM_STATE_UNKNOWN, HLED_OFF }
+};
+
+/*******************************************************************************
+ *                          	Private Functions                              *
+ *******************************************************************************/
+/**
+ * @brief Update the sensor state of a side with its new reading, if any.
+ */
+static void SBSM_voidTakeReading(BSM_SIDE_t * P_Side, u32 Copy_u32Now)
+{
+	u32 L_u32Trigger;
+	f32 L_f32Distance;
+	u8 L_u8Against;
+
+	// distance and trigger time come from the same reading
+	if ((SSCAN_u8GetReading(P_Side->Bsm_Sensor, &L_f32Distance, &L_u32Trigger) != OK) ||
+		((Copy_u32Now - L_u32Trigger) > (BSM_STALE_MS * BSM_US_PER_MS)))
+	{
+		P_Side->Bsm_u8SensorState = SBSM_STATE_UNKNOWN;
+		P_Side->Bsm_u8Count = 0;
+		return;
+	}
+
+	// the scanner keeps its latest reading: it is new when its trigger time changes
+	if (L_u32Trigger == P_Side->Bsm_u32Trigger)
+	{
+		return;
+	}
+	P_Side->Bsm_u32Trigger = L_u32Trigger;
+
+	switch (P_Side->Bsm_u8SensorState)
+	{
+	case SBSM_STATE_CLEAR:
+		L_u8Against = (L_f32Distance < BSM_OCCUPIED_CM);
+		break;
+	case SBSM_STATE_OCCUPIED:
+		L_u8Against = (L_f32Distance >= BSM_CLEAR_CM);
+		break;
+	default:
+		// the first reading decides, a distance between the thresholds is taken as occupied
+		P_Side->Bsm_u8SensorState = (L_f32Distance >= BSM_CLEAR_CM) ? SBSM_STATE_CLEAR : SBSM_STATE_OCCUPIED;
+		P_Side->Bsm_u8Count = 0;
+		return;
+	}
+
+	if (L_u8Against == 0)
+	{
+		P_Side->Bsm_u8Count = 0;
+		return;
+	}
+	P_Side->Bsm_u8Count++;
+	if ((P_Side->Bsm_u8SensorState == SBSM_STATE_CLEAR) && (P_Side->Bsm_u8Count >= BSM_ENTER_READINGS))
+	{
+		P_Side->Bsm_u8SensorState = SBSM_STATE_OCCUPIED;
+		P_Side->Bsm_u8Count = 0;
+	}
+	else if ((P_Side->Bsm_u8SensorState == SBSM_STATE_OCCUPIED) && (P_Side->Bsm_u8Count >= BSM_EXIT_READINGS))
+	{
+		P_Side->Bsm_u8SensorState = SBSM_STATE_CLEAR;
+		P_Side->Bsm_u8Count = 0;
+	}
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Forget the sides (unknown) and turn the LEDs off.
+ */
+void SBSM_voidInit(void)
+{
+	u8 L_u8Side;
+
+	for (L_u8Side = 0; L_u8Side < BSM_SIDE_COUNT; L_u8Side++)
+	{
+		SBSM_AstrSides[L_u8Side].Bsm_u8SensorState = SBSM_STATE_UNKNOWN;
+		SBSM_AstrSides[L_u8Side].Bsm_u8Count = 0;
+		SBSM_AstrSides[L_u8Side].Bsm_u8State = SBSM_STATE_UNKNOWN;
+		SBSM_AstrSides[L_u8Side].Bsm_u8Pattern = HLED_OFF;
+		HLED_u8SetPattern(SBSM_AstrSides[L_u8Side].Bsm_u8Led, HLED_OFF);
+	}
+}
+
+/**
+ * @brief Take the new side readings, update the states and the LEDs.
+ *
+ * The sensor wins over the neighbour table: a car the sensor sees is
+ * occupied whatever V2V says.
+ */
+void SBSM_voidTask(u8 Copy_u8TurnSide)
+{
+	u32 L_u32Now = MTMR_u32GetMicros();
+	BSM_SIDE_t * L_pSide;
+	u8 L_u8Side;
+	u8 L_u8State;
+	u8 L_u8Pattern;
+
+	for (L_u8Side = 0; L_u8Side < BSM_SIDE_COUNT; L_u8Side++)
+	{
+		L_pSide = &SBSM_AstrSides[L_u8Side];
+		SBSM_voidTakeReading(L_pSide, L_u32Now);
+
+		L_u8State = L_pSide->Bsm_u8SensorState;
+		if ((L_u8State != SBSM_STATE_OCCUPIED) && SNBR_u8IsLaneOccupied(L_pSide->Bsm_s8Lane))
+		{
+			L_u8State = SBSM_STATE_REPORTED;
+		}
+
+		switch (L_u8State)
+		{
+		case SBSM_STATE_OCCUPIED:
+			L_u8Pattern = (Copy_u8TurnSide == L_pSide->Bsm_Sensor) ? HLED_BLINK : HLED_STEADY;
+			break;
+		case SBSM_STATE_REPORTED:
+			L_u8Pattern = (Copy_u8TurnSide == L_pSide->Bsm_Sensor) ? HLED_BLINK : HLED_PULSE;
+			break;
+		default:
+			L_u8Pattern = HLED_OFF;
+			break;
+		}
+
+		if (L_u8State != L_pSide->Bsm_u8State)
+		{
+			L_pSide->Bsm_u8State = L_u8State;
+			STRACE_voidLog(STRACE_EVT_BLIND_SPOT, L_pSide->Bsm_Sensor, L_u8State);
+		}
+		if (L_u8Pattern != L_pSide->Bsm_u8Pattern)
+		{
+			L_pSide->Bsm_u8Pattern = L_u8Pattern;
+			HLED_u8SetPattern(L_pSide->Bsm_u8Led, L_u8Pattern);
+		}
+	}
+}
+
+/**
+ * @brief Get the state of a side.
+ */
+u8 SBSM_u8GetState(USNUM_t Copy_Side)
+{
+	u8 L_u8Side;
+
+	for (L_u8Side = 0; L_u8Side < BSM_SIDE_COUNT; L_u8Side++)
+	{
+		if (SBSM_AstrSides[L_u8Side].Bsm_Sensor == Copy_Side)
+		{
+			return SBSM_AstrSides[L_u8Side].Bsm_u8State;
+		}
+	}
+	return SBSM_STATE_UNKNOWN;
+}
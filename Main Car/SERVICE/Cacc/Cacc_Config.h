@@ -0,0 +1,75 @@
+/******************************************************************************
+ *
+ * @file Cacc_Config.h
+ *
+ * @brief Configuration file for the Cacc (cooperative adaptive cruise control) module.
+ *
+ * The car keeps a time gap to the car ahead instead of copying its speed
+ * order: the gap spacing grows with the own speed. The speed and the
+ * acceleration of the car ahead come from its beacons (SERVICE/V2V) when it
+ * sends them, from the range rate of the forward ultrasonic track otherwise.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_CACC_CACC_CONFIG_H_
+#define SERVICE_CACC_CACC_CONFIG_H_
+
+/**
+ * @brief Period of the control law in ms.
+ *
+ * The command is computed at this fixed rate, about 4 readings of the forward
+ * ultrasonic sensor per beacon.
+ */
+#define CACC_PERIOD_MS				50
+
+/**
+ * @brief Time gap to the car ahead in ms.
+ *
+ * TIME_GAP: the car ahead sends its speed and acceleration (V2V).
+ * ACC_TIME_GAP: only the ultrasonic range is known, the speed of the car
+ * ahead is found later, so the gap is longer.
+ */
+#define CACC_TIME_GAP_MS			600
+#define CACC_ACC_TIME_GAP_MS		1200
+
+/**
+ * @brief Gap kept at standstill in mm.
+ */
+#define CACC_STANDSTILL_MM			150
+
+/**
+ * @brief Gains of the law (/256, per second).
+ *
+ * KP: speed added per mm of gap error, KD: per mm/s of range rate.
+ */
+#define CACC_KP_Q8					128
+#define CACC_KD_Q8					77
+
+/**
+ * @brief Time the acceleration of the car ahead is looked ahead by (ms).
+ */
+#define CACC_ACCEL_LOOKAHEAD_MS		300
+
+/**
+ * @brief Largest change of the command in mm/s2.
+ */
+#define CACC_MAX_ACCEL_MM_S2		400
+#define CACC_MAX_DECEL_MM_S2		1500
+
+/**
+ * @brief The car ahead is lost when the forward track has no reading for this time (ms).
+ */
+#define CACC_RANGE_TIMEOUT_MS		300
+
+/**
+ * @brief Largest difference between the V2V gap and the ultrasonic range (mm).
+ *
+ * When the beacon of the nearest car ahead doesn't fit the range, the target
+ * of the ultrasonic sensor is something else and its speed is not used.
+ */
+#define CACC_V2V_MATCH_MM			500
+
+#endif /* SERVICE_CACC_CACC_CONFIG_H_ */
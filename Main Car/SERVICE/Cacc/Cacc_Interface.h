@@ -0,0 +1,72 @@
+/******************************************************************************
+ *
+ * @file Cacc_Interface.h
+ *
+ * @brief Interface file for the Cacc (cooperative adaptive cruise control) module.
+ *
+ * Follows the car ahead at a time gap. Every CACC_PERIOD_MS the speed
+ * command is
+ *
+ *   lead speed + lead acceleration * lookahead + KP * gap error + KD * range rate
+ *
+ * where the gap error is the forward range (SERVICE/Ttc) minus the standstill
+ * gap plus the time gap times the own speed (SERVICE/Odometry). The lead
+ * speed and acceleration are the ones of its beacon (SERVICE/Neighbour) when
+ * the beacon fits the range, the own speed plus the range rate otherwise. The
+ * command is limited in acceleration and never above the set speed. When the
+ * car ahead is lost it goes back to the set speed.
+ *
+ * @note Include Ultrasonic_Interface.h before this file. Not interrupt safe:
+ *       the task runs in the main loop, after STTC_voidTask and SV2V_voidTask.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_CACC_CACC_INTERFACE_H_
+#define SERVICE_CACC_CACC_INTERFACE_H_
+
+/**
+ * @brief Stop following.
+ */
+void SCACC_voidInit(void);
+
+/**
+ * @brief Start following the car ahead.
+ *
+ * @param Copy_u16Speed The speed the car drives at now in mm/s, the first command starts from it.
+ */
+void SCACC_voidStart(u16 Copy_u16Speed);
+
+/**
+ * @brief Stop following, the task gives no more commands.
+ */
+void SCACC_voidStop(void);
+
+/**
+ * @brief Compute the speed command when the period has elapsed.
+ *
+ * @param Copy_u16SetSpeed The speed asked by the driver in mm/s, the highest command.
+ * @param P_u16Command     Where the command is written in mm/s.
+ * @return OK if a new command is written, NOK if it is not due or the module is
+ *         stopped, NULL_PTR_ERR.
+ */
+u8 SCACC_u8Task(u16 Copy_u16SetSpeed, u16 * P_u16Command);
+
+/**
+ * @brief Check if the last command followed a car.
+ *
+ * @return 1 if the last command was computed from a car ahead, 0 if there was
+ *         none (the command goes back to the set speed) or the module is stopped.
+ */
+u8 SCACC_u8IsFollowing(void);
+
+/**
+ * @brief Time the main loop can sleep before the next command (us).
+ *
+ * @return 0 if the command is due, 0xFFFFFFFF if the module is stopped.
+ */
+u32 SCACC_u32GetIdleTime(void);
+
+#endif /* SERVICE_CACC_CACC_INTERFACE_H_ */
@@ -0,0 +1,29 @@
+/******************************************************************************
+ *
+ * @File: Cacc_Private.h
+ *
+ * @Brief: Private definitions for the Cacc (cooperative adaptive cruise control) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_CACC_CACC_PRIVATE_H_
+#define SERVICE_CACC_CACC_PRIVATE_H_
+
+#if (CACC_PERIOD_MS < 1)
+#error "CACC_PERIOD_MS must be at least 1"
+#endif
+
+#if (CACC_KP_Q8 > 1024) || (CACC_KD_Q8 > 1024)
+#error "The CACC gains are at most 4 (1024 / 256)"
+#endif
+
+#define CACC_Q8_ONE				256
+#define CACC_MM_PER_CM			10L
+#define CACC_MS_PER_S			1000L
+#define CACC_US_PER_MS			1000UL
+
+#endif /* SERVICE_CACC_CACC_PRIVATE_H_ */
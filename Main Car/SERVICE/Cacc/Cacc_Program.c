@@ -0,0 +1,240 @@
+/******************************************************************************
+ *
+ * @File: Cacc_Program.c
+ *
+ * @Brief: Implementation of functions for the Cacc Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+
+/*******************************************************************************
+ *                          	HAL Components                                 *
+ *******************************************************************************/
+#include "../../HAL/Ultrasonic/Ultrasonic_Interface.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../V2V/V2V_Interface.h"
+#include "../Neighbour/Neighbour_Interface.h"
+#include "../Odometry/Odometry_Interface.h"
+#include "../Ttc/Ttc_Interface.h"
+#include "Cacc_Interface.h"
+#include "Cacc_Config.h"
+#include "Cacc_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+static u8  SCACC_u8Running = 0;
+static u8  SCACC_u8Following = 0;
+static u32 SCACC_u32LastStep = 0;
+static s32 SCACC_s32Command = 0;
+
+/*******************************************************************************
+ *                          	Private Functions                              *
+ *******************************************************************************/
+/**
+ * @brief Get the speed and acceleration of the car ahead from its beacon.
+ *
+ * @param Copy_s32RangeMm The forward range the position of the beacon must fit.
+ * @return 1 if the nearest car ahead sends beacons and it is the forward target.
+ */
+static u8 SCACC_u8GetLead(s32 Copy_s32RangeMm, const SODO_POSE_t * P_strPose, s32 * P_s32Speed, s32 * P_s32Accel)
+{
+	SV2V_BEACON_t L_strLead;
+	s32 L_s32Gap;
+
+	if (SNBR_u8GetNearestAhead(&L_strLead) != OK)
+	{
+		return 0;
+	}
+
+	L_s32Gap = ((s32)L_strLead.Beacon_s16PosX * CACC_MM_PER_CM) - P_strPose->Pose_s32X - Copy_s32RangeMm;
+	if ((L_s32Gap > CACC_V2V_MATCH_MM) || (L_s32Gap < -CACC_V2V_MATCH_MM))
+	{
+		return 0;
+	}
+
+	*P_s32Speed = (s32)L_strLead.Beacon_u16Speed * CACC_MM_PER_CM;
+	*P_s32Accel = (s32)L_strLead.Beacon_s16Accel * CACC_MM_PER_CM;
+	return 1;
+}
+
+/**
+ * @brief Compute the command toward the car ahead.
+ *
+ * @return 1 if there is a car ahead, the command is written, 0 if not.
+ */
+static u8 SCACC_u8Follow(u32 Copy_u32Now, s32 * P_s32Command)
+{
+	STTC_RANGE_t L_strRange;
+	SODO_POSE_t L_strPose;
+	s32 L_s32Range;
+	s32 L_s32Rate;
+	s32 L_s32Own;
+	s32 L_s32LeadSpeed;
+	s32 L_s32LeadAccel = 0;
+	s32 L_s32Gap;
+
+	if ((STTC_u8GetRange(FORWARD_US, &L_strRange) != OK) ||
+		((Copy_u32Now - L_strRange.Range_u32Time) > (CACC_RANGE_TIMEOUT_MS * CACC_US_PER_MS)))
+	{
+		return 0;
+	}
+
+	SODO_u8GetPose(&L_strPose);
+	L_s32Own = (L_strPose.Pose_s16Speed > 0) ? L_strPose.Pose_s16Speed : 0;
+	L_s32Range = (s32)L_strRange.Range_u16Cm * CACC_MM_PER_CM;
+	// positive when the gap opens
+	L_s32Rate = -(s32)STTC_s16GetClosingSpeed(FORWARD_US) * CACC_MM_PER_CM;
+
+	if (SCACC_u8GetLead(L_s32Range, &L_strPose, &L_s32LeadSpeed, &L_s32LeadAccel))
+	{
+		L_s32Gap = CACC_STANDSTILL_MM + ((L_s32Own * CACC_TIME_GAP_MS) / CACC_MS_PER_S);
+	}
+	else
+	{
+		L_s32LeadSpeed = L_s32Own + L_s32Rate;
+		if (L_s32LeadSpeed < 0)
+		{
+			L_s32LeadSpeed = 0;
+		}
+		L_s32Gap = CACC_STANDSTILL_MM + ((L_s32Own * CACC_ACC_TIME_GAP_MS) / CACC_MS_PER_S);
+	}
+
+	*P_s32Command = L_s32LeadSpeed + ((L_s32LeadAccel * CACC_ACCEL_LOOKAHEAD_MS) / CACC_MS_PER_S) +
+					((CACC_KP_Q8 * (L_s32Range - L_s32Gap)) / CACC_Q8_ONE) +
+					((CACC_KD_Q8 * L_s32Rate) / CACC_Q8_ONE);
+	return 1;
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Stop following.
+ */
+void SCACC_voidInit(void)
+{
+	SCACC_voidStop();
+}
+
+/**
+ * @brief Start following the car ahead.
+ *
+ * The first command is due at once.
+ */
+void SCACC_voidStart(u16 Copy_u16Speed)
+{
+	SCACC_s32Command = Copy_u16Speed;
+	SCACC_u32LastStep = MTMR_u32GetMicros() - (CACC_PERIOD_MS * CACC_US_PER_MS);
+	SCACC_u8Following = 0;
+	SCACC_u8Running = 1;
+}
+
+/**
+ * @brief Stop following, the task gives no more commands.
+ */
+void SCACC_voidStop(void)
+{
+	SCACC_u8Running = 0;
+	SCACC_u8Following = 0;
+}
+
+/**
+ * @brief Compute the speed command when the period has elapsed.
+ *
+ * The steps are kept on the CACC_PERIOD_MS grid, a late call doesn't shift
+ * the next one. After a long stall the grid restarts from now.
+ */
+u8 SCACC_u8Task(u16 Copy_u16SetSpeed, u16 * P_u16Command)
+{
+	u32 L_u32Now = MTMR_u32GetMicros();
+	s32 L_s32Command = Copy_u16SetSpeed;
+	s32 L_s32Step;
+
+	if (P_u16Command == NULL)
+	{
+		return NULL_PTR_ERR;
+	}
+	if ((SCACC_u8Running == 0) || ((L_u32Now - SCACC_u32LastStep) < (CACC_PERIOD_MS * CACC_US_PER_MS)))
+	{
+		return NOK;
+	}
+
+	SCACC_u32LastStep += CACC_PERIOD_MS * CACC_US_PER_MS;
+	if ((L_u32Now - SCACC_u32LastStep) >= (CACC_PERIOD_MS * CACC_US_PER_MS))
+	{
+		SCACC_u32LastStep = L_u32Now;
+	}
+
+	SCACC_u8Following = SCACC_u8Follow(L_u32Now, &L_s32Command);
+
+	// acceleration limits, then the set speed
+	L_s32Step = (CACC_MAX_ACCEL_MM_S2 * CACC_PERIOD_MS) / CACC_MS_PER_S;
+	if (L_s32Command > (SCACC_s32Command + L_s32Step))
+	{
+		L_s32Command = SCACC_s32Command + L_s32Step;
+	}
+	L_s32Step = (CACC_MAX_DECEL_MM_S2 * CACC_PERIOD_MS) / CACC_MS_PER_S;
+	if (L_s32Command < (SCACC_s32Command - L_s32Step))
+	{
+		L_s32Command = SCACC_s32Command - L_s32Step;
+	}
+	if (L_s32Command > Copy_u16SetSpeed)
+	{
+		L_s32Command = Copy_u16SetSpeed;
+	}
+	if (L_s32Command < 0)
+	{
+		L_s32Command = 0;
+	}
+
+	SCACC_s32Command = L_s32Command;
+	*P_u16Command = (u16)L_s32Command;
+	return OK;
+}
+
+/**
+ * @brief Check if the last command followed a car.
+ */
+u8 SCACC_u8IsFollowing(void)
+{
+	return SCACC_u8Following;
+}
+
+/**
+ * @brief Time the main loop can sleep before the next command (us).
+ */
+u32 SCACC_u32GetIdleTime(void)
+{
+	u32 L_u32Elapsed;
+
+	if (SCACC_u8Running == 0)
+	{
+		return 0xFFFFFFFF;
+	}
+
+	L_u32Elapsed = MTMR_u32GetMicros() - SCACC_u32LastStep;
+	if (L_u32Elapsed >= (CACC_PERIOD_MS * CACC_US_PER_MS))
+	{
+		return 0;
+	}
+	return (CACC_PERIOD_MS * CACC_US_PER_MS) - L_u32Elapsed;
+}
@@ -0,0 +1,35 @@
+/******************************************************************************
+ *
+ * @file Camera_Config.h
+ *
+ * @brief Configuration file for the Camera (detection feed) module.
+ *
+ * The raspberry pushes the result of every camera capture on the camera
+ * channel of the link. The module keeps the latest one with its capture time
+ * on this car's clock.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_CAMERA_CAMERA_CONFIG_H_
+#define SERVICE_CAMERA_CAMERA_CONFIG_H_
+
+/**
+ * @brief Drift allowed between the raspberry clock and this one (ms per second, at least 1).
+ *
+ * The offset of the raspberry clock is the smallest one seen (the message that
+ * came the fastest). It is raised by this much every second, so a clock that
+ * runs slower is followed and the capture times don't grow old with the drift.
+ */
+#define CAM_OFFSET_RELAX_MS_PER_S	1
+
+/**
+ * @brief Longest delay from the capture to the reception taken as true (ms).
+ *
+ * A longer one means the raspberry clock restarted: the offset is learnt again.
+ */
+#define CAM_MAX_DELAY_MS			5000
+
+#endif /* SERVICE_CAMERA_CAMERA_CONFIG_H_ */
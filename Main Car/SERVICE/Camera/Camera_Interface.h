@@ -0,0 +1,66 @@
+/******************************************************************************
+ *
+ * @file Camera_Interface.h
+ *
+ * @brief Interface file for the Camera (detection feed) module.
+ *
+ * The raspberry doesn't wait for a request: it pushes the result of each
+ * capture (class, confidence, bearing and width of the box) with the time of
+ * the capture, at most a few times a second, on SLNK_CHANNEL_CAMERA. The
+ * module keeps the latest one, so the application reads it at once and knows
+ * how old it is.
+ *
+ * The capture time is taken to this car's clock with the offset of the
+ * raspberry clock, learnt from the fastest messages.
+ *
+ * @note Not interrupt safe: the task and the queries run in the main loop.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_CAMERA_CAMERA_INTERFACE_H_
+#define SERVICE_CAMERA_CAMERA_INTERFACE_H_
+
+/**
+ * @brief Detection classes.
+ */
+#define SCAM_CLASS_NONE				'N'		/**< Nothing recognized in the picture. */
+#define SCAM_CLASS_VEHICLE			'V'		/**< A vehicle is in the picture. */
+
+/**
+ * @brief Result of a camera capture.
+ */
+typedef struct
+{
+	u32 Det_u32CaptureTime;			/**< Local time of the capture in us. */
+	u32 Det_u32AgeMs;				/**< Time since the capture in ms, when it was read. */
+	u8  Det_u8Class;				/**< SCAM_CLASS_... */
+	u8  Det_u8Confidence;			/**< Confidence of the class in %. */
+	s8  Det_s8Bearing;				/**< Direction of the box center in degrees, positive to the left. */
+	u8  Det_u8Width;				/**< Width of the box in degrees (0 for SCAM_CLASS_NONE). */
+}SCAM_DETECTION_t;
+
+/**
+ * @brief Forget the detection and the raspberry clock.
+ */
+void SCAM_voidInit(void);
+
+/**
+ * @brief Take the detections received on the camera channel.
+ *
+ * Call it from the main loop after SLNK_voidTask.
+ */
+void SCAM_voidTask(void);
+
+/**
+ * @brief Get the latest detection.
+ *
+ * @param P_strDetection  Where the detection is copied, with its age.
+ * @param Copy_u32MaxAgeMs Oldest capture accepted (ms).
+ * @return OK, NOK if there is none or it is older, NULL_PTR_ERR.
+ */
+u8 SCAM_u8GetDetection(SCAM_DETECTION_t * P_strDetection, u32 Copy_u32MaxAgeMs);
+
+#endif /* SERVICE_CAMERA_CAMERA_INTERFACE_H_ */
@@ -0,0 +1,45 @@
+/******************************************************************************
+ *
+ * @File: Camera_Private.h
+ *
+ * @Brief: Private definitions for the Camera (detection feed) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_CAMERA_CAMERA_PRIVATE_H_
+#define SERVICE_CAMERA_CAMERA_PRIVATE_H_
+
+#if (CAM_OFFSET_RELAX_MS_PER_S < 1)
+#error "CAM_OFFSET_RELAX_MS_PER_S must be at least 1"
+#endif
+
+#if (CAM_MAX_DELAY_MS > 30000)
+#error "CAM_MAX_DELAY_MS must fit the 16 bits raspberry time stamps"
+#endif
+
+/**
+ * @brief Detection message on the camera channel.
+ *
+ * 'D' | CAPTURE TIME (ms, raspberry clock, 16 bits big endian) | CLASS |
+ * CONFIDENCE | BEARING | WIDTH
+ */
+#define CAM_MSG_DETECTION		'D'
+#define CAM_MSG_LENGTH			7
+
+#define CAM_MSG_TIME_HIGH		1
+#define CAM_MSG_TIME_LOW		2
+#define CAM_MSG_CLASS			3
+#define CAM_MSG_CONFIDENCE		4
+#define CAM_MSG_BEARING			5
+#define CAM_MSG_WIDTH			6
+
+#define CAM_MAX_CONFIDENCE		100
+
+#define CAM_US_PER_MS			1000UL
+#define CAM_MS_PER_S			1000
+
+#endif /* SERVICE_CAMERA_CAMERA_PRIVATE_H_ */
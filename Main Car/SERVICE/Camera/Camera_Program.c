@@ -0,0 +1,173 @@
+/******************************************************************************
+ *
+ * @File: Camera_Program.c
+ *
+ * @Brief: Implementation of functions for the Camera (detection feed) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../Link/Link_Interface.h"
+#include "../Link/Link_Config.h"
+#include "Camera_Interface.h"
+#include "Camera_Config.h"
+#include "Camera_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+static SCAM_DETECTION_t SCAM_strLatest;
+static u8 SCAM_u8DetectionValid = 0;
+
+/* local ms clock, it wraps like the raspberry time stamps */
+static u32 SCAM_u32ClockTime = 0;
+static u16 SCAM_u16ClockMs = 0;
+static u32 SCAM_u32RelaxMs = 0;
+
+/* raspberry clock: local ms - raspberry ms, for the fastest message */
+static u16 SCAM_u16Offset = 0;
+static u8 SCAM_u8OffsetValid = 0;
+
+/*******************************************************************************
+ *                          	Private Functions                              *
+ *******************************************************************************/
+/**
+ * @brief Move the local ms clock, and the offset with the allowed drift.
+ */
+static void SCAM_voidUpdateClock(u32 Copy_u32Now)
+{
+	u32 L_u32ElapsedMs = (Copy_u32Now - SCAM_u32ClockTime) / CAM_US_PER_MS;
+	u32 L_u32Seconds;
+
+	SCAM_u32ClockTime += L_u32ElapsedMs * CAM_US_PER_MS;
+	SCAM_u16ClockMs += (u16)L_u32ElapsedMs;
+
+	SCAM_u32RelaxMs += L_u32ElapsedMs;
+	L_u32Seconds = SCAM_u32RelaxMs / CAM_MS_PER_S;
+	SCAM_u32RelaxMs -= L_u32Seconds * CAM_MS_PER_S;
+	SCAM_u16Offset += (u16)(L_u32Seconds * CAM_OFFSET_RELAX_MS_PER_S);
+}
+
+/**
+ * @brief Take a detection message.
+ */
+static void SCAM_voidHandleMessage(const u8 * P_u8Message, u32 Copy_u32Now)
+{
+	u16 L_u16Capture = ((u16)P_u8Message[CAM_MSG_TIME_HIGH] << 8) | P_u8Message[CAM_MSG_TIME_LOW];
+	u16 L_u16Raw = (u16)(SCAM_u16ClockMs - L_u16Capture);
+	u16 L_u16Delay;
+
+	if ((P_u8Message[CAM_MSG_CLASS] != SCAM_CLASS_NONE) && (P_u8Message[CAM_MSG_CLASS] != SCAM_CLASS_VEHICLE))
+	{
+		return;
+	}
+
+	// offset + delay: a smaller one is a faster message, a much bigger one a new raspberry clock
+	L_u16Delay = (u16)(L_u16Raw - SCAM_u16Offset);
+	if ((SCAM_u8OffsetValid == 0) || ((s16)L_u16Delay < 0) || (L_u16Delay > CAM_MAX_DELAY_MS))
+	{
+		SCAM_u16Offset = L_u16Raw;
+		SCAM_u8OffsetValid = 1;
+		SCAM_u32RelaxMs = 0;
+		L_u16Delay = 0;
+	}
+
+	SCAM_strLatest.Det_u32CaptureTime = Copy_u32Now - (u32)L_u16Delay * CAM_US_PER_MS;
+	SCAM_strLatest.Det_u8Class = P_u8Message[CAM_MSG_CLASS];
+	SCAM_strLatest.Det_u8Confidence = P_u8Message[CAM_MSG_CONFIDENCE];
+	if (SCAM_strLatest.Det_u8Confidence > CAM_MAX_CONFIDENCE)
+	{
+		SCAM_strLatest.Det_u8Confidence = CAM_MAX_CONFIDENCE;
+	}
+	SCAM_strLatest.Det_s8Bearing = (s8)P_u8Message[CAM_MSG_BEARING];
+	SCAM_strLatest.Det_u8Width = P_u8Message[CAM_MSG_WIDTH];
+	SCAM_u8DetectionValid = 1;
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Initialize the module.
+ *
+ * This function forgets the detection and starts learning the raspberry clock again.
+ */
+void SCAM_voidInit(void)
+{
+	SCAM_u8DetectionValid = 0;
+	SCAM_u8OffsetValid = 0;
+	SCAM_u32ClockTime = MTMR_u32GetMicros();
+	SCAM_u16ClockMs = 0;
+	SCAM_u32RelaxMs = 0;
+}
+
+/**
+ * @brief Take the detections received on the camera channel.
+ *
+ * The raspberry sends a few per second, only the latest one is kept.
+ */
+void SCAM_voidTask(void)
+{
+	u8 L_Au8Message[LNK_MAX_PAYLOAD];
+	u8 L_u8Length;
+	u32 L_u32Now = MTMR_u32GetMicros();
+
+	SCAM_voidUpdateClock(L_u32Now);
+	while (SLNK_u8Receive(SLNK_CHANNEL_CAMERA, L_Au8Message, &L_u8Length) == OK)
+	{
+		if ((L_u8Length == CAM_MSG_LENGTH) && (L_Au8Message[0] == CAM_MSG_DETECTION))
+		{
+			SCAM_voidHandleMessage(L_Au8Message, L_u32Now);
+		}
+	}
+}
+
+/**
+ * @brief Get the latest detection.
+ */
+u8 SCAM_u8GetDetection(SCAM_DETECTION_t * P_strDetection, u32 Copy_u32MaxAgeMs)
+{
+	ERROR_STATE_T Loc_ErrorState = OK;
+	u32 L_u32AgeMs;
+
+	if (P_strDetection == NULL)
+	{
+		Loc_ErrorState = NULL_PTR_ERR;
+	}
+	else if (SCAM_u8DetectionValid == 0)
+	{
+		Loc_ErrorState = NOK;
+	}
+	else
+	{
+		L_u32AgeMs = (MTMR_u32GetMicros() - SCAM_strLatest.Det_u32CaptureTime) / CAM_US_PER_MS;
+		if (L_u32AgeMs > Copy_u32MaxAgeMs)
+		{
+			Loc_ErrorState = NOK;
+		}
+		else
+		{
+			*P_strDetection = SCAM_strLatest;
+			P_strDetection->Det_u32AgeMs = L_u32AgeMs;
+		}
+	}
+	return Loc_ErrorState;
+}
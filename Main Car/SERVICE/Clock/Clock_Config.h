@@ -0,0 +1,69 @@
+/******************************************************************************
+ *
+ * @file Clock_Config.h
+ *
+ * @brief Configuration file for the Clock (peer clock synchronisation) module.
+ *
+ * The cars exchange time requests and responses over V2V (two way, NTP like).
+ * Each exchange gives the offset of the clock of the other car and the round
+ * trip delay; the offset and the drift of each car are kept so the times in
+ * its frames can be moved to the local timebase.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_CLOCK_CLOCK_CONFIG_H_
+#define SERVICE_CLOCK_CLOCK_CONFIG_H_
+
+/**
+ * @brief Number of cars followed (at most 254).
+ *
+ * When the table is full, the car synchronised the longest time ago is replaced.
+ */
+#define CLK_MAX_PEERS				4
+
+/**
+ * @brief Exchanges kept per car (clock filter).
+ *
+ * The offset is taken from the exchange with the shortest round trip among
+ * the last ones: its delay is the most symmetric, the others waited in a FIFO
+ * or a Raspberry on one way.
+ */
+#define CLK_FILTER_SIZE				8
+
+/**
+ * @brief Part of the offset error taken at each new best exchange (1/CLK_OFFSET_GAIN).
+ */
+#define CLK_OFFSET_GAIN				4
+
+/**
+ * @brief Drift estimation.
+ *
+ * The drift is corrected by 1/CLK_DRIFT_GAIN of the measured error, between
+ * offsets CLK_MIN_DRIFT_INTERVAL_MS to 4 x CLK_MIN_DRIFT_INTERVAL_MS apart: the
+ * offsets are only known to a few ms, a long interval makes that small beside
+ * the drift. It is limited to CLK_MAX_DRIFT_PPM (the HSI oscillator is trimmed
+ * to 1 %).
+ */
+#define CLK_DRIFT_GAIN				4
+#define CLK_MIN_DRIFT_INTERVAL_MS	8000
+#define CLK_MAX_DRIFT_PPM			20000
+
+/**
+ * @brief Offset error taken as a restart of the other car (us).
+ *
+ * Much more than the asymmetry of an exchange. Its offset is then measured
+ * again from scratch.
+ */
+#define CLK_STEP_US					500000UL
+
+/**
+ * @brief Time the offset is extrapolated without a new exchange (ms).
+ *
+ * After it the car is not synchronised any more.
+ */
+#define CLK_HOLDOVER_MS				10000UL
+
+#endif /* SERVICE_CLOCK_CLOCK_CONFIG_H_ */
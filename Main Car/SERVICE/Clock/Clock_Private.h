@@ -0,0 +1,68 @@
+/******************************************************************************
+ *
+ * @File: Clock_Private.h
+ *
+ * @Brief: Private definitions for the Clock (peer clock synchronisation) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_CLOCK_CLOCK_PRIVATE_H_
+#define SERVICE_CLOCK_CLOCK_PRIVATE_H_
+
+#if (CLK_MAX_PEERS < 1) || (CLK_MAX_PEERS > 254)
+#error "CLK_MAX_PEERS must be 1 to 254"
+#endif
+
+#if (CLK_FILTER_SIZE < 1)
+#error "CLK_FILTER_SIZE must be at least 1"
+#endif
+
+/* the drift correction multiplies the offset error (at most CLK_STEP_US) by 1000 */
+#if (CLK_STEP_US > 2000000UL)
+#error "CLK_STEP_US must be at most 2 s"
+#endif
+
+/* the drift is applied over CLK_HOLDOVER_MS and measured over 4 x CLK_MIN_DRIFT_INTERVAL_MS in s32 */
+#if ((CLK_MAX_DRIFT_PPM * CLK_HOLDOVER_MS) > 0x7FFFFFFFUL) || ((CLK_MAX_DRIFT_PPM * 4UL * CLK_MIN_DRIFT_INTERVAL_MS) > 0x7FFFFFFFUL)
+#error "CLK_MAX_DRIFT_PPM is too large for the holdover or the drift interval"
+#endif
+
+#define CLK_NONE				0xFF
+#define CLK_US_PER_MS			1000UL
+
+/**
+ * @brief One time exchange.
+ */
+typedef struct
+{
+	u32 Sample_u32Offset;		/**< Other clock - local clock (us, modulo 2^32). */
+	u32 Sample_u32Delay;		/**< Round trip without the time spent in the other car (us). */
+	u32 Sample_u32Time;			/**< Local time of the response (T4). */
+}CLK_SAMPLE_t;
+
+/**
+ * @brief Clock of one car.
+ *
+ * The offset at the local time t is
+ * Peer_u32Offset + Peer_s32DriftPpm * (t - Peer_u32RefTime) / 10^6.
+ */
+typedef struct
+{
+	u8  Peer_u8Id;						/**< Vehicle ID, 0 when the entry is free. */
+	u8  Peer_u8Synced;					/**< 1 once an offset is measured. */
+	u8  Peer_u8Count;					/**< Samples in the filter. */
+	u8  Peer_u8Next;					/**< Filter slot of the next sample. */
+	CLK_SAMPLE_t Peer_AstrSamples[CLK_FILTER_SIZE];
+	u32 Peer_u32Offset;					/**< Offset at the reference time (us). */
+	u32 Peer_u32RefTime;				/**< Local time of the sample the offset comes from. */
+	s32 Peer_s32DriftPpm;
+	u32 Peer_u32DriftRefOffset;			/**< Offset the drift is measured from. */
+	u32 Peer_u32DriftRefTime;
+	u32 Peer_u32LastSampleTime;			/**< Local time of the last exchange. */
+}CLK_PEER_t;
+
+#endif /* SERVICE_CLOCK_CLOCK_PRIVATE_H_ */
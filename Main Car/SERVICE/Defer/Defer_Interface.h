@@ -0,0 +1,45 @@
+/******************************************************************************
+ *
+ * @file Defer_Interface.h
+ *
+ * @brief Interface file for the Defer (deferred work) module.
+ *
+ * An interrupt handler keeps only what must be done at once (reading the data
+ * register, a time stamp) and posts the rest, e.g. an application callback,
+ * as a work item. The PendSV exception runs the items in order at the lowest
+ * priority, right after the interrupts return: every other interrupt can
+ * pre-empt them, and they still run before the main loop resumes.
+ *
+ * @note The queue is lock free: SDEF_u8Post can be called from any interrupt
+ *       and from the main loop.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_DEFER_DEFER_INTERFACE_H_
+#define SERVICE_DEFER_DEFER_INTERFACE_H_
+
+/**
+ * @brief Empty the queue.
+ *
+ * @note The PendSV priority is set by MNVIC_voidInit (lowest group).
+ */
+void SDEF_voidInit(void);
+
+/**
+ * @brief Post a work item, run by the PendSV handler.
+ *
+ * @param Copy_pfWork The function to run.
+ * @param Copy_u32Arg Its argument.
+ * @return OK, NOK if the queue is full (the item is dropped), NULL_PTR_ERR.
+ */
+u8 SDEF_u8Post(void (*Copy_pfWork)(u32 Copy_u32Arg), u32 Copy_u32Arg);
+
+/**
+ * @brief Get the number of work items dropped because the queue was full.
+ */
+u32 SDEF_u32GetDropCount(void);
+
+#endif /* SERVICE_DEFER_DEFER_INTERFACE_H_ */
@@ -0,0 +1,63 @@
+/******************************************************************************
+ *
+ * @file Fusion_Config.h
+ *
+ * @brief Configuration file for the Fusion (camera / ultrasonic) module.
+ *
+ * The camera detections are matched with the forward ultrasonic track by
+ * time, bearing and range. Each match adds evidence to the class of the
+ * track: vehicle or object.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_FUSION_FUSION_CONFIG_H_
+#define SERVICE_FUSION_FUSION_CONFIG_H_
+
+/**
+ * @brief Time gate: largest time between the capture and the track reading (ms).
+ *
+ * An older detection is not taken, the track may have moved since.
+ */
+#define FUS_MAX_GAP_MS				400
+
+/**
+ * @brief Bearing gate: half width of the forward ultrasonic beam (degrees).
+ *
+ * A vehicle box that doesn't reach into the beam is not the echo of the track.
+ */
+#define FUS_BEAM_HALF_DEG			15
+
+/**
+ * @brief Range gate: width of the cars (cm) and the ratio allowed between the
+ *        width of the box and the width a car at the track range has.
+ */
+#define FUS_VEHICLE_WIDTH_CM		18
+#define FUS_WIDTH_RATIO				2
+
+/**
+ * @brief Evidence, the score of a track goes from -100 (object) to 100 (vehicle).
+ *
+ * A matched vehicle adds its confidence. A capture with nothing recognized
+ * while the track is there takes FUS_NONE_EVIDENCE, a vehicle out of the gates
+ * FUS_MISMATCH_EVIDENCE (something else is in front).
+ */
+#define FUS_NONE_EVIDENCE			40
+#define FUS_MISMATCH_EVIDENCE		20
+
+/**
+ * @brief Score from which the class is decided.
+ *
+ * With the values above one sure vehicle detection or two captures with
+ * nothing recognized are needed.
+ */
+#define FUS_DECISION_SCORE			60
+
+/**
+ * @brief The class is unknown again when the track got no evidence for this time (ms).
+ */
+#define FUS_MAX_EVIDENCE_AGE_MS		1000
+
+#endif /* SERVICE_FUSION_FUSION_CONFIG_H_ */
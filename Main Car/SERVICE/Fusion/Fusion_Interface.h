@@ -0,0 +1,58 @@
+/******************************************************************************
+ *
+ * @file Fusion_Interface.h
+ *
+ * @brief Interface file for the Fusion (camera / ultrasonic) module.
+ *
+ * Classifies the target of the forward ultrasonic track (SERVICE/Ttc) with
+ * the camera detections (SERVICE/Camera). A detection is matched with the
+ * track when it was captured close to a reading of the track, its box reaches
+ * into the ultrasonic beam and its width fits a car at the track range. The
+ * class and its confidence are kept per track, so the application reads them
+ * at once when something is in front.
+ *
+ * @note Include Ultrasonic_Interface.h before this file. Not interrupt safe:
+ *       the task and the queries run in the main loop.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_FUSION_FUSION_INTERFACE_H_
+#define SERVICE_FUSION_FUSION_INTERFACE_H_
+
+/**
+ * @brief Classes of the forward target.
+ */
+#define SFUS_CLASS_UNKNOWN			0	/**< No target, or not enough recent evidence. */
+#define SFUS_CLASS_VEHICLE			1
+#define SFUS_CLASS_OBJECT			2
+
+/**
+ * @brief Forget the class.
+ */
+void SFUS_voidInit(void);
+
+/**
+ * @brief Match the new camera detection with the forward track.
+ *
+ * Call it from the main loop after STTC_voidTask and SCAM_voidTask.
+ */
+void SFUS_voidTask(void);
+
+/**
+ * @brief Get the class of the forward target.
+ *
+ * @return SFUS_CLASS_UNKNOWN, SFUS_CLASS_VEHICLE or SFUS_CLASS_OBJECT.
+ */
+u8 SFUS_u8GetClass(void);
+
+/**
+ * @brief Get the confidence of the class of the forward target.
+ *
+ * @return 0 to 100 %.
+ */
+u8 SFUS_u8GetConfidence(void);
+
+#endif /* SERVICE_FUSION_FUSION_INTERFACE_H_ */
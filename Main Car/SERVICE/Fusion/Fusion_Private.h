@@ -0,0 +1,42 @@
+/******************************************************************************
+ *
+ * @File: Fusion_Private.h
+ *
+ * @Brief: Private definitions for the Fusion (camera / ultrasonic) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_FUSION_FUSION_PRIVATE_H_
+#define SERVICE_FUSION_FUSION_PRIVATE_H_
+
+#if (FUS_DECISION_SCORE < 1) || (FUS_DECISION_SCORE > 100)
+#error "FUS_DECISION_SCORE must be 1 to 100"
+#endif
+
+#if (FUS_WIDTH_RATIO < 1)
+#error "FUS_WIDTH_RATIO must be at least 1"
+#endif
+
+#define FUS_MAX_SCORE			100
+/* degrees per radian, the box width of a car is about FUS_DEG_PER_RAD * width / range */
+#define FUS_DEG_PER_RAD			57
+#define FUS_US_PER_MS			1000UL
+
+/**
+ * @brief Class of the forward track.
+ */
+typedef struct
+{
+	u8  Fus_u8Valid;			/**< 1 while the ultrasonic has a target. */
+	u8  Fus_u8Track;			/**< Number of the ultrasonic track. */
+	s16 Fus_s16Score;			/**< -100 (object) to 100 (vehicle). */
+	u8  Fus_u8Class;			/**< SFUS_CLASS_..., as last logged. */
+	u32 Fus_u32EvidenceTime;	/**< us, capture time of the last evidence. */
+	u32 Fus_u32LastCapture;		/**< us, capture time of the last detection taken. */
+}FUS_TRACK_t;
+
+#endif /* SERVICE_FUSION_FUSION_PRIVATE_H_ */
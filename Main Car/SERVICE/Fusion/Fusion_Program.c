@@ -0,0 +1,195 @@
+/******************************************************************************
+ *
+ * @File: Fusion_Program.c
+ *
+ * @Brief: Implementation of functions for the Fusion (camera / ultrasonic) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+
+/*******************************************************************************
+ *                          	HAL Components                                 *
+ *******************************************************************************/
+#include "../../HAL/Ultrasonic/Ultrasonic_Interface.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../Trace/Trace_Interface.h"
+#include "../Ttc/Ttc_Interface.h"
+#include "../Camera/Camera_Interface.h"
+#include "Fusion_Interface.h"
+#include "Fusion_Config.h"
+#include "Fusion_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+static FUS_TRACK_t SFUS_strForward;
+
+/*******************************************************************************
+ *                          	Private Functions                              *
+ *******************************************************************************/
+/**
+ * @brief Check that a vehicle box can be the target of the track.
+ *
+ * @return 1 if the box reaches into the beam and has the width of a car at the track range.
+ */
+static u8 SFUS_u8IsMatch(const SCAM_DETECTION_t * P_strDetection, u16 Copy_u16RangeCm)
+{
+	s16 L_s16Bearing = P_strDetection->Det_s8Bearing;
+	u32 L_u32Seen = (u32)P_strDetection->Det_u8Width * Copy_u16RangeCm;
+	u32 L_u32Expected = (u32)FUS_DEG_PER_RAD * FUS_VEHICLE_WIDTH_CM;
+
+	if (L_s16Bearing < 0)
+	{
+		L_s16Bearing = -L_s16Bearing;
+	}
+	if ((L_s16Bearing - (P_strDetection->Det_u8Width / 2)) > FUS_BEAM_HALF_DEG)
+	{
+		return 0;
+	}
+	return ((L_u32Seen * FUS_WIDTH_RATIO) >= L_u32Expected) && (L_u32Seen <= (L_u32Expected * FUS_WIDTH_RATIO));
+}
+
+/**
+ * @brief Add the evidence of a detection to the score of the track.
+ */
+static void SFUS_voidAddEvidence(const SCAM_DETECTION_t * P_strDetection, u16 Copy_u16RangeCm)
+{
+	s16 L_s16Evidence;
+
+	if (P_strDetection->Det_u8Class == SCAM_CLASS_VEHICLE)
+	{
+		L_s16Evidence = SFUS_u8IsMatch(P_strDetection, Copy_u16RangeCm) ? (s16)P_strDetection->Det_u8Confidence : -FUS_MISMATCH_EVIDENCE;
+	}
+	else
+	{
+		// the ultrasonic sees something the camera doesn't recognize
+		L_s16Evidence = -FUS_NONE_EVIDENCE;
+	}
+
+	SFUS_strForward.Fus_s16Score += L_s16Evidence;
+	if (SFUS_strForward.Fus_s16Score > FUS_MAX_SCORE)
+	{
+		SFUS_strForward.Fus_s16Score = FUS_MAX_SCORE;
+	}
+	else if (SFUS_strForward.Fus_s16Score < -FUS_MAX_SCORE)
+	{
+		SFUS_strForward.Fus_s16Score = -FUS_MAX_SCORE;
+	}
+	SFUS_strForward.Fus_u32EvidenceTime = P_strDetection->Det_u32CaptureTime;
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Initialize the module.
+ */
+void SFUS_voidInit(void)
+{
+	SFUS_strForward.Fus_u8Valid = 0;
+	SFUS_strForward.Fus_s16Score = 0;
+	SFUS_strForward.Fus_u8Class = SFUS_CLASS_UNKNOWN;
+	SFUS_strForward.Fus_u32LastCapture = 0;
+}
+
+/**
+ * @brief Match the new camera detection with the forward track.
+ *
+ * A new track starts with no evidence. A detection is taken once, when a
+ * reading of the track is close enough to its capture: a detection captured
+ * too long after the last reading waits for the next one.
+ */
+void SFUS_voidTask(void)
+{
+	STTC_RANGE_t L_strRange;
+	SCAM_DETECTION_t L_strDetection;
+	s32 L_s32GapUs;
+	u8 L_u8Class;
+
+	if (STTC_u8GetRange(FORWARD_US, &L_strRange) != OK)
+	{
+		SFUS_strForward.Fus_u8Valid = 0;
+	}
+	else
+	{
+		if ((SFUS_strForward.Fus_u8Valid == 0) || (L_strRange.Range_u8Track != SFUS_strForward.Fus_u8Track))
+		{
+			SFUS_strForward.Fus_u8Valid = 1;
+			SFUS_strForward.Fus_u8Track = L_strRange.Range_u8Track;
+			SFUS_strForward.Fus_s16Score = 0;
+		}
+
+		if ((SCAM_u8GetDetection(&L_strDetection, FUS_MAX_EVIDENCE_AGE_MS) == OK) &&
+			(L_strDetection.Det_u32CaptureTime != SFUS_strForward.Fus_u32LastCapture))
+		{
+			L_s32GapUs = (s32)(L_strDetection.Det_u32CaptureTime - L_strRange.Range_u32Time);
+			if (L_s32GapUs <= (s32)(FUS_MAX_GAP_MS * FUS_US_PER_MS))
+			{
+				SFUS_strForward.Fus_u32LastCapture = L_strDetection.Det_u32CaptureTime;
+				if (L_s32GapUs >= -(s32)(FUS_MAX_GAP_MS * FUS_US_PER_MS))
+				{
+					SFUS_voidAddEvidence(&L_strDetection, L_strRange.Range_u16Cm);
+				}
+			}
+		}
+	}
+
+	// the class changes are recorded for the trace dump
+	L_u8Class = SFUS_u8GetClass();
+	if (L_u8Class != SFUS_strForward.Fus_u8Class)
+	{
+		SFUS_strForward.Fus_u8Class = L_u8Class;
+		STRACE_voidLog(STRACE_EVT_FUSION_CLASS, L_u8Class, ((u16)SFUS_strForward.Fus_u8Track << 8) | SFUS_u8GetConfidence());
+	}
+}
+
+/**
+ * @brief Get the class of the forward target.
+ */
+u8 SFUS_u8GetClass(void)
+{
+	if ((SFUS_strForward.Fus_u8Valid == 0) || (SFUS_strForward.Fus_s16Score == 0) ||
+		(((MTMR_u32GetMicros() - SFUS_strForward.Fus_u32EvidenceTime) / FUS_US_PER_MS) > FUS_MAX_EVIDENCE_AGE_MS))
+	{
+		return SFUS_CLASS_UNKNOWN;
+	}
+	if (SFUS_strForward.Fus_s16Score >= FUS_DECISION_SCORE)
+	{
+		return SFUS_CLASS_VEHICLE;
+	}
+	if (SFUS_strForward.Fus_s16Score <= -FUS_DECISION_SCORE)
+	{
+		return SFUS_CLASS_OBJECT;
+	}
+	return SFUS_CLASS_UNKNOWN;
+}
+
+/**
+ * @brief Get the confidence of the class of the forward target.
+ */
+u8 SFUS_u8GetConfidence(void)
+{
+	if (SFUS_u8GetClass() == SFUS_CLASS_UNKNOWN)
+	{
+		return 0;
+	}
+	return (u8)((SFUS_strForward.Fus_s16Score < 0) ? -SFUS_strForward.Fus_s16Score : SFUS_strForward.Fus_s16Score);
+}
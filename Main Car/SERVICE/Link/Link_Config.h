@@ -0,0 +1,68 @@
+/******************************************************************************
+ *
+ * @file Link_Config.h
+ *
+ * @brief Configuration file for the Link (reliable transport) module.
+ *
+ * The request / answer messages exchanged with the Raspberry are numbered and
+ * acknowledged, so several of them can be on the link at once instead of one
+ * handshake byte waiting for the other. Each logical channel (camera, V2V
+ * queries, telemetry) has its own numbering and queues.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_LINK_LINK_CONFIG_H_
+#define SERVICE_LINK_LINK_CONFIG_H_
+
+/**
+ * @brief Number of logical channels (at most 16).
+ *
+ * The channels are served in their number order: a frame of a channel is only
+ * sent when the channels before it have nothing to send.
+ */
+#define LNK_CHANNEL_COUNT			3
+
+/**
+ * @brief Send window of each channel: messages not acknowledged yet (power of two, at most 64).
+ *
+ * The same number of messages received out of order is kept until the missing
+ * one is sent again.
+ */
+#define LNK_WINDOW_SIZE				4
+
+/**
+ * @brief Largest message in bytes.
+ *
+ * A frame takes LNK_MAX_PAYLOAD + 7 bytes, about 16 ms of the 9600 baud link.
+ */
+#define LNK_MAX_PAYLOAD				8
+
+/**
+ * @brief Retransmission.
+ *
+ * A message that is not acknowledged after LNK_RETRY_MS is sent again alone,
+ * the ones after it are not. After LNK_MAX_RETRIES the other side is taken as
+ * restarted: the messages in flight on that channel are dropped and its
+ * sequence is reset.
+ */
+#define LNK_RETRY_MS				80
+#define LNK_MAX_RETRIES				5
+
+/**
+ * @brief Number of received messages of each channel waiting for the application (power of two).
+ *
+ * When it is full, the messages stay in the receive window of the channel and
+ * are not acknowledged, so the other side sends them again later. The other
+ * channels go on.
+ */
+#define LNK_RX_QUEUE_SIZE			4
+
+/**
+ * @brief Number of frames waiting for the task after the USART1 interrupt (power of two).
+ */
+#define LNK_RX_FRAMES				8
+
+#endif /* SERVICE_LINK_LINK_CONFIG_H_ */
@@ -0,0 +1,598 @@
+/******************************************************************************
+ *
+ * @File: Link_Program.c
+ *
+ * @Brief: Implementation of functions for the Link (reliable transport) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+#include "../../MCAL/USART/USART_Interface.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../Trace/Trace_Interface.h"
+#include "Link_Interface.h"
+#include "Link_Config.h"
+#include "Link_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+/* windows and queues of the channels */
+static LNK_CHANNEL_t SLNK_AstrChannels[LNK_CHANNEL_COUNT];
+
+/* frames queued by the USART1 interrupt for the task */
+static volatile LNK_FRAME_t SLNK_AstrRxFrames[LNK_RX_FRAMES];
+static volatile u8 SLNK_u8FrameHead = 0;
+static volatile u8 SLNK_u8FrameTail = 0;
+
+/* receive parser, interrupt context only */
+static LNK_RX_STATE_t SLNK_RxState = LNK_RX_SYNC;
+static LNK_FRAME_t SLNK_strRxFrame;
+static u8 SLNK_u8RxIndex;
+static u8 SLNK_u8RxChecksum;
+
+/*******************************************************************************
+ *                          	Private Functions                              *
+ *******************************************************************************/
+/**
+ * @brief Frame a message of a channel and queue it on the Raspberry link.
+ *
+ * Every frame acknowledges the messages of the channel received so far.
+ *
+ * @return The result of the USART1 queuing.
+ */
+static u8 SLNK_u8SendFrame(u8 Copy_u8Type, u8 Copy_u8Channel, u8 Copy_u8Seq, const u8 * P_u8Payload, u8 Copy_u8Length)
+{
+	LNK_CHANNEL_t * L_pstrChannel = &SLNK_AstrChannels[Copy_u8Channel];
+	u8 L_Au8Frame[LNK_MAX_PAYLOAD + LNK_FRAME_OVERHEAD];
+	u8 L_u8Checksum;
+	u8 L_u8Index;
+	u8 L_u8State;
+
+	L_Au8Frame[0] = LNK_SYNC_BYTE;
+	L_Au8Frame[1] = Copy_u8Type;
+	L_Au8Frame[2] = Copy_u8Channel;
+	L_Au8Frame[3] = Copy_u8Seq;
+	L_Au8Frame[4] = L_pstrChannel->Chn_u8RxExpected;
+	L_Au8Frame[5] = Copy_u8Length;
+	L_u8Checksum = Copy_u8Type ^ Copy_u8Channel ^ Copy_u8Seq ^ L_pstrChannel->Chn_u8RxExpected ^ Copy_u8Length;
+	for (L_u8Index = 0; L_u8Index < Copy_u8Length; L_u8Index++)
+	{
+		L_Au8Frame[6 + L_u8Index] = P_u8Payload[L_u8Index];
+		L_u8Checksum ^= P_u8Payload[L_u8Index];
+	}
+	L_Au8Frame[6 + Copy_u8Length] = L_u8Checksum;
+
+	L_u8State = MUSART1_u8QueueData(L_Au8Frame, Copy_u8Length + LNK_FRAME_OVERHEAD);
+	if (L_u8State == OK)
+	{
+		// the acknowledge went with the frame
+		L_pstrChannel->Chn_u8AckPending = 0;
+	}
+	return L_u8State;
+}
+
+/**
+ * @brief Send a message of the send window of a channel.
+ *
+ * @return The result of the USART1 queuing.
+ */
+static u8 SLNK_u8SendSlot(u8 Copy_u8Channel, u8 Copy_u8Seq)
+{
+	LNK_TX_SLOT_t * L_pstrSlot = &SLNK_AstrChannels[Copy_u8Channel].Chn_AstrTxWindow[Copy_u8Seq & LNK_WINDOW_MASK];
+	u8 L_u8State;
+
+	L_u8State = SLNK_u8SendFrame(LNK_TYPE_DATA, Copy_u8Channel, Copy_u8Seq, L_pstrSlot->Tx_Au8Payload, L_pstrSlot->Tx_u8Length);
+	if (L_u8State == OK)
+	{
+		L_pstrSlot->Tx_u32SentTime = MTMR_u32GetMicros();
+	}
+	return L_u8State;
+}
+
+/**
+ * @brief Drop the messages in flight on a channel and restart its sequence on both sides.
+ */
+static void SLNK_voidReset(u8 Copy_u8Channel)
+{
+	LNK_CHANNEL_t * L_pstrChannel = &SLNK_AstrChannels[Copy_u8Channel];
+
+	STRACE_voidLog(STRACE_EVT_LINK_RESET, L_pstrChannel->Chn_u8TxNext,
+			((u16)Copy_u8Channel << 8) | (u8)(L_pstrChannel->Chn_u8TxNext - L_pstrChannel->Chn_u8TxBase));
+	L_pstrChannel->Chn_u8TxBase = L_pstrChannel->Chn_u8TxNext;
+	L_pstrChannel->Chn_u8TxSent = L_pstrChannel->Chn_u8TxNext;
+	L_pstrChannel->Chn_u8ResetPending = 1;
+}
+
+/**
+ * @brief Send the pending RESET of a channel.
+ *
+ * @return OK when no RESET is left to send, NOK when the FIFO is full.
+ */
+static u8 SLNK_u8SendReset(u8 Copy_u8Channel)
+{
+	LNK_CHANNEL_t * L_pstrChannel = &SLNK_AstrChannels[Copy_u8Channel];
+
+	if (L_pstrChannel->Chn_u8ResetPending)
+	{
+		if (SLNK_u8SendFrame(LNK_TYPE_RESET, Copy_u8Channel, L_pstrChannel->Chn_u8TxNext, NULL, 0) != OK)
+		{
+			return NOK;
+		}
+		L_pstrChannel->Chn_u8ResetPending = 0;
+	}
+	return OK;
+}
+
+/**
+ * @brief Send what a channel has to send, as long as the USART1 FIFO takes it.
+ *
+ * Order: the RESET, the messages whose timeout passed, the new messages, then
+ * the acknowledge when no data frame carried it. Only the messages whose own
+ * timeout passed are sent again: the ones after a lost message are kept by the
+ * other side and acknowledged with it. A message out of retries drops the ones
+ * in flight, its RESET goes before the new messages.
+ *
+ * @return OK when the channel has nothing left to send now, NOK when the FIFO is full.
+ */
+static u8 SLNK_u8ServeChannel(u8 Copy_u8Channel, u32 Copy_u32Now)
+{
+	LNK_CHANNEL_t * L_pstrChannel = &SLNK_AstrChannels[Copy_u8Channel];
+	LNK_TX_SLOT_t * L_pstrSlot;
+	u8 L_u8Seq;
+
+	if (SLNK_u8SendReset(Copy_u8Channel) != OK)
+	{
+		return NOK;
+	}
+
+	for (L_u8Seq = L_pstrChannel->Chn_u8TxBase; L_u8Seq != L_pstrChannel->Chn_u8TxSent; L_u8Seq++)
+	{
+		L_pstrSlot = &L_pstrChannel->Chn_AstrTxWindow[L_u8Seq & LNK_WINDOW_MASK];
+		if ((Copy_u32Now - L_pstrSlot->Tx_u32SentTime) >= (LNK_RETRY_MS * LNK_US_PER_MS))
+		{
+			if (L_pstrSlot->Tx_u8Retries >= LNK_MAX_RETRIES)
+			{
+				SLNK_voidReset(Copy_u8Channel);
+				break;
+			}
+			if (SLNK_u8SendSlot(Copy_u8Channel, L_u8Seq) != OK)
+			{
+				return NOK;
+			}
+			L_pstrSlot->Tx_u8Retries++;
+			STRACE_voidLog(STRACE_EVT_LINK_RETRY, L_u8Seq, ((u16)Copy_u8Channel << 8) | L_pstrSlot->Tx_u8Retries);
+		}
+	}
+
+	// the reset of a message out of retries
+	if (SLNK_u8SendReset(Copy_u8Channel) != OK)
+	{
+		return NOK;
+	}
+
+	while (L_pstrChannel->Chn_u8TxSent != L_pstrChannel->Chn_u8TxNext)
+	{
+		if (SLNK_u8SendSlot(Copy_u8Channel, L_pstrChannel->Chn_u8TxSent) != OK)
+		{
+			return NOK;
+		}
+		L_pstrChannel->Chn_u8TxSent++;
+	}
+
+	if (L_pstrChannel->Chn_u8AckPending)
+	{
+		if (SLNK_u8SendFrame(LNK_TYPE_ACK, Copy_u8Channel, 0, NULL, 0) != OK)
+		{
+			return NOK;
+		}
+	}
+	return OK;
+}
+
+/**
+ * @brief Serve the channels by priority.
+ *
+ * When the FIFO is full, the channels after the one that filled it wait for
+ * the next call: a slow channel only takes the room left by the ones before it.
+ */
+static void SLNK_voidTransmit(void)
+{
+	u32 L_u32Now = MTMR_u32GetMicros();
+	u8 L_u8Channel;
+
+	for (L_u8Channel = 0; L_u8Channel < LNK_CHANNEL_COUNT; L_u8Channel++)
+	{
+		if (SLNK_u8ServeChannel(L_u8Channel, L_u32Now) != OK)
+		{
+			break;
+		}
+	}
+}
+
+/**
+ * @brief Move the messages of a channel received in order to the queue of the application.
+ *
+ * The acknowledge only moves when the queue takes the message.
+ */
+static void SLNK_voidDeliver(LNK_CHANNEL_t * P_strChannel)
+{
+	u8 L_u8Slot = P_strChannel->Chn_u8RxExpected & LNK_WINDOW_MASK;
+
+	while (P_strChannel->Chn_Au8RxValid[L_u8Slot]
+			&& ((u8)(P_strChannel->Chn_u8RxQueueHead - P_strChannel->Chn_u8RxQueueTail) < LNK_RX_QUEUE_SIZE))
+	{
+		P_strChannel->Chn_AstrRxQueue[P_strChannel->Chn_u8RxQueueHead & LNK_RX_QUEUE_MASK] = P_strChannel->Chn_AstrRxWindow[L_u8Slot];
+		P_strChannel->Chn_u8RxQueueHead++;
+		P_strChannel->Chn_Au8RxValid[L_u8Slot] = 0;
+		P_strChannel->Chn_u8RxExpected++;
+		L_u8Slot = P_strChannel->Chn_u8RxExpected & LNK_WINDOW_MASK;
+	}
+}
+
+/**
+ * @brief Handle a received frame.
+ */
+static void SLNK_voidHandleFrame(const LNK_FRAME_t * P_strFrame)
+{
+	LNK_CHANNEL_t * L_pstrChannel = &SLNK_AstrChannels[P_strFrame->Frame_u8Channel];
+	u8 L_u8Slot;
+	u8 L_u8Index;
+
+	// cumulative acknowledge: everything before Ack is received, an old one is ignored
+	if ((u8)(P_strFrame->Frame_u8Ack - L_pstrChannel->Chn_u8TxBase) <= (u8)(L_pstrChannel->Chn_u8TxSent - L_pstrChannel->Chn_u8TxBase))
+	{
+		L_pstrChannel->Chn_u8TxBase = P_strFrame->Frame_u8Ack;
+	}
+
+	if (P_strFrame->Frame_u8Type == LNK_TYPE_RESET)
+	{
+		L_pstrChannel->Chn_u8RxExpected = P_strFrame->Frame_u8Seq;
+		for (L_u8Index = 0; L_u8Index < LNK_WINDOW_SIZE; L_u8Index++)
+		{
+			L_pstrChannel->Chn_Au8RxValid[L_u8Index] = 0;
+		}
+		L_pstrChannel->Chn_u8AckPending = 1;
+	}
+	else if (P_strFrame->Frame_u8Type == LNK_TYPE_DATA)
+	{
+		// in the window: kept even out of order, a copy already received is only acknowledged again
+		if ((u8)(P_strFrame->Frame_u8Seq - L_pstrChannel->Chn_u8RxExpected) < LNK_WINDOW_SIZE)
+		{
+			L_u8Slot = P_strFrame->Frame_u8Seq & LNK_WINDOW_MASK;
+			if (L_pstrChannel->Chn_Au8RxValid[L_u8Slot] == 0)
+			{
+				L_pstrChannel->Chn_AstrRxWindow[L_u8Slot].Msg_u8Length = P_strFrame->Frame_u8Length;
+				for (L_u8Index = 0; L_u8Index < P_strFrame->Frame_u8Length; L_u8Index++)
+				{
+					L_pstrChannel->Chn_AstrRxWindow[L_u8Slot].Msg_Au8Payload[L_u8Index] = P_strFrame->Frame_Au8Payload[L_u8Index];
+				}
+				L_pstrChannel->Chn_Au8RxValid[L_u8Slot] = 1;
+			}
+		}
+		L_pstrChannel->Chn_u8AckPending = 1;
+	}
+	else
+	{
+		// acknowledge only
+	}
+}
+
+/**
+ * @brief Handle the frames queued by the interrupt.
+ */
+static void SLNK_voidDrainFrames(void)
+{
+	LNK_FRAME_t L_strFrame;
+	u8 L_u8Channel;
+
+	while (SLNK_u8FrameTail != SLNK_u8FrameHead)
+	{
+		L_strFrame = SLNK_AstrRxFrames[SLNK_u8FrameTail & LNK_RX_FRAMES_MASK];
+		SLNK_u8FrameTail++;
+		SLNK_voidHandleFrame(&L_strFrame);
+	}
+	for (L_u8Channel = 0; L_u8Channel < LNK_CHANNEL_COUNT; L_u8Channel++)
+	{
+		SLNK_voidDeliver(&SLNK_AstrChannels[L_u8Channel]);
+	}
+}
+
+/**
+ * @brief USART1 receive hook (interrupt context).
+ *
+ * @return 1 if the byte belongs to a link frame, 0 if not.
+ */
+static u8 SLNK_u8RxHook(u8 Copy_u8Data)
+{
+	u8 L_u8Consumed = 1;
+	u8 L_u8Head;
+
+	switch (SLNK_RxState)
+	{
+	case LNK_RX_SYNC:
+		if (Copy_u8Data == LNK_SYNC_BYTE)
+		{
+			SLNK_RxState = LNK_RX_TYPE;
+		}
+		else
+		{
+			L_u8Consumed = 0;
+		}
+		break;
+
+	case LNK_RX_TYPE:
+		SLNK_strRxFrame.Frame_u8Type = Copy_u8Data;
+		SLNK_u8RxChecksum = Copy_u8Data;
+		SLNK_RxState = LNK_RX_CHANNEL;
+		break;
+
+	case LNK_RX_CHANNEL:
+		SLNK_strRxFrame.Frame_u8Channel = Copy_u8Data;
+		SLNK_u8RxChecksum ^= Copy_u8Data;
+		// a channel this side doesn't have: the frame is dropped
+		SLNK_RxState = (Copy_u8Data < LNK_CHANNEL_COUNT) ? LNK_RX_SEQ : LNK_RX_SYNC;
+		break;
+
+	case LNK_RX_SEQ:
+		SLNK_strRxFrame.Frame_u8Seq = Copy_u8Data;
+		SLNK_u8RxChecksum ^= Copy_u8Data;
+		SLNK_RxState = LNK_RX_ACK;
+		break;
+
+	case LNK_RX_ACK:
+		SLNK_strRxFrame.Frame_u8Ack = Copy_u8Data;
+		SLNK_u8RxChecksum ^= Copy_u8Data;
+		SLNK_RxState = LNK_RX_LENGTH;
+		break;
+
+	case LNK_RX_LENGTH:
+		SLNK_strRxFrame.Frame_u8Length = Copy_u8Data;
+		SLNK_u8RxChecksum ^= Copy_u8Data;
+		SLNK_u8RxIndex = 0;
+		if (Copy_u8Data > LNK_MAX_PAYLOAD)
+		{
+			SLNK_RxState = LNK_RX_SYNC;
+		}
+		else if (Copy_u8Data == 0)
+		{
+			SLNK_RxState = LNK_RX_CHECKSUM;
+		}
+		else
+		{
+			SLNK_RxState = LNK_RX_PAYLOAD;
+		}
+		break;
+
+	case LNK_RX_PAYLOAD:
+		SLNK_strRxFrame.Frame_Au8Payload[SLNK_u8RxIndex++] = Copy_u8Data;
+		SLNK_u8RxChecksum ^= Copy_u8Data;
+		if (SLNK_u8RxIndex >= SLNK_strRxFrame.Frame_u8Length)
+		{
+			SLNK_RxState = LNK_RX_CHECKSUM;
+		}
+		break;
+
+	case LNK_RX_CHECKSUM:
+		L_u8Head = SLNK_u8FrameHead;
+		// a frame the task has no room for is lost, it is sent again
+		if ((Copy_u8Data == SLNK_u8RxChecksum) && ((u8)(L_u8Head - SLNK_u8FrameTail) < LNK_RX_FRAMES))
+		{
+			SLNK_AstrRxFrames[L_u8Head & LNK_RX_FRAMES_MASK] = SLNK_strRxFrame;
+			SLNK_u8FrameHead = L_u8Head + 1;
+		}
+		SLNK_RxState = LNK_RX_SYNC;
+		break;
+
+	default:
+		SLNK_RxState = LNK_RX_SYNC;
+		break;
+	}
+	return L_u8Consumed;
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Initialize the module.
+ *
+ * This function empties the windows and the queues, installs the USART1
+ * receive hook and sends a RESET on every channel so the other side expects
+ * sequence 0.
+ */
+void SLNK_voidInit(void)
+{
+	LNK_CHANNEL_t * L_pstrChannel;
+	u8 L_u8Channel;
+	u8 L_u8Index;
+
+	for (L_u8Channel = 0; L_u8Channel < LNK_CHANNEL_COUNT; L_u8Channel++)
+	{
+		L_pstrChannel = &SLNK_AstrChannels[L_u8Channel];
+		L_pstrChannel->Chn_u8TxBase = 0;
+		L_pstrChannel->Chn_u8TxSent = 0;
+		L_pstrChannel->Chn_u8TxNext = 0;
+		L_pstrChannel->Chn_u8RxExpected = 0;
+		L_pstrChannel->Chn_u8AckPending = 0;
+		for (L_u8Index = 0; L_u8Index < LNK_WINDOW_SIZE; L_u8Index++)
+		{
+			L_pstrChannel->Chn_Au8RxValid[L_u8Index] = 0;
+		}
+		L_pstrChannel->Chn_u8RxQueueHead = 0;
+		L_pstrChannel->Chn_u8RxQueueTail = 0;
+		L_pstrChannel->Chn_u8ResetPending = 1;
+	}
+	SLNK_u8FrameHead = 0;
+	SLNK_u8FrameTail = 0;
+	SLNK_RxState = LNK_RX_SYNC;
+	MUSART1_u8AddRxCallBack(SLNK_u8RxHook);
+
+	SLNK_voidTransmit();
+}
+
+/**
+ * @brief Send a message.
+ *
+ * The message is kept in the send window of its channel until it is
+ * acknowledged, and framed when its channel gets its turn.
+ */
+u8 SLNK_u8Send(u8 Copy_u8Channel, const u8 * P_u8Data, u8 Copy_u8Length)
+{
+	ERROR_STATE_T Loc_ErrorState = OK;
+	LNK_CHANNEL_t * L_pstrChannel;
+	LNK_TX_SLOT_t * L_pstrSlot;
+	u8 L_u8Index;
+
+	if (P_u8Data == NULL)
+	{
+		Loc_ErrorState = NULL_PTR_ERR;
+	}
+	else if ((Copy_u8Channel >= LNK_CHANNEL_COUNT) || (Copy_u8Length == 0) || (Copy_u8Length > LNK_MAX_PAYLOAD))
+	{
+		Loc_ErrorState = OUT_OF_RANGE;
+	}
+	else
+	{
+		// the acknowledges received meanwhile may free the window
+		SLNK_voidDrainFrames();
+		L_pstrChannel = &SLNK_AstrChannels[Copy_u8Channel];
+		if ((u8)(L_pstrChannel->Chn_u8TxNext - L_pstrChannel->Chn_u8TxBase) >= LNK_WINDOW_SIZE)
+		{
+			Loc_ErrorState = NOK;
+		}
+		else
+		{
+			L_pstrSlot = &L_pstrChannel->Chn_AstrTxWindow[L_pstrChannel->Chn_u8TxNext & LNK_WINDOW_MASK];
+			L_pstrSlot->Tx_u8Length = Copy_u8Length;
+			L_pstrSlot->Tx_u8Retries = 0;
+			for (L_u8Index = 0; L_u8Index < Copy_u8Length; L_u8Index++)
+			{
+				L_pstrSlot->Tx_Au8Payload[L_u8Index] = P_u8Data[L_u8Index];
+				STRACE_voidLog(STRACE_EVT_LINK_MSG_TX, Copy_u8Length - 1 - L_u8Index, ((u16)Copy_u8Channel << 8) | P_u8Data[L_u8Index]);
+			}
+			L_pstrChannel->Chn_u8TxNext++;
+			SLNK_voidTransmit();
+		}
+	}
+	return Loc_ErrorState;
+}
+
+/**
+ * @brief Take the oldest received message of a channel.
+ */
+u8 SLNK_u8Receive(u8 Copy_u8Channel, u8 * P_u8Data, u8 * P_u8Length)
+{
+	ERROR_STATE_T Loc_ErrorState = OK;
+	LNK_CHANNEL_t * L_pstrChannel;
+	LNK_MSG_t * L_pstrMsg;
+	u8 L_u8Index;
+
+	if ((P_u8Data == NULL) || (P_u8Length == NULL))
+	{
+		Loc_ErrorState = NULL_PTR_ERR;
+	}
+	else if (Copy_u8Channel >= LNK_CHANNEL_COUNT)
+	{
+		Loc_ErrorState = OUT_OF_RANGE;
+	}
+	else
+	{
+		SLNK_voidDrainFrames();
+		L_pstrChannel = &SLNK_AstrChannels[Copy_u8Channel];
+		if (L_pstrChannel->Chn_u8RxQueueHead == L_pstrChannel->Chn_u8RxQueueTail)
+		{
+			Loc_ErrorState = NOK;
+		}
+		else
+		{
+			L_pstrMsg = &L_pstrChannel->Chn_AstrRxQueue[L_pstrChannel->Chn_u8RxQueueTail & LNK_RX_QUEUE_MASK];
+			*P_u8Length = L_pstrMsg->Msg_u8Length;
+			for (L_u8Index = 0; L_u8Index < L_pstrMsg->Msg_u8Length; L_u8Index++)
+			{
+				P_u8Data[L_u8Index] = L_pstrMsg->Msg_Au8Payload[L_u8Index];
+				//recording the message for the replay (bytes left after this one)
+				STRACE_voidLog(STRACE_EVT_LINK_MSG_RX, L_pstrMsg->Msg_u8Length - 1 - L_u8Index, ((u16)Copy_u8Channel << 8) | P_u8Data[L_u8Index]);
+			}
+			L_pstrChannel->Chn_u8RxQueueTail++;
+			// the window moves on with the room made in the queue
+			SLNK_voidDeliver(L_pstrChannel);
+		}
+	}
+	return Loc_ErrorState;
+}
+
+/**
+ * @brief Periodic task.
+ */
+void SLNK_voidTask(void)
+{
+	SLNK_voidDrainFrames();
+	SLNK_voidTransmit();
+}
+
+/**
+ * @brief Check for received frames the task has not handled yet.
+ */
+u8 SLNK_u8IsRxPending(void)
+{
+	return (SLNK_u8FrameHead != SLNK_u8FrameTail);
+}
+
+/**
+ * @brief Get the time left before the task has something to do.
+ */
+u32 SLNK_u32GetIdleTime(void)
+{
+	u32 L_u32Now = MTMR_u32GetMicros();
+	u32 L_u32Elapsed;
+	u32 L_u32Idle = LNK_NO_DEADLINE;
+	LNK_CHANNEL_t * L_pstrChannel;
+	u8 L_u8Channel;
+	u8 L_u8Seq;
+
+	if (SLNK_u8FrameHead != SLNK_u8FrameTail)
+	{
+		return 0;
+	}
+
+	for (L_u8Channel = 0; L_u8Channel < LNK_CHANNEL_COUNT; L_u8Channel++)
+	{
+		L_pstrChannel = &SLNK_AstrChannels[L_u8Channel];
+		if (L_pstrChannel->Chn_u8AckPending || L_pstrChannel->Chn_u8ResetPending
+				|| (L_pstrChannel->Chn_u8TxSent != L_pstrChannel->Chn_u8TxNext))
+		{
+			return 0;
+		}
+		for (L_u8Seq = L_pstrChannel->Chn_u8TxBase; L_u8Seq != L_pstrChannel->Chn_u8TxSent; L_u8Seq++)
+		{
+			L_u32Elapsed = L_u32Now - L_pstrChannel->Chn_AstrTxWindow[L_u8Seq & LNK_WINDOW_MASK].Tx_u32SentTime;
+			if (L_u32Elapsed >= (LNK_RETRY_MS * LNK_US_PER_MS))
+			{
+				return 0;
+			}
+			if (((LNK_RETRY_MS * LNK_US_PER_MS) - L_u32Elapsed) < L_u32Idle)
+			{
+				L_u32Idle = (LNK_RETRY_MS * LNK_US_PER_MS) - L_u32Elapsed;
+			}
+		}
+	}
+	return L_u32Idle;
+}
@@ -0,0 +1,83 @@
+/******************************************************************************
+ *
+ * @file Manoeuvre_Config.h
+ *
+ * @brief Configuration file for the Manoeuvre (overtake planner) module.
+ *
+ * The overtake is planned from the speeds, the gap to the car ahead and the
+ * lane width, with the turn radius of the car given by the odometry model
+ * (SERVICE/Odometry).
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_MANOEUVRE_MANOEUVRE_CONFIG_H_
+#define SERVICE_MANOEUVRE_MANOEUVRE_CONFIG_H_
+
+/**
+ * @brief Length of the cars in mm (this car and the car passed).
+ */
+#define MAN_OWN_LENGTH_MM			250
+#define MAN_LEAD_LENGTH_MM			250
+
+/**
+ * @brief Distance kept to the rear of the car ahead while leaving its lane (mm).
+ *
+ * The overtake is refused when the lane change would bring the car closer.
+ */
+#define MAN_MIN_GAP_MM				100
+
+/**
+ * @brief Distance between the rear of this car and the front of the passed car when merging back (mm).
+ */
+#define MAN_MERGE_CLEARANCE_MM		150
+
+/**
+ * @brief Heading of the lane changes in degrees.
+ *
+ * A lane change is an arc to this heading, a straight line, and an arc back.
+ * The shallowest one is taken first, it is made steeper by MAN_ANGLE_STEP_DEG
+ * up to MAN_MAX_ANGLE_DEG when the gap to the car ahead is too short. The
+ * angle is reduced when the two arcs alone already cross the lane.
+ */
+#define MAN_MIN_ANGLE_DEG			30
+#define MAN_MAX_ANGLE_DEG			80
+#define MAN_ANGLE_STEP_DEG			5
+
+/**
+ * @brief Command of the inner side in the forward turns of the motor driver (% of the outer side).
+ *
+ * The lane changes use the forward turns, and the turns on one side (inner
+ * side stopped, shorter radius) when the gap is too short for them.
+ */
+#define MAN_ARC_INNER_PERCENT		40
+
+/**
+ * @brief Largest lateral acceleration in the arcs (mm/s^2).
+ *
+ * The lane changes are driven at the highest speed level that keeps under it.
+ */
+#define MAN_MAX_LATERAL_MM_S2		1500
+
+/**
+ * @brief Speed levels (1000 of PWM compare) of the manoeuvre.
+ *
+ * The car passes at MAN_PASS_MARGIN_LEVELS above the car ahead, at least at
+ * its own level, within MAN_MIN_LEVEL (below it the motors stall) and
+ * MAN_MAX_LEVEL.
+ */
+#define MAN_PASS_MARGIN_LEVELS		4
+#define MAN_MIN_LEVEL				3
+#define MAN_MAX_LEVEL				9
+
+/**
+ * @brief Time given to each step before the next one is taken (% of the planned time).
+ *
+ * At least MAN_TIMEOUT_MIN_MS, so a step that the model gets wrong still ends.
+ */
+#define MAN_TIMEOUT_PERCENT			200
+#define MAN_TIMEOUT_MIN_MS			200
+
+#endif /* SERVICE_MANOEUVRE_MANOEUVRE_CONFIG_H_ */
@@ -0,0 +1,103 @@
+/******************************************************************************
+ *
+ * @file Manoeuvre_Interface.h
+ *
+ * @brief Interface file for the Manoeuvre (overtake planner) module.
+ *
+ * Plans an overtake as a schedule of motor steps: a lane change to the free
+ * lane (arc, line, arc back to the road heading), the pass, and a lane change
+ * back in front of the passed car. The shape of the lane changes comes from
+ * the lane width and the turn radius of the car, their speed from the lateral
+ * acceleration limit, and the length of the pass from the gap and the speeds
+ * of both cars: the faster the cars, the shorter the steps.
+ *
+ * The steps end on the pose of the odometry (heading reached or distance
+ * driven), not on time, so they hold at any speed. The application drives
+ * the steps.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_MANOEUVRE_MANOEUVRE_INTERFACE_H_
+#define SERVICE_MANOEUVRE_MANOEUVRE_INTERFACE_H_
+
+/**
+ * @brief Side of the overtake.
+ */
+#define SMAN_SIDE_RIGHT				0
+#define SMAN_SIDE_LEFT				1
+
+/**
+ * @brief How a step ends.
+ */
+#define SMAN_END_TURN_LEFT			0	/**< The heading reached the target turning left. */
+#define SMAN_END_TURN_RIGHT			1	/**< The heading reached the target turning right. */
+#define SMAN_END_TRAVEL				2	/**< The car drove the distance of the step. */
+
+/**
+ * @brief Step flags.
+ */
+#define SMAN_FLAG_SIDE_CLEAR		0x01	/**< The step goes on while the passed car is still seen beside. */
+
+#define SMAN_MAX_STEPS				7
+
+/**
+ * @brief Data the overtake is planned on.
+ */
+typedef struct
+{
+	u8  Request_u8Side;				/**< SMAN_SIDE_RIGHT or SMAN_SIDE_LEFT. */
+	u8  Request_u8OwnLevel;			/**< Speed level of this car (0 to 9). */
+	u16 Request_u16LeadSpeed;		/**< Speed of the car ahead in mm/s. */
+	u16 Request_u16Gap;				/**< Distance to the rear of the car ahead in mm. */
+	u16 Request_u16LaneWidth;		/**< Distance between the lane centers in mm. */
+}SMAN_REQUEST_t;
+
+/**
+ * @brief Step of the motor schedule.
+ */
+typedef struct
+{
+	u8  Step_u8Order;				/**< Motor order (HDCM_u8CarState). */
+	u8  Step_u8Level;				/**< Speed level (HDCM_u8ChangeSpeed). */
+	u8  Step_u8End;					/**< SMAN_END_... */
+	u8  Step_u8Flags;				/**< SMAN_FLAG_... */
+	s16 Step_s16Heading;			/**< Target heading from the heading at the start of the overtake (binary angle). */
+	u16 Step_u16Travel;				/**< Distance of the step in mm (SMAN_END_TRAVEL). */
+	u32 Step_u32Timeout;			/**< Time after which the next step is taken in us. */
+}SMAN_STEP_t;
+
+/**
+ * @brief Overtake schedule.
+ */
+typedef struct
+{
+	SMAN_STEP_t Plan_AstrSteps[SMAN_MAX_STEPS];
+	u8  Plan_u8Count;
+	u32 Plan_u32Duration;			/**< Planned time of the whole overtake in ms. */
+}SMAN_PLAN_t;
+
+/**
+ * @brief Plan an overtake.
+ *
+ * @param P_Request The speeds, the gap and the lane width.
+ * @param P_Plan    Where the schedule is written.
+ * @return OK, NOK if the gap is too short to leave the lane or the car can't go
+ *         faster than the car ahead, NULL_PTR_ERR.
+ */
+u8 SMAN_u8PlanOvertake(const SMAN_REQUEST_t * P_Request, SMAN_PLAN_t * P_Plan);
+
+/**
+ * @brief Check if a step is done.
+ *
+ * @param P_Step          The step.
+ * @param Copy_u16Heading Heading of the car at the start of the overtake (binary angle).
+ * @param Copy_s32Travel  Distance driven by the car at the start of the step (Pose_s32Travel).
+ * @param P_Pose          The pose of the car now.
+ * @return 1 if the end of the step is reached, 0 if not.
+ */
+u8 SMAN_u8IsStepDone(const SMAN_STEP_t * P_Step, u16 Copy_u16Heading, s32 Copy_s32Travel, const SODO_POSE_t * P_Pose);
+
+#endif /* SERVICE_MANOEUVRE_MANOEUVRE_INTERFACE_H_ */
@@ -0,0 +1,82 @@
+/******************************************************************************
+ *
+ * @File: Manoeuvre_Private.h
+ *
+ * @Brief: Private definitions for the Manoeuvre (overtake planner) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_MANOEUVRE_MANOEUVRE_PRIVATE_H_
+#define SERVICE_MANOEUVRE_MANOEUVRE_PRIVATE_H_
+
+#if (MAN_MIN_LEVEL < 1) || (MAN_MAX_LEVEL > 9) || (MAN_MIN_LEVEL > MAN_MAX_LEVEL)
+#error "MAN_MIN_LEVEL and MAN_MAX_LEVEL must be 1 to 9, MAN_MIN_LEVEL first"
+#endif
+
+#if (MAN_ARC_INNER_PERCENT < 0) || (MAN_ARC_INNER_PERCENT >= 100)
+#error "MAN_ARC_INNER_PERCENT must be 0 to 99"
+#endif
+
+#if (MAN_MIN_ANGLE_DEG < 5) || (MAN_MAX_ANGLE_DEG > 85) || (MAN_MIN_ANGLE_DEG > MAN_MAX_ANGLE_DEG) || (MAN_ANGLE_STEP_DEG < 1)
+#error "MAN_MIN_ANGLE_DEG and MAN_MAX_ANGLE_DEG must be 5 to 85, MAN_MIN_ANGLE_DEG first"
+#endif
+
+/**
+ * @brief Command of the inner side in the turns on one side (% of the outer side).
+ */
+#define MAN_PIVOT_INNER_PERCENT	0
+
+/**
+ * @brief Radius of a turn (mm), from the odometry model.
+ *
+ * The outer side goes at v, the inner one at INNER % of v: the car goes at the
+ * mean of both and turns at the difference over the track.
+ */
+#define MAN_TURN_RADIUS(INNER)	((ODO_TRACK_WIDTH_MM * (100L + (INNER)) * 256L) / \
+								 (2L * (100L - (INNER)) * ODO_TURN_FACTOR_Q8))
+
+/**
+ * @brief Speed of the car in a turn for a speed of the outer side.
+ */
+#define MAN_TURN_SPEED(SPEED, INNER)	(((SPEED) * (100L + (INNER))) / 200L)
+
+/**
+ * @brief Binary angles (65536 is a full turn).
+ */
+#define MAN_QUARTER_TURN		16384
+#define MAN_Q15_ONE				32768L
+
+#define MAN_MS_PER_S			1000L
+#define MAN_US_PER_MS			1000L
+
+/**
+ * @brief Steps of the overtake, in order.
+ */
+#define MAN_STEP_OUT_ARC		0
+#define MAN_STEP_OUT_LINE		1
+#define MAN_STEP_OUT_ALIGN		2
+#define MAN_STEP_PASS			3
+#define MAN_STEP_BACK_ARC		4
+#define MAN_STEP_BACK_LINE		5
+#define MAN_STEP_BACK_ALIGN		6
+
+/**
+ * @brief Shape of a lane change.
+ */
+typedef struct
+{
+	u8  Lane_u8Level;				/**< Speed level. */
+	u8  Lane_u8Inner;				/**< Command of the inner side in the turns (%). */
+	s32 Lane_s32Radius;				/**< Radius of the turns in mm. */
+	u16 Lane_u16Angle;				/**< Heading of the line, binary angle. */
+	s32 Lane_s32Line;				/**< Length of the line in mm. */
+	s32 Lane_s32ArcTime;			/**< Time of one arc in ms. */
+	s32 Lane_s32LineTime;			/**< Time of the line in ms. */
+	s32 Lane_s32Advance;			/**< Distance along the road in mm. */
+}MAN_LANE_CHANGE_t;
+
+#endif /* SERVICE_MANOEUVRE_MANOEUVRE_PRIVATE_H_ */
@@ -0,0 +1,296 @@
+/******************************************************************************
+ *
+ * @File: Manoeuvre_Program.c
+ *
+ * @Brief: Implementation of functions for the Manoeuvre (overtake planner) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../Odometry/Odometry_Interface.h"
+#include "../Odometry/Odometry_Config.h"
+#include "Manoeuvre_Interface.h"
+#include "Manoeuvre_Config.h"
+#include "Manoeuvre_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+/* turns of the lane changes, in the order they are tried: forward turns, then turns on one side */
+static const u8 SMAN_Au8TurnInner[2] = {MAN_ARC_INNER_PERCENT, MAN_PIVOT_INNER_PERCENT};
+
+/*******************************************************************************
+ *                          	Private Functions	                           *
+ *******************************************************************************/
+/**
+ * @brief Distance across the road covered by the two arcs of a lane change (mm).
+ */
+static s32 SMAN_s32ArcsWidth(s32 Copy_s32Radius, u16 Copy_u16Angle)
+{
+	s32 L_s32Cosine = SODO_s16Sine((u16)(Copy_u16Angle + MAN_QUARTER_TURN));
+
+	return (2 * Copy_s32Radius * (MAN_Q15_ONE - L_s32Cosine)) / MAN_Q15_ONE;
+}
+
+/**
+ * @brief Highest speed level, up to the given one, that keeps the turns under the lateral acceleration limit.
+ */
+static u8 SMAN_u8TurnLevel(u8 Copy_u8Level, u8 Copy_u8Inner)
+{
+	s32 L_s32Speed;
+
+	while (Copy_u8Level > MAN_MIN_LEVEL)
+	{
+		L_s32Speed = MAN_TURN_SPEED((s32)Copy_u8Level * ODO_SPEED_LEVEL_MM_S, Copy_u8Inner);
+		if ((L_s32Speed * L_s32Speed) <= (MAN_MAX_LATERAL_MM_S2 * MAN_TURN_RADIUS(Copy_u8Inner)))
+		{
+			break;
+		}
+		Copy_u8Level--;
+	}
+	return Copy_u8Level;
+}
+
+/**
+ * @brief Shape and timing of a lane change.
+ *
+ * The two arcs turn to the lane change heading and back, the line between them
+ * covers the rest of the lane width.
+ */
+static void SMAN_voidPlanLaneChange(u8 Copy_u8Level, u8 Copy_u8Inner, u16 Copy_u16Angle, s32 Copy_s32Width, MAN_LANE_CHANGE_t * P_Lane)
+{
+	s32 L_s32Speed = (s32)Copy_u8Level * ODO_SPEED_LEVEL_MM_S;
+	s32 L_s32Radius = MAN_TURN_RADIUS(Copy_u8Inner);
+	u16 L_u16Low = 0;
+	u16 L_u16Middle;
+	s32 L_s32Sine;
+	s32 L_s32Cosine;
+	s32 L_s32Arc;
+
+	// the largest angle whose arcs don't cross the lane alone
+	if (SMAN_s32ArcsWidth(L_s32Radius, Copy_u16Angle) > Copy_s32Width)
+	{
+		while ((Copy_u16Angle - L_u16Low) > 1)
+		{
+			L_u16Middle = (u16)((L_u16Low + Copy_u16Angle) / 2);
+			if (SMAN_s32ArcsWidth(L_s32Radius, L_u16Middle) <= Copy_s32Width)
+			{
+				L_u16Low = L_u16Middle;
+			}
+			else
+			{
+				Copy_u16Angle = L_u16Middle;
+			}
+		}
+		Copy_u16Angle = L_u16Low;
+	}
+
+	L_s32Sine = SODO_s16Sine(Copy_u16Angle);
+	L_s32Cosine = SODO_s16Sine((u16)(Copy_u16Angle + MAN_QUARTER_TURN));
+	P_Lane->Lane_u8Level = Copy_u8Level;
+	P_Lane->Lane_u8Inner = Copy_u8Inner;
+	P_Lane->Lane_s32Radius = L_s32Radius;
+	P_Lane->Lane_u16Angle = Copy_u16Angle;
+	P_Lane->Lane_s32Line = 0;
+	if (L_s32Sine > 0)
+	{
+		P_Lane->Lane_s32Line = ((Copy_s32Width - SMAN_s32ArcsWidth(L_s32Radius, Copy_u16Angle)) * MAN_Q15_ONE) / L_s32Sine;
+	}
+
+	// arc length: radius x angle in radians (2 x pi / 65536 ~ 201 / 2^21)
+	L_s32Arc = ((L_s32Radius * (s32)Copy_u16Angle) / 256 * 201) / 8192;
+	P_Lane->Lane_s32ArcTime = (L_s32Arc * MAN_MS_PER_S) / MAN_TURN_SPEED(L_s32Speed, Copy_u8Inner);
+	P_Lane->Lane_s32LineTime = (P_Lane->Lane_s32Line * MAN_MS_PER_S) / L_s32Speed;
+	P_Lane->Lane_s32Advance = (2 * L_s32Radius * L_s32Sine + P_Lane->Lane_s32Line * L_s32Cosine) / MAN_Q15_ONE;
+}
+
+/**
+ * @brief Fill a step of the schedule.
+ */
+static void SMAN_voidSetStep(SMAN_STEP_t * P_Step, u8 Copy_u8Order, u8 Copy_u8Level, u8 Copy_u8End,
+							 s16 Copy_s16Heading, s32 Copy_s32Travel, s32 Copy_s32Time)
+{
+	u32 L_u32Timeout = ((u32)Copy_s32Time * MAN_TIMEOUT_PERCENT) / 100;
+
+	if (L_u32Timeout < MAN_TIMEOUT_MIN_MS)
+	{
+		L_u32Timeout = MAN_TIMEOUT_MIN_MS;
+	}
+	if (Copy_s32Travel > 0xFFFF)
+	{
+		Copy_s32Travel = 0xFFFF;
+	}
+	P_Step->Step_u8Order = Copy_u8Order;
+	P_Step->Step_u8Level = Copy_u8Level;
+	P_Step->Step_u8End = Copy_u8End;
+	P_Step->Step_u8Flags = 0;
+	P_Step->Step_s16Heading = Copy_s16Heading;
+	P_Step->Step_u16Travel = (u16)Copy_s32Travel;
+	P_Step->Step_u32Timeout = L_u32Timeout * MAN_US_PER_MS;
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Plan an overtake.
+ *
+ * The car must gain on the car ahead its gap, both lengths and the merge
+ * clearance. The lane changes gain what they advance along the road minus
+ * what the car ahead drives meanwhile, the pass gains the rest at the speed
+ * difference.
+ */
+u8 SMAN_u8PlanOvertake(const SMAN_REQUEST_t * P_Request, SMAN_PLAN_t * P_Plan)
+{
+	MAN_LANE_CHANGE_t L_strLane;
+	s32 L_s32Lead;
+	s32 L_s32PassSpeed;
+	s32 L_s32LaneTime;
+	s32 L_s32Gain;
+	s32 L_s32Needed;
+	s32 L_s32PassTime;
+	s32 L_s32PassTravel;
+	u8 L_u8PassLevel;
+	u8 L_u8LaneLevel;
+	u8 L_u8Turn;
+	u8 L_u8Found;
+	u16 L_u16Degrees;
+	u8 L_u8Out;
+	u8 L_u8Back;
+	u8 L_u8OutEnd;
+	u8 L_u8BackEnd;
+	s16 L_s16Angle;
+
+	if ((P_Request == NULL) || (P_Plan == NULL))
+	{
+		return NULL_PTR_ERR;
+	}
+
+	// pass above the car ahead, not slower than now
+	L_s32Lead = P_Request->Request_u16LeadSpeed;
+	L_u8PassLevel = (u8)((L_s32Lead + ODO_SPEED_LEVEL_MM_S - 1) / ODO_SPEED_LEVEL_MM_S) + MAN_PASS_MARGIN_LEVELS;
+	if (L_u8PassLevel < P_Request->Request_u8OwnLevel)
+	{
+		L_u8PassLevel = P_Request->Request_u8OwnLevel;
+	}
+	if (L_u8PassLevel < MAN_MIN_LEVEL)
+	{
+		L_u8PassLevel = MAN_MIN_LEVEL;
+	}
+	if (L_u8PassLevel > MAN_MAX_LEVEL)
+	{
+		L_u8PassLevel = MAN_MAX_LEVEL;
+	}
+	L_s32PassSpeed = (s32)L_u8PassLevel * ODO_SPEED_LEVEL_MM_S;
+	if (L_s32PassSpeed <= L_s32Lead)
+	{
+		return NOK;
+	}
+
+	// the smoothest lane change that leaves the lane before the car ahead,
+	// driven as fast as the lateral acceleration allows
+	L_u8Found = 0;
+	for (L_u8Turn = 0; (L_u8Turn < 2) && (L_u8Found == 0); L_u8Turn++)
+	{
+		L_u8LaneLevel = SMAN_u8TurnLevel(L_u8PassLevel, SMAN_Au8TurnInner[L_u8Turn]);
+		for (L_u16Degrees = MAN_MIN_ANGLE_DEG; (L_u16Degrees <= MAN_MAX_ANGLE_DEG) && (L_u8Found == 0); L_u16Degrees += MAN_ANGLE_STEP_DEG)
+		{
+			SMAN_voidPlanLaneChange(L_u8LaneLevel, SMAN_Au8TurnInner[L_u8Turn], SODO_DEG_TO_ANGLE(L_u16Degrees),
+									P_Request->Request_u16LaneWidth, &L_strLane);
+			L_s32LaneTime = 2 * L_strLane.Lane_s32ArcTime + L_strLane.Lane_s32LineTime;
+			L_s32Gain = L_strLane.Lane_s32Advance - (L_s32Lead * L_s32LaneTime) / MAN_MS_PER_S;
+			L_u8Found = (((s32)P_Request->Request_u16Gap - L_s32Gain) >= MAN_MIN_GAP_MM);
+		}
+	}
+	if (L_u8Found == 0)
+	{
+		return NOK;
+	}
+
+	// when the car ahead gains during the lane change back, the pass makes up for it
+	L_s32Needed = (s32)P_Request->Request_u16Gap + MAN_LEAD_LENGTH_MM + MAN_OWN_LENGTH_MM + MAN_MERGE_CLEARANCE_MM - L_s32Gain;
+	if (L_s32Gain < 0)
+	{
+		L_s32Needed -= L_s32Gain;
+	}
+	if (L_s32Needed < 0)
+	{
+		L_s32Needed = 0;
+	}
+	L_s32PassTime = (L_s32Needed * MAN_MS_PER_S) / (L_s32PassSpeed - L_s32Lead);
+	L_s32PassTravel = (L_s32Needed * L_s32PassSpeed) / (L_s32PassSpeed - L_s32Lead);
+
+	// the heading is positive to the left
+	L_s16Angle = (s16)L_strLane.Lane_u16Angle;
+	if (P_Request->Request_u8Side == SMAN_SIDE_LEFT)
+	{
+		L_u8Out = (L_strLane.Lane_u8Inner == MAN_PIVOT_INNER_PERCENT) ? 'L' : 'G';
+		L_u8Back = (L_strLane.Lane_u8Inner == MAN_PIVOT_INNER_PERCENT) ? 'R' : 'I';
+		L_u8OutEnd = SMAN_END_TURN_LEFT;
+		L_u8BackEnd = SMAN_END_TURN_RIGHT;
+	}
+	else
+	{
+		L_s16Angle = -L_s16Angle;
+		L_u8Out = (L_strLane.Lane_u8Inner == MAN_PIVOT_INNER_PERCENT) ? 'R' : 'I';
+		L_u8Back = (L_strLane.Lane_u8Inner == MAN_PIVOT_INNER_PERCENT) ? 'L' : 'G';
+		L_u8OutEnd = SMAN_END_TURN_RIGHT;
+		L_u8BackEnd = SMAN_END_TURN_LEFT;
+	}
+
+	SMAN_voidSetStep(&P_Plan->Plan_AstrSteps[MAN_STEP_OUT_ARC], L_u8Out, L_u8LaneLevel, L_u8OutEnd, L_s16Angle, 0, L_strLane.Lane_s32ArcTime);
+	SMAN_voidSetStep(&P_Plan->Plan_AstrSteps[MAN_STEP_OUT_LINE], 'F', L_u8LaneLevel, SMAN_END_TRAVEL, L_s16Angle, L_strLane.Lane_s32Line, L_strLane.Lane_s32LineTime);
+	SMAN_voidSetStep(&P_Plan->Plan_AstrSteps[MAN_STEP_OUT_ALIGN], L_u8Back, L_u8LaneLevel, L_u8BackEnd, 0, 0, L_strLane.Lane_s32ArcTime);
+	SMAN_voidSetStep(&P_Plan->Plan_AstrSteps[MAN_STEP_PASS], 'F', L_u8PassLevel, SMAN_END_TRAVEL, 0, L_s32PassTravel, L_s32PassTime);
+	P_Plan->Plan_AstrSteps[MAN_STEP_PASS].Step_u8Flags = SMAN_FLAG_SIDE_CLEAR;
+	SMAN_voidSetStep(&P_Plan->Plan_AstrSteps[MAN_STEP_BACK_ARC], L_u8Back, L_u8LaneLevel, L_u8BackEnd, (s16)-L_s16Angle, 0, L_strLane.Lane_s32ArcTime);
+	SMAN_voidSetStep(&P_Plan->Plan_AstrSteps[MAN_STEP_BACK_LINE], 'F', L_u8LaneLevel, SMAN_END_TRAVEL, (s16)-L_s16Angle, L_strLane.Lane_s32Line, L_strLane.Lane_s32LineTime);
+	SMAN_voidSetStep(&P_Plan->Plan_AstrSteps[MAN_STEP_BACK_ALIGN], L_u8Out, L_u8LaneLevel, L_u8OutEnd, 0, 0, L_strLane.Lane_s32ArcTime);
+	P_Plan->Plan_u8Count = SMAN_MAX_STEPS;
+	P_Plan->Plan_u32Duration = (u32)(2 * L_s32LaneTime + L_s32PassTime);
+
+	return OK;
+}
+
+/**
+ * @brief Check if a step is done.
+ */
+u8 SMAN_u8IsStepDone(const SMAN_STEP_t * P_Step, u16 Copy_u16Heading, s32 Copy_s32Travel, const SODO_POSE_t * P_Pose)
+{
+	s16 L_s16Error;
+	s32 L_s32Travel;
+
+	if ((P_Step == NULL) || (P_Pose == NULL))
+	{
+		return 1;
+	}
+
+	L_s16Error = (s16)(u16)(P_Pose->Pose_u16Heading - (u16)(Copy_u16Heading + (u16)P_Step->Step_s16Heading));
+	switch (P_Step->Step_u8End)
+	{
+	case SMAN_END_TURN_LEFT:
+		return (L_s16Error >= 0);
+	case SMAN_END_TURN_RIGHT:
+		return (L_s16Error <= 0);
+	default:
+		L_s32Travel = P_Pose->Pose_s32Travel - Copy_s32Travel;
+		if (L_s32Travel < 0)
+		{
+			L_s32Travel = -L_s32Travel;
+		}
+		return (L_s32Travel >= P_Step->Step_u16Travel);
+	}
+}
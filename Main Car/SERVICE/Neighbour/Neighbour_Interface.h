@@ -0,0 +1,98 @@
+/******************************************************************************
+ *
+ * @file Neighbour_Interface.h
+ *
+ * @brief Interface file for the Neighbour table module.
+ *
+ * Fixed capacity table of the surrounding vehicles, filled with the V2V
+ * beacons. A vehicle is found from its ID in constant time (ID to slot map),
+ * the least recently heard vehicle is replaced when the table is full, and the
+ * vehicles are grouped by lane so the lane queries don't rescan the table.
+ *
+ * @note Not interrupt safe: the V2V module updates the table from its task,
+ *       in the main loop, like the queries.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_NEIGHBOUR_NEIGHBOUR_INTERFACE_H_
+#define SERVICE_NEIGHBOUR_NEIGHBOUR_INTERFACE_H_
+
+/**
+ * @brief Adjacent lanes, as seen in the driving direction (Y grows to the left).
+ */
+#define SNBR_LEFT_LANE			1
+#define SNBR_RIGHT_LANE			(-1)
+
+/**
+ * @brief Empty the table.
+ */
+void SNBR_voidInit(void);
+
+/**
+ * @brief Insert or refresh a vehicle.
+ *
+ * @param P_Beacon The received beacon, Beacon_u32RxTime and Beacon_u32CaptureTime must be set.
+ * @return OK, NOK for the reserved ID 0, NULL_PTR_ERR.
+ */
+u8 SNBR_u8Update(const SV2V_BEACON_t * P_Beacon);
+
+/**
+ * @brief Remove the vehicles not heard for NBR_STALE_TIMEOUT_MS.
+ */
+void SNBR_voidPurge(void);
+
+/**
+ * @brief Set the position of this car, used by the lane queries.
+ *
+ * @param Copy_s16PosX Position along the road in cm.
+ * @param Copy_s16PosY Position across the road in cm.
+ */
+void SNBR_voidSetOwnPosition(s16 Copy_s16PosX, s16 Copy_s16PosY);
+
+/**
+ * @brief Get the latest beacon of a vehicle.
+ *
+ * The position and the front distance are extrapolated from the capture time
+ * of the beacon to now, with the speed of the vehicle.
+ *
+ * @param Copy_u8Id The vehicle ID.
+ * @param P_Beacon  Where the beacon is copied.
+ * @return OK, NOK if the vehicle is unknown or stale, NULL_PTR_ERR.
+ */
+u8 SNBR_u8Get(u8 Copy_u8Id, SV2V_BEACON_t * P_Beacon);
+
+/**
+ * @brief Get where a vehicle is from this car.
+ *
+ * The gap uses the position of the vehicle extrapolated to now.
+ *
+ * @param Copy_u8Id        The vehicle ID.
+ * @param P_s8LaneOffset   Where its lane is written, relative to the lane of this car (0 same lane, > 0 on the left).
+ * @param P_s32Gap         Where its distance along the road is written in cm (> 0 ahead of this car).
+ * @return OK, NOK if the vehicle is unknown or stale, NULL_PTR_ERR.
+ */
+u8 SNBR_u8GetRelativePosition(u8 Copy_u8Id, s8 * P_s8LaneOffset, s32 * P_s32Gap);
+
+/**
+ * @brief Get the nearest vehicle ahead of this car in its lane.
+ *
+ * @param P_Beacon Where the beacon of that vehicle is copied (extrapolated to now).
+ * @return OK, NOK if there is none, NULL_PTR_ERR.
+ */
+u8 SNBR_u8GetNearestAhead(SV2V_BEACON_t * P_Beacon);
+
+/**
+ * @brief Check for a vehicle beside this car in an adjacent lane.
+ *
+ * A vehicle counts when its position extrapolated to now is within
+ * NBR_SIDE_WINDOW_CM along the road.
+ *
+ * @param Copy_s8LaneOffset SNBR_LEFT_LANE or SNBR_RIGHT_LANE.
+ * @return 1 if a vehicle is there, 0 if not.
+ */
+u8 SNBR_u8IsLaneOccupied(s8 Copy_s8LaneOffset);
+
+#endif /* SERVICE_NEIGHBOUR_NEIGHBOUR_INTERFACE_H_ */
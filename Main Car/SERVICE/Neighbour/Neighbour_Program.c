@@ -0,0 +1,409 @@
+/******************************************************************************
+ *
+ * @File: Neighbour_Program.c
+ *
+ * @Brief: Implementation of functions for the Neighbour table Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+#include "../../LIB/ERROR_STATE.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "../V2V/V2V_Interface.h"
+#include "Neighbour_Interface.h"
+#include "Neighbour_Config.h"
+#include "Neighbour_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+static NBR_ENTRY_t SNBR_AstrEntries[NBR_CAPACITY];
+/* slot of each vehicle ID, NBR_NONE if unknown */
+static u8 SNBR_Au8IdToSlot[256];
+static u8 SNBR_u8LruHead = NBR_NONE;
+static u8 SNBR_u8LruTail = NBR_NONE;
+static u8 SNBR_u8FreeHead = NBR_NONE;
+static u8 SNBR_Au8LaneHead[NBR_LANE_BUCKETS];
+
+static s16 SNBR_s16OwnPosX = 0;
+static s8  SNBR_s8OwnLane = 0;
+
+/*******************************************************************************
+ *                          	Private Functions                              *
+ *******************************************************************************/
+static s8 SNBR_s8GetLane(s16 Copy_s16PosY)
+{
+	s32 L_s32Shifted = (s32)Copy_s16PosY + (NBR_LANE_WIDTH_CM / 2);
+
+	/* floor division, lane 0 spans [-width/2, width/2[ */
+	if (L_s32Shifted >= 0)
+	{
+		return (s8)(L_s32Shifted / NBR_LANE_WIDTH_CM);
+	}
+	return (s8)(-((-L_s32Shifted + NBR_LANE_WIDTH_CM - 1) / NBR_LANE_WIDTH_CM));
+}
+
+static u8 SNBR_u8IsStale(const NBR_ENTRY_t * P_Entry, u32 Copy_u32Now)
+{
+	return ((Copy_u32Now - P_Entry->Nbr_strBeacon.Beacon_u32RxTime) >= (NBR_STALE_TIMEOUT_MS * NBR_US_PER_MS));
+}
+
+/**
+ * @brief Copy the beacon of a vehicle, extrapolated from its capture time to now.
+ *
+ * The vehicle goes on at its speed along the nearest axis of its heading (as
+ * the sender integrates its own position) and the obstacle in front of it is
+ * taken as still. The age is limited to NBR_STALE_TIMEOUT_MS.
+ */
+static void SNBR_voidExtrapolate(const NBR_ENTRY_t * P_Entry, u32 Copy_u32Now, SV2V_BEACON_t * P_Beacon)
+{
+	u32 L_u32AgeMs;
+	u32 L_u32Travel;
+
+	*P_Beacon = P_Entry->Nbr_strBeacon;
+
+	if ((s32)(Copy_u32Now - P_Beacon->Beacon_u32CaptureTime) <= 0)
+	{
+		return;
+	}
+	L_u32AgeMs = (Copy_u32Now - P_Beacon->Beacon_u32CaptureTime) / NBR_US_PER_MS;
+	if (L_u32AgeMs > NBR_STALE_TIMEOUT_MS)
+	{
+		L_u32AgeMs = NBR_STALE_TIMEOUT_MS;
+	}
+	L_u32Travel = ((u32)P_Beacon->Beacon_u16Speed * L_u32AgeMs) / NBR_MS_PER_S;
+
+	if ((P_Beacon->Beacon_u16Heading < 45) || (P_Beacon->Beacon_u16Heading >= 315))
+	{
+		P_Beacon->Beacon_s16PosX += (s16)L_u32Travel;
+	}
+	else if (P_Beacon->Beacon_u16Heading < 135)
+	{
+		P_Beacon->Beacon_s16PosY += (s16)L_u32Travel;
+	}
+	else if (P_Beacon->Beacon_u16Heading < 225)
+	{
+		P_Beacon->Beacon_s16PosX -= (s16)L_u32Travel;
+	}
+	else
+	{
+		P_Beacon->Beacon_s16PosY -= (s16)L_u32Travel;
+	}
+
+	P_Beacon->Beacon_u16FrontDistance = (P_Beacon->Beacon_u16FrontDistance > L_u32Travel) ?
+										(u16)(P_Beacon->Beacon_u16FrontDistance - L_u32Travel) : 0;
+}
+
+static void SNBR_voidLruUnlink(u8 Copy_u8Slot)
+{
+	NBR_ENTRY_t * L_pstrEntry = &SNBR_AstrEntries[Copy_u8Slot];
+
+	if (L_pstrEntry->Nbr_u8LruPrev != NBR_NONE)
+	{
+		SNBR_AstrEntries[L_pstrEntry->Nbr_u8LruPrev].Nbr_u8LruNext = L_pstrEntry->Nbr_u8LruNext;
+	}
+	else
+	{
+		SNBR_u8LruHead = L_pstrEntry->Nbr_u8LruNext;
+	}
+	if (L_pstrEntry->Nbr_u8LruNext != NBR_NONE)
+	{
+		SNBR_AstrEntries[L_pstrEntry->Nbr_u8LruNext].Nbr_u8LruPrev = L_pstrEntry->Nbr_u8LruPrev;
+	}
+	else
+	{
+		SNBR_u8LruTail = L_pstrEntry->Nbr_u8LruPrev;
+	}
+}
+
+static void SNBR_voidLruPushHead(u8 Copy_u8Slot)
+{
+	SNBR_AstrEntries[Copy_u8Slot].Nbr_u8LruPrev = NBR_NONE;
+	SNBR_AstrEntries[Copy_u8Slot].Nbr_u8LruNext = SNBR_u8LruHead;
+	if (SNBR_u8LruHead != NBR_NONE)
+	{
+		SNBR_AstrEntries[SNBR_u8LruHead].Nbr_u8LruPrev = Copy_u8Slot;
+	}
+	else
+	{
+		SNBR_u8LruTail = Copy_u8Slot;
+	}
+	SNBR_u8LruHead = Copy_u8Slot;
+}
+
+static void SNBR_voidLaneUnlink(u8 Copy_u8Slot)
+{
+	NBR_ENTRY_t * L_pstrEntry = &SNBR_AstrEntries[Copy_u8Slot];
+
+	if (L_pstrEntry->Nbr_u8LanePrev != NBR_NONE)
+	{
+		SNBR_AstrEntries[L_pstrEntry->Nbr_u8LanePrev].Nbr_u8LaneNext = L_pstrEntry->Nbr_u8LaneNext;
+	}
+	else
+	{
+		SNBR_Au8LaneHead[(u8)L_pstrEntry->Nbr_s8Lane & NBR_BUCKET_MASK] = L_pstrEntry->Nbr_u8LaneNext;
+	}
+	if (L_pstrEntry->Nbr_u8LaneNext != NBR_NONE)
+	{
+		SNBR_AstrEntries[L_pstrEntry->Nbr_u8LaneNext].Nbr_u8LanePrev = L_pstrEntry->Nbr_u8LanePrev;
+	}
+}
+
+static void SNBR_voidLanePush(u8 Copy_u8Slot, s8 Copy_s8Lane)
+{
+	u8 L_u8Bucket = (u8)Copy_s8Lane & NBR_BUCKET_MASK;
+
+	SNBR_AstrEntries[Copy_u8Slot].Nbr_s8Lane = Copy_s8Lane;
+	SNBR_AstrEntries[Copy_u8Slot].Nbr_u8LanePrev = NBR_NONE;
+	SNBR_AstrEntries[Copy_u8Slot].Nbr_u8LaneNext = SNBR_Au8LaneHead[L_u8Bucket];
+	if (SNBR_Au8LaneHead[L_u8Bucket] != NBR_NONE)
+	{
+		SNBR_AstrEntries[SNBR_Au8LaneHead[L_u8Bucket]].Nbr_u8LanePrev = Copy_u8Slot;
+	}
+	SNBR_Au8LaneHead[L_u8Bucket] = Copy_u8Slot;
+}
+
+static void SNBR_voidRemove(u8 Copy_u8Slot)
+{
+	SNBR_voidLruUnlink(Copy_u8Slot);
+	SNBR_voidLaneUnlink(Copy_u8Slot);
+	SNBR_Au8IdToSlot[SNBR_AstrEntries[Copy_u8Slot].Nbr_strBeacon.Beacon_u8Id] = NBR_NONE;
+	SNBR_AstrEntries[Copy_u8Slot].Nbr_u8LruNext = SNBR_u8FreeHead;
+	SNBR_u8FreeHead = Copy_u8Slot;
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Empty the table.
+ *
+ * This function chains all the entries in the free list and forgets all the IDs.
+ */
+void SNBR_voidInit(void)
+{
+	u16 L_u16Index;
+
+	for (L_u16Index = 0; L_u16Index < 256; L_u16Index++)
+	{
+		SNBR_Au8IdToSlot[L_u16Index] = NBR_NONE;
+	}
+	for (L_u16Index = 0; L_u16Index < NBR_LANE_BUCKETS; L_u16Index++)
+	{
+		SNBR_Au8LaneHead[L_u16Index] = NBR_NONE;
+	}
+	for (L_u16Index = 0; L_u16Index < NBR_CAPACITY; L_u16Index++)
+	{
+		SNBR_AstrEntries[L_u16Index].Nbr_u8LruNext = (L_u16Index + 1 < NBR_CAPACITY) ? (u8)(L_u16Index + 1) : NBR_NONE;
+	}
+	SNBR_u8FreeHead = 0;
+	SNBR_u8LruHead = NBR_NONE;
+	SNBR_u8LruTail = NBR_NONE;
+}
+
+/**
+ * @brief Insert or refresh a vehicle.
+ *
+ * A known vehicle keeps its slot, a new one takes a free slot or the slot of
+ * the least recently updated vehicle. The vehicle moves to the head of the LRU
+ * list and to the list of its current lane.
+ */
+u8 SNBR_u8Update(const SV2V_BEACON_t * P_Beacon)
+{
+	u8 L_u8Slot;
+	s8 L_s8Lane;
+
+	if (P_Beacon == NULL)
+	{
+		return NULL_PTR_ERR;
+	}
+	if (P_Beacon->Beacon_u8Id == 0)
+	{
+		return NOK;
+	}
+
+	L_s8Lane = SNBR_s8GetLane(P_Beacon->Beacon_s16PosY);
+	L_u8Slot = SNBR_Au8IdToSlot[P_Beacon->Beacon_u8Id];
+
+	if (L_u8Slot != NBR_NONE)
+	{
+		SNBR_voidLruUnlink(L_u8Slot);
+		if (SNBR_AstrEntries[L_u8Slot].Nbr_s8Lane != L_s8Lane)
+		{
+			SNBR_voidLaneUnlink(L_u8Slot);
+			SNBR_voidLanePush(L_u8Slot, L_s8Lane);
+		}
+	}
+	else
+	{
+		if (SNBR_u8FreeHead == NBR_NONE)
+		{
+			/* full: replace the vehicle heard from the longest time ago */
+			SNBR_voidRemove(SNBR_u8LruTail);
+		}
+		L_u8Slot = SNBR_u8FreeHead;
+		SNBR_u8FreeHead = SNBR_AstrEntries[L_u8Slot].Nbr_u8LruNext;
+		SNBR_Au8IdToSlot[P_Beacon->Beacon_u8Id] = L_u8Slot;
+		SNBR_voidLanePush(L_u8Slot, L_s8Lane);
+	}
+
+	SNBR_AstrEntries[L_u8Slot].Nbr_strBeacon = *P_Beacon;
+	SNBR_voidLruPushHead(L_u8Slot);
+	return OK;
+}
+
+/**
+ * @brief Remove the stale vehicles.
+ *
+ * The LRU tail is the oldest update, so only the stale entries are visited.
+ */
+void SNBR_voidPurge(void)
+{
+	u32 L_u32Now = MTMR_u32GetMicros();
+
+	while ((SNBR_u8LruTail != NBR_NONE) && SNBR_u8IsStale(&SNBR_AstrEntries[SNBR_u8LruTail], L_u32Now))
+	{
+		SNBR_voidRemove(SNBR_u8LruTail);
+	}
+}
+
+/**
+ * @brief Set the position of this car.
+ */
+void SNBR_voidSetOwnPosition(s16 Copy_s16PosX, s16 Copy_s16PosY)
+{
+	SNBR_s16OwnPosX = Copy_s16PosX;
+	SNBR_s8OwnLane = SNBR_s8GetLane(Copy_s16PosY);
+}
+
+/**
+ * @brief Get the latest beacon of a vehicle, extrapolated to now.
+ */
+u8 SNBR_u8Get(u8 Copy_u8Id, SV2V_BEACON_t * P_Beacon)
+{
+	u32 L_u32Now = MTMR_u32GetMicros();
+	u8 L_u8Slot;
+
+	if (P_Beacon == NULL)
+	{
+		return NULL_PTR_ERR;
+	}
+	L_u8Slot = SNBR_Au8IdToSlot[Copy_u8Id];
+	if ((L_u8Slot == NBR_NONE) || SNBR_u8IsStale(&SNBR_AstrEntries[L_u8Slot], L_u32Now))
+	{
+		return NOK;
+	}
+	SNBR_voidExtrapolate(&SNBR_AstrEntries[L_u8Slot], L_u32Now, P_Beacon);
+	return OK;
+}
+
+/**
+ * @brief Get where a vehicle is from this car.
+ *
+ * The gap is taken with the position extrapolated to now, the lane is the
+ * one of the beacon, as in the lane queries.
+ */
+u8 SNBR_u8GetRelativePosition(u8 Copy_u8Id, s8 * P_s8LaneOffset, s32 * P_s32Gap)
+{
+	u32 L_u32Now = MTMR_u32GetMicros();
+	SV2V_BEACON_t L_strBeacon;
+	u8 L_u8Slot;
+
+	if ((P_s8LaneOffset == NULL) || (P_s32Gap == NULL))
+	{
+		return NULL_PTR_ERR;
+	}
+	L_u8Slot = SNBR_Au8IdToSlot[Copy_u8Id];
+	if ((L_u8Slot == NBR_NONE) || SNBR_u8IsStale(&SNBR_AstrEntries[L_u8Slot], L_u32Now))
+	{
+		return NOK;
+	}
+	SNBR_voidExtrapolate(&SNBR_AstrEntries[L_u8Slot], L_u32Now, &L_strBeacon);
+	*P_s8LaneOffset = (s8)(SNBR_AstrEntries[L_u8Slot].Nbr_s8Lane - SNBR_s8OwnLane);
+	*P_s32Gap = (s32)L_strBeacon.Beacon_s16PosX - SNBR_s16OwnPosX;
+	return OK;
+}
+
+/**
+ * @brief Get the nearest vehicle ahead of this car in its lane.
+ *
+ * The gaps are taken with the positions extrapolated to now, the lane is the
+ * one of the beacon.
+ */
+u8 SNBR_u8GetNearestAhead(SV2V_BEACON_t * P_Beacon)
+{
+	u32 L_u32Now = MTMR_u32GetMicros();
+	SV2V_BEACON_t L_strBeacon;
+	s32 L_s32Gap;
+	s32 L_s32BestGap = 0x7FFFFFFF;
+	u8 L_u8Best = NBR_NONE;
+	u8 L_u8Slot;
+
+	if (P_Beacon == NULL)
+	{
+		return NULL_PTR_ERR;
+	}
+
+	for (L_u8Slot = SNBR_Au8LaneHead[(u8)SNBR_s8OwnLane & NBR_BUCKET_MASK]; L_u8Slot != NBR_NONE;
+		 L_u8Slot = SNBR_AstrEntries[L_u8Slot].Nbr_u8LaneNext)
+	{
+		if ((SNBR_AstrEntries[L_u8Slot].Nbr_s8Lane != SNBR_s8OwnLane) || SNBR_u8IsStale(&SNBR_AstrEntries[L_u8Slot], L_u32Now))
+		{
+			continue;
+		}
+		SNBR_voidExtrapolate(&SNBR_AstrEntries[L_u8Slot], L_u32Now, &L_strBeacon);
+		L_s32Gap = (s32)L_strBeacon.Beacon_s16PosX - SNBR_s16OwnPosX;
+		if ((L_s32Gap > 0) && (L_s32Gap < L_s32BestGap))
+		{
+			L_s32BestGap = L_s32Gap;
+			L_u8Best = L_u8Slot;
+			*P_Beacon = L_strBeacon;
+		}
+	}
+
+	return (L_u8Best == NBR_NONE) ? NOK : OK;
+}
+
+/**
+ * @brief Check for a vehicle beside this car in an adjacent lane.
+ */
+u8 SNBR_u8IsLaneOccupied(s8 Copy_s8LaneOffset)
+{
+	u32 L_u32Now = MTMR_u32GetMicros();
+	SV2V_BEACON_t L_strBeacon;
+	s8 L_s8Lane = SNBR_s8OwnLane + Copy_s8LaneOffset;
+	s32 L_s32Gap;
+	u8 L_u8Slot;
+
+	for (L_u8Slot = SNBR_Au8LaneHead[(u8)L_s8Lane & NBR_BUCKET_MASK]; L_u8Slot != NBR_NONE;
+		 L_u8Slot = SNBR_AstrEntries[L_u8Slot].Nbr_u8LaneNext)
+	{
+		if ((SNBR_AstrEntries[L_u8Slot].Nbr_s8Lane != L_s8Lane) || SNBR_u8IsStale(&SNBR_AstrEntries[L_u8Slot], L_u32Now))
+		{
+			continue;
+		}
+		SNBR_voidExtrapolate(&SNBR_AstrEntries[L_u8Slot], L_u32Now, &L_strBeacon);
+		L_s32Gap = (s32)L_strBeacon.Beacon_s16PosX - SNBR_s16OwnPosX;
+		if ((L_s32Gap > -NBR_SIDE_WINDOW_CM) && (L_s32Gap < NBR_SIDE_WINDOW_CM))
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
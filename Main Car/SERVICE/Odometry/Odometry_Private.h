@@ -0,0 +1,48 @@
+/******************************************************************************
+ *
+ * @File: Odometry_Private.h
+ *
+ * @Brief: Private definitions for the Odometry Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_ODOMETRY_ODOMETRY_PRIVATE_H_
+#define SERVICE_ODOMETRY_ODOMETRY_PRIVATE_H_
+
+#define ODO_US_PER_MS			1000L
+#define ODO_UM_PER_MM			1000L
+
+/**
+ * @brief Largest wheel command (PWM compare period).
+ */
+#define ODO_MAX_COMMAND			10000L
+
+/**
+ * @brief Heading change for a difference of travel of the sides (binary angle / 2^32 per um).
+ *
+ * 2^32 / (2 x pi x track width in um), scaled by the turn factor.
+ */
+#define ODO_ANGLE_PER_UM		((683565L * ODO_TURN_FACTOR_Q8) / 256 / ODO_TRACK_WIDTH_MM)
+
+/* largest travel of a side in one step (um), then the heading and position products must fit an s32 */
+#define ODO_MAX_STEP_UM			((ODO_MAX_COMMAND * ODO_SPEED_LEVEL_MM_S / 1000) * ODO_PERIOD_MS)
+
+#if (ODO_PERIOD_MS < 1) || (ODO_PERIOD_MS > 100)
+#error "ODO_PERIOD_MS must be 1 to 100"
+#endif
+
+#if ((2 * ODO_MAX_STEP_UM * ODO_ANGLE_PER_UM) > 0x7FFFFFFFL) || ((ODO_MAX_STEP_UM * 32768L) > 0x7FFFFFFFL)
+#error "ODO_PERIOD_MS is too long for the speed and the track width"
+#endif
+
+/**
+ * @brief Quarter of the sine table (65 points), Q15.
+ */
+#define ODO_SINE_POINTS			65
+#define ODO_QUARTER				0x40000000UL
+
+#endif /* SERVICE_ODOMETRY_ODOMETRY_PRIVATE_H_ */
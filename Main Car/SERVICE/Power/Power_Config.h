@@ -0,0 +1,60 @@
+/******************************************************************************
+ *
+ * @file Power_Config.h
+ *
+ * @brief Configuration file for the Power (profiles) module.
+ *
+ * Each profile selects the system clock of the car and the peripherals that
+ * stay clocked. The clock of a profile must keep APB1 <= 42 MHz with the
+ * APB1 prescaler of RCC_Config.h.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_POWER_POWER_CONFIG_H_
+#define SERVICE_POWER_POWER_CONFIG_H_
+
+/**
+ * @brief Parked: the car is stopped, only the links and the beacons run.
+ *
+ * HSI / 4 = 4 MHz, the PLL is stopped.
+ */
+#define PWR_PARKED_CLOCK				RCC_SYSCLK_HSI
+#define PWR_PARKED_AHB_DIVIDER			4
+
+/**
+ * @brief Cruising: straight driving, one front distance per pass.
+ *
+ * HSI = 16 MHz, the clock the control loop was written for.
+ */
+#define PWR_CRUISE_CLOCK				RCC_SYSCLK_HSI
+#define PWR_CRUISE_AHB_DIVIDER			1
+
+/**
+ * @brief Manoeuvre: overtake, turns and obstacle handling.
+ *
+ * PLL = 84 MHz, the shortest reaction time.
+ */
+#define PWR_MANOEUVRE_CLOCK				RCC_SYSCLK_PLL
+#define PWR_MANOEUVRE_AHB_DIVIDER		1
+
+/**
+ * @brief Stop the clock of the motor PWM timer (TIM2) while parked (1 = yes).
+ *
+ * The motors are already stopped by their direction pins.
+ */
+#define PWR_PARKED_GATE_MOTOR_TIMER		1
+
+/**
+ * @brief Peripherals never used by the car, their clock is stopped at init
+ *        (bit masks of the RCC enable bits).
+ *
+ * TIM4 drives the blind spot LEDs, also while parked.
+ */
+#define PWR_UNUSED_AHB1		((1UL << RCC_AHB1_GPIOC) | (1UL << RCC_AHB1_GPIOD) | (1UL << RCC_AHB1_GPIOE) | (1UL << RCC_AHB1_GPIOH))
+#define PWR_UNUSED_APB1		((1UL << RCC_APB1_TIMER3) | (1UL << RCC_APB1_USART2))
+#define PWR_UNUSED_APB2		0
+
+#endif /* SERVICE_POWER_POWER_CONFIG_H_ */
@@ -0,0 +1,51 @@
+/******************************************************************************
+ *
+ * @file Power_Interface.h
+ *
+ * @brief Interface file for the Power (profiles) module.
+ *
+ * The car runs at the lowest clock that keeps up with what it is doing:
+ * parked, cruising or manoeuvring. Changing the profile switches the system
+ * clock, re-derives the SysTick, timer and USART divisors so their timing is
+ * unchanged, and gates the peripherals the profile doesn't use.
+ *
+ * @note Not interrupt safe: call it from the main loop. A profile change takes
+ *       up to a few hundred microseconds when the PLL has to lock.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_POWER_POWER_INTERFACE_H_
+#define SERVICE_POWER_POWER_INTERFACE_H_
+
+/**
+ * @brief Power profiles.
+ */
+#define SPWR_PROFILE_PARKED			0
+#define SPWR_PROFILE_CRUISE			1
+#define SPWR_PROFILE_MANOEUVRE		2
+
+/**
+ * @brief Stop the clock of the unused peripherals and enter the parked profile.
+ *
+ * @note Call it after the drivers are initialized.
+ */
+void SPWR_voidInit(void);
+
+/**
+ * @brief Change the power profile, nothing is done if it is already active.
+ *
+ * @param Copy_u8Profile SPWR_PROFILE_PARKED, SPWR_PROFILE_CRUISE or SPWR_PROFILE_MANOEUVRE.
+ * @return OK, OUT_OF_RANGE for an unknown profile, NOK if the clock can't be switched
+ *         or an ultrasonic echo is being timed (call it again later).
+ */
+u8 SPWR_u8SetProfile(u8 Copy_u8Profile);
+
+/**
+ * @brief Get the active power profile.
+ */
+u8 SPWR_u8GetProfile(void);
+
+#endif /* SERVICE_POWER_POWER_INTERFACE_H_ */
@@ -0,0 +1,34 @@
+/******************************************************************************
+ *
+ * @File: Power_Private.h
+ *
+ * @Brief: Private definitions for the Power Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_POWER_POWER_PRIVATE_H_
+#define SERVICE_POWER_POWER_PRIVATE_H_
+
+#define PWR_PROFILE_COUNT		3
+
+/**
+ * @brief No profile applied yet (the first SPWR_u8SetProfile always switches).
+ */
+#define PWR_PROFILE_NONE		0xFF
+
+#define PWR_HZ_PER_MHZ			1000000UL
+
+/**
+ * @brief Clock of one profile.
+ */
+typedef struct
+{
+	u8  Pwr_u8Source;			/**< RCC_SYSCLK_HSI, RCC_SYSCLK_HSE or RCC_SYSCLK_PLL */
+	u16 Pwr_u16AhbDivider;		/**< HCLK = source / divider */
+}PWR_PROFILE_t;
+
+#endif /* SERVICE_POWER_POWER_PRIVATE_H_ */
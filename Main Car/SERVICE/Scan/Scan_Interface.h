@@ -0,0 +1,137 @@
+/******************************************************************************
+ *
+ * @file Scan_Interface.h
+ *
+ * @brief Interface file for the Scan (ultrasonic sensor ring) module.
+ *
+ * The task fires the sensors slot by slot with HUS_u8StartMeasure and collects
+ * the echoes without waiting for them, the application reads the latest
+ * accepted distance of each sensor. Readings of sensors fired together that
+ * look like crosstalk are rejected (STRACE_EVT_US_CROSSTALK).
+ *
+ * Each sensor is pinged only as often as the scan mode needs (the front one
+ * faster when the car goes faster, a side one faster while the car watches that
+ * side) and its measurement ends at its range gate.
+ *
+ * @note Include Ultrasonic_Interface.h before this file. Not interrupt safe:
+ *       the task and the queries run in the main loop.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_SCAN_SCAN_INTERFACE_H_
+#define SERVICE_SCAN_SCAN_INTERFACE_H_
+
+/**
+ * @brief Mask of a sensor, used for the slots.
+ */
+#define SSCAN_SENSOR(US)			(1U << ((US) - 1))
+
+/**
+ * @brief Scan modes, chosen by the application (SCAN_MODE_PERIODS_US).
+ */
+#define SSCAN_MODE_PARKED			0
+#define SSCAN_MODE_CRUISE			1
+#define SSCAN_MODE_LEFT_SIDE		2
+#define SSCAN_MODE_RIGHT_SIDE		3
+
+/**
+ * @brief Forget the readings and start a new sweep.
+ *
+ * The sensors get their range gates, the mode is SSCAN_MODE_PARKED.
+ *
+ * @note HUS_voidInit must be called before.
+ */
+void SSCAN_voidInit(void);
+
+/**
+ * @brief Set the ping periods from what the car is doing.
+ *
+ * @param Copy_u8Mode       SSCAN_MODE_PARKED, SSCAN_MODE_CRUISE, SSCAN_MODE_LEFT_SIDE or SSCAN_MODE_RIGHT_SIDE.
+ * @param Copy_u16SpeedCmS  Speed of the car in cm/s, for the speed driven periods.
+ * @return OK, OUT_OF_RANGE for a wrong mode.
+ */
+u8 SSCAN_u8SetMode(u8 Copy_u8Mode, u16 Copy_u16SpeedCmS);
+
+/**
+ * @brief Ping a sensor in the next slot that has it, even if the mode has it off.
+ *
+ * The request holds until a distance of the sensor is accepted.
+ *
+ * @param Copy_Sensor The sensor.
+ */
+void SSCAN_voidRequest(USNUM_t Copy_Sensor);
+
+/**
+ * @brief Collect the echoes of the current slot, start the next slot when it is time.
+ *
+ * Call it from the main loop, it never waits for an echo (EXTI backend).
+ */
+void SSCAN_voidTask(void);
+
+/**
+ * @brief Get the latest accepted distance of a sensor.
+ *
+ * @param Copy_Sensor   The sensor.
+ * @param P_f32Distance Distance in cm.
+ * @return OK, NOK if the sensor has no reading yet, NULL_PTR_ERR, OUT_OF_RANGE.
+ */
+u8 SSCAN_u8GetDistance(USNUM_t Copy_Sensor, f32 * P_f32Distance);
+
+/**
+ * @brief Get the latest accepted distance of a sensor if it was not read yet.
+ *
+ * @param Copy_Sensor   The sensor.
+ * @param P_f32Distance Distance in cm.
+ * @return OK once for each accepted distance, NOK if there is no new one, NULL_PTR_ERR, OUT_OF_RANGE.
+ */
+u8 SSCAN_u8GetNewDistance(USNUM_t Copy_Sensor, f32 * P_f32Distance);
+
+/**
+ * @brief Get the latest accepted distance of a sensor with its trigger time.
+ *
+ * The trigger time tells the readings apart: a reading is new when it
+ * changes. Unlike SSCAN_u8GetNewDistance, it leaves the reading new for the
+ * other users.
+ *
+ * @param Copy_Sensor   The sensor.
+ * @param P_f32Distance Distance in cm.
+ * @param P_u32Time     Trigger time of the reading (MTMR_u32GetMicros timebase).
+ * @return OK, NOK if the sensor has no reading yet, NULL_PTR_ERR, OUT_OF_RANGE.
+ */
+u8 SSCAN_u8GetReading(USNUM_t Copy_Sensor, f32 * P_f32Distance, u32 * P_u32Time);
+
+/**
+ * @brief Age of the latest accepted distance of a sensor (us since its trigger).
+ *
+ * @param Copy_Sensor The sensor.
+ * @return The age, 0xFFFFFFFF if the sensor has no reading.
+ */
+u32 SSCAN_u32GetAge(USNUM_t Copy_Sensor);
+
+/**
+ * @brief Range gate of a sensor (SCAN_GATE_xxx_CM).
+ *
+ * A distance equal to the gate means nothing was found within it.
+ *
+ * @param Copy_Sensor The sensor.
+ * @return The gate in cm, 0 for the full range or a wrong sensor.
+ */
+u16 SSCAN_u16GetRangeGate(USNUM_t Copy_Sensor);
+
+/**
+ * @brief Number of complete sweeps since SSCAN_voidInit.
+ */
+u32 SSCAN_u32GetSweepCount(void);
+
+/**
+ * @brief Time the main loop can sleep before the task has something to do (us).
+ *
+ * @return 0 if a slot is due, SCAN_PENDING_POLL_US while a slot waits for its
+ *         echoes, the time to the next ping otherwise (0xFFFFFFFF if all off).
+ */
+u32 SSCAN_u32GetIdleTime(void);
+
+#endif /* SERVICE_SCAN_SCAN_INTERFACE_H_ */
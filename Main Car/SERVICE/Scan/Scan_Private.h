@@ -0,0 +1,42 @@
+/******************************************************************************
+ *
+ * @File: Scan_Private.h
+ *
+ * @Brief: Private definitions for the Scan Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_SCAN_SCAN_PRIVATE_H_
+#define SERVICE_SCAN_SCAN_PRIVATE_H_
+
+#if (SCAN_SLOT_COUNT < 1) || (SCAN_SLOT_COUNT > 4)
+#error "SCAN_SLOT_COUNT must be 1 to 4"
+#endif
+
+#define SCAN_SENSOR_COUNT		4
+#define SCAN_MODE_COUNT			4
+
+/* period computed from the speed (SCAN_MODE_PERIODS_US) */
+#define SCAN_BY_SPEED			0xFFFFFFFFUL
+#define SCAN_US_PER_S			1000000UL
+
+/**
+ * @brief State of one sensor.
+ */
+typedef struct
+{
+	f32 Scan_f32Distance;		/**< Last accepted distance (cm). */
+	f32 Scan_f32Raw;			/**< Reading of the current slot, not checked yet. */
+	u32 Scan_u32Time;			/**< us, trigger time of the accepted distance. */
+	u32 Scan_u32LastTrigger;	/**< us, last trigger of the sensor. */
+	u32 Scan_u32Period;			/**< us between two pings, 0 when off. */
+	u8 Scan_u8Valid;			/**< A distance was accepted. */
+	u8 Scan_u8New;				/**< The accepted distance was not read with SSCAN_u8GetNewDistance. */
+	u8 Scan_u8Requested;		/**< Pinged at the next slot whatever its period. */
+}SCAN_SENSOR_t;
+
+#endif /* SERVICE_SCAN_SCAN_PRIVATE_H_ */
@@ -0,0 +1,81 @@
+/******************************************************************************
+ *
+ * @file Trace_Interface.h
+ *
+ * @brief Interface file for the Trace (flight recorder) module.
+ *
+ * The recorder keeps the last TRACE_BUFFER_SIZE events in a RAM ring buffer with
+ * microsecond timestamps, so the sequence leading to an incident can be dumped
+ * over USART6 after the car stops and replayed on the host.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_TRACE_TRACE_INTERFACE_H_
+#define SERVICE_TRACE_TRACE_INTERFACE_H_
+
+/**
+ * @brief Recorded event types.
+ *
+ * The numbering is part of the dump format, new events must be appended.
+ */
+typedef enum
+{
+	STRACE_EVT_US_DISTANCE = 1,	/**< Arg: USNUM_t sensor,           Value: distance in cm */
+	STRACE_EVT_MOTOR_STATE,		/**< Arg: new MOTOR_STATE_T,        Value: G_u32SpeedIndicator */
+	STRACE_EVT_MOTOR_SPEED,		/**< Arg: 0,                        Value: G_u32SpeedIndicator */
+	STRACE_EVT_BT_ORDER,		/**< Arg: 0,                        Value: Bluetooth order byte */
+	STRACE_EVT_LINK_RX,			/**< Arg: USART number,             Value: received byte (handshake / V2V data) */
+	STRACE_EVT_LINK_TX,			/**< Arg: USART number,             Value: transmitted byte (handshake / V2V data) */
+	STRACE_EVT_MARKER,			/**< Arg: free,                     Value: free (application markers) */
+	STRACE_EVT_BEACON_STATUS,	/**< Arg: sender vehicle ID,        Value: color << 12 | brake << 11 | speed in cm/s (11 bits) */
+	STRACE_EVT_BEACON_DISTANCE,	/**< Arg: sender vehicle ID,        Value: sender front obstacle distance in cm */
+	STRACE_EVT_BEACON_POS_X,	/**< Arg: sender vehicle ID,        Value: sender X position in cm (s16) */
+	STRACE_EVT_BEACON_POS_Y,	/**< Arg: sender vehicle ID,        Value: sender Y position in cm (s16) */
+	STRACE_EVT_EMERGENCY_TX,	/**< Arg: emergency kind,           Value: sequence */
+	STRACE_EVT_EMERGENCY_RX,	/**< Arg: sender vehicle ID,        Value: kind << 8 | sequence */
+	STRACE_EVT_EMERGENCY_LATENCY,	/**< Arg: acknowledging vehicle ID, Value: one way latency in 100 us */
+	STRACE_EVT_POWER_PROFILE,	/**< Arg: new power profile,        Value: HCLK in MHz */
+	STRACE_EVT_US_CROSSTALK,	/**< Arg: USNUM_t sensor,           Value: rejected distance in cm */
+	STRACE_EVT_LINK_MSG_RX,		/**< Arg: message bytes left after this one, Value: channel << 8 | received message byte */
+	STRACE_EVT_LINK_MSG_TX,		/**< Arg: message bytes left after this one, Value: channel << 8 | sent message byte */
+	STRACE_EVT_LINK_RETRY,		/**< Arg: message sequence,         Value: channel << 8 | retransmission count */
+	STRACE_EVT_LINK_RESET,		/**< Arg: new sequence,             Value: channel << 8 | messages dropped */
+	STRACE_EVT_FUSION_CLASS,	/**< Arg: class of the forward target, Value: track << 8 | confidence in % */
+	STRACE_EVT_CLOCK_SYNC,		/**< Arg: other vehicle ID,         Value: clock drift in ppm (s16), 0 on a (re)start */
+	STRACE_EVT_OVERTAKE,		/**< Arg: other vehicle ID,         Value: SV2V_OVERTAKE_... state << 12 | speed cap in cm/s */
+	STRACE_EVT_BLIND_SPOT		/**< Arg: side sensor (USNUM_t),    Value: SBSM_STATE_... of the side */
+
+}STRACE_EVENT_t;
+
+/**
+ * @brief Initialize the recorder.
+ *
+ * Clears the ring buffer and starts recording.
+ *
+ * @note The microsecond timebase (MTMR_voidTimeBaseInit) must be running.
+ */
+void STRACE_voidInit(void);
+
+/**
+ * @brief Record one event.
+ *
+ * Safe to call from thread and interrupt context: each caller reserves its own
+ * slot with a single atomic increment, no interrupt masking is needed.
+ *
+ * @param Copy_u8Event  The event type (STRACE_EVENT_t).
+ * @param Copy_u8Arg    The event argument.
+ * @param Copy_u16Value The event value.
+ */
+void STRACE_voidLog(u8 Copy_u8Event, u8 Copy_u8Arg, u16 Copy_u16Value);
+
+/**
+ * @brief Dump the recorded events over USART6, oldest first.
+ *
+ * Recording is paused during the dump and resumed afterwards.
+ */
+void STRACE_voidDump(void);
+
+#endif /* SERVICE_TRACE_TRACE_INTERFACE_H_ */
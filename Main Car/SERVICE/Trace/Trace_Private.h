@@ -0,0 +1,44 @@
+/******************************************************************************
+ *
+ * @File: Trace_Private.h
+ *
+ * @Brief: Private definitions for the Trace (flight recorder) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_TRACE_TRACE_PRIVATE_H_
+#define SERVICE_TRACE_TRACE_PRIVATE_H_
+
+#if ((TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1)) != 0)
+#error "TRACE_BUFFER_SIZE must be a power of two"
+#endif
+
+#define TRACE_INDEX_MASK		(TRACE_BUFFER_SIZE - 1)
+
+/**
+ * @brief Dump header sent before the recorded events.
+ *
+ * "TRCE" | version | entry size | entries count (u16, little endian)
+ */
+#define TRACE_MAGIC_0			'T'
+#define TRACE_MAGIC_1			'R'
+#define TRACE_MAGIC_2			'C'
+#define TRACE_MAGIC_3			'E'
+#define TRACE_FORMAT_VERSION	1
+
+/**
+ * @brief One recorded event (8 bytes, little endian on the wire).
+ */
+typedef struct
+{
+	u32 Trace_u32Timestamp;	/**< Microseconds from the system timebase. */
+	u8  Trace_u8Event;		/**< One of STRACE_EVENT_t. */
+	u8  Trace_u8Arg;		/**< Event argument (sensor number, motor state, ...). */
+	u16 Trace_u16Value;		/**< Event value (distance in cm, speed, data byte, ...). */
+}TRACE_ENTRY_t;
+
+#endif /* SERVICE_TRACE_TRACE_PRIVATE_H_ */
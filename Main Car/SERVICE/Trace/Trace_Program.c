@@ -0,0 +1,128 @@
+/******************************************************************************
+ *
+ * @File: Trace_Program.c
+ *
+ * @Brief: Implementation of functions for the Trace (flight recorder) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                           Standard Types                                  *
+ *******************************************************************************/
+#include "../../LIB/ITI_STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "../../MCAL/GPTimer/TIMER_interface.h"
+#include "../../MCAL/USART/USART_Interface.h"
+
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "Trace_Interface.h"
+#include "Trace_Config.h"
+#include "Trace_Private.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+static TRACE_ENTRY_t STRACE_AstrBuffer[TRACE_BUFFER_SIZE];
+/* free running write counter, the slot is (counter & TRACE_INDEX_MASK) */
+static volatile u32 STRACE_u32Head = 0;
+static volatile u8  STRACE_u8Frozen = 1;
+
+/*******************************************************************************
+ *                          	Private Functions                              *
+ *******************************************************************************/
+static void STRACE_voidSendU16(u16 Copy_u16Data)
+{
+	MUSART6_voidTransmitData((u8)(Copy_u16Data));
+	MUSART6_voidTransmitData((u8)(Copy_u16Data >> 8));
+}
+
+/*******************************************************************************
+ *                          	APIs Implementation                            *
+ *******************************************************************************/
+/**
+ * @brief Initialize the recorder.
+ *
+ * This function clears the write counter and enables recording.
+ */
+void STRACE_voidInit(void)
+{
+	STRACE_u32Head = 0;
+	STRACE_u8Frozen = 0;
+}
+
+/**
+ * @brief Record one event in the ring buffer.
+ *
+ * The slot is reserved with an atomic fetch-and-add (LDREX/STREX on Cortex-M4),
+ * so an interrupt that logs in the middle of a thread-mode log gets its own slot.
+ * When the buffer is full the oldest event is overwritten.
+ *
+ * @param Copy_u8Event  The event type (STRACE_EVENT_t).
+ * @param Copy_u8Arg    The event argument.
+ * @param Copy_u16Value The event value.
+ */
+void STRACE_voidLog(u8 Copy_u8Event, u8 Copy_u8Arg, u16 Copy_u16Value)
+{
+	TRACE_ENTRY_t * L_pstrEntry;
+
+	if (STRACE_u8Frozen == 0)
+	{
+		L_pstrEntry = &STRACE_AstrBuffer[__atomic_fetch_add(&STRACE_u32Head, 1, __ATOMIC_RELAXED) & TRACE_INDEX_MASK];
+		L_pstrEntry->Trace_u32Timestamp = MTMR_u32GetMicros();
+		L_pstrEntry->Trace_u8Event  = Copy_u8Event;
+		L_pstrEntry->Trace_u8Arg    = Copy_u8Arg;
+		L_pstrEntry->Trace_u16Value = Copy_u16Value;
+	}
+	else
+	{
+		// recorder paused (not initialized or dumping)
+	}
+}
+
+/**
+ * @brief Dump the recorded events over USART6.
+ *
+ * The dump is a "TRCE" header followed by the events from the oldest to the newest,
+ * each one as timestamp (u32), event (u8), argument (u8) and value (u16), little endian.
+ */
+void STRACE_voidDump(void)
+{
+	u32 L_u32Head;
+	u32 L_u32Count;
+	u32 L_u32Index;
+	TRACE_ENTRY_t * L_pstrEntry;
+
+	STRACE_u8Frozen = 1;
+	L_u32Head  = STRACE_u32Head;
+	L_u32Count = (L_u32Head < TRACE_BUFFER_SIZE) ? L_u32Head : TRACE_BUFFER_SIZE;
+
+	MUSART6_voidTransmitData(TRACE_MAGIC_0);
+	MUSART6_voidTransmitData(TRACE_MAGIC_1);
+	MUSART6_voidTransmitData(TRACE_MAGIC_2);
+	MUSART6_voidTransmitData(TRACE_MAGIC_3);
+	MUSART6_voidTransmitData(TRACE_FORMAT_VERSION);
+	MUSART6_voidTransmitData(sizeof(TRACE_ENTRY_t));
+	STRACE_voidSendU16((u16)L_u32Count);
+
+	for (L_u32Index = L_u32Head - L_u32Count; L_u32Index != L_u32Head; L_u32Index++)
+	{
+		L_pstrEntry = &STRACE_AstrBuffer[L_u32Index & TRACE_INDEX_MASK];
+		STRACE_voidSendU16((u16)(L_pstrEntry->Trace_u32Timestamp));
+		STRACE_voidSendU16((u16)(L_pstrEntry->Trace_u32Timestamp >> 16));
+		MUSART6_voidTransmitData(L_pstrEntry->Trace_u8Event);
+		MUSART6_voidTransmitData(L_pstrEntry->Trace_u8Arg);
+		STRACE_voidSendU16(L_pstrEntry->Trace_u16Value);
+	}
+
+	STRACE_u8Frozen = 0;
+}
@@ -0,0 +1,83 @@
+/******************************************************************************
+ *
+ * @file Ttc_Interface.h
+ *
+ * @brief Interface file for the Ttc (time to collision) module.
+ *
+ * The task takes the new readings of the scanner (SERVICE/Scan) and filters
+ * them per direction into a range and a range rate, in fixed point. The time
+ * to collision divides the range by the closing speed:
+ *  - the range rate of the track once it has TTC_MIN_SAMPLES readings,
+ *  - ahead, combined with the V2V speed difference to the nearest car ahead
+ *    (neighbour table), or this car's own speed for an obstacle without V2V
+ *    while the track is new.
+ *
+ * @note Include Ultrasonic_Interface.h before this file. Not interrupt safe:
+ *       the task and the queries run in the main loop.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SERVICE_TTC_TTC_INTERFACE_H_
+#define SERVICE_TTC_TTC_INTERFACE_H_
+
+/**
+ * @brief Time to collision when nothing is closing in.
+ */
+#define STTC_NO_COLLISION			0xFFFFFFFFUL
+
+/**
+ * @brief Filtered range of a direction.
+ */
+typedef struct
+{
+	u16 Range_u16Cm;				/**< Filtered range in cm. */
+	u32 Range_u32Time;				/**< Local time of the last reading in the track in us. */
+	u8  Range_u8Track;				/**< Number of the track, it changes when a new target is taken. */
+}STTC_RANGE_t;
+
+/**
+ * @brief Forget the tracks.
+ *
+ * @note SSCAN_voidInit must be called before.
+ */
+void STTC_voidInit(void);
+
+/**
+ * @brief Take the new readings of the scanner into the tracks.
+ *
+ * Call it from the main loop after SSCAN_voidTask.
+ *
+ * @param Copy_u16OwnSpeedCmS Speed of this car in cm/s.
+ */
+void STTC_voidTask(u16 Copy_u16OwnSpeedCmS);
+
+/**
+ * @brief Get the time to collision in a direction.
+ *
+ * @param Copy_Sensor The direction.
+ * @return The time in ms (0 when already due), STTC_NO_COLLISION if there is
+ *         no target or it doesn't come closer.
+ */
+u32 STTC_u32GetTtc(USNUM_t Copy_Sensor);
+
+/**
+ * @brief Get the closing speed used for the time to collision.
+ *
+ * @param Copy_Sensor The direction.
+ * @return The speed in cm/s, positive when closing, 0 without target.
+ */
+s16 STTC_s16GetClosingSpeed(USNUM_t Copy_Sensor);
+
+/**
+ * @brief Get the filtered range of the target in a direction.
+ *
+ * @param Copy_Sensor The direction.
+ * @param P_strRange  Where the range is written.
+ * @return OK, NOK if there is no target, OUT_OF_RANGE, NULL_PTR_ERR.
+ */
+u8 STTC_u8GetRange(USNUM_t Copy_Sensor, STTC_RANGE_t * P_strRange);
+
+#endif /* SERVICE_TTC_TTC_INTERFACE_H_ */
@@ -0,0 +1,41 @@
+/******************************************************************************
+ *
+ * @File: Ttc_Private.h
+ *
+ * @Brief: Private definitions for the Ttc Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_TTC_TTC_PRIVATE_H_
+#define SERVICE_TTC_TTC_PRIVATE_H_
+
+#if (TTC_ALPHA_Q8 > 256) || (TTC_BETA_Q8 > 256) || (TTC_V2V_WEIGHT_Q8 > 256)
+#error "The TTC gains and weights are fractions of 256"
+#endif
+
+#define TTC_SENSOR_COUNT		4
+
+/* fixed point: ranges in 1/16 cm, rates in 1/16 cm/s */
+#define TTC_ONE					16
+#define TTC_MS_PER_S			1000
+#define TTC_US_PER_MS			1000UL
+#define TTC_Q8_ONE				256
+
+/**
+ * @brief Range track of one direction.
+ */
+typedef struct
+{
+	s32 Ttc_s32Range;			/**< Filtered range (1/16 cm). */
+	s32 Ttc_s32Rate;			/**< Range rate (1/16 cm/s), negative when closing. */
+	u32 Ttc_u32Time;			/**< us, time of the last reading in the track. */
+	u32 Ttc_u32Seen;			/**< us, time of the last reading taken from the scanner. */
+	u8 Ttc_u8Samples;			/**< Readings in the track, 0 when there is no target. */
+	u8 Ttc_u8Track;				/**< Number of the track, counts the new targets. */
+}TTC_TRACK_t;
+
+#endif /* SERVICE_TTC_TTC_PRIVATE_H_ */
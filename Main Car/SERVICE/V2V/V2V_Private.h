@@ -0,0 +1,200 @@
+/******************************************************************************
+ *
+ * @File: V2V_Private.h
+ *
+ * @Brief: Private definitions for the V2V (vehicle status beacon) Module
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+
+#ifndef SERVICE_V2V_V2V_PRIVATE_H_
+#define SERVICE_V2V_V2V_PRIVATE_H_
+
+/**
+ * @brief Frame format on the Raspberry link.
+ *
+ * SYNC | TYPE | LENGTH | PAYLOAD (LENGTH bytes) | CHECKSUM
+ *
+ * The checksum is the XOR of TYPE, LENGTH and the payload bytes. The legacy
+ * handshake bytes are all below 0x80, so a SYNC byte always starts a frame.
+ */
+#define V2V_SYNC_BYTE			0xAA
+#define V2V_FRAME_OVERHEAD		4
+#define V2V_MAX_PAYLOAD			24
+
+/**
+ * @brief Frame types.
+ */
+#define V2V_TYPE_BEACON			0x01
+#define V2V_TYPE_EMERGENCY		0x02
+#define V2V_TYPE_EMERGENCY_ACK	0x03
+#define V2V_TYPE_TIME_REQUEST	0x04
+#define V2V_TYPE_TIME_RESPONSE	0x05
+#define V2V_TYPE_OVERTAKE		0x06
+#define V2V_TYPE_OVERTAKE_ACK	0x07
+
+/**
+ * @brief Beacon payload (little endian).
+ *
+ * id (1) | color (1) | pos X cm (2) | pos Y cm (2) | speed cm/s (2) |
+ * heading deg (2) | brake (1) | front distance cm (2) | timestamp us (4) |
+ * acceleration cm/s2 (2, signed)
+ *
+ * The timestamp is the sender time of the position integration the status
+ * was taken with. The acceleration is the speed change since the previous
+ * beacon of the sender.
+ */
+#define V2V_BEACON_LENGTH		19
+
+/**
+ * @brief Emergency payload (little endian).
+ *
+ * id (1) | kind (1) | sequence (1) | sender time us (4)
+ */
+#define V2V_EMERGENCY_LENGTH	7
+
+/**
+ * @brief Emergency acknowledge payload (little endian).
+ *
+ * id (1) | warning sender id (1) | sequence (1) | echoed sender time us (4) |
+ * turnaround us (4)
+ *
+ * The turnaround is the time the acknowledge waited in the receiver, so the
+ * warning sender gets the one way latency as (round trip - turnaround) / 2.
+ */
+#define V2V_EMERGENCY_ACK_LENGTH	11
+
+/**
+ * @brief Time request payload (little endian), sent to all the cars.
+ *
+ * id (1) | T1: sender time us (4)
+ */
+#define V2V_TIME_REQUEST_LENGTH		5
+
+/**
+ * @brief Time response payload (little endian).
+ *
+ * id (1) | requester id (1) | echoed T1 (4) | T2: request reception us (4) |
+ * T3: response sending us (4)
+ *
+ * T2 and T3 are in the clock of the responder, the requester adds T4, the
+ * reception of the response in its own clock.
+ */
+#define V2V_TIME_RESPONSE_LENGTH	14
+
+/**
+ * @brief Overtake payload (little endian), from the passing car to the lead car.
+ *
+ * id (1) | lead id (1) | kind (1) | sequence (1) | speed cap cm/s (2) |
+ * hold time ms (2)
+ *
+ * A REQUEST asks the lead car to keep its speed at or below the cap for the
+ * hold time, counted from the reception. A COMPLETE releases it earlier.
+ */
+#define V2V_OVERTAKE_LENGTH			8
+#define V2V_OVERTAKE_REQUEST		1
+#define V2V_OVERTAKE_COMPLETE		2
+
+/**
+ * @brief Overtake acknowledge payload (little endian).
+ *
+ * id (1) | requester id (1) | sequence (1) | result (1) | speed cap held cm/s (2)
+ */
+#define V2V_OVERTAKE_ACK_LENGTH		6
+#define V2V_OVERTAKE_GRANTED		1
+#define V2V_OVERTAKE_REFUSED		2
+#define V2V_OVERTAKE_RELEASED		3
+
+/**
+ * @brief Unit of the latency recorded in the trace (us).
+ */
+#define V2V_LATENCY_UNIT_US		100
+
+#define V2V_US_PER_MS			1000UL
+#define V2V_MS_PER_S			1000L
+#define V2V_MM_PER_CM			10L
+
+/**
+ * @brief Largest acceleration sent in the beacons (cm/s2), a speed order step between two beacons is clipped.
+ */
+#define V2V_MAX_ACCEL			2000L
+
+/**
+ * @brief Receive parser states.
+ */
+typedef enum
+{
+	V2V_RX_SYNC,
+	V2V_RX_TYPE,
+	V2V_RX_LENGTH,
+	V2V_RX_PAYLOAD,
+	V2V_RX_CHECKSUM
+
+}V2V_RX_STATE_t;
+
+#if ((V2V_RX_QUEUE_SIZE & (V2V_RX_QUEUE_SIZE - 1)) != 0)
+#error "V2V_RX_QUEUE_SIZE must be a power of two"
+#endif
+
+#define V2V_RX_QUEUE_MASK		(V2V_RX_QUEUE_SIZE - 1)
+
+#if ((V2V_RX_FRAMES & (V2V_RX_FRAMES - 1)) != 0)
+#error "V2V_RX_FRAMES must be a power of two"
+#endif
+
+#define V2V_RX_FRAMES_MASK		(V2V_RX_FRAMES - 1)
+
+/**
+ * @brief Frame checked by the USART1 interrupt, decoded by PendSV.
+ */
+typedef struct
+{
+	u8  Frame_u8Type;
+	u8  Frame_u8Length;
+	u32 Frame_u32RxTime;		/**< us, reception of the checksum byte. */
+	u8  Frame_Au8Payload[V2V_MAX_PAYLOAD];
+}V2V_FRAME_t;
+
+/**
+ * @brief Overtake of this car being asked or released, SV2V_OVERTAKE_... otherwise.
+ */
+#define V2V_OVERTAKE_COMPLETING		0xFF
+
+/**
+ * @brief Emergency to acknowledge, written by the USART1 interrupt and sent by the task.
+ */
+typedef struct
+{
+	u8  Ack_u8Sender;
+	u8  Ack_u8Sequence;
+	u32 Ack_u32SenderTime;
+	u32 Ack_u32RxTime;
+}V2V_ACK_t;
+
+/**
+ * @brief Overtake acknowledge, written by the receive work (PendSV) and sent by the task.
+ */
+typedef struct
+{
+	u8  OvtAck_u8Requester;
+	u8  OvtAck_u8Sequence;
+	u8  OvtAck_u8Result;
+	u16 OvtAck_u16Cap;
+}V2V_OVERTAKE_ACK_t;
+
+/**
+ * @brief Time exchange, a request to answer or a response to give to SERVICE/Clock.
+ */
+typedef struct
+{
+	u8  Time_u8Peer;			/**< Requester of the request, responder of the response. */
+	u32 Time_u32T1;
+	u32 Time_u32T2;
+	u32 Time_u32T3;
+	u32 Time_u32T4;
+}V2V_TIME_t;
+
+#endif /* SERVICE_V2V_V2V_PRIVATE_H_ */
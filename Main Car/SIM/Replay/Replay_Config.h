@@ -0,0 +1,55 @@
+/******************************************************************************
+ *
+ * @file Replay_Config.h
+ *
+ * @brief Configuration file for the host replay harness.
+ *
+ * The replay build runs the application code of main.c on a PC against a
+ * flight recorder dump. These values define how the virtual clock advances
+ * while the application runs, since the host does not execute at MCU speed.
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ *****************************************************************************/
+#ifndef SIM_REPLAY_REPLAY_CONFIG_H_
+#define SIM_REPLAY_REPLAY_CONFIG_H_
+
+/**
+ * @brief Virtual duration of one pass of the main loop in microseconds.
+ *
+ * Each HDCM call ticks the clock by this much. The passes that have nothing to
+ * do go to sleep (MSTK_voidSleep), which moves the clock to the deadline or the
+ * next recorded input.
+ */
+#define REPLAY_LOOP_TICK_US			2
+
+/**
+ * @brief SysTick ticks per microsecond (AHB / 8 with the 16 MHz HSI).
+ *
+ * Used to convert MSTK_voidSetBusyWait() delays into virtual time.
+ */
+#define REPLAY_STK_TICKS_PER_US		2
+
+/**
+ * @brief Distance returned by a sensor that has no recorded reading yet (cm).
+ */
+#define REPLAY_US_NO_READING_CM		400
+
+/**
+ * @brief Echo time per centimetre of measured distance (round trip, us).
+ */
+#define REPLAY_US_ECHO_US_PER_CM	58
+
+/**
+ * @brief Time the replay keeps running after the last recorded event (us).
+ */
+#define REPLAY_TAIL_US				1000000
+
+/**
+ * @brief Largest trace accepted (the dump counter is 16 bits wide).
+ */
+#define REPLAY_MAX_ENTRIES			65535
+
+#endif /* SIM_REPLAY_REPLAY_CONFIG_H_ */
@@ -0,0 +1,943 @@
+/******************************************************************************
+ *
+ * @File: Replay_Program.c
+ *
+ * @Brief: Host replay harness for the Main Car application
+ *
+ * The application code of main.c (blind spot, object detected and overtake
+ * branches, APP_voidDecodeRasspData) is compiled for the PC together with
+ * host versions of the MCAL and HAL drivers it uses. Instead of touching the
+ * hardware, these drivers take their results from a flight recorder dump:
+ *
+ *  - HUS_u8StartMeasure() takes the last distance recorded for the sensor at
+ *    the current virtual time, HUS_u8GetDistance() gives it once its echo
+ *    time has passed. The real scanner module schedules the pings.
+ *  - SLNK_u8Receive() returns the next message received from the raspberry
+ *    pi on the channel once the virtual time reaches it, the link transport
+ *    itself is not replayed (the recorded messages already went through it).
+ *    The telemetry messages are not printed, the camera detections go
+ *    through the real camera and fusion modules, the class changes of the
+ *    forward target are printed.
+ *  - Bluetooth orders are applied to G_u8BluetoothOrder when the virtual time
+ *    reaches them, like the USART6 interrupt does on the car.
+ *  - The neighbour beacons recorded by the V2V task are encoded again as
+ *    frames and given to the V2V receive hook when the virtual time reaches
+ *    them, so the real V2V and neighbour table modules run on them.
+ *  - The answers of the car ahead to the overtake requests are given back
+ *    the same way, as acknowledges of the request in progress. The requests
+ *    and releases of the application are printed.
+ *
+ * The virtual clock advances with busy waits, sensor echoes, motor commands
+ * and the sleep of the idle main loop (see Replay_Config.h). The motor, LED and raspberry link messages
+ * of the application are printed one per line with their virtual time, so
+ * the output of a recorded run can be kept and compared after every change.
+ *
+ * Build (from the Main Car folder):
+ *     gcc -o replay SIM/Replay/Replay_Program.c
+ * Run:
+ *     ./replay [-v] <trace file>      (-v also prints the replayed inputs)
+ *
+ * The replay stops REPLAY_TAIL_US after the last recorded event.
+ *
+ * The Traces folder keeps short traces of the object ahead, overtake granted,
+ * overtake refused and blind spot cases with their expected output
+ * (side_rates: one side pinged slower than the other while turning). Check
+ * them after every change (from the repository folder):
+ *     python Tools/replay_check.py <replay binary> "Main Car/SIM/Replay/Traces"
+ *
+ * @Author: Project Team
+ *
+ * @Date: November 11, 2023
+ *
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+/* the project defines its own NULL in ITI_STD_TYPES.h */
+#undef NULL
+
+/*******************************************************************************
+ *                          	Application                                    *
+ *******************************************************************************/
+/* the application entry becomes APP_voidMain, main() is the replay entry */
+#define main APP_voidMain
+#include "../../main.c"
+#undef main
+
+/* the V2V services run for real, fed by the replayed frames */
+#include "../../SERVICE/V2V/V2V_Program.c"
+#include "../../SERVICE/Neighbour/Neighbour_Program.c"
+#include "../../SERVICE/Clock/Clock_Program.c"
+/* the pose is integrated from the replayed motor commands */
+#include "../../SERVICE/Odometry/Odometry_Program.c"
+#include "../../SERVICE/Manoeuvre/Manoeuvre_Program.c"
+/* the scanner runs for real on the replayed distances */
+#include "../../SERVICE/Scan/Scan_Program.c"
+#include "../../SERVICE/Ttc/Ttc_Program.c"
+#include "../../SERVICE/Camera/Camera_Program.c"
+#include "../../SERVICE/Fusion/Fusion_Program.c"
+#include "../../SERVICE/Cacc/Cacc_Program.c"
+/* the blind spot monitor runs for real, the LED patterns are printed */
+#include "../../SERVICE/BlindSpot/BlindSpot_Program.c"
+
+/*******************************************************************************
+ *                          	Private Components                             *
+ *******************************************************************************/
+#include "../../HAL/DC_Motor/DC_Motor_Private.h"
+#include "../../SERVICE/Trace/Trace_Private.h"
+#include "../../SERVICE/Link/Link_Config.h"
+#include "Replay_Config.h"
+
+/*******************************************************************************
+ *                          	Global Variables	                           *
+ *******************************************************************************/
+/* owned by the USART and DC motor drivers on the car */
+u8 G_u8BluetoothOrder = 'S';
+u32 G_u32SpeedIndicator = 4000;
+static void (*REPLAY_pfCommandHook)(void) = NULL;
+
+static TRACE_ENTRY_t REPLAY_AstrEntries[REPLAY_MAX_ENTRIES];
+static u32 REPLAY_u32Count = 0;
+/* virtual time in microseconds since the first recorded event */
+static u32 REPLAY_u32Now = 0;
+static u32 REPLAY_u32End = 0;
+static u8  REPLAY_u8Verbose = 0;
+
+/* next entry to check for each kind of input */
+static u32 REPLAY_u32OrderCursor = 0;
+static u32 REPLAY_Au32LinkCursor[LNK_CHANNEL_COUNT];
+static u32 REPLAY_Au32UsCursor[BACKWARD_US + 1];
+static f32 REPLAY_Af32UsDistance[BACKWARD_US + 1];
+/* measurement in progress of each sensor: result, time it is ready, range gate */
+static u8  REPLAY_Au8UsMeasuring[BACKWARD_US + 1];
+static f32 REPLAY_Af32UsResult[BACKWARD_US + 1];
+static u32 REPLAY_Au32UsReady[BACKWARD_US + 1];
+static u16 REPLAY_Au16UsGate[BACKWARD_US + 1];
+static u32 REPLAY_u32BeaconCursor = 0;
+/* neighbour beacons rebuilt from the trace, indexed by vehicle ID */
+static SV2V_BEACON_t REPLAY_AstrBeacons[256];
+/* USART1 receive hook installed by the V2V module (the link module is replaced) */
+static u8 (*REPLAY_pfRxHook)(u8) = NULL;
+
+/* last printed outputs, only changes are printed */
+static u32 REPLAY_u32PrintedSpeed;
+static u8  REPLAY_Au8LedPattern[2] = { HLED_OFF, HLED_OFF };
+
+static const char * const REPLAY_ApcMotorStates[] =
+{
+	"STOP", "FORWARD", "BACKWARD", "RIGHT", "LEFT",
+	"FORWARD_LEFT", "FORWARD_RIGHT", "BACK_LEFT", "BACK_RIGHT"
+};
+static const char * const REPLAY_ApcLedPatterns[] =
+{
+	"OFF", "STEADY", "BLINK", "PULSE"
+};
+static const char * const REPLAY_ApcSensors[] =
+{
+	"?", "FORWARD", "LEFT", "RIGHT", "BACKWARD"
+};
+
+/*******************************************************************************
+ *                          	Private Functions                              *
+ *******************************************************************************/
+static void REPLAY_voidPrintTime(void)
+{
+	printf("%12.6f  ", REPLAY_u32Now / 1e6);
+}
+
+static void REPLAY_voidFinish(const char * Copy_pcReason)
+{
+	REPLAY_voidPrintTime();
+	printf("END          %s\n", Copy_pcReason);
+	exit(0);
+}
+
+/**
+ * @brief Give a rebuilt beacon to the V2V receive hook as a frame.
+ */
+static void REPLAY_voidInjectBeacon(const SV2V_BEACON_t * P_Beacon)
+{
+	u8 L_Au8Frame[V2V_BEACON_LENGTH + V2V_FRAME_OVERHEAD];
+	u8 * L_pu8Payload = &L_Au8Frame[3];
+	u8 L_u8Checksum = 0;
+	u8 L_u8Index;
+
+	if (REPLAY_u8Verbose)
+	{
+		REPLAY_voidPrintTime();
+		printf("BEACON       id %-10u color %u brake %u speed %u front %u pos %d,%d\n", P_Beacon->Beacon_u8Id,
+			   P_Beacon->Beacon_u8Color, P_Beacon->Beacon_u8Brake, P_Beacon->Beacon_u16Speed,
+			   P_Beacon->Beacon_u16FrontDistance, P_Beacon->Beacon_s16PosX, P_Beacon->Beacon_s16PosY);
+	}
+	if (REPLAY_pfRxHook == NULL)
+	{
+		return;
+	}
+
+	L_Au8Frame[0] = V2V_SYNC_BYTE;
+	L_Au8Frame[1] = V2V_TYPE_BEACON;
+	L_Au8Frame[2] = V2V_BEACON_LENGTH;
+	L_pu8Payload[0] = P_Beacon->Beacon_u8Id;
+	L_pu8Payload[1] = P_Beacon->Beacon_u8Color;
+	SV2V_voidPutU16(&L_pu8Payload[2], (u16)P_Beacon->Beacon_s16PosX);
+	SV2V_voidPutU16(&L_pu8Payload[4], (u16)P_Beacon->Beacon_s16PosY);
+	SV2V_voidPutU16(&L_pu8Payload[6], P_Beacon->Beacon_u16Speed);
+	SV2V_voidPutU16(&L_pu8Payload[8], P_Beacon->Beacon_u16Heading);
+	L_pu8Payload[10] = P_Beacon->Beacon_u8Brake;
+	SV2V_voidPutU16(&L_pu8Payload[11], P_Beacon->Beacon_u16FrontDistance);
+	SV2V_voidPutU16(&L_pu8Payload[13], 0);
+	SV2V_voidPutU16(&L_pu8Payload[15], 0);
+	SV2V_voidPutU16(&L_pu8Payload[17], (u16)P_Beacon->Beacon_s16Accel);
+	for (L_u8Index = 1; L_u8Index < (V2V_BEACON_LENGTH + 3); L_u8Index++)
+	{
+		L_u8Checksum ^= L_Au8Frame[L_u8Index];
+	}
+	L_Au8Frame[V2V_BEACON_LENGTH + 3] = L_u8Checksum;
+
+	for (L_u8Index = 0; L_u8Index < sizeof(L_Au8Frame); L_u8Index++)
+	{
+		REPLAY_pfRxHook(L_Au8Frame[L_u8Index]);
+	}
+}
+
+/**
+ * @brief Give a recorded answer of the car ahead to the V2V receive hook as a frame.
+ *
+ * It acknowledges the overtake request of the application in progress, if any.
+ *
+ * @param Copy_u8LeadId The answering vehicle ID.
+ * @param Copy_u16Value The recorded state << 12 | speed cap in cm/s.
+ */
+static void REPLAY_voidInjectOvertakeAck(u8 Copy_u8LeadId, u16 Copy_u16Value)
+{
+	u8 L_Au8Frame[V2V_OVERTAKE_ACK_LENGTH + V2V_FRAME_OVERHEAD];
+	u8 * L_pu8Payload = &L_Au8Frame[3];
+	u8 L_u8Checksum = 0;
+	u8 L_u8Index;
+
+	if (REPLAY_u8Verbose)
+	{
+		REPLAY_voidPrintTime();
+		printf("OVERTAKE_ACK id %-10u %s cap %u\n", Copy_u8LeadId,
+			   ((Copy_u16Value >> 12) == SV2V_OVERTAKE_GRANTED) ? "GRANTED" : "REFUSED", Copy_u16Value & 0xFFF);
+	}
+	if (REPLAY_pfRxHook == NULL)
+	{
+		return;
+	}
+
+	L_Au8Frame[0] = V2V_SYNC_BYTE;
+	L_Au8Frame[1] = V2V_TYPE_OVERTAKE_ACK;
+	L_Au8Frame[2] = V2V_OVERTAKE_ACK_LENGTH;
+	L_pu8Payload[0] = Copy_u8LeadId;
+	L_pu8Payload[1] = V2V_OWN_ID;
+	L_pu8Payload[2] = SV2V_u8OvertakeSequence;
+	L_pu8Payload[3] = ((Copy_u16Value >> 12) == SV2V_OVERTAKE_GRANTED) ? V2V_OVERTAKE_GRANTED : V2V_OVERTAKE_REFUSED;
+	SV2V_voidPutU16(&L_pu8Payload[4], Copy_u16Value & 0xFFF);
+	for (L_u8Index = 1; L_u8Index < (V2V_OVERTAKE_ACK_LENGTH + 3); L_u8Index++)
+	{
+		L_u8Checksum ^= L_Au8Frame[L_u8Index];
+	}
+	L_Au8Frame[V2V_OVERTAKE_ACK_LENGTH + 3] = L_u8Checksum;
+
+	for (L_u8Index = 0; L_u8Index < sizeof(L_Au8Frame); L_u8Index++)
+	{
+		REPLAY_pfRxHook(L_Au8Frame[L_u8Index]);
+	}
+}
+
+/**
+ * @brief Move the virtual clock forward.
+ *
+ * Applies the Bluetooth orders and delivers the neighbour beacons and the
+ * overtake answers recorded up to the new time, as the USART interrupts would have done, and ends the
+ * replay after the recorded period.
+ */
+static void REPLAY_voidAdvance(u32 Copy_u32Micros)
+{
+	TRACE_ENTRY_t * L_pstrEntry;
+	SV2V_BEACON_t * L_pstrBeacon;
+
+	REPLAY_u32Now += Copy_u32Micros;
+
+	while (REPLAY_u32OrderCursor < REPLAY_u32Count)
+	{
+		L_pstrEntry = &REPLAY_AstrEntries[REPLAY_u32OrderCursor];
+		if (L_pstrEntry->Trace_u32Timestamp > REPLAY_u32Now)
+		{
+			break;
+		}
+		if (L_pstrEntry->Trace_u8Event == STRACE_EVT_BT_ORDER)
+		{
+			G_u8BluetoothOrder = (u8)L_pstrEntry->Trace_u16Value;
+			if (REPLAY_u8Verbose)
+			{
+				REPLAY_voidPrintTime();
+				printf("BT_ORDER     %c\n", G_u8BluetoothOrder);
+			}
+		}
+		REPLAY_u32OrderCursor++;
+	}
+
+	/* a beacon is recorded as STATUS, DISTANCE, POS_X, POS_Y */
+	while (REPLAY_u32BeaconCursor < REPLAY_u32Count)
+	{
+		L_pstrEntry = &REPLAY_AstrEntries[REPLAY_u32BeaconCursor];
+		if (L_pstrEntry->Trace_u32Timestamp > REPLAY_u32Now)
+		{
+			break;
+		}
+		L_pstrBeacon = &REPLAY_AstrBeacons[L_pstrEntry->Trace_u8Arg];
+		if (L_pstrEntry->Trace_u8Event == STRACE_EVT_BEACON_STATUS)
+		{
+			L_pstrBeacon->Beacon_u8Id = L_pstrEntry->Trace_u8Arg;
+			L_pstrBeacon->Beacon_u8Color = (u8)(L_pstrEntry->Trace_u16Value >> 12);
+			L_pstrBeacon->Beacon_u8Brake = (u8)((L_pstrEntry->Trace_u16Value >> 11) & 1);
+			L_pstrBeacon->Beacon_u16Speed = L_pstrEntry->Trace_u16Value & 0x7FF;
+		}
+		else if (L_pstrEntry->Trace_u8Event == STRACE_EVT_BEACON_DISTANCE)
+		{
+			L_pstrBeacon->Beacon_u16FrontDistance = L_pstrEntry->Trace_u16Value;
+		}
+		else if (L_pstrEntry->Trace_u8Event == STRACE_EVT_BEACON_POS_X)
+		{
+			L_pstrBeacon->Beacon_s16PosX = (s16)L_pstrEntry->Trace_u16Value;
+		}
+		else if (L_pstrEntry->Trace_u8Event == STRACE_EVT_BEACON_POS_Y)
+		{
+			L_pstrBeacon->Beacon_s16PosY = (s16)L_pstrEntry->Trace_u16Value;
+			REPLAY_voidInjectBeacon(L_pstrBeacon);
+		}
+		else if ((L_pstrEntry->Trace_u8Event == STRACE_EVT_OVERTAKE) &&
+				 (((L_pstrEntry->Trace_u16Value >> 12) == SV2V_OVERTAKE_GRANTED) ||
+				  ((L_pstrEntry->Trace_u16Value >> 12) == SV2V_OVERTAKE_REFUSED)))
+		{
+			REPLAY_voidInjectOvertakeAck(L_pstrEntry->Trace_u8Arg, L_pstrEntry->Trace_u16Value);
+		}
+		REPLAY_u32BeaconCursor++;
+	}
+
+	if (REPLAY_u32Now > REPLAY_u32End)
+	{
+		REPLAY_voidFinish("end of trace");
+	}
+}
+
+/**
+ * @brief Find the next entry of an event type at or after a cursor.
+ *
+ * @return The entry index, or REPLAY_u32Count when there is none.
+ */
+static u32 REPLAY_u32FindNext(u32 Copy_u32From, u8 Copy_u8Event, u8 Copy_u8Arg)
+{
+	u32 L_u32Index;
+
+	for (L_u32Index = Copy_u32From; L_u32Index < REPLAY_u32Count; L_u32Index++)
+	{
+		if ((REPLAY_AstrEntries[L_u32Index].Trace_u8Event == Copy_u8Event) &&
+			(REPLAY_AstrEntries[L_u32Index].Trace_u8Arg == Copy_u8Arg))
+		{
+			break;
+		}
+	}
+	return L_u32Index;
+}
+
+/**
+ * @brief Find the next byte received on a link channel at or after a cursor.
+ *
+ * @return The entry index, or REPLAY_u32Count when there is none.
+ */
+static u32 REPLAY_u32FindNextMessage(u8 Copy_u8Channel, u32 Copy_u32From)
+{
+	u32 L_u32Index;
+
+	for (L_u32Index = Copy_u32From; L_u32Index < REPLAY_u32Count; L_u32Index++)
+	{
+		if ((REPLAY_AstrEntries[L_u32Index].Trace_u8Event == STRACE_EVT_LINK_MSG_RX) &&
+			((REPLAY_AstrEntries[L_u32Index].Trace_u16Value >> 8) == Copy_u8Channel))
+		{
+			break;
+		}
+	}
+	return L_u32Index;
+}
+
+/* command stopped by the last HDCM_voidStop, see HDCM_voidResume */
+static enum MOTOR_STATE_T REPLAY_StoppedState = STOP;
+
+static void REPLAY_voidMotorState(enum MOTOR_STATE_T Copy_State)
+{
+	/* the motor driver only acts when the state changes */
+	REPLAY_voidAdvance(REPLAY_LOOP_TICK_US);
+	if (MOTOR_STATE != Copy_State)
+	{
+		if (REPLAY_pfCommandHook != NULL)
+		{
+			REPLAY_pfCommandHook();
+		}
+		MOTOR_STATE = Copy_State;
+		REPLAY_u32PrintedSpeed = G_u32SpeedIndicator;
+		REPLAY_voidPrintTime();
+		printf("MOTOR_STATE  %-13s speed %lu\n", REPLAY_ApcMotorStates[Copy_State], (unsigned long)G_u32SpeedIndicator);
+	}
+}
+
+/**
+ * @brief Read a little endian flight recorder dump into REPLAY_AstrEntries.
+ *
+ * Timestamps are rebased on the first event, so the virtual clock starts at 0
+ * and a single wrap of the 32 bit timebase inside the trace is harmless.
+ */
+static ERROR_STATE_T REPLAY_u8LoadTrace(const char * Copy_pcFileName)
+{
+	ERROR_STATE_T Loc_ErrorState = OK;
+	FILE * L_pFile;
+	u8 L_Au8Header[8];
+	u8 L_Au8Entry[8];
+	u32 L_u32Count;
+	u32 L_u32Index;
+	u32 L_u32Start = 0;
+
+	L_pFile = fopen(Copy_pcFileName, "rb");
+	if (L_pFile == NULL)
+	{
+		return NULL_PTR_ERR;
+	}
+
+	if ((fread(L_Au8Header, 1, sizeof(L_Au8Header), L_pFile) != sizeof(L_Au8Header)) ||
+		(L_Au8Header[0] != TRACE_MAGIC_0) || (L_Au8Header[1] != TRACE_MAGIC_1) ||
+		(L_Au8Header[2] != TRACE_MAGIC_2) || (L_Au8Header[3] != TRACE_MAGIC_3) ||
+		(L_Au8Header[4] != TRACE_FORMAT_VERSION) || (L_Au8Header[5] != sizeof(L_Au8Entry)))
+	{
+		Loc_ErrorState = NOK;
+	}
+	else
+	{
+		L_u32Count = L_Au8Header[6] | ((u32)L_Au8Header[7] << 8);
+		for (L_u32Index = 0; L_u32Index < L_u32Count; L_u32Index++)
+		{
+			if (fread(L_Au8Entry, 1, sizeof(L_Au8Entry), L_pFile) != sizeof(L_Au8Entry))
+			{
+				/* truncated capture, keep what was received */
+				break;
+			}
+			REPLAY_AstrEntries[L_u32Index].Trace_u32Timestamp = L_Au8Entry[0] | ((u32)L_Au8Entry[1] << 8) |
+																((u32)L_Au8Entry[2] << 16) | ((u32)L_Au8Entry[3] << 24);
+			REPLAY_AstrEntries[L_u32Index].Trace_u8Event = L_Au8Entry[4];
+			REPLAY_AstrEntries[L_u32Index].Trace_u8Arg = L_Au8Entry[5];
+			REPLAY_AstrEntries[L_u32Index].Trace_u16Value = L_Au8Entry[6] | ((u16)L_Au8Entry[7] << 8);
+
+			if (L_u32Index == 0)
+			{
+				L_u32Start = REPLAY_AstrEntries[0].Trace_u32Timestamp;
+			}
+			REPLAY_AstrEntries[L_u32Index].Trace_u32Timestamp = (u32)((REPLAY_AstrEntries[L_u32Index].Trace_u32Timestamp - L_u32Start) & 0xFFFFFFFFUL);
+		}
+		REPLAY_u32Count = L_u32Index;
+		if (REPLAY_u32Count > 0)
+		{
+			REPLAY_u32End = REPLAY_AstrEntries[REPLAY_u32Count - 1].Trace_u32Timestamp + REPLAY_TAIL_US;
+		}
+	}
+
+	fclose(L_pFile);
+	return Loc_ErrorState;
+}
+
+/*******************************************************************************
+ *                          	MCAL Replacements                              *
+ *******************************************************************************/
+void MRCC_VoidInit(void) {}
+void MRCC_VoidEnablePeriphral(u8 Copy_U8PeriphralBus, u8 Copy_U8PeriphralNumber) {}
+
+void MGPIO_voidSetPinMode(u8 Copy_u8PortName, u8 Copy_u8PinNum, u8 Copy_u8Mode) {}
+void MGPIO_voidSetOutPutMode(u8 Copy_u8PortName, u8 Copy_u8PinNum, u8 Copy_u8OutPutMode) {}
+void MGPIO_voidSetOutputSpeed(u8 Copy_u8PortName, u8 Copy_u8PinNum, u8 Copy_u8OutPutSpeed) {}
+void MGPIO_voidSetPinAltFun(u8 Copy_u8PortName, u8 Copy_u8PinNum, u8 Copy_u8AltFun) {}
+
+void MGPIO_voidSetPinValue(u8 Copy_u8PortName, u8 Copy_u8PinNum, u8 Copy_u8PinVal) {}
+
+void MSTK_voidInit(void) {}
+void MSTK_voidSetBusyWait(u32 Copy_u32Ticks)
+{
+	REPLAY_voidAdvance(Copy_u32Ticks / REPLAY_STK_TICKS_PER_US);
+}
+
+/* the core sleeps until the deadline or the next recorded entry, the input that would wake it */
+void MSTK_voidSleep(u32 Copy_u32Ticks, u8 (*Copy_pfIsBusy)(void))
+{
+	u32 L_u32Wake = REPLAY_u32Now + Copy_u32Ticks / REPLAY_STK_TICKS_PER_US;
+	u32 L_u32Next = (REPLAY_u32OrderCursor < REPLAY_u32BeaconCursor) ? REPLAY_u32OrderCursor : REPLAY_u32BeaconCursor;
+	u8 L_u8Channel;
+
+	for (L_u8Channel = 0; L_u8Channel < LNK_CHANNEL_COUNT; L_u8Channel++)
+	{
+		REPLAY_Au32LinkCursor[L_u8Channel] = REPLAY_u32FindNextMessage(L_u8Channel, REPLAY_Au32LinkCursor[L_u8Channel]);
+		if (REPLAY_Au32LinkCursor[L_u8Channel] < L_u32Next)
+		{
+			L_u32Next = REPLAY_Au32LinkCursor[L_u8Channel];
+		}
+	}
+
+	if ((Copy_pfIsBusy != NULL) && Copy_pfIsBusy())
+	{
+		return;
+	}
+	if ((L_u32Next < REPLAY_u32Count) && (REPLAY_AstrEntries[L_u32Next].Trace_u32Timestamp < L_u32Wake))
+	{
+		L_u32Wake = REPLAY_AstrEntries[L_u32Next].Trace_u32Timestamp;
+	}
+	REPLAY_voidAdvance(L_u32Wake - REPLAY_u32Now);
+}
+
+void MTMR_voidTimeBaseInit(void) {}
+u32 MTMR_u32GetMicros(void)
+{
+	return REPLAY_u32Now;
+}
+
+void MNVIC_voidInit(void) {}
+void MNVIC_voidEnableInterrupt(u8 Copy_u8IntPos) {}
+u8 MNVIC_u8EnterCritical(u8 Copy_u8GroupNum) { return 0; }
+void MNVIC_voidExitCritical(u8 Copy_u8SavedState) {}
+
+void MUSART1_voidInit(void) {}
+void MUSART6_voidInit(void) {}
+void MUSART6_voidTransmitData(u8 Copy_u8Data) {}
+
+/* the beacons of the car itself are not printed, its overtake requests and releases are */
+u8 MUSART1_u8QueueData(const u8 * P_u8Data, u8 Copy_u8Length)
+{
+	if ((Copy_u8Length == (V2V_OVERTAKE_LENGTH + V2V_FRAME_OVERHEAD)) && (P_u8Data[1] == V2V_TYPE_OVERTAKE))
+	{
+		REPLAY_voidPrintTime();
+		printf("OVERTAKE     %-13s lead %u cap %u hold %u\n", (P_u8Data[5] == V2V_OVERTAKE_REQUEST) ? "REQUEST" : "COMPLETE",
+			   P_u8Data[4], SV2V_u16GetU16(&P_u8Data[7]), SV2V_u16GetU16(&P_u8Data[9]));
+	}
+	return OK;
+}
+
+/* the emergency warnings of the application are printed */
+u8 MUSART1_u8QueueUrgentData(const u8 * P_u8Data, u8 Copy_u8Length)
+{
+	if ((Copy_u8Length > 4) && (P_u8Data[1] == V2V_TYPE_EMERGENCY))
+	{
+		REPLAY_voidPrintTime();
+		printf("EMERGENCY    kind %u seq %u\n", P_u8Data[4], P_u8Data[5]);
+	}
+	return OK;
+}
+
+u8 MUSART1_u8AddRxCallBack(u8 (*Copy_pfRxHook)(u8))
+{
+	REPLAY_pfRxHook = Copy_pfRxHook;
+	return OK;
+}
+
+/*******************************************************************************
+ *                          	HAL Replacements                               *
+ *******************************************************************************/
+void HUS_voidInit(void) {}
+
+/**
+ * @brief Sample and hold of the recorded distances.
+ *
+ * Takes the last reading of the sensor recorded up to the virtual time, cut
+ * at the range gate, it is ready after its echo time.
+ */
+u8 HUS_u8StartMeasure(USNUM_t A_USNUM_t_Ultrasonic_Num)
+{
+	u32 L_u32Next;
+	f32 L_f32Distance;
+
+	if ((A_USNUM_t_Ultrasonic_Num < FORWARD_US) || (A_USNUM_t_Ultrasonic_Num > BACKWARD_US))
+	{
+		return OUT_OF_RANGE;
+	}
+	if (REPLAY_Au8UsMeasuring[A_USNUM_t_Ultrasonic_Num])
+	{
+		return NOK;
+	}
+
+	while (1)
+	{
+		L_u32Next = REPLAY_u32FindNext(REPLAY_Au32UsCursor[A_USNUM_t_Ultrasonic_Num], STRACE_EVT_US_DISTANCE, A_USNUM_t_Ultrasonic_Num);
+		if ((L_u32Next >= REPLAY_u32Count) || (REPLAY_AstrEntries[L_u32Next].Trace_u32Timestamp > REPLAY_u32Now))
+		{
+			break;
+		}
+		REPLAY_Af32UsDistance[A_USNUM_t_Ultrasonic_Num] = REPLAY_AstrEntries[L_u32Next].Trace_u16Value;
+		REPLAY_Au32UsCursor[A_USNUM_t_Ultrasonic_Num] = L_u32Next + 1;
+	}
+
+	L_f32Distance = REPLAY_Af32UsDistance[A_USNUM_t_Ultrasonic_Num];
+	if ((REPLAY_Au16UsGate[A_USNUM_t_Ultrasonic_Num] != 0) && (L_f32Distance > REPLAY_Au16UsGate[A_USNUM_t_Ultrasonic_Num]))
+	{
+		L_f32Distance = REPLAY_Au16UsGate[A_USNUM_t_Ultrasonic_Num];
+	}
+	if (REPLAY_u8Verbose)
+	{
+		REPLAY_voidPrintTime();
+		printf("US_DISTANCE  %-13s %.0f cm\n", REPLAY_ApcSensors[A_USNUM_t_Ultrasonic_Num], L_f32Distance);
+	}
+	REPLAY_Af32UsResult[A_USNUM_t_Ultrasonic_Num] = L_f32Distance;
+	REPLAY_Au32UsReady[A_USNUM_t_Ultrasonic_Num] = REPLAY_u32Now + (u32)(L_f32Distance * REPLAY_US_ECHO_US_PER_CM);
+	REPLAY_Au8UsMeasuring[A_USNUM_t_Ultrasonic_Num] = 1;
+	return OK;
+}
+
+u8 HUS_u8GetDistance(USNUM_t A_USNUM_t_Ultrasonic_Num, f32 * P_f32Distance)
+{
+	if ((A_USNUM_t_Ultrasonic_Num < FORWARD_US) || (A_USNUM_t_Ultrasonic_Num > BACKWARD_US))
+	{
+		return OUT_OF_RANGE;
+	}
+	if ((REPLAY_Au8UsMeasuring[A_USNUM_t_Ultrasonic_Num] == 0) ||
+		(REPLAY_u32Now < REPLAY_Au32UsReady[A_USNUM_t_Ultrasonic_Num]))
+	{
+		return NOK;
+	}
+	REPLAY_Au8UsMeasuring[A_USNUM_t_Ultrasonic_Num] = 0;
+	*P_f32Distance = REPLAY_Af32UsResult[A_USNUM_t_Ultrasonic_Num];
+	return OK;
+}
+
+u8 HUS_u8SetRangeGate(USNUM_t A_USNUM_t_Ultrasonic_Num, u16 Copy_u16RangeCm)
+{
+	if ((A_USNUM_t_Ultrasonic_Num < FORWARD_US) || (A_USNUM_t_Ultrasonic_Num > BACKWARD_US))
+	{
+		return OUT_OF_RANGE;
+	}
+	REPLAY_Au16UsGate[A_USNUM_t_Ultrasonic_Num] = Copy_u16RangeCm;
+	return OK;
+}
+
+u8 HUS_u8IsMeasuring(void)
+{
+	u8 L_u8Sensor;
+
+	for (L_u8Sensor = FORWARD_US; L_u8Sensor <= BACKWARD_US; L_u8Sensor++)
+	{
+		if (REPLAY_Au8UsMeasuring[L_u8Sensor] != 0)
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief Blind spot LEDs: PB8 (right side) and PB9 (left side) on TIM4.
+ */
+void HLED_voidInit(void) {}
+
+u8 HLED_u8SetPattern(u8 Copy_u8Led, u8 Copy_u8Pattern)
+{
+	if ((Copy_u8Led > HLED_LEFT) || (Copy_u8Pattern > HLED_PULSE))
+	{
+		return OUT_OF_RANGE;
+	}
+	if (REPLAY_Au8LedPattern[Copy_u8Led] != Copy_u8Pattern)
+	{
+		REPLAY_Au8LedPattern[Copy_u8Led] = Copy_u8Pattern;
+		REPLAY_voidPrintTime();
+		printf("LED          %-13s %s\n", (Copy_u8Led == HLED_RIGHT) ? "RIGHT" : "LEFT", REPLAY_ApcLedPatterns[Copy_u8Pattern]);
+	}
+	return OK;
+}
+
+void HDCM_u8Init(void) {}
+void HDCM_voidStart(void) {}
+
+void HDCM_voidMoveForward(void)      { REPLAY_voidMotorState(FORWARD); }
+void HDCM_voidMoveBackward(void)     { REPLAY_voidMotorState(BACKWARD); }
+void HDCM_voidStop(void)
+{
+	REPLAY_StoppedState = MOTOR_STATE;
+	REPLAY_voidMotorState(STOP);
+}
+void HDCM_voidMoveRight(void)        { REPLAY_voidMotorState(RIGHT); }
+void HDCM_voidMoveLeft(void)         { REPLAY_voidMotorState(LEFT); }
+void HDCM_voidMoveForwardLeft(void)  { REPLAY_voidMotorState(FORWARD_LEFT); }
+void HDCM_voidMoveForwardRight(void) { REPLAY_voidMotorState(FORWARD_RIGHT); }
+void HDCM_voidMoveBackLeft(void)     { REPLAY_voidMotorState(BACK_LEFT); }
+void HDCM_voidMoveBackRight(void)    { REPLAY_voidMotorState(BACK_RIGHT); }
+void HDCM_voidResume(void)
+{
+	if (MOTOR_STATE == STOP)
+	{
+		REPLAY_voidMotorState(REPLAY_StoppedState);
+	}
+}
+
+u8 HDCM_u8CarState(u8 Copy_u8CarState)
+{
+	ERROR_STATE_T Loc_ErrorState = OK;
+
+	switch (Copy_u8CarState)
+	{
+	case 'F': HDCM_voidMoveForward();      break;
+	case 'B': HDCM_voidMoveBackward();     break;
+	case 'S': HDCM_voidStop();             break;
+	case 'R': HDCM_voidMoveRight();        break;
+	case 'L': HDCM_voidMoveLeft();         break;
+	case 'G': HDCM_voidMoveForwardLeft();  break;
+	case 'I': HDCM_voidMoveForwardRight(); break;
+	case 'J': HDCM_voidMoveBackRight();    break;
+	case 'H': HDCM_voidMoveBackLeft();     break;
+	default :
+		REPLAY_voidAdvance(REPLAY_LOOP_TICK_US);
+		Loc_ErrorState = NOK;
+		break;
+	}
+	return Loc_ErrorState;
+}
+
+/**
+ * @brief Print the speed when it changed since the last print.
+ */
+static void REPLAY_voidPrintSpeed(void)
+{
+	if (G_u32SpeedIndicator != REPLAY_u32PrintedSpeed)
+	{
+		REPLAY_u32PrintedSpeed = G_u32SpeedIndicator;
+		REPLAY_voidPrintTime();
+		printf("MOTOR_SPEED  %-13s speed %lu\n", "", (unsigned long)G_u32SpeedIndicator);
+	}
+}
+
+u8 HDCM_u8ChangeSpeed(u8 A_u8RelativeSpeed)
+{
+	ERROR_STATE_T Loc_ErrorState = OK;
+
+	REPLAY_voidAdvance(REPLAY_LOOP_TICK_US);
+	if (REPLAY_pfCommandHook != NULL)
+	{
+		REPLAY_pfCommandHook();
+	}
+	if (A_u8RelativeSpeed <= 9)
+	{
+		G_u32SpeedIndicator = A_u8RelativeSpeed * 1000UL;
+	}
+	else if ((A_u8RelativeSpeed >= '0') && (A_u8RelativeSpeed <= '9'))
+	{
+		G_u32SpeedIndicator = (A_u8RelativeSpeed - '0') * 1000UL;
+	}
+	else if (A_u8RelativeSpeed == 'q')
+	{
+		G_u32SpeedIndicator = 10000;
+	}
+	else
+	{
+		Loc_ErrorState = OUT_OF_RANGE;
+	}
+
+	REPLAY_voidPrintSpeed();
+	return Loc_ErrorState;
+}
+
+u8 HDCM_u8SetSpeedCompare(u16 Copy_u16Compare)
+{
+	REPLAY_voidAdvance(REPLAY_LOOP_TICK_US);
+	if (REPLAY_pfCommandHook != NULL)
+	{
+		REPLAY_pfCommandHook();
+	}
+	if (Copy_u16Compare > 10000)
+	{
+		return OUT_OF_RANGE;
+	}
+	G_u32SpeedIndicator = Copy_u16Compare;
+	REPLAY_voidPrintSpeed();
+	return OK;
+}
+
+/* same compare ratios as the driver */
+void HDCM_voidGetWheelCommand(s16 * P_s16Left, s16 * P_s16Right)
+{
+	s16 L_s16Speed = (s16)G_u32SpeedIndicator;
+	s16 L_s16Left = 0;
+	s16 L_s16Right = 0;
+
+	switch (MOTOR_STATE)
+	{
+	case FORWARD:       L_s16Left = L_s16Speed;             L_s16Right = L_s16Speed;             break;
+	case BACKWARD:      L_s16Left = -L_s16Speed;            L_s16Right = -L_s16Speed;            break;
+	case RIGHT:         L_s16Left = L_s16Speed;                                                  break;
+	case LEFT:                                              L_s16Right = L_s16Speed;             break;
+	case FORWARD_LEFT:  L_s16Left = (L_s16Speed * 4) / 10;  L_s16Right = L_s16Speed;             break;
+	case FORWARD_RIGHT: L_s16Left = L_s16Speed;             L_s16Right = (L_s16Speed * 4) / 10;  break;
+	case BACK_LEFT:     L_s16Left = -(L_s16Speed * 3) / 10; L_s16Right = -L_s16Speed;            break;
+	case BACK_RIGHT:    L_s16Left = -L_s16Speed;            L_s16Right = -(L_s16Speed * 3) / 10; break;
+	default:                                                                                     break;
+	}
+	if (P_s16Left != NULL)
+	{
+		*P_s16Left = L_s16Left;
+	}
+	if (P_s16Right != NULL)
+	{
+		*P_s16Right = L_s16Right;
+	}
+}
+
+void HDCM_voidSetCommandCallBack(void (*Copy_pfHandler)(void))
+{
+	REPLAY_pfCommandHook = Copy_pfHandler;
+}
+
+/*******************************************************************************
+ *                          	SERVICE Replacements                           *
+ *******************************************************************************/
+void STRACE_voidInit(void) {}
+/* the decisions of the fusion are printed with the commands */
+void STRACE_voidLog(u8 Copy_u8Event, u8 Copy_u8Arg, u16 Copy_u16Value)
+{
+	static const char * const L_Apu8Classes[] = {"UNKNOWN", "VEHICLE", "OBJECT"};
+
+	if ((Copy_u8Event == STRACE_EVT_FUSION_CLASS) && (Copy_u8Arg <= SFUS_CLASS_OBJECT))
+	{
+		REPLAY_voidPrintTime();
+		printf("FUSION_CLASS %-13s track %u %u %%\n", L_Apu8Classes[Copy_u8Arg], Copy_u16Value >> 8, Copy_u16Value & 0xFF);
+	}
+}
+void STRACE_voidDump(void)
+{
+	REPLAY_voidPrintTime();
+	printf("TRACE_DUMP\n");
+}
+
+/* the work posted by the handlers runs at once, as PendSV does when they return */
+void SDEF_voidInit(void) {}
+u8 SDEF_u8Post(void (*Copy_pfWork)(u32), u32 Copy_u32Arg)
+{
+	Copy_pfWork(Copy_u32Arg);
+	return OK;
+}
+
+/* the virtual time doesn't depend on the clock, the profiles have nothing to replay */
+void SPWR_voidInit(void) {}
+u8 SPWR_u8SetProfile(u8 Copy_u8Profile)
+{
+	return OK;
+}
+
+/* the messages of the application are printed, the recorded answers are given back in time */
+void SLNK_voidInit(void) {}
+void SLNK_voidTask(void) {}
+
+u8 SLNK_u8Send(u8 Copy_u8Channel, const u8 * P_u8Data, u8 Copy_u8Length)
+{
+	u8 L_u8Index;
+
+	if (Copy_u8Channel == SLNK_CHANNEL_TELEMETRY)
+	{
+		return OK;
+	}
+	REPLAY_voidPrintTime();
+	printf("LINK_MSG_TX  ch %u", Copy_u8Channel);
+	for (L_u8Index = 0; L_u8Index < Copy_u8Length; L_u8Index++)
+	{
+		printf(" %3u %c", P_u8Data[L_u8Index], ((P_u8Data[L_u8Index] >= 32) && (P_u8Data[L_u8Index] < 127)) ? P_u8Data[L_u8Index] : '.');
+	}
+	printf("\n");
+	return OK;
+}
+
+/**
+ * @brief Next recorded message of a channel, once the virtual time reaches it.
+ *
+ * A message is recorded one byte per entry, the argument counts the bytes left.
+ */
+u8 SLNK_u8Receive(u8 Copy_u8Channel, u8 * P_u8Data, u8 * P_u8Length)
+{
+	TRACE_ENTRY_t * L_pstrEntry;
+	u32 * L_pu32Cursor;
+	u8 L_u8Length = 0;
+	u8 L_u8Index;
+
+	if (Copy_u8Channel >= LNK_CHANNEL_COUNT)
+	{
+		return OUT_OF_RANGE;
+	}
+	L_pu32Cursor = &REPLAY_Au32LinkCursor[Copy_u8Channel];
+	*L_pu32Cursor = REPLAY_u32FindNextMessage(Copy_u8Channel, *L_pu32Cursor);
+	if ((*L_pu32Cursor >= REPLAY_u32Count) || (REPLAY_AstrEntries[*L_pu32Cursor].Trace_u32Timestamp > REPLAY_u32Now))
+	{
+		return NOK;
+	}
+	do
+	{
+		L_pstrEntry = &REPLAY_AstrEntries[(*L_pu32Cursor)++];
+		if (L_u8Length < LNK_MAX_PAYLOAD)
+		{
+			P_u8Data[L_u8Length++] = (u8)L_pstrEntry->Trace_u16Value;
+		}
+		*L_pu32Cursor = REPLAY_u32FindNextMessage(Copy_u8Channel, *L_pu32Cursor);
+	} while ((L_pstrEntry->Trace_u8Arg > 0) && (*L_pu32Cursor < REPLAY_u32Count));
+	*P_u8Length = L_u8Length;
+
+	if (REPLAY_u8Verbose)
+	{
+		REPLAY_voidPrintTime();
+		printf("LINK_MSG_RX  ch %u", Copy_u8Channel);
+		for (L_u8Index = 0; L_u8Index < L_u8Length; L_u8Index++)
+		{
+			printf(" %3u %c", P_u8Data[L_u8Index], ((P_u8Data[L_u8Index] >= 32) && (P_u8Data[L_u8Index] < 127)) ? P_u8Data[L_u8Index] : '.');
+		}
+		printf("\n");
+	}
+	return OK;
+}
+
+/* the frames are handled by the link task on the car, the replayed messages wake the sleep by their time */
+u8 SLNK_u8IsRxPending(void)
+{
+	return 0;
+}
+
+/* there is nothing to retransmit */
+u32 SLNK_u32GetIdleTime(void)
+{
+	return 0xFFFFFFFFUL;
+}
+
+/*******************************************************************************
+ *                          	Entry Function                                 *
+ *******************************************************************************/
+int main(int argc, char * argv[])
+{
+	u8 L_u8Sensor;
+	const char * L_pcFileName = NULL;
+
+	if ((argc == 3) && (strcmp(argv[1], "-v") == 0))
+	{
+		REPLAY_u8Verbose = 1;
+		L_pcFileName = argv[2];
+	}
+	else if (argc == 2)
+	{
+		L_pcFileName = argv[1];
+	}
+	else
+	{
+		fprintf(stderr, "usage: replay [-v] <trace file>\n");
+		return 2;
+	}
+
+	if (REPLAY_u8LoadTrace(L_pcFileName) != OK)
+	{
+		fprintf(stderr, "replay: %s is not a readable trace dump\n", L_pcFileName);
+		return 1;
+	}
+
+	for (L_u8Sensor = FORWARD_US; L_u8Sensor <= BACKWARD_US; L_u8Sensor++)
+	{
+		REPLAY_Af32UsDistance[L_u8Sensor] = REPLAY_US_NO_READING_CM;
+	}
+	REPLAY_u32PrintedSpeed = G_u32SpeedIndicator;
+
+	APP_voidMain();
+	return 0;
+}
@@ -1,527 +1,1048 @@
-/** ****************************************************************************
- * @mainpage V2V Communication Project (Main Car)
- *
- * @File main.c
- *
- * @brief this file is application file 
- *
- * @author Project Team 
- *
- * @date 6/11/2023
- *
- ****************************************************************************** */
- /*******************************************************************************
- *                          	Standard Types                                 *
- *******************************************************************************/
-#include "LIB/BIT_MATH.h"
-#include "LIB/ITI_STD_TYPES.h"
-/*******************************************************************************
- *                          	MCAL Components                                 *
- *******************************************************************************/
-#include "MCAL/RCC/RCC_Interface.h"
-#include "MCAL/GPIOx/GPIO_Interface.h"
-#include "MCAL/SYSTICK/SYSTICK_Interface.h"
-#include "MCAL/GPTimer/TIMER_interface.h"
-#include "MCAL/NVIC/NVIC_Interface.h"
-#include "MCAL/USART/USART_Interface.h"
-/*******************************************************************************
- *                          	HAL Components                                 *
- *******************************************************************************/
-#include "HAL/DC_Motor/DC_Motor_Interface.h"
-#include "HAL/Ultrasonic/Ultrasonic_Interface.h"
-/*******************************************************************************
- *                          	Global Defenations                             *
- *******************************************************************************/
-
-#define RED 						   		    1
-#define OBJECT_DETECTED  				       	1
-#define OBJECT_NOT_DETECTED	 					0
-
-#define REQ_FOR_RASPBERRY_FOR_DUMMY				'R'
-#define REQ_FOR_RASPBERRY_FOR_CAMERA			'C'
-
-#define VEHICLE_DETECTED 						'V'
-#define VEHICLE_NOT_DETECTED 					'O'
-
-typedef struct
-{
-	u8 car_u8color;
-	u8 car_u8speed;
-	u8 car_u8objectDetected;
-
-}CAR_t;
-
-CAR_t Dummy_Car_Data;
-
-typedef enum
-{
-	RIGHT_OVT,
-	LEFT_OVT
-
-}OVER_TAKE_DIR_t;
-
-extern u8 G_u8BluetoothOrder;   
-extern u32 G_u32SpeedIndicator;	
-extern u8 G_u8CameraDetection ;
-u8 G_u8PassedCarFlag=1;
-u8 G_u8FlagRightInvalid=0;
-u8 G_u8EntranceFlag = 0;
-u32 G_u32USDistance=100;
-u8 G_u8HandShake=0; 
-u8 G_u8RasspDummyData=0;
-
-/**
- * @brief Decoding the data received from rasspberry pi.
- *
- * This function takes value as data and divide it to required data .
- * 
- * @param Copy_u8RasspData The data which required to be decoded.
- * @param *P_Dummy_Car_Data The address where the required new data will be saved.
- *
- */
-void APP_voidDecodeRasspData(u8 Copy_u8RasspData , CAR_t * P_Dummy_Car_Data)
-{
-	P_Dummy_Car_Data->car_u8speed=Copy_u8RasspData%10;
-	Copy_u8RasspData/=10;
-	P_Dummy_Car_Data->car_u8objectDetected=Copy_u8RasspData%10;
-	Copy_u8RasspData/=10;
-	P_Dummy_Car_Data->car_u8color=Copy_u8RasspData%10;
-	Copy_u8RasspData/=10;
-}
-/**
- * @brief this function responsible for ovartaken sequence.
- *
- * This function takes direction of overtake sequence.
- * 
- * @param A_OverTakeDir The direction of overtaken sequence .
- *
- */
-void APP_voidOverTakeSeq(OVER_TAKE_DIR_t A_OverTakeDir)
-{
-	u8 L_u8checkflag = 1;
-	u32 L_u32LocalSpeed = 0;
-	
-	switch (A_OverTakeDir)
-	{
-	case RIGHT_OVT:
-	
-		L_u32LocalSpeed = G_u32SpeedIndicator;
-		G_u32SpeedIndicator =5000;
-		HDCM_voidMoveRight();
-		MSTK_voidSetBusyWait(1000000);
-		HDCM_voidMoveForward();
-		MSTK_voidSetBusyWait(1800000);
-		HDCM_voidMoveLeft();
-		MSTK_voidSetBusyWait(1400000); 
-		HDCM_u8ChangeSpeed(Dummy_Car_Data.car_u8speed+4);
-		HDCM_voidMoveForward();
-
-		while(G_u8PassedCarFlag == 1)
-		{
-			G_u32USDistance = HUS_f32CalcDistance(LEFT_US);
-			while(G_u32USDistance <= 50) 
-			{
-				G_u32USDistance = HUS_f32CalcDistance(LEFT_US);
-				G_u8PassedCarFlag=0;
-				if((G_u32USDistance>50) && (L_u8checkflag==1))
-				{
-					L_u8checkflag=2;
-					MSTK_voidSetBusyWait(4000000);
-					G_u32USDistance=0;
-				}
-				else if(G_u32USDistance<50)
-				{
-					L_u8checkflag=1;
-				}
-			}
-		}
-		L_u8checkflag=1;
-
-		if	(G_u8PassedCarFlag==0)
-		{
-			G_u32SpeedIndicator = 5000;
-			HDCM_voidMoveLeft();
-			MSTK_voidSetBusyWait(1000000);   
-			HDCM_voidMoveForward();
-			MSTK_voidSetBusyWait(2000000);
-			HDCM_voidMoveRight();
-			MSTK_voidSetBusyWait(800000); 
-			G_u32SpeedIndicator = L_u32LocalSpeed;
-			HDCM_voidMoveForward();
-			G_u8PassedCarFlag = 1;
-		}
-		break;
-
-	case LEFT_OVT:
-		
-		L_u32LocalSpeed = G_u32SpeedIndicator;
-		G_u32SpeedIndicator =5000;
-		HDCM_voidMoveLeft();
-		MSTK_voidSetBusyWait(1000000);
-		HDCM_voidMoveForward();
-		MSTK_voidSetBusyWait(1800000);
-		HDCM_voidMoveRight();
-		MSTK_voidSetBusyWait(1400000); 
-		HDCM_u8ChangeSpeed(Dummy_Car_Data.car_u8speed+4);
-		HDCM_voidMoveForward();
-
-		while(G_u8PassedCarFlag == 1)
-		{
-			G_u32USDistance = HUS_f32CalcDistance(LEFT_US);
-			while(G_u32USDistance <= 50) 
-			{
-				G_u32USDistance = HUS_f32CalcDistance(LEFT_US);
-				G_u8PassedCarFlag=0; 
-				if((G_u32USDistance > 50) && (L_u8checkflag == 1))
-				{
-					L_u8checkflag = 2;
-					MSTK_voidSetBusyWait(4000000);
-					G_u32USDistance=0;
-				}
-				else if(G_u32USDistance<50)
-				{
-					L_u8checkflag=1;
-				}
-			}
-		}
-		L_u8checkflag=1;
-		
-		if (G_u8PassedCarFlag==0)
-		{
-			G_u32SpeedIndicator = 5000;
-			HDCM_voidMoveRight();
-			MSTK_voidSetBusyWait(1000000);   
-			HDCM_voidMoveForward();
-			MSTK_voidSetBusyWait(2000000);
-			HDCM_voidMoveLeft();
-			MSTK_voidSetBusyWait(800000); 
-			G_u32SpeedIndicator = L_u32LocalSpeed;
-			HDCM_voidMoveForward();
-			G_u8PassedCarFlag = 1;
-		}
-		break ;
-		
-	default : break;
-	}
-}
-/*******************************************************************************
- *                          	Entry Function                                 *
- *******************************************************************************/
-void main (void)
-{
-	u8 L_u8responseAck= 0;
-	s8 L_s8counterStop=-2;
-	u8 L_u8blindSpotDistance=0;
-	u8 L_u8leftLEDFlag = 0;
-	u8 L_u8RightLEDFlag = 0;
-	u8 L_u8RightLEDCounter = 0;
-	u8 L_u8RightLEDCounter = 0;
-	
-	// RCC Initialization
-	MRCC_VoidInit(); 
-	MSTK_voidInit();
-	// ENABLE GPIOA + DC MOTOR Initialization
-	HDCM_u8Init();   
-
-	//ENABLE GPIOB
-	MRCC_VoidEnablePeriphral(AHB1_BUS,GPIO_PORTB);
-
-	//ENABLE TIMER2
-	MRCC_VoidEnablePeriphral(APB1_BUS,RCC_APB1_TIMER2);
-
-	// TIMER2 channel 1  PINS
-	MGPIO_voidSetPinMode(GPIO_PORTA,CH1_PIN,GPIO_MODE_ALTF);
-	MGPIO_voidSetPinAltFun(GPIO_PORTA,CH1_PIN,GPIO_ALTFN_1);
-	// TIMER2 channel 2  PINS
-	MGPIO_voidSetPinMode(GPIO_PORTA,CH2_PIN,GPIO_MODE_ALTF);
-	MGPIO_voidSetPinAltFun(GPIO_PORTA,CH2_PIN,GPIO_ALTFN_1);
-	// DC MOTOR Starting
-	HDCM_voidStart();
-	// ULTRASONIC INITIALIZATION
-	HUS_voidInit();
-
-	//ENABLE USART1
-	MRCC_VoidEnablePeriphral(APB2_BUS,RCC_APB2_USART1);
-	//ENABLE USART6
-	MRCC_VoidEnablePeriphral(APB2_BUS,RCC_APB2_USART6);
-
-	// ENABLE USART1  INTERRUPT
-	MNVIC_voidEnableInterrupt(NVIC_USART1);
-	// ENABLE USART6  INTERRUPT
-	MNVIC_voidEnableInterrupt(NVIC_USART6);
-
-	//USART1  PINS
-	MGPIO_voidSetPinMode(MUSART1_PORT,MUSART1_TX_PIN,GPIO_MODE_ALTF); //TX
-	MGPIO_voidSetPinAltFun(MUSART1_PORT,MUSART1_TX_PIN,MUSART1_ALF);
-	MGPIO_voidSetPinMode(MUSART1_PORT,MUSART1_RX_PIN,GPIO_MODE_ALTF); //RX
-	MGPIO_voidSetPinAltFun(MUSART1_PORT,MUSART1_RX_PIN,MUSART1_ALF);
-
-	//USART6  PINS
-	MGPIO_voidSetPinMode(MUSART6_PORT,MUSART6_TX_PIN,GPIO_MODE_ALTF); //TX
-	MGPIO_voidSetPinAltFun(MUSART6_PORT,MUSART6_TX_PIN,MUSART6_ALF);
-	MGPIO_voidSetPinMode(MUSART6_PORT,MUSART6_RX_PIN,GPIO_MODE_ALTF); //RX
-	MGPIO_voidSetPinAltFun(MUSART6_PORT,MUSART6_RX_PIN,MUSART6_ALF);
-
-	// USART1 Initialization   >> for Raspberry
-	MUSART1_voidInit();
-	// USART6 Initialization   >> for Bluetooth
-	MUSART6_voidInit();
-
-
-	// pins for LEDS (used for blindspot detection)
-	MGPIO_voidSetPinMode(GPIO_PORTB,GPIO_PIN8,GPIO_MODE_OUTPUT);    // used for right side
-	MGPIO_voidSetOutputSpeed(GPIO_PORTB,GPIO_PIN8,GPIO_OUTPUT_SPEED_LOW);
-	MGPIO_voidSetOutPutMode(GPIO_PORTB,GPIO_PIN8,GPIO_OUTPUT_TYPE_PUSH_PULL);
-
-	MGPIO_voidSetPinMode(GPIO_PORTB,GPIO_PIN9,GPIO_MODE_OUTPUT);	// used for left side
-	MGPIO_voidSetOutputSpeed(GPIO_PORTB,GPIO_PIN9,GPIO_OUTPUT_SPEED_LOW);
-	MGPIO_voidSetOutPutMode(GPIO_PORTB,GPIO_PIN9,GPIO_OUTPUT_TYPE_PUSH_PULL);
-
-
-	G_u8BluetoothOrder='S';
-	u32 L_u32counter = 250000;
-	
-	while (1)
-	{
-		// CONTROL THE SPEED AND DIRECTION OF THE Main CAR
-		if ((G_u8BluetoothOrder >='0' && G_u8BluetoothOrder<='9')||(G_u8BluetoothOrder=='q'))
-		{
-			HDCM_u8ChangeSpeed(G_u8BluetoothOrder);
-
-		}	
-		
-		else if (G_u8BluetoothOrder == 'R')
-		{
-			L_u8blindSpotDistance = HUS_f32CalcDistance(RIGHT_US);
-			if(L_u8blindSpotDistance < 20)
-			{
-				MGPIO_voidSetPinValue(GPIO_PORTB,GPIO_PIN8,GPIO_HIGH);
-				HDCM_u8CarState('F');
-				L_u8RightLEDFlag = 1;	
-			}
-			else
-			{
-				MGPIO_voidSetPinValue(GPIO_PORTB,GPIO_PIN8,GPIO_LOW);
-				HDCM_u8CarState('R');
-				L_u8RightLEDFlag = 0;	
-			}
-		}
-		
-		else if (G_u8BluetoothOrder == 'L')
-		{
-			L_u8blindSpotDistance = HUS_f32CalcDistance(LEFT_US);
-			if(L_u8blindSpotDistance < 20)
-			{
-				MGPIO_voidSetPinValue(GPIO_PORTB,GPIO_PIN9,GPIO_HIGH);
-				HDCM_u8CarState('F');
-				L_u8LeftLEDFlag = 1;
-			}
-			else
-			{
-				MGPIO_voidSetPinValue(GPIO_PORTB,GPIO_PIN9,GPIO_LOW);
-				HDCM_u8CarState('L');
-				L_u8LeftLEDFlag = 0;	
-			}
-		}
-		
-		else if(G_u8BluetoothOrder == 'F')
-		{
-			HDCM_u8CarState('F');
-		}
-		
-		else
-		{
-			MGPIO_voidSetPinValue(GPIO_PORTB,GPIO_PIN8,GPIO_LOW);
-			MGPIO_voidSetPinValue(GPIO_PORTB,GPIO_PIN9,GPIO_LOW);
-			L_u8LeftLEDFlag = 0;
-			L_u8RightLEDFlag = 0;
-			HDCM_u8CarState(G_u8BluetoothOrder);
-		}
-		
-		
-		if (G_u8BluetoothOrder == 'F' || (L_u8RightLEDFlag==1) || (L_u8LeftLEDFlag==1))
-		{	
-			if(L_u32counter>=250000)
-			{
-				L_u32counter=0;
-				G_u32USDistance = HUS_f32CalcDistance(FORWARD_US);
-
-				if((G_u32USDistance < 70))
-				{
-			
-					G_u8HandShake=MUSART1_u8ReciveData();
-					if(G_u8HandShake == 'D')
-					{
-						MUSART1_voidTransmitData('A');
-					}
-					else
-					{
-						MUSART1_voidTransmitData('H');
-						G_u8HandShake = 0;
-						continue;
-					}
-					G_u8HandShake = 0;
-
-					MUSART1_voidTransmitData(REQ_FOR_RASPBERRY_FOR_CAMERA);
-					L_u8responseAck=MUSART1_u8ReciveData();
-					if(L_u8responseAck != 'S')
-					{
-						MUSART1_voidTransmitData('<');
-						L_u8responseAck = 0;
-						continue;
-					}
-					else
-					{
-						MUSART1_voidTransmitData('S');
-					}
-					L_u8responseAck = 0;
-
-					G_u8CameraDetection=MUSART1_u8ReciveData();
-					
-					//Receive data from raspberry that contains the result of the camera
-					if((G_u8CameraDetection == 'V')||(G_u8CameraDetection == 'O'))
-					{
-						MUSART1_voidTransmitData('F');
-					}
-					else
-					{
-						MUSART1_voidTransmitData('G');
-						G_u8CameraDetection = 0;
-						continue;
-					}
-
-					if(G_u8CameraDetection == VEHICLE_DETECTED) // vehicle detected
-					{
-						L_s8counterStop=0;
-						G_u8CameraDetection=0;
-						
-						// Send request for my raspberry to get data from dummy car
-						G_u8HandShake=MUSART1_u8ReciveData();
-						if(G_u8HandShake == 'D')
-						{
-							MUSART1_voidTransmitData('A');
-						}
-						else
-						{
-							MUSART1_voidTransmitData('H');
-							G_u8HandShake = 0;
-							continue;
-						}
-						G_u8HandShake = 0;
-
-						MUSART1_voidTransmitData(REQ_FOR_RASPBERRY_FOR_DUMMY);
-						L_u8responseAck=MUSART1_u8ReciveData();
-						if(L_u8responseAck != 'S')
-						{
-							MUSART1_voidTransmitData(')');
-							L_u8responseAck = 0;
-							continue;
-						}
-						else
-						{
-							MUSART1_voidTransmitData('S');
-						}
-						L_u8responseAck = 0;
-
-						// Receiving dummy car data from raspberry:
-						G_u8RasspDummyData=MUSART1_u8ReciveData();
-
-						if((G_u8RasspDummyData >= 100) && (G_u8RasspDummyData <= 119))
-						{
-							MUSART1_voidTransmitData('K');
-						}
-						else
-						{
-							G_u8RasspDummyData = 0;
-							MUSART1_voidTransmitData('L');
-							continue;
-						}
-
-						// Decoding data coming from raspberry
-						APP_voidDecodeRasspData(G_u8RasspDummyData,&Dummy_Car_Data);
-
-						G_u8RasspDummyData=0;
-
-						if (Dummy_Car_Data.car_u8color==RED) 
-						{
-							// there is no car in front of dummy car
-							if(Dummy_Car_Data.car_u8objectDetected==OBJECT_NOT_DETECTED)
-							{
-								G_u32USDistance = HUS_f32CalcDistance(RIGHT_US); // RIGHT_US
-
-								if(G_u32USDistance > 20)
-								{
-									MGPIO_voidSetPinValue(GPIO_PORTB,GPIO_PIN8,GPIO_LOW);
-									APP_voidOverTakeSeq(RIGHT_OVT);
-								}
-								else
-								{   // if there is an object in range of 20 cm
-									// now we have to check on our left
-									G_u8FlagRightInvalid=1;
-									MGPIO_voidSetPinValue(GPIO_PORTB,GPIO_PIN8,GPIO_HIGH);						
-								}
-								if(G_u8FlagRightInvalid==1)
-								{
-									G_u32USDistance = HUS_f32CalcDistance(LEFT_US); // LEFT_US
-									if(G_u32USDistance > 20)
-									{
-										MGPIO_voidSetPinValue(GPIO_PORTB,GPIO_PIN9,GPIO_LOW);
-										APP_voidOverTakeSeq(LEFT_OVT);
-									}
-									else
-									{
-										// if there is an object in RIGHT ANN LEFT
-										// go as the dummy car
-										HDCM_u8ChangeSpeed(Dummy_Car_Data.car_u8speed+2);
-										MGPIO_voidSetPinValue(GPIO_PORTB,GPIO_PIN9,GPIO_HIGH);
-									}
-
-									G_u8FlagRightInvalid=0; // to not enter it again without checking right is not ok
-								}
-				
-							}//end of No object front of the dummy car
-							else
-							{
-								//there is an object in front of the dummy car
-								HDCM_u8ChangeSpeed(Dummy_Car_Data.car_u8speed + 2);
-							}
-						}//end of the car is red
-
-					}//end of  A car is detected
-					else
-					{
-						// OBJECT DETECTED  so the car have to stop immediately
-						if(L_s8counterStop==0)
-						{
-							G_u8BluetoothOrder='S'; 
-						}
-						else
-						{
-							L_s8counterStop++;
-						}
-					}
-
-					G_u8CameraDetection=0; // to start the while (camera) again
-					MSTK_voidSetBusyWait(1000);
-
-				} // end of something is in front of the main car
-				else
-				{
-					//there is no thing in front of the main car within mentioned range
-				}
-
-			}
-
-		}//end of bluetooth order = 'F'
-		else
-		{
-			//bluetooth order is not 'F'
-			//do nothing
-		}
-
-		L_u32counter++;
-
-	}// end of while
-
-}//end of main
-
+/** ****************************************************************************
+ * @mainpage V2V Communication Project (Main Car)
+ *
+ * @File main.c
+ *
+ * @brief this file is application file 
+ *
+ * @author Project Team 
+ *
+ * @date 6/11/2023
+ *
+ ****************************************************************************** */
+ /*******************************************************************************
+ *                          	Standard Types                                 *
+ *******************************************************************************/
+#include "LIB/BIT_MATH.h"
+#include "LIB/ITI_STD_TYPES.h"
+#include "LIB/ERROR_STATE.h"
+/*******************************************************************************
+ *                          	MCAL Components                                 *
+ *******************************************************************************/
+#include "MCAL/RCC/RCC_Interface.h"
+#include "MCAL/GPIOx/GPIO_Interface.h"
+#include "MCAL/SYSTICK/SYSTICK_Interface.h"
+#include "MCAL/SYSTICK/SYSTICK_Config.h"
+#include "MCAL/GPTimer/TIMER_interface.h"
+#include "MCAL/NVIC/NVIC_Interface.h"
+#include "MCAL/USART/USART_Interface.h"
+/*******************************************************************************
+ *                          	HAL Components                                 *
+ *******************************************************************************/
+#include "HAL/DC_Motor/DC_Motor_Interface.h"
+#include "HAL/Ultrasonic/Ultrasonic_Interface.h"
+#include "HAL/Led/Led_Interface.h"
+/*******************************************************************************
+ *                          	SERVICE Components                              *
+ *******************************************************************************/
+#include "SERVICE/Trace/Trace_Interface.h"
+#include "SERVICE/Trace/Trace_Config.h"
+#include "SERVICE/V2V/V2V_Interface.h"
+#include "SERVICE/V2V/V2V_Config.h"
+#include "SERVICE/Odometry/Odometry_Interface.h"
+#include "SERVICE/Odometry/Odometry_Config.h"
+#include "SERVICE/Manoeuvre/Manoeuvre_Interface.h"
+#include "SERVICE/Power/Power_Interface.h"
+#include "SERVICE/Defer/Defer_Interface.h"
+#include "SERVICE/Neighbour/Neighbour_Interface.h"
+#include "SERVICE/Neighbour/Neighbour_Config.h"
+#include "SERVICE/Scan/Scan_Interface.h"
+#include "SERVICE/Ttc/Ttc_Interface.h"
+#include "SERVICE/Link/Link_Interface.h"
+#include "SERVICE/Link/Link_Config.h"
+#include "SERVICE/Camera/Camera_Interface.h"
+#include "SERVICE/Fusion/Fusion_Interface.h"
+#include "SERVICE/Cacc/Cacc_Interface.h"
+#include "SERVICE/BlindSpot/BlindSpot_Interface.h"
+/*******************************************************************************
+ *                          	Global Defenations                             *
+ *******************************************************************************/
+
+#define RED 						   		    1
+#define OBJECT_DETECTED  				       	1
+#define OBJECT_NOT_DETECTED	 					0
+
+#define REQ_FOR_RASPBERRY_FOR_DUMMY				'R'
+
+#define DUMMY_OBJECT_RANGE_CM					200
+
+/* the raspberry answers the requests on the link within this time, or the check is dropped */
+#define RASPBERRY_ANSWER_TIMEOUT_US				1000000UL
+
+/* status report to the raspberry on the telemetry channel, at most this often:
+ * 'T', order, speed (cm/s), front distance (cm), front time to collision (ms), big endian */
+#define TELEMETRY_MESSAGE						'T'
+#define TELEMETRY_PERIOD_US						1000000UL
+
+/* the car ahead is checked when it will be reached in this time (70 cm at 50 cm/s),
+ * or when it is this close whatever the speed */
+#define REACTION_TTC_MS							1400
+#define REACTION_DISTANCE_CM					20
+
+/* an emergency brake of the car ahead stops this one when it is at most this far,
+ * a farther one leaves time to the own obstacle checks */
+#define EMERGENCY_BRAKE_RANGE_CM				150
+
+/* the passed car is beside while the side sensor reads at most this */
+#define OVERTAKE_SIDE_CLEAR_CM					50
+
+/* the speed of the following is applied in steps of this many PWM counts (10 mm/s),
+ * the small corrections of the control law don't change the motors every period */
+#define FOLLOW_COMPARE_STEP						100
+
+/* the manoeuvre profile is entered below the first distance and left above the second,
+ * a reading around one limit doesn't switch the clock back and forth */
+#define POWER_NEAR_ENTER_CM						70
+#define POWER_NEAR_EXIT_CM						90
+
+#define STK_TICKS_PER_US						(MSTK_TICK_FREQ_HZ / 1000000UL)
+
+typedef struct
+{
+	u8 car_u8color;
+	u8 car_u8speed;
+	u8 car_u8objectDetected;
+
+}CAR_t;
+
+CAR_t Dummy_Car_Data;
+
+typedef enum
+{
+	RIGHT_OVT,
+	LEFT_OVT
+
+}OVER_TAKE_DIR_t;
+
+extern u8 G_u8BluetoothOrder;   
+extern u32 G_u32SpeedIndicator;	
+u8 G_u8FlagRightInvalid=0;
+u8 G_u8EntranceFlag = 0;
+u32 G_u32USDistance=100;
+/* something is close ahead for the power profile, see POWER_NEAR_ENTER_CM */
+u8 G_u8ObstacleNear=0;
+u8 G_u8RasspDummyData=0;
+u8 G_u8AppliedOrder=0;
+/* following the car ahead (SERVICE/Cacc), the speed order is kept aside meanwhile */
+u8 G_u8Following=0;
+u32 G_u32SetSpeedIndicator=0;
+
+/**
+ * @brief Decoding the data received from rasspberry pi.
+ *
+ * This function takes value as data and divide it to required data .
+ * 
+ * @param Copy_u8RasspData The data which required to be decoded.
+ * @param *P_Dummy_Car_Data The address where the required new data will be saved.
+ *
+ */
+void APP_voidDecodeRasspData(u8 Copy_u8RasspData , CAR_t * P_Dummy_Car_Data)
+{
+	P_Dummy_Car_Data->car_u8speed=Copy_u8RasspData%10;
+	Copy_u8RasspData/=10;
+	P_Dummy_Car_Data->car_u8objectDetected=Copy_u8RasspData%10;
+	Copy_u8RasspData/=10;
+	P_Dummy_Car_Data->car_u8color=Copy_u8RasspData%10;
+	Copy_u8RasspData/=10;
+}
+/**
+ * @brief Filling the dummy car data from its latest beacon.
+ *
+ * The beacon gives the same information as the 'R' request, without the round trip
+ * through the two raspberry pis.
+ *
+ * @param P_Beacon The latest beacon received from the car ahead.
+ * @param *P_Dummy_Car_Data The address where the required new data will be saved.
+ *
+ */
+void APP_voidBeaconToCarData(const SV2V_BEACON_t * P_Beacon , CAR_t * P_Dummy_Car_Data)
+{
+	P_Dummy_Car_Data->car_u8color = P_Beacon->Beacon_u8Color;
+	P_Dummy_Car_Data->car_u8objectDetected = (P_Beacon->Beacon_u16FrontDistance < DUMMY_OBJECT_RANGE_CM) ? OBJECT_DETECTED : OBJECT_NOT_DETECTED;
+	P_Dummy_Car_Data->car_u8speed = P_Beacon->Beacon_u16Speed / (ODO_SPEED_LEVEL_MM_S / 10);
+	if (P_Dummy_Car_Data->car_u8speed > 9)
+	{
+		P_Dummy_Car_Data->car_u8speed = 9;
+	}
+}
+/**
+ * @brief Stopping the motors on an emergency warning of another car.
+ *
+ * Called from the USART1 interrupt that received the warning, so the motors
+ * don't wait for the main loop or the lower priority handlers. Whether the
+ * warning concerns this car is decided right after, from PendSV, by
+ * APP_voidEmergencyHandler.
+ *
+ * @param Copy_u8SenderId The vehicle ID of the warning car.
+ * @param Copy_u8Kind SV2V_EMERGENCY_BRAKE or SV2V_EMERGENCY_HAZARD, other kinds are ignored.
+ *
+ */
+void APP_voidEmergencyStop(u8 Copy_u8SenderId , u8 Copy_u8Kind)
+{
+	if ((Copy_u8Kind == SV2V_EMERGENCY_BRAKE) || (Copy_u8Kind == SV2V_EMERGENCY_HAZARD))
+	{
+		HDCM_voidStop();
+	}
+}
+/**
+ * @brief Holding or undoing the stop of an emergency warning of another car.
+ *
+ * Called from PendSV after APP_voidEmergencyStop. The stop order holds the car
+ * stopped until the driver sends a new order.
+ *
+ * Both warnings concern the cars behind the sender in its lane: the car only
+ * stays stopped when the neighbour table puts the sender ahead in the same
+ * lane, and for a brake warning only within EMERGENCY_BRAKE_RANGE_CM, else it
+ * drives on with its command. A sender the table doesn't know (no beacon yet,
+ * or stale) can't be placed, the car stays stopped.
+ *
+ * @param Copy_u8SenderId The vehicle ID of the warning car.
+ * @param Copy_u8Kind SV2V_EMERGENCY_BRAKE or SV2V_EMERGENCY_HAZARD, other kinds are ignored.
+ *
+ */
+void APP_voidEmergencyHandler(u8 Copy_u8SenderId , u8 Copy_u8Kind)
+{
+	s8 L_s8LaneOffset;
+	s32 L_s32Gap;
+
+	if ((Copy_u8Kind != SV2V_EMERGENCY_BRAKE) && (Copy_u8Kind != SV2V_EMERGENCY_HAZARD))
+	{
+		return;
+	}
+	if (SNBR_u8GetRelativePosition(Copy_u8SenderId, &L_s8LaneOffset, &L_s32Gap) == OK)
+	{
+		// another lane, behind this car, or a brake too far ahead
+		if ((L_s8LaneOffset != 0) || (L_s32Gap <= 0) ||
+			((Copy_u8Kind == SV2V_EMERGENCY_BRAKE) && (L_s32Gap > EMERGENCY_BRAKE_RANGE_CM)))
+		{
+			HDCM_voidResume();
+			return;
+		}
+	}
+
+	G_u8BluetoothOrder = 'S';
+	// the main loop may be driving the motors: make it apply the stop again
+	G_u8AppliedOrder = 0;
+}
+/**
+ * @brief Choosing the power profile from what the car is doing.
+ *
+ * Parked when stopped, manoeuvre while turning or when something is in front
+ * (camera check and overtake), cruise otherwise. Something is in front from
+ * POWER_NEAR_ENTER_CM until it is farther than POWER_NEAR_EXIT_CM.
+ *
+ * @return SPWR_PROFILE_PARKED, SPWR_PROFILE_CRUISE or SPWR_PROFILE_MANOEUVRE.
+ */
+u8 APP_u8PowerProfile(void)
+{
+	if ((G_u8BluetoothOrder == 'S') || (G_u8BluetoothOrder == TRACE_DUMP_ORDER))
+	{
+		return SPWR_PROFILE_PARKED;
+	}
+	if (G_u32USDistance < POWER_NEAR_ENTER_CM)
+	{
+		G_u8ObstacleNear = 1;
+	}
+	else if (G_u32USDistance > POWER_NEAR_EXIT_CM)
+	{
+		G_u8ObstacleNear = 0;
+	}
+	if ((G_u8BluetoothOrder == 'R') || (G_u8BluetoothOrder == 'L') || (G_u8ObstacleNear != 0))
+	{
+		return SPWR_PROFILE_MANOEUVRE;
+	}
+	return SPWR_PROFILE_CRUISE;
+}
+/**
+ * @brief Estimated speed of the car, as published in the beacons.
+ *
+ * @return The speed of the odometry in cm/s, 0 when stopped.
+ */
+u16 APP_u16OwnSpeed(void)
+{
+	return SODO_u16GetSpeedCmS();
+}
+/**
+ * @brief Choosing the ultrasonic scan mode from what the car is doing.
+ *
+ * The front sensor is pinged faster when the car goes faster, a side sensor
+ * faster while the car turns to that side (both are watched in the background).
+ *
+ * @return SSCAN_MODE_PARKED, SSCAN_MODE_CRUISE, SSCAN_MODE_LEFT_SIDE or SSCAN_MODE_RIGHT_SIDE.
+ */
+u8 APP_u8ScanMode(void)
+{
+	if ((G_u8BluetoothOrder == 'S') || (G_u8BluetoothOrder == TRACE_DUMP_ORDER))
+	{
+		return SSCAN_MODE_PARKED;
+	}
+	if (G_u8BluetoothOrder == 'R')
+	{
+		return SSCAN_MODE_RIGHT_SIDE;
+	}
+	if (G_u8BluetoothOrder == 'L')
+	{
+		return SSCAN_MODE_LEFT_SIDE;
+	}
+	return SSCAN_MODE_CRUISE;
+}
+/**
+ * @brief Measuring a distance now and waiting for it.
+ *
+ * The sensor is pinged by the scanner in its next slot, its measurement ends
+ * at its range gate.
+ *
+ * @param Copy_Sensor The sensor.
+ * @return The distance in cm.
+ */
+f32 APP_f32WaitDistance(USNUM_t Copy_Sensor)
+{
+	f32 L_f32Distance = 0;
+
+	SSCAN_voidRequest(Copy_Sensor);
+	// a reading taken before the request is not taken
+	SSCAN_u8GetNewDistance(Copy_Sensor, &L_f32Distance);
+	SSCAN_voidTask();
+	while (SSCAN_u8GetNewDistance(Copy_Sensor, &L_f32Distance) != OK)
+	{
+		// the echo edges wake the core
+		MSTK_voidSleep(SSCAN_u32GetIdleTime() * STK_TICKS_PER_US, NULL);
+		SSCAN_voidTask();
+	}
+	return L_f32Distance;
+}
+/**
+ * @brief Checking for work that came while the main loop was going to sleep.
+ *
+ * Called by MSTK_voidSleep with the interrupts masked: a new bluetooth order
+ * or V2V work keeps the core awake.
+ *
+ * @return 1 if the main loop has something to do, 0 if not.
+ */
+u8 APP_u8IsBusy(void)
+{
+	return (G_u8BluetoothOrder != G_u8AppliedOrder) || (SV2V_u32GetIdleTime() == 0) || SLNK_u8IsRxPending();
+}
+/**
+ * @brief Following the car ahead at a time gap, when it can't be passed.
+ *
+ * The speed order in force is the highest speed of the following.
+ */
+void APP_voidStartFollowing(void)
+{
+	if (G_u8Following == 0)
+	{
+		G_u8Following = 1;
+		G_u32SetSpeedIndicator = G_u32SpeedIndicator;
+		SCACC_voidStart((u16)((G_u32SpeedIndicator * ODO_SPEED_LEVEL_MM_S) / 1000));
+	}
+}
+/**
+ * @brief Stopping the following, the speed of the motors is left as it is.
+ */
+void APP_voidStopFollowing(void)
+{
+	if (G_u8Following != 0)
+	{
+		G_u8Following = 0;
+		SCACC_voidStop();
+	}
+}
+/**
+ * @brief Applying the speed command of the following.
+ *
+ * The following stops on any other order than 'F', and when the car ahead is
+ * gone and the speed is back to the order.
+ */
+void APP_voidFollowStep(void)
+{
+	u16 L_u16SetSpeed;
+	u16 L_u16Command;
+	u32 L_u32Compare;
+
+	if (G_u8Following == 0)
+	{
+		return;
+	}
+	if (G_u8BluetoothOrder != 'F')
+	{
+		// the new order sets the speed
+		APP_voidStopFollowing();
+		return;
+	}
+
+	L_u16SetSpeed = (u16)((G_u32SetSpeedIndicator * ODO_SPEED_LEVEL_MM_S) / 1000);
+	if (SCACC_u8Task(L_u16SetSpeed, &L_u16Command) != OK)
+	{
+		return;
+	}
+
+	if ((SCACC_u8IsFollowing() == 0) && (L_u16Command >= L_u16SetSpeed))
+	{
+		HDCM_u8SetSpeedCompare((u16)G_u32SetSpeedIndicator);
+		APP_voidStopFollowing();
+		return;
+	}
+
+	L_u32Compare = ((u32)L_u16Command * 1000) / ODO_SPEED_LEVEL_MM_S;
+	L_u32Compare -= L_u32Compare % FOLLOW_COMPARE_STEP;
+	if (L_u32Compare != G_u32SpeedIndicator)
+	{
+		HDCM_u8SetSpeedCompare((u16)L_u32Compare);
+	}
+}
+/**
+ * @brief Asking the raspberry for the dummy car data.
+ *
+ * 'R' on the V2V channel, the answer is 'R' then the dummy car data (1xx).
+ *
+ * @return OK when the answer came, NOK if the raspberry didn't answer in time.
+ */
+u8 APP_u8AskDummyCar(void)
+{
+	u8 L_Au8Message[LNK_MAX_PAYLOAD];
+	u8 L_u8Length;
+	u32 L_u32Start = MTMR_u32GetMicros();
+	u32 L_u32Elapsed;
+	u32 L_u32IdleUs;
+
+	G_u8RasspDummyData = 0;
+	L_Au8Message[0] = REQ_FOR_RASPBERRY_FOR_DUMMY;
+	if (SLNK_u8Send(SLNK_CHANNEL_V2V, L_Au8Message, 1) != OK)
+	{
+		return NOK;
+	}
+
+	while (1)
+	{
+		SLNK_voidTask();
+		while (SLNK_u8Receive(SLNK_CHANNEL_V2V, L_Au8Message, &L_u8Length) == OK)
+		{
+			if ((L_u8Length == 2) && (L_Au8Message[0] == REQ_FOR_RASPBERRY_FOR_DUMMY) &&
+				(L_Au8Message[1] >= 100) && (L_Au8Message[1] <= 119))
+			{
+				G_u8RasspDummyData = L_Au8Message[1];
+			}
+		}
+		if (G_u8RasspDummyData != 0)
+		{
+			return OK;
+		}
+
+		L_u32Elapsed = MTMR_u32GetMicros() - L_u32Start;
+		if (L_u32Elapsed >= RASPBERRY_ANSWER_TIMEOUT_US)
+		{
+			return NOK;
+		}
+		// the answer frames wake the core
+		L_u32IdleUs = SLNK_u32GetIdleTime();
+		if (L_u32IdleUs > (RASPBERRY_ANSWER_TIMEOUT_US - L_u32Elapsed))
+		{
+			L_u32IdleUs = RASPBERRY_ANSWER_TIMEOUT_US - L_u32Elapsed;
+		}
+		MSTK_voidSleep(L_u32IdleUs * STK_TICKS_PER_US, SLNK_u8IsRxPending);
+	}
+}
+/**
+ * @brief Reporting the status of the car to the raspberry.
+ *
+ * Goes on the lowest priority channel, so it never delays a camera or V2V
+ * frame. A report the send window can't take is skipped, the next one is newer.
+ */
+void APP_voidSendTelemetry(void)
+{
+	static u32 L_u32LastReport = 0;
+	u8 L_Au8Message[LNK_MAX_PAYLOAD];
+	u32 L_u32Now = MTMR_u32GetMicros();
+	u32 L_u32Ttc;
+	u16 L_u16Speed;
+
+	if ((L_u32Now - L_u32LastReport) < TELEMETRY_PERIOD_US)
+	{
+		return;
+	}
+	L_u32LastReport = L_u32Now;
+
+	L_u16Speed = APP_u16OwnSpeed();
+	L_u32Ttc = STTC_u32GetTtc(FORWARD_US);
+	if (L_u32Ttc > 0xFFFF)
+	{
+		L_u32Ttc = 0xFFFF;
+	}
+	L_Au8Message[0] = TELEMETRY_MESSAGE;
+	L_Au8Message[1] = G_u8BluetoothOrder;
+	L_Au8Message[2] = (u8)(L_u16Speed >> 8);
+	L_Au8Message[3] = (u8)L_u16Speed;
+	L_Au8Message[4] = (u8)(G_u32USDistance >> 8);
+	L_Au8Message[5] = (u8)G_u32USDistance;
+	L_Au8Message[6] = (u8)(L_u32Ttc >> 8);
+	L_Au8Message[7] = (u8)L_u32Ttc;
+	SLNK_u8Send(SLNK_CHANNEL_TELEMETRY, L_Au8Message, 8);
+}
+/**
+ * @brief Checking for an order the main loop has not applied yet.
+ *
+ * The overtake starts on the applied order. The driver's orders and the
+ * emergency handler (which clears the applied order) make it differ.
+ *
+ * @note Also the sleep busy check of the overtake steps.
+ *
+ * @return 1 if a new order came, 0 if not.
+ */
+u8 APP_u8IsNewOrder(void)
+{
+	return (G_u8BluetoothOrder != G_u8AppliedOrder);
+}
+/**
+ * @brief Driving a step of the overtake until its end on the odometry.
+ *
+ * The pose is checked every odometry period, the V2V beacons go on meanwhile.
+ * A step that doesn't end in its time (wheels slipping, model off) gives way
+ * to the next one. A new order (the driver's stop, an emergency warning) ends
+ * the step at once, the motors are left to it.
+ *
+ * @param P_Step The step.
+ * @param Copy_u16Heading Heading of the car at the start of the overtake.
+ * @param Copy_Side The sensor watching the passed car.
+ * @return OK at the end of the step, NOK if a new order came.
+ */
+u8 APP_u8DriveStep(const SMAN_STEP_t * P_Step, u16 Copy_u16Heading, USNUM_t Copy_Side)
+{
+	SODO_POSE_t L_strPose;
+	s32 L_s32Travel;
+	u32 L_u32Start;
+	u32 L_u32IdleUs;
+	f32 L_f32Distance = 0;
+	u8 L_u8SideBusy = 0;
+
+	if (APP_u8IsNewOrder())
+	{
+		return NOK;
+	}
+	HDCM_u8ChangeSpeed(P_Step->Step_u8Level);
+	HDCM_u8CarState(P_Step->Step_u8Order);
+	SODO_u8GetPose(&L_strPose);
+	L_s32Travel = L_strPose.Pose_s32Travel;
+	L_u32Start = MTMR_u32GetMicros();
+
+	while ((MTMR_u32GetMicros() - L_u32Start) < P_Step->Step_u32Timeout)
+	{
+		if (APP_u8IsNewOrder())
+		{
+			return NOK;
+		}
+		SSCAN_voidTask();
+		if (SSCAN_u8GetNewDistance(Copy_Side, &L_f32Distance) == OK)
+		{
+			L_u8SideBusy = (L_f32Distance <= OVERTAKE_SIDE_CLEAR_CM);
+		}
+		SODO_u8GetPose(&L_strPose);
+		// the pass goes on while the passed car is still beside
+		if (SMAN_u8IsStepDone(P_Step, Copy_u16Heading, L_s32Travel, &L_strPose) &&
+			(((P_Step->Step_u8Flags & SMAN_FLAG_SIDE_CLEAR) == 0) || (L_u8SideBusy == 0)))
+		{
+			break;
+		}
+		SV2V_voidTask();
+
+		// the echo edges wake the core before the next pose check
+		L_u32IdleUs = SSCAN_u32GetIdleTime();
+		if (L_u32IdleUs > (ODO_PERIOD_MS * 1000UL))
+		{
+			L_u32IdleUs = ODO_PERIOD_MS * 1000UL;
+		}
+		MSTK_voidSleep(L_u32IdleUs * STK_TICKS_PER_US, APP_u8IsNewOrder);
+	}
+	return OK;
+}
+/**
+ * @brief Sleep busy check: the car ahead answered the overtake request.
+ */
+u8 APP_u8IsOvertakeAnswered(void)
+{
+	return (SV2V_u8GetOvertakeState(NULL) != SV2V_OVERTAKE_PENDING);
+}
+/**
+ * @brief Asking the car ahead to hold its speed during the overtake.
+ *
+ * The V2V task goes on while the answer is awaited, the request is sent
+ * again by it until the retries run out.
+ *
+ * @param Copy_u8LeadId    The vehicle ID of the car ahead.
+ * @param Copy_u16Speed    The speed the car ahead must not exceed in cm/s.
+ * @param Copy_u16HoldTime The longest time of the overtake in ms.
+ * @param P_u16Cap         Where the speed granted by the car ahead is written in cm/s.
+ * @return SV2V_OVERTAKE_GRANTED, SV2V_OVERTAKE_REFUSED or SV2V_OVERTAKE_NO_ANSWER.
+ */
+u8 APP_u8NegotiateOvertake(u8 Copy_u8LeadId, u16 Copy_u16Speed, u16 Copy_u16HoldTime, u16 * P_u16Cap)
+{
+	u8 L_u8State;
+
+	if (SV2V_u8RequestOvertake(Copy_u8LeadId, Copy_u16Speed, Copy_u16HoldTime) != OK)
+	{
+		return SV2V_OVERTAKE_NO_ANSWER;
+	}
+	while ((L_u8State = SV2V_u8GetOvertakeState(P_u16Cap)) == SV2V_OVERTAKE_PENDING)
+	{
+		SV2V_voidTask();
+		// the acknowledge frame wakes the core
+		MSTK_voidSleep(SV2V_u32GetIdleTime() * STK_TICKS_PER_US, APP_u8IsOvertakeAnswered);
+	}
+	return L_u8State;
+}
+/**
+ * @brief this function responsible for ovartaken sequence.
+ *
+ * The overtake is planned from the speed of the car, the speed of the car
+ * ahead, the gap to it and the lane width, then driven step by step. The car
+ * goes back to its speed along the road at the end.
+ *
+ * When the car ahead is known by its beacons, it is asked first to hold its
+ * speed for the worst case time of the plan. The pass is then planned again
+ * with the speed it granted and the gap left after the wait. A car that
+ * doesn't answer (older firmware) is passed as before, at the speed of its
+ * last status.
+ *
+ * A new order during the pass (the driver's stop, an emergency warning) ends
+ * it at once: the car is left to that order, it doesn't go forward again, and
+ * the car ahead is released.
+ * 
+ * @param A_OverTakeDir The direction of overtaken sequence .
+ * @param Copy_u16Gap   Distance to the car ahead in cm.
+ * @param Copy_u8LeadId Vehicle ID of the car ahead, 0 if it sends no beacon.
+ * @return OK, also when a new order ended it, NOK if the overtake can't be done
+ *         (gap too short, car ahead too fast, car ahead already holding its
+ *         speed for another car).
+ *
+ */
+u8 APP_u8OverTakeSeq(OVER_TAKE_DIR_t A_OverTakeDir, u16 Copy_u16Gap, u8 Copy_u8LeadId)
+{
+	SMAN_REQUEST_t L_strRequest;
+	SMAN_PLAN_t L_strPlan;
+	SODO_POSE_t L_strPose;
+	USNUM_t L_Side;
+	u32 L_u32LocalSpeed;
+	u8 L_u8Step;
+	u32 L_u32HoldMs = 0;
+	u16 L_u16Cap = 0;
+	s32 L_s32Travel;
+	s32 L_s32Gap;
+	u8 L_u8Done = OK;
+
+	// after the pass the car goes back to the speed order, also when it was following
+	L_u32LocalSpeed = (G_u8Following != 0) ? G_u32SetSpeedIndicator : G_u32SpeedIndicator;
+	L_strRequest.Request_u8Side = (A_OverTakeDir == LEFT_OVT) ? SMAN_SIDE_LEFT : SMAN_SIDE_RIGHT;
+	L_strRequest.Request_u8OwnLevel = (G_u32SpeedIndicator >= 9000) ? 9 : (u8)(G_u32SpeedIndicator / 1000);
+	L_strRequest.Request_u16LeadSpeed = Dummy_Car_Data.car_u8speed * ODO_SPEED_LEVEL_MM_S;
+	L_strRequest.Request_u16Gap = Copy_u16Gap * 10;
+	L_strRequest.Request_u16LaneWidth = NBR_LANE_WIDTH_CM * 10;
+	if (SMAN_u8PlanOvertake(&L_strRequest, &L_strPlan) != OK)
+	{
+		return NOK;
+	}
+
+	if (Copy_u8LeadId != 0)
+	{
+		// every step may take up to its timeout
+		for (L_u8Step = 0; L_u8Step < L_strPlan.Plan_u8Count; L_u8Step++)
+		{
+			L_u32HoldMs += L_strPlan.Plan_AstrSteps[L_u8Step].Step_u32Timeout / 1000UL;
+		}
+		SODO_u8GetPose(&L_strPose);
+		L_s32Travel = L_strPose.Pose_s32Travel;
+
+		switch (APP_u8NegotiateOvertake(Copy_u8LeadId, L_strRequest.Request_u16LeadSpeed / 10,
+										(L_u32HoldMs > 0xFFFF) ? 0xFFFF : (u16)L_u32HoldMs, &L_u16Cap))
+		{
+		case SV2V_OVERTAKE_REFUSED:
+			// another car is passing it
+			SV2V_voidCompleteOvertake();
+			return NOK;
+		case SV2V_OVERTAKE_GRANTED:
+			if ((u32)L_u16Cap * 10 < L_strRequest.Request_u16LeadSpeed)
+			{
+				L_strRequest.Request_u16LeadSpeed = L_u16Cap * 10;
+			}
+			break;
+		default:
+			break;
+		}
+
+		// the car ahead may have stood still while this one waited
+		SODO_u8GetPose(&L_strPose);
+		L_s32Gap = (s32)L_strRequest.Request_u16Gap - (L_strPose.Pose_s32Travel - L_s32Travel);
+		L_strRequest.Request_u16Gap = (L_s32Gap > 0) ? (u16)L_s32Gap : 0;
+		if (SMAN_u8PlanOvertake(&L_strRequest, &L_strPlan) != OK)
+		{
+			SV2V_voidCompleteOvertake();
+			return NOK;
+		}
+	}
+
+	// the car being passed is watched at the side rate
+	if (A_OverTakeDir == LEFT_OVT)
+	{
+		L_Side = RIGHT_US;
+		SSCAN_u8SetMode(SSCAN_MODE_RIGHT_SIDE, APP_u16OwnSpeed());
+	}
+	else
+	{
+		L_Side = LEFT_US;
+		SSCAN_u8SetMode(SSCAN_MODE_LEFT_SIDE, APP_u16OwnSpeed());
+	}
+
+	SODO_u8GetPose(&L_strPose);
+	for (L_u8Step = 0; (L_u8Step < L_strPlan.Plan_u8Count) && (L_u8Done == OK); L_u8Step++)
+	{
+		L_u8Done = APP_u8DriveStep(&L_strPlan.Plan_AstrSteps[L_u8Step], L_strPose.Pose_u16Heading, L_Side);
+	}
+
+	APP_voidStopFollowing();
+	// the speed of the order is given back, the motors only go forward again when the pass ended
+	HDCM_u8SetSpeedCompare((u16)L_u32LocalSpeed);
+	if (L_u8Done == OK)
+	{
+		HDCM_u8CarState('F');
+	}
+	// back in the lane or stopped, the car passed may speed up again
+	SV2V_voidCompleteOvertake();
+	return OK;
+}
+/*******************************************************************************
+ *                          	Entry Function                                 *
+ *******************************************************************************/
+void main (void)
+{
+	u8 L_u8LeftTurnHeld = 0;
+	u8 L_u8RightTurnHeld = 0;
+	SV2V_BEACON_t L_strAheadBeacon;
+	u8 L_u8ForwardClass;
+	u8 L_u8DummyAsked;
+	u8 L_u8LeadId = 0;
+	u16 L_u16FrontGap = 0;
+	f32 L_f32Distance;
+	u32 L_u32IdleUs;
+	u32 L_u32ScanIdleUs;
+	u32 L_u32LinkIdleUs;
+	u32 L_u32FollowIdleUs;
+	
+	// RCC Initialization
+	MRCC_VoidInit(); 
+	MSTK_voidInit();
+	//ENABLE TIMER5 (microsecond timebase) + flight recorder
+	MRCC_VoidEnablePeriphral(APB1_BUS,RCC_APB1_TIMER5);
+	MTMR_voidTimeBaseInit();
+	STRACE_voidInit();
+	// ENABLE GPIOA + DC MOTOR Initialization
+	HDCM_u8Init();   
+	// pose of the car from the wheel command
+	SODO_voidInit();
+
+	//ENABLE GPIOB
+	MRCC_VoidEnablePeriphral(AHB1_BUS,GPIO_PORTB);
+
+	//ENABLE TIMER2
+	MRCC_VoidEnablePeriphral(APB1_BUS,RCC_APB1_TIMER2);
+
+	// TIMER2 channel 1  PINS
+	MGPIO_voidSetPinMode(GPIO_PORTA,CH1_PIN,GPIO_MODE_ALTF);
+	MGPIO_voidSetPinAltFun(GPIO_PORTA,CH1_PIN,GPIO_ALTFN_1);
+	// TIMER2 channel 2  PINS
+	MGPIO_voidSetPinMode(GPIO_PORTA,CH2_PIN,GPIO_MODE_ALTF);
+	MGPIO_voidSetPinAltFun(GPIO_PORTA,CH2_PIN,GPIO_ALTFN_1);
+	// DC MOTOR Starting
+	HDCM_voidStart();
+	// ULTRASONIC INITIALIZATION
+	HUS_voidInit();
+	SSCAN_voidInit();
+	STTC_voidInit();
+
+	//ENABLE USART1
+	MRCC_VoidEnablePeriphral(APB2_BUS,RCC_APB2_USART1);
+	//ENABLE USART6
+	MRCC_VoidEnablePeriphral(APB2_BUS,RCC_APB2_USART6);
+
+	// interrupt priorities: echo edges, then bluetooth orders, then the raspberry link
+	MNVIC_voidInit();
+	// the slow part of the handlers runs from PendSV
+	SDEF_voidInit();
+	// ENABLE USART1  INTERRUPT
+	MNVIC_voidEnableInterrupt(NVIC_USART1);
+	// ENABLE USART6  INTERRUPT
+	MNVIC_voidEnableInterrupt(NVIC_USART6);
+
+	//USART1  PINS
+	MGPIO_voidSetPinMode(MUSART1_PORT,MUSART1_TX_PIN,GPIO_MODE_ALTF); //TX
+	MGPIO_voidSetPinAltFun(MUSART1_PORT,MUSART1_TX_PIN,MUSART1_ALF);
+	MGPIO_voidSetPinMode(MUSART1_PORT,MUSART1_RX_PIN,GPIO_MODE_ALTF); //RX
+	MGPIO_voidSetPinAltFun(MUSART1_PORT,MUSART1_RX_PIN,MUSART1_ALF);
+
+	//USART6  PINS
+	MGPIO_voidSetPinMode(MUSART6_PORT,MUSART6_TX_PIN,GPIO_MODE_ALTF); //TX
+	MGPIO_voidSetPinAltFun(MUSART6_PORT,MUSART6_TX_PIN,MUSART6_ALF);
+	MGPIO_voidSetPinMode(MUSART6_PORT,MUSART6_RX_PIN,GPIO_MODE_ALTF); //RX
+	MGPIO_voidSetPinAltFun(MUSART6_PORT,MUSART6_RX_PIN,MUSART6_ALF);
+
+	// USART1 Initialization   >> for Raspberry
+	MUSART1_voidInit();
+	// USART6 Initialization   >> for Bluetooth
+	MUSART6_voidInit();
+	// V2V beacons over the raspberry link
+	SV2V_voidInit();
+	SV2V_voidSetEmergencyStopCallBack(APP_voidEmergencyStop);
+	SV2V_voidSetEmergencyCallBack(APP_voidEmergencyHandler);
+	// camera and dummy car requests over the raspberry link
+	SLNK_voidInit();
+	// camera detections pushed by the raspberry
+	SCAM_voidInit();
+	SFUS_voidInit();
+	SCACC_voidInit();
+	// stop the unused clocks, the car starts parked
+	SPWR_voidInit();
+
+
+	// LEDS (used for blindspot detection): PB8 right side, PB9 left side, on the TIMER4 PWM channels
+	MRCC_VoidEnablePeriphral(APB1_BUS,RCC_APB1_TIMER4);
+	HLED_voidInit();
+	SBSM_voidInit();
+
+
+	G_u8BluetoothOrder='S';
+	
+	while (1)
+	{
+		// lowest clock for what the car is doing, before driving the motors
+		SPWR_u8SetProfile(APP_u8PowerProfile());
+
+		// ping the sensors as often as the speed and the manoeuvre need
+		SSCAN_u8SetMode(APP_u8ScanMode(), APP_u16OwnSpeed());
+		SSCAN_voidTask();
+		STTC_voidTask(APP_u16OwnSpeed());
+
+		// publish our status to the other cars
+		SODO_voidTask();
+		SV2V_voidSetOwnState((G_u8BluetoothOrder == 'S'), (u16)G_u32USDistance);
+		SV2V_voidTask();
+		APP_voidSendTelemetry();
+		SLNK_voidTask();
+		SCAM_voidTask();
+		// what is in front: camera detections matched with the forward track
+		SFUS_voidTask();
+		// what is beside: the LEDs follow the sides, they blink toward the side the car turns to
+		SBSM_voidTask((G_u8BluetoothOrder == 'R') ? RIGHT_US : ((G_u8BluetoothOrder == 'L') ? LEFT_US : SBSM_NO_TURN));
+		// time gap to the car ahead when it couldn't be passed
+		APP_voidFollowStep();
+
+		// CONTROL THE SPEED AND DIRECTION OF THE Main CAR
+		if (G_u8BluetoothOrder == TRACE_DUMP_ORDER)
+		{
+			// stop the car then send the flight recorder content to the phone
+			HDCM_voidStop();
+			STRACE_voidDump();
+			G_u8BluetoothOrder = 'S';
+			G_u8AppliedOrder = 'S';
+		}
+		else if ((G_u8BluetoothOrder >='0' && G_u8BluetoothOrder<='9')||(G_u8BluetoothOrder=='q'))
+		{
+			if (G_u8AppliedOrder != G_u8BluetoothOrder)
+			{
+				G_u8AppliedOrder = G_u8BluetoothOrder;
+				HDCM_u8ChangeSpeed(G_u8AppliedOrder);
+			}
+		}	
+		
+		else if (G_u8BluetoothOrder == 'R')
+		{
+			// the blind spot monitor keeps the side up to date, the turn waits until it is known clear
+			G_u8AppliedOrder = 'R';
+			if(SBSM_u8GetState(RIGHT_US) != SBSM_STATE_CLEAR)
+			{
+				HDCM_u8CarState('F');
+				L_u8RightTurnHeld = 1;	
+			}
+			else
+			{
+				HDCM_u8CarState('R');
+				L_u8RightTurnHeld = 0;	
+			}
+		}
+		
+		else if (G_u8BluetoothOrder == 'L')
+		{
+			G_u8AppliedOrder = 'L';
+			if(SBSM_u8GetState(LEFT_US) != SBSM_STATE_CLEAR)
+			{
+				HDCM_u8CarState('F');
+				L_u8LeftTurnHeld = 1;
+			}
+			else
+			{
+				HDCM_u8CarState('L');
+				L_u8LeftTurnHeld = 0;	
+			}
+		}
+		
+		else if(G_u8BluetoothOrder == 'F')
+		{
+			// the motors keep their state, they are driven again only on a new order
+			if (G_u8AppliedOrder != 'F')
+			{
+				G_u8AppliedOrder = 'F';
+				HDCM_u8CarState('F');
+			}
+		}
+		
+		else if (G_u8AppliedOrder != G_u8BluetoothOrder)
+		{
+			G_u8AppliedOrder = G_u8BluetoothOrder;
+			L_u8LeftTurnHeld = 0;
+			L_u8RightTurnHeld = 0;
+			HDCM_u8CarState(G_u8AppliedOrder);
+		}
+		
+		
+		if (G_u8BluetoothOrder == 'F' || (L_u8RightTurnHeld==1) || (L_u8LeftTurnHeld==1))
+		{	
+			// the front is checked on every new reading, the scanner pings it every few cm travelled
+			if(SSCAN_u8GetNewDistance(FORWARD_US, &L_f32Distance) == OK)
+			{
+				G_u32USDistance = L_f32Distance;
+
+				// on the time to reach it: earlier at speed, not for a far car when crawling
+				if((G_u32USDistance < REACTION_DISTANCE_CM) || (STTC_u32GetTtc(FORWARD_US) < REACTION_TTC_MS))
+				{
+			
+					// the class of the target is kept up to date with the camera detections
+					L_u8ForwardClass = SFUS_u8GetClass();
+					if (L_u8ForwardClass == SFUS_CLASS_UNKNOWN)
+					{
+						// not enough recent evidence, the front is checked again on its next reading
+						continue;
+					}
+
+					if(L_u8ForwardClass == SFUS_CLASS_VEHICLE) // vehicle detected
+					{
+						// the side checks reuse the distance variable
+						L_u16FrontGap = (u16)G_u32USDistance;
+						// the dummy car is asked when its beacons are missing (old raspberry script)
+						L_u8DummyAsked = (SNBR_u8GetNearestAhead(&L_strAheadBeacon) != OK);
+						L_u8LeadId = (L_u8DummyAsked == 0) ? L_strAheadBeacon.Beacon_u8Id : 0;
+						if ((L_u8DummyAsked != 0) && (APP_u8AskDummyCar() != OK))
+						{
+							// no answer, the front is checked again on its next reading
+							continue;
+						}
+						
+						if (L_u8DummyAsked == 0)
+						{
+							// the data of the car ahead is already here from its beacons
+							APP_voidBeaconToCarData(&L_strAheadBeacon,&Dummy_Car_Data);
+						}
+						else
+						{
+							// Decoding data coming from raspberry
+							APP_voidDecodeRasspData(G_u8RasspDummyData,&Dummy_Car_Data);
+							G_u8RasspDummyData=0;
+						}
+
+						if (Dummy_Car_Data.car_u8color==RED) 
+						{
+							// there is no car in front of dummy car
+							if(Dummy_Car_Data.car_u8objectDetected==OBJECT_NOT_DETECTED)
+							{
+								G_u32USDistance = APP_f32WaitDistance(RIGHT_US); // RIGHT_US
+
+								// the lane must be free for the sensor and for the neighbour table
+								if((G_u32USDistance > 20) && (SNBR_u8IsLaneOccupied(SNBR_RIGHT_LANE) == 0))
+								{
+									if (APP_u8OverTakeSeq(RIGHT_OVT, L_u16FrontGap, L_u8LeadId) != OK)
+									{
+										// the pass can't be done now, keep the time gap to the car ahead
+										APP_voidStartFollowing();
+									}
+								}
+								else
+								{   // if there is an object in range of 20 cm
+									// now we have to check on our left
+									// the blind spot monitor shows the side on its LED
+									G_u8FlagRightInvalid=1;
+								}
+								if(G_u8FlagRightInvalid==1)
+								{
+									G_u32USDistance = APP_f32WaitDistance(LEFT_US); // LEFT_US
+									if((G_u32USDistance > 20) && (SNBR_u8IsLaneOccupied(SNBR_LEFT_LANE) == 0))
+									{
+										if (APP_u8OverTakeSeq(LEFT_OVT, L_u16FrontGap, L_u8LeadId) != OK)
+										{
+											// the pass can't be done now, keep the time gap to the car ahead
+											APP_voidStartFollowing();
+										}
+									}
+									else
+									{
+										// if there is an object in RIGHT ANN LEFT
+										// follow the dummy car
+										APP_voidStartFollowing();
+									}
+
+									G_u8FlagRightInvalid=0; // to not enter it again without checking right is not ok
+								}
+				
+							}//end of No object front of the dummy car
+							else
+							{
+								//there is an object in front of the dummy car
+								APP_voidStartFollowing();
+							}
+						}//end of the car is red
+
+					}//end of  A car is detected
+					else
+					{
+						// OBJECT DETECTED  so the car have to stop immediately, the evidence was debounced by the fusion
+						G_u8BluetoothOrder='S'; 
+						// warn the cars behind without waiting for their next request
+						SV2V_u8SendEmergency(SV2V_EMERGENCY_HAZARD);
+					}
+
+					MSTK_voidSetBusyWait(1000);
+
+				} // end of something is in front of the main car
+				else
+				{
+					//there is no thing in front of the main car within mentioned range
+				}
+
+			}
+
+		}//end of bluetooth order = 'F'
+		else
+		{
+			//bluetooth order is not 'F'
+			//do nothing
+		}
+
+		// nothing to do before the next ping, V2V, link or following deadline: sleep until then,
+		// a bluetooth order, a raspberry frame or an echo edge wakes the core at once with its interrupt
+		L_u32IdleUs = SV2V_u32GetIdleTime();
+		L_u32ScanIdleUs = SSCAN_u32GetIdleTime();
+		if (L_u32ScanIdleUs < L_u32IdleUs)
+		{
+			L_u32IdleUs = L_u32ScanIdleUs;
+		}
+		L_u32LinkIdleUs = SLNK_u32GetIdleTime();
+		if (L_u32LinkIdleUs < L_u32IdleUs)
+		{
+			L_u32IdleUs = L_u32LinkIdleUs;
+		}
+		L_u32FollowIdleUs = SCACC_u32GetIdleTime();
+		if (L_u32FollowIdleUs < L_u32IdleUs)
+		{
+			L_u32IdleUs = L_u32FollowIdleUs;
+		}
+		MSTK_voidSleep(L_u32IdleUs * STK_TICKS_PER_US, APP_u8IsBusy);
+
+	}// end of while
+
+}//end of main
+
@@ -1,4 +1,6 @@
 import threading
+import queue
+import struct
 import serial
 import socket
 import cv2
@@ -24,137 +26,291 @@ client_socket = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
 client_socket.connect((server_host, server_port))
 response_ack='0'
 errorMessageToSTM='0'
-cameraStatus='0'
 send_ack='0'
-cameraValue ='O'
-comRequestMessage ='0'
-flag=0
+
+# V2V frames (status beacons, emergencies, time requests and responses, overtake
+# negotiation) share the serial link with the handshake bytes:
+# SYNC(0xAA) | TYPE | LENGTH | PAYLOAD | CHECKSUM (xor of TYPE, LENGTH, PAYLOAD).
+# The frames coming from the STM are broadcast to the other cars over UDP and the
+# frames of the other cars are written to the STM, the other bytes keep their old path.
+V2V_SYNC = 0xAA
+V2V_MAX_PAYLOAD = 24
+V2V_PORT = 12346
+ser_lock = threading.Lock()
+legacy_bytes = queue.Queue()
+own_ids = set()
+v2v_socket = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+v2v_socket.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+v2v_socket.setsockopt(socket.SOL_SOCKET, socket.SO_BROADCAST, 1)
+v2v_socket.bind(('', V2V_PORT))
+
+def ser_write(data):
+	with ser_lock:
+		ser.write(data)
+
+# Link frames carry the request / answer messages of the STM, several at once:
+# SYNC(0xA5) | TYPE | CHANNEL | SEQ | ACK | LENGTH | PAYLOAD | CHECKSUM (xor of TYPE to PAYLOAD).
+# Each channel is numbered on its own: DATA frames are numbered, ACK is the next number
+# expected from the other side (all the ones before are received), a message not
+# acknowledged in time is sent again alone. A lost message only holds its own channel.
+LINK_SYNC = 0xA5
+LINK_DATA = 1
+LINK_ACK = 2
+LINK_RESET = 3
+LINK_WINDOW = 4
+LINK_MAX_PAYLOAD = 8
+LINK_RETRY_S = 0.08
+LINK_MAX_RETRIES = 5
+LINK_CHANNEL_V2V = 0
+LINK_CHANNEL_CAMERA = 1
+LINK_CHANNEL_TELEMETRY = 2
+LINK_CHANNEL_COUNT = 3
+
+def link_frame_is_valid(frame):
+	if len(frame) < 7 or frame[0] != LINK_SYNC or frame[5] != len(frame) - 7 or frame[2] >= LINK_CHANNEL_COUNT:
+		return False
+	checksum = 0
+	for byte in frame[1:-1]:
+		checksum ^= byte
+	return checksum == frame[-1]
+
+class LinkChannel:
+	def __init__(self):
+		self.tx_base = 0
+		self.tx_next = 0
+		self.tx_slots = {}      # sequence : [message, sent time, retries]
+		self.rx_expected = 0
+		self.rx_window = {}     # sequence : message received after a missing one
+		self.messages = queue.Queue()
+
+class Link:
+	def __init__(self):
+		self.lock = threading.Condition()
+		self.channels = [LinkChannel() for i in range(LINK_CHANNEL_COUNT)]
+
+	def write(self, kind, channel, seq, payload):
+		frame = bytes([kind, channel, seq, self.channels[channel].rx_expected, len(payload)]) + payload
+		checksum = 0
+		for byte in frame:
+			checksum ^= byte
+		ser_write(bytes([LINK_SYNC]) + frame + bytes([checksum]))
+
+	# drop the messages in flight on a channel, the other side expects tx_next next
+	def reset(self, channel):
+		with self.lock:
+			state = self.channels[channel]
+			state.tx_base = state.tx_next
+			state.tx_slots.clear()
+			self.write(LINK_RESET, channel, state.tx_next, b'')
+			self.lock.notify_all()
+
+	def reset_all(self):
+		for channel in range(LINK_CHANNEL_COUNT):
+			self.reset(channel)
+
+	def send(self, channel, message):
+		with self.lock:
+			state = self.channels[channel]
+			while ((state.tx_next - state.tx_base) & 0xFF) >= LINK_WINDOW:
+				self.lock.wait()
+			seq = state.tx_next
+			state.tx_slots[seq] = [message, time.monotonic(), 0]
+			state.tx_next = (seq + 1) & 0xFF
+			self.write(LINK_DATA, channel, seq, message)
+
+	def receive(self, channel):
+		return self.channels[channel].messages.get()
+
+	def on_frame(self, frame):
+		kind, channel, seq, ack, length = frame[1], frame[2], frame[3], frame[4], frame[5]
+		with self.lock:
+			state = self.channels[channel]
+			if ((ack - state.tx_base) & 0xFF) <= ((state.tx_next - state.tx_base) & 0xFF):
+				while state.tx_base != ack:
+					state.tx_slots.pop(state.tx_base, None)
+					state.tx_base = (state.tx_base + 1) & 0xFF
+				self.lock.notify_all()
+			if kind == LINK_RESET:
+				state.rx_expected = seq
+				state.rx_window.clear()
+				self.write(LINK_ACK, channel, 0, b'')
+			elif kind == LINK_DATA:
+				if ((seq - state.rx_expected) & 0xFF) < LINK_WINDOW:
+					state.rx_window[seq] = frame[6:6 + length]
+				while state.rx_expected in state.rx_window:
+					state.messages.put(state.rx_window.pop(state.rx_expected))
+					state.rx_expected = (state.rx_expected + 1) & 0xFF
+				self.write(LINK_ACK, channel, 0, b'')
+
+	# send again the messages whose own timeout passed
+	def retry_task(self):
+		while True:
+			time.sleep(LINK_RETRY_S / 4)
+			with self.lock:
+				now = time.monotonic()
+				for channel, state in enumerate(self.channels):
+					for seq, slot in list(state.tx_slots.items()):
+						if now - slot[1] < LINK_RETRY_S:
+							continue
+						if slot[2] >= LINK_MAX_RETRIES:
+							self.reset(channel)
+							break
+						slot[1] = now
+						slot[2] += 1
+						self.write(LINK_DATA, channel, seq, slot[0])
+
+link = Link()
+
+def ser_read():
+	return legacy_bytes.get()
+
+def frame_is_valid(frame):
+	if len(frame) < 4 or frame[0] != V2V_SYNC or frame[2] != len(frame) - 4:
+		return False
+	checksum = 0
+	for byte in frame[1:-1]:
+		checksum ^= byte
+	return checksum == frame[-1]
+
+# Split the bytes coming from the STM into link frames, V2V frames and handshake bytes
+def serial_reader_task():
+	while True :
+		byte = ser.read()
+		if byte[0] == LINK_SYNC :
+			header = ser.read(5)
+			if header[4] > LINK_MAX_PAYLOAD :
+				continue
+			frame = byte + header + ser.read(header[4] + 1)
+			if link_frame_is_valid(frame) :
+				link.on_frame(frame)
+			continue
+		if byte[0] != V2V_SYNC :
+			legacy_bytes.put(byte)
+			continue
+		header = ser.read(2)
+		if header[1] > V2V_MAX_PAYLOAD :
+			continue
+		frame = byte + header + ser.read(header[1] + 1)
+		if frame_is_valid(frame) :
+			if header[1] > 0 :
+				own_ids.add(frame[3])
+			v2v_socket.sendto(frame, ('<broadcast>', V2V_PORT))
+
+# Give the frames of the other cars to the STM
+def v2v_receive_task():
+	while True :
+		frame, address = v2v_socket.recvfrom(64)
+		if frame_is_valid(frame) and (frame[2] == 0 or frame[3] not in own_ids) :
+			ser_write(frame)
 
 # Function for camera detection using OpenCV and Haar Cascade
+# Detection pushed to the STM on the camera channel, without waiting for a request:
+# 'D' | capture time (ms, 16 bits) | class ('V' vehicle, 'N' nothing) | confidence (%) |
+# bearing of the box center (degrees, positive to the left) | width of the box (degrees)
+CAMERA_WIDTH = 320
+CAMERA_FOV_DEG = 62.2
+CAMERA_PUSH_MIN_S = 0.2
+detection_lock = threading.Condition()
+detection = None
+
 def camera_detection_task():
-	global flag
-	global cameraValue
-	global comRequestMessage
+	global detection
+	# Create a PiCamera instance, kept open between the captures
+	camera = picamera.PiCamera()
+	camera.resolution = (CAMERA_WIDTH, 240)
+	camera.framerate = 30
+	camera.iso = 800  # Adjust ISO for low light, experiment with different values
+	camera.shutter_speed = 6000000  # Set shutter speed for low light, experiment with different values
+	camera.awb_mode = 'auto'
+	while True :
+		captureTime = int(time.monotonic() * 1000) & 0xFFFF
+		# Capture an image
+		camera.capture("image2.jpg")
+
+		# Read the captured image with OpenCV
+		image = cv2.imread("image2.jpg")
+		# Convert the image to grayscale (required for Haar cascades)
+		gray = cv2.cvtColor(image, cv2.COLOR_BGR2GRAY)
+		# Perform car detection, the number of neighbours of a box tells how sure it is
+		cars, neighbours = car_cascade.detectMultiScale2(gray, scaleFactor=1.1, minNeighbors=5, minSize=(30, 30))
+		if len(cars) > 0:
+			best = max(range(len(cars)), key=lambda k: cars[k][2])
+			x, y, w, h = cars[best]
+			bearing = int(round((CAMERA_WIDTH / 2 - (x + w / 2)) * CAMERA_FOV_DEG / CAMERA_WIDTH))
+			width = int(round(w * CAMERA_FOV_DEG / CAMERA_WIDTH))
+			result = (captureTime, b'V', min(100, int(neighbours[best]) * 10), bearing, width)
+		else:
+			result = (captureTime, b'N', 0, 0, 0)
+		with detection_lock :
+			detection = result
+			detection_lock.notify()
+
+# Push each new detection to the main car stm, not faster than CAMERA_PUSH_MIN_S
+def camera_push_task():
+	global detection
 	while True :
-		if  flag==1 :
-			flag = 0
-			#open your own camera  
-			# Create a PiCamera instance
-			camera = picamera.PiCamera()
-			camera.resolution = (320, 240)
-			camera.framerate = 30
-			camera.iso = 800  # Adjust ISO for low light, experiment with different values
-			camera.shutter_speed = 6000000  # Set shutter speed for low light, experiment with different values
-			camera.awb_mode = 'auto'
-			#time.sleep(2)  # Allow camera to adjust to new settings
-			# Capture an image
-			camera.capture("image2.jpg")
-			#print("Image captured successfully")
-
-			# Read the captured image with OpenCV
-			image = cv2.imread("image2.jpg")
-			
-			# Convert the image to grayscale (required for Haar cascades)
-			gray = cv2.cvtColor(image, cv2.COLOR_BGR2GRAY)
-			# Perform car detection
-			cars = car_cascade.detectMultiScale(gray, scaleFactor=1.1, minNeighbors=5, minSize=(30, 30))
-			if len(cars) > 0:
-				#print("Car detected!")
-				cameraValue='V'
-				#ser.write(b'V')
-			else:
-				#print("No car detected.")
-				cameraValue='O'
-				#ser.write(b'V')
-			# Close the camera when done
-			camera.close()
-
-# Function for running the rest of your Python code
-def rest_of_code_task():
-	global flag
-	global cameraValue
-	global comRequestMessage
+		with detection_lock :
+			while detection is None :
+				detection_lock.wait()
+			captureTime, detectedClass, confidence, bearing, width = detection
+			detection = None
+		link.send(LINK_CHANNEL_CAMERA, b'D' + struct.pack('>H', captureTime) + detectedClass + struct.pack('>BbB', confidence, bearing, width))
+		time.sleep(CAMERA_PUSH_MIN_S)
+
+# Ask the dummy car through its raspberry on the V2V channel, the camera answers don't wait for it
+def dummy_car_task():
 	while True :
-		ser.write(b'D')
-		print("start COMM")
-		response_ack = ser.read()
-		response_ack = response_ack.decode()
-		#print("read 1 " + response_ack)
-		if (response_ack != 'A'):
-			#print(response_ack)
-			response_ack='0'
+		comRequestMessage = link.receive(LINK_CHANNEL_V2V)
+		if comRequestMessage != b'R' :
+			link.send(LINK_CHANNEL_V2V, b'N') #send not ack
 			continue
-		response_ack='0'
-		# Receive Request from main car stm
-		comRequestMessage = ser.read()
-		comRequestMessage = comRequestMessage.decode()
-		print("ReceivedREQ: " + comRequestMessage)
-		if comRequestMessage == 'R' : #start wifi communication
-			ser.write(b'S') #send ack
-			response_ack = ser.read()
-			response_ack = response_ack.decode()
-			#print("read 2 " + response_ack)
-			if (response_ack == ')'): #check if the STM received correctly
-				#print(response_ack)
-				response_ack='0'
-				continue
-			response_ack='0'
-			# send request to wifi dummy car
-			client_socket.send(comRequestMessage.encode())
-			# receive data from wifi dummy car
-			dummyCarResponse = client_socket.recv(1024).decode()
-			print("ReceivedData: " + dummyCarResponse)
-			# send data to main car stm
-			ser.write(dummyCarResponse.encode())
-			response_ack = ser.read()
-			response_ack = response_ack.decode()
-			#print("read 3 " + response_ack)
-			#print(response_ack)
-			if (response_ack != 'K'): #check if the STM received correctly
-				response_ack='0'
-				continue
-			response_ack='0'
-			print("Communication done ")
-			print("==========================")
-		elif comRequestMessage == 'C' :
-			flag=1
-			ser.write(b'S') #send ack
-			response_ack = ser.read()
-			response_ack = response_ack.decode()
-			if (response_ack == '<'): #check if the STM received correctly
-				#print(response_ack)
-				response_ack='0'
-				continue
-			response_ack='0'
-			#open your own camera  
-			cameraStatus = cameraValue
-			ser.write(cameraStatus.encode())
-			response_ack = ser.read()
-			response_ack = response_ack.decode()
-			if (response_ack != 'F'): #check if the STM received correctly
-				#print("as" + response_ack)
-				response_ack='0'
-				cameraStatus = '0'
-				continue
-			response_ack='0'
-			cameraStatus = '0' 
-		else :
-			#print('not R or C')
-			ser.write(b'N') #send not ack
-	# Close the socket
-	client_socket.close()
-
-# Create two threads, one for each task
+		# send request to wifi dummy car
+		client_socket.send(b'R')
+		# receive data from wifi dummy car
+		dummyCarResponse = client_socket.recv(1024)
+		print("ReceivedData: " + str(dummyCarResponse[0]))
+		# send data to main car stm
+		link.send(LINK_CHANNEL_V2V, b'R' + dummyCarResponse[:1])
+		print("Communication done ")
+		print("==========================")
+
+# Status reports of the main car: 'T', order, speed (cm/s), front distance (cm), front time to collision (ms)
+def telemetry_task():
+	while True :
+		report = link.receive(LINK_CHANNEL_TELEMETRY)
+		if len(report) != 8 or report[:1] != b'T' :
+			continue
+		speed, distance, ttc = struct.unpack('>HHH', report[2:8])
+		print("Telemetry: order %s speed %d cm/s distance %d cm ttc %s" % (chr(report[1]), speed, distance, 'none' if ttc == 0xFFFF else '%d ms' % ttc))
+
+# Create the threads, one for each task
 camera_thread = threading.Thread(target=camera_detection_task)
-rest_thread = threading.Thread(target=rest_of_code_task)
+push_thread = threading.Thread(target=camera_push_task)
+serial_thread = threading.Thread(target=serial_reader_task)
+v2v_thread = threading.Thread(target=v2v_receive_task)
+dummy_thread = threading.Thread(target=dummy_car_task)
+retry_thread = threading.Thread(target=link.retry_task)
+telemetry_thread = threading.Thread(target=telemetry_task)
 
-# Start both threads
+# Start the threads
 camera_thread.start()
-rest_thread.start()
+push_thread.start()
+serial_thread.start()
+v2v_thread.start()
+dummy_thread.start()
+retry_thread.start()
+telemetry_thread.start()
+# the STM expects our sequence from 0
+link.reset_all()
 
-# Wait for both threads to complete
+# Wait for the threads to complete
 camera_thread.join()
-rest_thread.join()
+push_thread.join()
+serial_thread.join()
+v2v_thread.join()
+dummy_thread.join()
+retry_thread.join()
+telemetry_thread.join()
 
 
 
@@ -0,0 +1,48 @@
+# Replay regression check
+# Runs the host replay build of the Main Car application (Main Car/SIM/Replay)
+# on every recorded trace of a folder and compares the motor / LED / link command
+# stream with the expected output saved next to the trace (<trace>.out).
+#
+# The traces of the Main Car are kept in Main Car/SIM/Replay/Traces.
+#
+# usage : python replay_check.py <replay binary> <traces folder>            (check)
+#         python replay_check.py --update <replay binary> <traces folder>   (save expected outputs)
+import os
+import sys
+import subprocess
+
+TRACE_EXTENSION = '.trc'
+EXPECTED_EXTENSION = '.out'
+
+def replay(binary, trace):
+	return subprocess.run([binary, trace], stdout=subprocess.PIPE, check=True).stdout.decode()
+
+def main(args):
+	update = len(args) == 3 and args[0] == '--update'
+	if update:
+		args = args[1:]
+	if len(args) != 2:
+		print('usage: replay_check.py [--update] <replay binary> <traces folder>')
+		return 2
+	binary, folder = args
+	failed = 0
+	traces = sorted(name for name in os.listdir(folder) if name.endswith(TRACE_EXTENSION))
+	for name in traces:
+		trace = os.path.join(folder, name)
+		expected_name = trace + EXPECTED_EXTENSION
+		output = replay(binary, trace)
+		if update:
+			with open(expected_name, 'w') as expected_file:
+				expected_file.write(output)
+		elif not os.path.exists(expected_name):
+			print('NEW   %s' % name)
+		else:
+			with open(expected_name) as expected_file:
+				if expected_file.read() != output:
+					print('DIFF  %s' % name)
+					failed += 1
+	print('%d traces, %d different' % (len(traces), failed))
+	return 1 if failed else 0
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv[1:]))
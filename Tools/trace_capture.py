@@ -0,0 +1,133 @@
+# Flight recorder capture tool
+# Stops the car with the TRACE_DUMP_ORDER ('T') over the Bluetooth serial link,
+# receives the RAM ring buffer dumped by STRACE_voidDump() and saves it to a trace file.
+#
+# usage : python trace_capture.py <serial port> <trace file>     (capture + print)
+#         python trace_capture.py --decode <trace file>          (print a saved trace)
+import sys
+import struct
+import serial
+
+TRACE_DUMP_ORDER = b'T'
+HEADER_FORMAT = '<4sBBH'     # magic, version, entry size, entries count
+ENTRY_FORMAT = '<IBBH'       # timestamp (us), event, argument, value
+
+EVENT_NAMES = {
+	1: 'US_DISTANCE',
+	2: 'MOTOR_STATE',
+	3: 'MOTOR_SPEED',
+	4: 'BT_ORDER',
+	5: 'LINK_RX',
+	6: 'LINK_TX',
+	7: 'MARKER',
+	8: 'BEACON',
+	9: 'BEACON_DIST',
+	10: 'BEACON_X',
+	11: 'BEACON_Y',
+	12: 'EMERGENCY_TX',
+	13: 'EMERGENCY_RX',
+	14: 'WARN_LATENCY',
+	15: 'POWER',
+	16: 'US_XTALK',
+	17: 'LINK_MSG_RX',
+	18: 'LINK_MSG_TX',
+	19: 'LINK_RETRY',
+	20: 'LINK_RESET',
+	21: 'FUSION_CLASS',
+	22: 'CLOCK_SYNC',
+	23: 'OVERTAKE',
+	24: 'BLIND_SPOT',
+}
+US_NAMES = {1: 'FORWARD', 2: 'LEFT', 3: 'RIGHT', 4: 'BACKWARD'}
+POWER_PROFILES = ['PARKED', 'CRUISE', 'MANOEUVRE']
+FUSION_CLASSES = ['UNKNOWN', 'VEHICLE', 'OBJECT']
+OVERTAKE_STATES = ['IDLE', 'PENDING', 'GRANTED', 'REFUSED', 'NO_ANSWER']
+BLIND_SPOT_STATES = ['UNKNOWN', 'CLEAR', 'REPORTED', 'OCCUPIED']
+MOTOR_STATES = ['STOP', 'FORWARD', 'BACKWARD', 'RIGHT', 'LEFT', 'FORWARD_LEFT', 'FORWARD_RIGHT', 'BACK_LEFT', 'BACK_RIGHT']
+
+def read_trace(data):
+	magic, version, entry_size, count = struct.unpack_from(HEADER_FORMAT, data, 0)
+	if magic != b'TRCE' or entry_size != struct.calcsize(ENTRY_FORMAT):
+		raise ValueError('not a trace dump')
+	offset = struct.calcsize(HEADER_FORMAT)
+	entries = []
+	for i in range(count):
+		entries.append(struct.unpack_from(ENTRY_FORMAT, data, offset + i * entry_size))
+	return entries
+
+def describe(event, arg, value):
+	name = EVENT_NAMES.get(event, str(event))
+	if event in (1, 16):
+		return '%-12s %-8s %d cm' % (name, US_NAMES.get(arg, arg), value)
+	if event == 2:
+		return '%-12s %-8s speed %d' % (name, MOTOR_STATES[arg] if arg < len(MOTOR_STATES) else arg, value)
+	if event in (4, 5, 6):
+		text = chr(value) if 32 <= value < 127 else '.'
+		return '%-12s %-8s %3d %s' % (name, arg, value, text)
+	if event in (17, 18):
+		byte = value & 0xFF
+		text = chr(byte) if 32 <= byte < 127 else '.'
+		return '%-12s ch %-5d %3d %s  (%d left)' % (name, value >> 8, byte, text, arg)
+	if event == 8:
+		return '%-12s id %-5d color %d brake %d speed %d cm/s' % (name, arg, value >> 12, (value >> 11) & 1, value & 0x7FF)
+	if event in (10, 11):
+		return '%-12s id %-5d %d cm' % (name, arg, value - 0x10000 if value >= 0x8000 else value)
+	if event == 13:
+		return '%-12s id %-5d kind %d seq %d' % (name, arg, value >> 8, value & 0xFF)
+	if event == 14:
+		return '%-12s id %-5d %.1f ms' % (name, arg, value / 10.0)
+	if event == 19:
+		return '%-12s ch %-5d seq %-4d retry %d' % (name, value >> 8, arg, value & 0xFF)
+	if event == 20:
+		return '%-12s ch %-5d seq %-4d dropped %d' % (name, value >> 8, arg, value & 0xFF)
+	if event == 21:
+		return '%-12s %-8s track %d %d %%' % (name, FUSION_CLASSES[arg] if arg < len(FUSION_CLASSES) else arg, value >> 8, value & 0xFF)
+	if event == 22:
+		return '%-12s id %-5d drift %d ppm' % (name, arg, value - 0x10000 if value >= 0x8000 else value)
+	if event == 23:
+		state = value >> 12
+		return '%-12s id %-5d %-9s cap %d cm/s' % (name, arg, OVERTAKE_STATES[state] if state < len(OVERTAKE_STATES) else state, value & 0xFFF)
+	if event == 24:
+		return '%-12s %-8s %s' % (name, US_NAMES.get(arg, arg), BLIND_SPOT_STATES[value] if value < len(BLIND_SPOT_STATES) else value)
+	if event == 15:
+		return '%-12s %-8s %d MHz' % (name, POWER_PROFILES[arg] if arg < len(POWER_PROFILES) else arg, value)
+	return '%-12s %-8s %d' % (name, arg, value)
+
+def print_trace(entries):
+	if not entries:
+		print('empty trace')
+		return
+	start = entries[0][0]
+	for timestamp, event, arg, value in entries:
+		print('%12.6f  %s' % (((timestamp - start) & 0xFFFFFFFF) / 1e6, describe(event, arg, value)))
+
+def capture(port, file_name):
+	ser = serial.Serial(port, baudrate=9600)
+	ser.timeout = 30
+	ser.reset_input_buffer()
+	ser.write(TRACE_DUMP_ORDER)
+	# skip anything until the magic word
+	window = b''
+	while window != b'TRCE':
+		byte = ser.read(1)
+		if not byte:
+			raise IOError('no dump received')
+		window = (window + byte)[-4:]
+	rest = ser.read(struct.calcsize(HEADER_FORMAT) - 4)
+	header = window + rest
+	count = struct.unpack_from(HEADER_FORMAT, header, 0)[3]
+	body = ser.read(count * struct.calcsize(ENTRY_FORMAT))
+	ser.close()
+	data = header + body
+	with open(file_name, 'wb') as trace_file:
+		trace_file.write(data)
+	return data
+
+if __name__ == '__main__':
+	if len(sys.argv) == 3 and sys.argv[1] == '--decode':
+		with open(sys.argv[2], 'rb') as trace_file:
+			print_trace(read_trace(trace_file.read()))
+	elif len(sys.argv) == 3:
+		print_trace(read_trace(capture(sys.argv[1], sys.argv[2])))
+	else:
+		print('usage: trace_capture.py <serial port> <trace file> | --decode <trace file>')